@@ -0,0 +1,346 @@
+/********************************************************************************************************
+
+Authors:		(c) 2023 Maths Town
+
+Licence:		The MIT License
+
+*********************************************************************************************************
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************
+
+
+Description:
+
+	Adaptive supersampling.  Extra samples are only taken where the image has edges.
+
+	A block is first rendered with one sample per pixel (at the pixel's position).  The contrast of
+	a pixel is the range of luma (or alpha, if larger) over it and its four neighbours in the block.
+	Refinement is in two passes:
+		1) Pixels with more contrast than the threshold are taken to 4 samples (or max_samples if less).
+		2) Those whose own samples still differ by more than the threshold are taken to max_samples.
+	So only pixels that an edge or fine detail actually crosses get the full count.  The extra samples
+	are packed into whole vectors (whichever pixels they come from) and rendered with render_pixel(),
+	so the cost follows the number of edge pixels rather than the size of the frame.
+
+	Sample positions follow the R2 sequence (low discrepancy, with an even blue noise like spacing),
+	shifted by a hash of the pixel's position so neighbouring pixels don't share a pattern.  Samples
+	are averaged with equal weights (colour weighted by alpha).
+
+	The budget is the most extra samples per pixel, on average.  It is applied to each block and each
+	pass, with the highest contrast pixels served first, so the result doesn't depend on the order
+	threads render the blocks in.  Edges that run exactly along a block's border are only seen from
+	inside the block.
+
+	render_block() (render-block.h) calls antialias_block() for renderers that have
+		AntialiasSettings antialias_settings() const;
+	Renderers must accept positions between pixels in render_pixel().
+
+Types:
+
+	AntialiasSettings	- Maximum samples, contrast threshold and budget.
+
+Functions:
+
+	antialias_max_samples()	- Maximum samples for an item of antialias_mode_names (the parameter list).
+	antialias_block()		- Add samples to the edges of a rendered block.
+
+*******************************************************************************************************/
+#pragma once
+
+#include "simd-concepts.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+template <SimdFloat S> struct BlockOutput;
+
+
+/**************************************************************************************************
+ * Settings.  (Read from the project's parameters each frame)
+ * ************************************************************************************************/
+struct AntialiasSettings {
+	int max_samples{ 1 };		//Samples per pixel, including the first.  (1 is off)
+	float threshold{ 0.05f };	//Contrast (0..1) above which samples are added
+	float budget{ 4.0f };		//Most extra samples per pixel, on average
+
+	bool enabled() const noexcept { return max_samples > 1 && budget > 0.0f; }
+};
+
+
+//Items for the project's parameter list, and the samples for each.
+inline constexpr std::array<const char*, 4> antialias_mode_names{
+	"Off",
+	"Up to 4 Samples",
+	"Up to 8 Samples",
+	"Up to 16 Samples",
+};
+
+inline constexpr int antialias_max_samples(int list_index) noexcept {
+	constexpr std::array<int, 4> samples{ 1, 4, 8, 16 };
+	return (list_index >= 0 && list_index < static_cast<int>(samples.size())) ? samples[list_index] : 1;
+}
+
+
+namespace antialias_detail {
+
+	//Samples for a pixel on an edge, before checking whether they agree.
+	inline constexpr int first_samples = 4;
+
+	//A pixel with extra samples.  (Pixel index within the block)
+	struct Candidate {
+		int pixel{};
+		int slot{};				//Index of the sums.  (Candidates are reordered by the budget)
+		int samples{ 1 };		//Taken so far, including the first
+		int extra{};			//To take next
+		float priority{};		//Contrast with the neighbours, then the range of the samples
+		float luma_min{};
+		float luma_max{};
+		float alpha_min{};
+		float alpha_max{};
+	};
+
+	//Scratch memory.  One per thread, reused between blocks.
+	template <typename F>
+	struct Scratch {
+		std::vector<float> luma{};
+		std::vector<float> alpha{};
+		std::vector<Candidate> candidates{};
+		std::vector<F> x{};
+		std::vector<F> y{};
+		std::vector<int> owner{};			//Candidate of each sample
+		std::vector<F> sum{};				//Red, green & blue (weighted by alpha) and alpha, for each slot
+	};
+
+	//Hash of a pixel position, to 0..1.
+	inline double pixel_hash(int x, int y, uint32_t salt) noexcept {
+		uint32_t h = (static_cast<uint32_t>(x) * 0x8da6b343u) ^ (static_cast<uint32_t>(y) * 0xd8163841u) ^ salt;
+		h ^= h >> 16;
+		h *= 0x7feb352du;
+		h ^= h >> 15;
+		h *= 0x846ca68bu;
+		h ^= h >> 16;
+		return h * (1.0 / 4294967296.0);
+	}
+
+	//R2 sequence steps.  (1/g and 1/g^2, where g is the plastic number)
+	inline constexpr double r2_step_x = 0.7548776662466927;
+	inline constexpr double r2_step_y = 0.5698402909980532;
+
+	//Cut the extra samples to fit in 'allowed', highest priority first.  (Takes what is given from 'allowed')
+	inline void apply_budget(std::vector<Candidate>& candidates, long long& allowed) {
+		long long requested = 0;
+		for (const auto& c : candidates) requested += c.extra;
+		if (requested > allowed) {
+			std::stable_sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) { return a.priority > b.priority; });
+			requested = 0;
+			for (auto& c : candidates) {
+				c.extra = static_cast<int>(std::min<long long>(c.extra, allowed - requested));
+				requested += c.extra;
+			}
+		}
+		allowed -= requested;
+	}
+}
+
+
+/**************************************************************************************************
+ * Add samples to the edges of a block rendered with one sample per pixel.  (See above)
+ * ************************************************************************************************/
+template <typename R, SimdFloat S>
+void antialias_block(const R& renderer, BlockOutput<S>& out, const AntialiasSettings& settings) {
+	using namespace antialias_detail;
+	typedef typename S::F F;
+	constexpr int n = S::number_of_elements();
+	if (!settings.enabled() || out.width <= 0 || out.height <= 0) return;
+
+	thread_local Scratch<F> scratch{};
+	auto& candidates = scratch.candidates;
+	auto& sum = scratch.sum;
+	const int w = out.width;
+	const int h = out.height;
+	const auto lane = [&](const std::vector<S>& plane, int px, int py) { return plane[static_cast<size_t>(py) * out.vectors_per_row + px / n].element(px % n); };
+
+	//Luma & alpha of each pixel
+	scratch.luma.resize(static_cast<size_t>(w) * h);
+	scratch.alpha.resize(static_cast<size_t>(w) * h);
+	for (int j = 0; j < h; j++) {
+		for (int i = 0; i < out.vectors_per_row; i++) {
+			const auto c = out.get(i, j);
+			const S luma = fma(c.red, S(static_cast<F>(0.2126)), fma(c.green, S(static_cast<F>(0.7152)), c.blue * static_cast<F>(0.0722)));
+			for (int k = 0; k < n && i * n + k < w; k++) {
+				scratch.luma[static_cast<size_t>(j) * w + i * n + k] = static_cast<float>(luma.element(k));
+				scratch.alpha[static_cast<size_t>(j) * w + i * n + k] = static_cast<float>(c.alpha.element(k));
+			}
+		}
+	}
+
+	//Pixels with more contrast than the threshold
+	const int first = std::min(settings.max_samples, first_samples);
+	candidates.clear();
+	for (int j = 0; j < h; j++) {
+		for (int i = 0; i < w; i++) {
+			const int p = j * w + i;
+			float luma_min = scratch.luma[p], luma_max = luma_min;
+			float alpha_min = scratch.alpha[p], alpha_max = alpha_min;
+			const auto neighbour = [&](int q) {
+				luma_min = std::min(luma_min, scratch.luma[q]);
+				luma_max = std::max(luma_max, scratch.luma[q]);
+				alpha_min = std::min(alpha_min, scratch.alpha[q]);
+				alpha_max = std::max(alpha_max, scratch.alpha[q]);
+			};
+			if (i > 0) neighbour(p - 1);
+			if (i + 1 < w) neighbour(p + 1);
+			if (j > 0) neighbour(p - w);
+			if (j + 1 < h) neighbour(p + w);
+
+			const float contrast = std::max(luma_max - luma_min, alpha_max - alpha_min);
+			if (!(contrast > settings.threshold)) continue;
+			Candidate c{};
+			c.pixel = p;
+			c.extra = first - 1;
+			c.priority = contrast;
+			c.luma_min = c.luma_max = scratch.luma[p];
+			c.alpha_min = c.alpha_max = scratch.alpha[p];
+			candidates.push_back(c);
+		}
+	}
+
+	//Keep within the budget
+	long long allowed = static_cast<long long>(static_cast<double>(settings.budget) * w * h);
+	apply_budget(candidates, allowed);
+	std::erase_if(candidates, [](const Candidate& c) { return c.extra <= 0; });
+	if (candidates.empty()) return;
+
+	//Start each sum with the first sample
+	sum.assign(candidates.size() * 4, static_cast<F>(0.0));
+	for (size_t c = 0; c < candidates.size(); c++) {
+		candidates[c].slot = static_cast<int>(c);
+		const int px = candidates[c].pixel % w;
+		const int py = candidates[c].pixel / w;
+		const F a = lane(out.alpha, px, py);
+		sum[c * 4 + 0] = lane(out.red, px, py) * a;
+		sum[c * 4 + 1] = lane(out.green, px, py) * a;
+		sum[c * 4 + 2] = lane(out.blue, px, py) * a;
+		sum[c * 4 + 3] = a;
+	}
+
+	//Render each candidate's extra samples, packed into whole vectors.  (Padded with copies of the last sample)
+	//The R2 sequence carries on from the samples already taken.
+	const auto take_samples = [&]() {
+		scratch.x.clear();
+		scratch.y.clear();
+		scratch.owner.clear();
+		for (int c = 0; c < static_cast<int>(candidates.size()); c++) {
+			auto& candidate = candidates[c];
+			const int px = out.x + candidate.pixel % w;
+			const int py = out.y + candidate.pixel / w;
+			const double shift_x = pixel_hash(px, py, 0x9e3779b9u);
+			const double shift_y = pixel_hash(px, py, 0x85ebca6bu);
+			for (int k = candidate.samples; k < candidate.samples + candidate.extra; k++) {
+				const double u = shift_x + k * r2_step_x;
+				const double v = shift_y + k * r2_step_y;
+				scratch.x.push_back(static_cast<F>(px + (u - std::floor(u)) - 0.5));
+				scratch.y.push_back(static_cast<F>(py + (v - std::floor(v)) - 0.5));
+				scratch.owner.push_back(c);
+			}
+			candidate.samples += candidate.extra;
+			candidate.extra = 0;
+		}
+		const size_t samples = scratch.owner.size();
+		if (samples == 0) return;
+		while (scratch.owner.size() % n != 0) {
+			scratch.x.push_back(scratch.x.back());
+			scratch.y.push_back(scratch.y.back());
+			scratch.owner.push_back(-1);
+		}
+
+		for (size_t s = 0; s < samples; s += n) {
+			S x{}, y{};
+			for (int k = 0; k < n; k++) {
+				x.set_element(k, scratch.x[s + k]);
+				y.set_element(k, scratch.y[s + k]);
+			}
+			const auto colour = renderer.render_pixel(x, y);
+			const S luma = fma(colour.red, S(static_cast<F>(0.2126)), fma(colour.green, S(static_cast<F>(0.7152)), colour.blue * static_cast<F>(0.0722)));
+			for (int k = 0; k < n; k++) {
+				if (scratch.owner[s + k] < 0) break;
+				auto& candidate = candidates[scratch.owner[s + k]];
+				const size_t slot = static_cast<size_t>(candidate.slot) * 4;
+				const F a = colour.alpha.element(k);
+				sum[slot + 0] += colour.red.element(k) * a;
+				sum[slot + 1] += colour.green.element(k) * a;
+				sum[slot + 2] += colour.blue.element(k) * a;
+				sum[slot + 3] += a;
+				candidate.luma_min = std::min(candidate.luma_min, static_cast<float>(luma.element(k)));
+				candidate.luma_max = std::max(candidate.luma_max, static_cast<float>(luma.element(k)));
+				candidate.alpha_min = std::min(candidate.alpha_min, static_cast<float>(a));
+				candidate.alpha_max = std::max(candidate.alpha_max, static_cast<float>(a));
+			}
+		}
+	};
+	take_samples();
+
+	//Pixels whose samples still disagree go on to max_samples, from what is left of the budget
+	if (settings.max_samples > first && allowed > 0) {
+		for (auto& c : candidates) {
+			c.priority = std::max(c.luma_max - c.luma_min, c.alpha_max - c.alpha_min);
+			c.extra = (c.priority > settings.threshold) ? settings.max_samples - c.samples : 0;
+		}
+		apply_budget(candidates, allowed);
+		take_samples();
+	}
+
+	//Average
+	for (const auto& c : candidates) {
+		const int px = c.pixel % w;
+		const int py = c.pixel / w;
+		const size_t index = static_cast<size_t>(py) * out.vectors_per_row + px / n;
+		const size_t slot = static_cast<size_t>(c.slot) * 4;
+		const F total_alpha = sum[slot + 3];
+		if (!(total_alpha > static_cast<F>(0.0))) {
+			out.alpha[index].set_element(px % n, static_cast<F>(0.0));
+			continue;
+		}
+		const F to_colour = static_cast<F>(1.0) / total_alpha;
+		out.red[index].set_element(px % n, sum[slot + 0] * to_colour);
+		out.green[index].set_element(px % n, sum[slot + 1] * to_colour);
+		out.blue[index].set_element(px % n, sum[slot + 2] * to_colour);
+		out.alpha[index].set_element(px % n, total_alpha / static_cast<F>(c.samples));
+	}
+
+#ifdef _DEBUG
+	//Debug check.  The samples must keep within the budget & max_samples, and each pixel's average
+	//must lie within the range of its samples.  (Skipped for pixels with negative or non-finite samples)
+	long long extra_samples = 0;
+	for (const auto& c : candidates) {
+		if (c.samples > settings.max_samples) throw std::logic_error("Antialiasing: A pixel has more than max_samples.");
+		extra_samples += c.samples - 1;
+		const int px = c.pixel % w;
+		const int py = c.pixel / w;
+		const float a = static_cast<float>(lane(out.alpha, px, py));
+		const float luma = static_cast<float>(0.2126 * lane(out.red, px, py) + 0.7152 * lane(out.green, px, py) + 0.0722 * lane(out.blue, px, py));
+		if (!(c.alpha_min > 0.0f) || !std::isfinite(c.luma_min) || !std::isfinite(c.luma_max) || !std::isfinite(c.alpha_max)) continue;
+		const float tolerance = 1e-4f * std::max({ 1.0f, std::abs(c.luma_min), std::abs(c.luma_max) });
+		if (!(luma >= c.luma_min - tolerance && luma <= c.luma_max + tolerance)) throw std::logic_error("Antialiasing: A pixel's average is outside the range of its samples.");
+		if (!(a >= c.alpha_min - 1e-4f && a <= c.alpha_max + 1e-4f)) throw std::logic_error("Antialiasing: A pixel's alpha is outside the range of its samples.");
+	}
+	if (extra_samples > static_cast<long long>(static_cast<double>(settings.budget) * w * h)) throw std::logic_error("Antialiasing: More samples were taken than the budget allows.");
+#endif
+}
@@ -0,0 +1,97 @@
+/********************************************************************************************************
+
+Authors:		(c) 2023 Maths Town
+
+Licence:		The MIT License
+
+*********************************************************************************************************
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************
+
+Description:
+
+	Lets a host stop a render that is no longer wanted (e.g. the user has moved to another frame).
+
+	Render loops ask is_cancelled() between units of work (a tile, or a line of a pre-pass) and
+	stop taking new work once it returns true.  Work already started is finished, so a frame stops
+	within about the time it takes to render a tile.
+
+	The token can be cancelled directly (cancel()), or given a function that asks the host (e.g.
+	OpenFX's abort()).  Hosts' abort functions can be slow and aren't always safe to call from several
+	threads at once, so only one thread calls it at a time, at most once per interval.  The other
+	threads just read the flag.  Once cancelled, a token stays cancelled.
+
+	Hosts that must only be called from the thread that started the render (After Effects) use a
+	token without a host function.  They ask the host between batches of work and cancel() it.
+
+Types:
+
+	CancellationToken	- Shared by the threads of one render.
+
+*******************************************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+
+/**************************************************************************************************
+ * Cancellation shared by the threads of one render.
+ * ************************************************************************************************/
+class CancellationToken {
+public:
+	typedef std::chrono::steady_clock Clock;
+
+	//A token that is only cancelled by cancel()
+	CancellationToken() = default;
+
+	//A token that also asks the host.  host_cancelled() returns true if the render should stop.
+	explicit CancellationToken(std::function<bool()> host_cancelled, Clock::duration interval = std::chrono::milliseconds(1)) :
+		host_check(std::move(host_cancelled)), interval(interval) {}
+
+	CancellationToken(const CancellationToken&) = delete;
+	CancellationToken& operator=(const CancellationToken&) = delete;
+
+	//Stop the render
+	void cancel() noexcept { cancelled.store(true, std::memory_order_relaxed); }
+
+	//True if the render should stop.  Asks the host if it is this thread's turn.
+	bool is_cancelled() noexcept {
+		if (cancelled.load(std::memory_order_relaxed)) return true;
+		if (!host_check) return false;
+
+		const auto now = Clock::now().time_since_epoch().count();
+		if (now < next_check.load(std::memory_order_relaxed)) return false;
+		std::unique_lock lock(check_mutex, std::try_to_lock);
+		if (!lock.owns_lock()) return false;		//Another thread is asking
+		next_check.store(now + interval.count(), std::memory_order_relaxed);
+		if (host_check()) cancel();
+		return cancelled.load(std::memory_order_relaxed);
+	}
+
+	//True if the render was cancelled.  (Doesn't ask the host.  e.g. once all threads have finished)
+	bool was_cancelled() const noexcept { return cancelled.load(std::memory_order_relaxed); }
+
+private:
+	std::atomic<bool> cancelled{};
+	std::function<bool()> host_check{};
+	Clock::duration interval{};
+	std::atomic<Clock::rep> next_check{};
+	std::mutex check_mutex{};
+};
@@ -0,0 +1,446 @@
+/********************************************************************************************************
+
+Authors:		(c) 2023 Maths Town
+
+Licence:		The MIT License
+
+*********************************************************************************************************
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************
+
+Description:
+
+	Draft renders that only render some of the pixels, and complete the frame later.
+
+	While the user is dragging a slider, hosts ask for draft quality.  Renderers that have
+		DraftPattern draft_pattern() const;
+	then render a checkerboard (half the pixels) or one pixel in each 2x2 (a quarter), and the rest
+	are interpolated from the pixels around them.  Each missing pixel is the average of the pairs of
+	neighbours that face each other across it (left/right and up/down, or the diagonals), weighted
+	towards the pair that differs the least.  So edges are followed rather than blurred across.
+	(For 1 in 4, the diagonal pixels are filled first, leaving a checkerboard)
+
+	The rendered pixels are kept in a DraftFrame.  When the same frame (same parameters, time and size)
+	is next rendered at full quality, only the other pixels are rendered, so the first draft isn't
+	wasted.  Anti-aliasing is only done at full quality.
+
+	The pattern follows the pixel's position in the frame, so tiles agree at their borders.  Missing
+	pixels on a block's border are interpolated from the pixels inside the block.  The pixels are
+	rendered with render_pixel(), packed into whole vectors across the rows of the block, so renderers
+	must accept any positions in a vector.  (Not for renderers that need PacketLayout::quads)
+
+Types:
+
+	DraftPattern	- Which pixels a draft renders.
+	DraftFrame		- The pixels rendered by a draft, for completing the frame.
+
+Functions:
+
+	draft_frame_key()		- Names the image a draft renders.  (Parameters, time and size)
+	render_block_draft()	- Render a block's pattern pixels, keep them and fill in the rest.
+	complete_block()		- Render the pixels a draft left out.  (Or the whole block)
+
+*******************************************************************************************************/
+#pragma once
+
+#include "colour.h"
+#include "render-block.h"
+#include "simd-concepts.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+
+//Which pixels a draft renders.  (In the order of draft_pattern_names)
+enum class DraftPattern {
+	checkerboard,		//Pixels where x + y is even
+	quarter,			//Pixels where x and y are even
+	all,
+};
+
+//Items for the project's parameter list.
+inline constexpr std::array<const char*, 3> draft_pattern_names{
+	"Checkerboard (1/2)",
+	"1 in 4 Pixels",
+	"All Pixels",
+};
+
+
+/**************************************************************************************************
+ * Names the image a draft renders.  A draft is only completed by a render with the same key.
+ * ************************************************************************************************/
+inline uint64_t draft_frame_key(uint64_t parameter_hash, double time, int width, int height) noexcept {
+	uint64_t h = parameter_hash;
+	const auto mix = [&h](uint64_t v) {
+		h ^= v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+	};
+	mix(std::bit_cast<uint64_t>(time));
+	mix(static_cast<uint64_t>(static_cast<uint32_t>(width)));
+	mix(static_cast<uint64_t>(static_cast<uint32_t>(height)));
+	return h;
+}
+
+
+namespace draft_detail {
+
+	//The columns of row y a pass renders: every 'step' pixel whose x & 1 == parity.  (Step 1 is all, 0 is none)
+	struct RowPixels {
+		int step{};
+		int parity{};
+	};
+
+	//Pixels rendered by a draft, or (complete) the pixels it left out.
+	inline RowPixels row_pixels(DraftPattern pattern, bool complete, int y) noexcept {
+		const int odd_row = y & 1;
+		switch (pattern) {
+		case DraftPattern::checkerboard: return RowPixels{ 2, odd_row ^ (complete ? 1 : 0) };
+		case DraftPattern::quarter:
+			if (!complete) return odd_row ? RowPixels{} : RowPixels{ 2, 0 };
+			return odd_row ? RowPixels{ 1, 0 } : RowPixels{ 2, 1 };
+		default: return complete ? RowPixels{} : RowPixels{ 1, 0 };
+		}
+	}
+
+	inline bool is_draft_pixel(DraftPattern pattern, int x, int y) noexcept {
+		const auto row = row_pixels(pattern, false, y);
+		return row.step == 1 || (row.step == 2 && (x & 1) == row.parity);
+	}
+
+	//Scratch memory.  One per thread, reused between blocks.
+	template <typename F>
+	struct Scratch {
+		std::array<std::vector<F>, 4> planes{};		//Red, green, blue & alpha of each pixel
+		std::vector<float> luma{};
+		std::vector<uint8_t> known{};				//0 missing, 1 known, 2 filled in this pass
+		std::vector<F> x{};
+		std::vector<F> y{};
+	};
+
+	template <typename F>
+	inline float luma(const Scratch<F>& s, size_t p) noexcept {
+		return static_cast<float>(s.planes[0][p]) * 0.2126f + static_cast<float>(s.planes[1][p]) * 0.7152f + static_cast<float>(s.planes[2][p]) * 0.0722f;
+	}
+
+	//Set one pixel of a block from lane k of c.
+	template <SimdFloat S>
+	inline void set_pixel(BlockOutput<S>& out, int column, int row, const ColourRGBA<S>& c, int k) noexcept {
+		constexpr int n = S::number_of_elements();
+		const size_t index = static_cast<size_t>(row) * out.vectors_per_row + column / n;
+		out.red[index].set_element(column % n, c.red.element(k));
+		out.green[index].set_element(column % n, c.green.element(k));
+		out.blue[index].set_element(column % n, c.blue.element(k));
+		out.alpha[index].set_element(column % n, c.alpha.element(k));
+	}
+
+	//Render the pixels at positions xs,ys (in the frame, within the block), packed into whole vectors.
+	//(The last vector is padded with copies of the last pixel)
+	template <typename R, SimdFloat S>
+	void render_positions(const R& renderer, BlockOutput<S>& out, const std::vector<typename S::F>& xs, const std::vector<typename S::F>& ys) {
+		constexpr int n = S::number_of_elements();
+		for (size_t first = 0; first < xs.size(); first += n) {
+			S px{}, py{};
+			const int count = static_cast<int>(std::min<size_t>(n, xs.size() - first));
+			for (int k = 0; k < n; k++) {
+				px.set_element(k, xs[first + std::min(k, count - 1)]);
+				py.set_element(k, ys[first + std::min(k, count - 1)]);
+			}
+			const auto c = renderer.render_pixel(px, py);
+			for (int k = 0; k < count; k++) set_pixel(out, static_cast<int>(xs[first + k]) - out.x, static_cast<int>(ys[first + k]) - out.y, c, k);
+		}
+	}
+
+	//Render a pass's pixels of a block.  (out is already sized.  Other pixels are left as they are)
+	//The pixels are packed across rows, so no lanes are wasted at the ends of rows.
+	template <typename R, SimdFloat S>
+	void render_pixels(const R& renderer, BlockOutput<S>& out, DraftPattern pattern, bool complete) {
+		typedef typename S::F F;
+		thread_local std::vector<F> xs{};
+		thread_local std::vector<F> ys{};
+		xs.clear();
+		ys.clear();
+		for (int j = 0; j < out.height; j++) {
+			const auto row = row_pixels(pattern, complete, out.y + j);
+			if (row.step == 0) continue;
+			const int first = (row.step == 1 || (out.x & 1) == row.parity) ? 0 : 1;
+			for (int i = first; i < out.width; i += row.step) {
+				xs.push_back(static_cast<F>(out.x + i));
+				ys.push_back(static_cast<F>(out.y + j));
+			}
+		}
+		render_positions(renderer, out, xs, ys);
+	}
+
+	//Fill missing pixels from pairs of known neighbours (dx,dy and -dx,-dy), weighted towards the pair with
+	//the smallest difference.  A neighbour without its partner (at the block's border) has a low weight.
+	template <typename F>
+	void fill_pass(Scratch<F>& s, int w, int h, const std::array<std::array<int, 2>, 2>& pairs) {
+		constexpr float flat = 1.0f / 64.0f;		//Differences below this count as flat
+		for (int j = 0; j < h; j++) {
+			for (int i = 0; i < w; i++) {
+				const int p = j * w + i;
+				if (s.known[p] != 0) continue;
+				std::array<float, 4> total{};
+				float total_weight = 0.0f;
+				for (const auto& d : pairs) {
+					const int ax = i + d[0], ay = j + d[1];
+					const int bx = i - d[0], by = j - d[1];
+					const int a = (ax >= 0 && ay >= 0 && ax < w && ay < h && s.known[ay * w + ax] == 1) ? ay * w + ax : -1;
+					const int b = (bx >= 0 && by >= 0 && bx < w && by < h && s.known[by * w + bx] == 1) ? by * w + bx : -1;
+					if (a >= 0 && b >= 0) {
+						const float difference = std::abs(s.luma[a] - s.luma[b]) + static_cast<float>(std::abs(s.planes[3][a] - s.planes[3][b]));
+						const float weight = 0.5f / (flat + difference);
+						for (int c = 0; c < 4; c++) total[c] += static_cast<float>(s.planes[c][a] + s.planes[c][b]) * weight;
+						total_weight += weight + weight;
+					}
+					else if (a >= 0 || b >= 0) {
+						for (int c = 0; c < 4; c++) total[c] += static_cast<float>(s.planes[c][a >= 0 ? a : b]);
+						total_weight += 1.0f;
+					}
+				}
+				if (total_weight == 0.0f) continue;
+				const float to_value = 1.0f / total_weight;
+				for (int c = 0; c < 4; c++) s.planes[c][p] = static_cast<F>(total[c] * to_value);
+				s.luma[p] = luma(s, p);
+				s.known[p] = 2;
+			}
+		}
+		for (auto& k : s.known) k = (k == 2) ? 1 : k;
+	}
+
+	//Debug check of a filled in block.  kept is the block with the frame's kept pixels loaded over it, so the
+	//pattern's pixels must be unchanged by filling in.  The others are averages, so must lie within the
+	//range of the pattern's pixels.  (Channel by channel, skipping non-finite values)
+	template <SimdFloat S>
+	void check_draft_block(const BlockOutput<S>& out, const BlockOutput<S>& kept, DraftPattern pattern) {
+		typedef typename S::F F;
+		constexpr int n = S::number_of_elements();
+		const auto same = [](F a, F b) { return a == b || (a != a && b != b); };
+		const std::array<const std::vector<S>*, 4> planes{ &out.red, &out.green, &out.blue, &out.alpha };
+		const std::array<const std::vector<S>*, 4> kept_planes{ &kept.red, &kept.green, &kept.blue, &kept.alpha };
+		for (int c = 0; c < 4; c++) {
+			const auto value = [&](int i, int j) { return (*planes[c])[static_cast<size_t>(j) * out.vectors_per_row + i / n].element(i % n); };
+			F low = std::numeric_limits<F>::infinity();
+			F high = -std::numeric_limits<F>::infinity();
+			for (int j = 0; j < out.height; j++) {
+				for (int i = 0; i < out.width; i++) {
+					if (!is_draft_pixel(pattern, out.x + i, out.y + j)) continue;
+					if (!same(value(i, j), (*kept_planes[c])[static_cast<size_t>(j) * out.vectors_per_row + i / n].element(i % n))) {
+						throw std::logic_error("Draft: A rendered pixel was changed by filling in the block.");
+					}
+					if (std::isfinite(value(i, j))) {
+						low = std::min(low, value(i, j));
+						high = std::max(high, value(i, j));
+					}
+				}
+			}
+			const F tolerance = static_cast<F>(1e-5) * std::max({ static_cast<F>(1.0), std::abs(low), std::abs(high) });
+			for (int j = 0; j < out.height; j++) {
+				for (int i = 0; i < out.width; i++) {
+					if (is_draft_pixel(pattern, out.x + i, out.y + j) || !std::isfinite(value(i, j)) || !(low <= high)) continue;
+					if (value(i, j) < low - tolerance || value(i, j) > high + tolerance) throw std::logic_error("Draft: A filled in pixel is outside the range of the rendered pixels.");
+				}
+			}
+		}
+	}
+}
+
+
+/**************************************************************************************************
+ * The pixels rendered by a draft of the rectangle x1,y1 - x2,y2 (x2,y2 exclusive).
+ * Threads keep the pixels of their own blocks, so no locks are needed while rendering.  Share it
+ * (read only) once the render has finished.
+ * ************************************************************************************************/
+struct DraftFrame {
+	uint64_t key{};
+	DraftPattern pattern{ DraftPattern::all };
+	int x1{};
+	int y1{};
+	int x2{};
+	int y2{};
+	std::vector<float> pixels{};		//RGBA of the pattern's pixels only, row by row
+
+	DraftFrame() = default;
+	DraftFrame(uint64_t frame_key, DraftPattern draft_pattern, int left, int top, int right, int bottom) :
+		key(frame_key), pattern(draft_pattern), x1(left), y1(top), x2(std::max(right, left)), y2(std::max(bottom, top)),
+		pixels(row_index(y2) * 4) {}
+
+	bool contains(int x, int y, int w, int h) const noexcept { return x >= x1 && y >= y1 && x + w <= x2 && y + h <= y2; }
+
+	//Keep the pattern's pixels of a block.  (The block must be inside the rectangle)
+	template <SimdFloat S>
+	void store(const BlockOutput<S>& out) noexcept {
+		constexpr int n = S::number_of_elements();
+		for (int j = 0; j < out.height; j++) {
+			const auto row = draft_detail::row_pixels(pattern, false, out.y + j);
+			if (row.step == 0) continue;
+			const int first = first_column(row, out.x);
+			float* p = &pixels[pixel_index(row, first, out.y + j) * 4];
+			for (int i = first - out.x; i < out.width; i += row.step, p += 4) {
+				const size_t index = static_cast<size_t>(j) * out.vectors_per_row + i / n;
+				p[0] = static_cast<float>(out.red[index].element(i % n));
+				p[1] = static_cast<float>(out.green[index].element(i % n));
+				p[2] = static_cast<float>(out.blue[index].element(i % n));
+				p[3] = static_cast<float>(out.alpha[index].element(i % n));
+			}
+		}
+	}
+
+	//Put the kept pixels into a block.  (Other pixels are left as they are)
+	template <SimdFloat S>
+	void load(BlockOutput<S>& out) const noexcept {
+		typedef typename S::F F;
+		constexpr int n = S::number_of_elements();
+		for (int j = 0; j < out.height; j++) {
+			const auto row = draft_detail::row_pixels(pattern, false, out.y + j);
+			if (row.step == 0) continue;
+			const int first = first_column(row, out.x);
+			const float* p = &pixels[pixel_index(row, first, out.y + j) * 4];
+			for (int i = first - out.x; i < out.width; i += row.step, p += 4) {
+				const size_t index = static_cast<size_t>(j) * out.vectors_per_row + i / n;
+				out.red[index].set_element(i % n, static_cast<F>(p[0]));
+				out.green[index].set_element(i % n, static_cast<F>(p[1]));
+				out.blue[index].set_element(i % n, static_cast<F>(p[2]));
+				out.alpha[index].set_element(i % n, static_cast<F>(p[3]));
+			}
+		}
+	}
+
+private:
+	//The first of a row's pattern pixels at or after column x.
+	static int first_column(draft_detail::RowPixels row, int x) noexcept {
+		return (row.step == 1 || (x & 1) == row.parity) ? x : x + 1;
+	}
+
+	//How many of row y's pixels are kept.
+	size_t row_size(int y) const noexcept {
+		const auto row = draft_detail::row_pixels(pattern, false, y);
+		if (row.step == 0) return 0;
+		const int first = first_column(row, x1);
+		return first < x2 ? static_cast<size_t>((x2 - first + row.step - 1) / row.step) : 0;
+	}
+
+	//Index of row y's first kept pixel.  The layout of a row only depends on whether y is odd, so the
+	//rows above y are half of each kind.
+	size_t row_index(int y) const noexcept {
+		const size_t rows = static_cast<size_t>(y - y1);
+		return (rows + 1) / 2 * row_size(y1) + rows / 2 * row_size(y1 + 1);
+	}
+
+	//Index of the pixel at column x (a pattern pixel) of row y.
+	size_t pixel_index(draft_detail::RowPixels row, int x, int y) const noexcept {
+		return row_index(y) + static_cast<size_t>((x - first_column(row, x1)) / row.step);
+	}
+};
+
+
+/**************************************************************************************************
+ * Render the pattern's pixels of a block, keep them in frame, then fill in the others.
+ * (Any pixel with no rendered neighbours, e.g. in a block one pixel wide, is rendered)
+ * ************************************************************************************************/
+template <typename R, SimdFloat S>
+void render_block_draft(const R& renderer, int x, int y, int w, int h, BlockOutput<S>& out, DraftFrame& frame) {
+	using namespace draft_detail;
+	typedef typename S::F F;
+	constexpr int n = S::number_of_elements();
+	if (frame.pattern == DraftPattern::all || !frame.contains(x, y, w, h)) {
+		render_block(renderer, x, y, w, h, out);
+		return;
+	}
+	out.resize(x, y, w, h);
+	if (out.width == 0 || out.height == 0) return;
+	render_pixels(renderer, out, frame.pattern, false);
+	frame.store(out);
+
+	//Planes of the block, with the rendered pixels known
+	thread_local Scratch<F> s{};
+	const size_t size = static_cast<size_t>(out.width) * out.height;
+	for (auto& plane : s.planes) plane.resize(size);
+	s.luma.resize(size);
+	s.known.resize(size);
+	for (int j = 0; j < out.height; j++) {
+		for (int i = 0; i < out.width; i++) {
+			const size_t p = static_cast<size_t>(j) * out.width + i;
+			const size_t index = static_cast<size_t>(j) * out.vectors_per_row + i / n;
+			s.planes[0][p] = out.red[index].element(i % n);
+			s.planes[1][p] = out.green[index].element(i % n);
+			s.planes[2][p] = out.blue[index].element(i % n);
+			s.planes[3][p] = out.alpha[index].element(i % n);
+			s.luma[p] = luma(s, p);
+			s.known[p] = is_draft_pixel(frame.pattern, out.x + i, out.y + j) ? 1 : 0;
+		}
+	}
+
+	//Fill in.  (1 in 4 fills the diagonals first, leaving a checkerboard)
+	if (frame.pattern == DraftPattern::quarter) fill_pass(s, out.width, out.height, { { { 1, 1 }, { 1, -1 } } });
+	fill_pass(s, out.width, out.height, { { { 1, 0 }, { 0, 1 } } });
+
+	//Back to the block.  Pixels that couldn't be filled are rendered.
+	s.x.clear();
+	s.y.clear();
+	for (int j = 0; j < out.height; j++) {
+		for (int i = 0; i < out.width; i++) {
+			const size_t p = static_cast<size_t>(j) * out.width + i;
+			if (s.known[p] == 0) {
+				s.x.push_back(static_cast<F>(out.x + i));
+				s.y.push_back(static_cast<F>(out.y + j));
+				continue;
+			}
+			const size_t index = static_cast<size_t>(j) * out.vectors_per_row + i / n;
+			out.red[index].set_element(i % n, s.planes[0][p]);
+			out.green[index].set_element(i % n, s.planes[1][p]);
+			out.blue[index].set_element(i % n, s.planes[2][p]);
+			out.alpha[index].set_element(i % n, s.planes[3][p]);
+		}
+	}
+	render_positions(renderer, out, s.x, s.y);
+
+#ifdef _DEBUG
+	BlockOutput<S> kept = out;
+	frame.load(kept);
+	check_draft_block(out, kept, frame.pattern);
+#endif
+}
+
+
+/**************************************************************************************************
+ * Render a block at full quality, taking the pixels a draft rendered from frame.  Blocks that frame
+ * doesn't cover are rendered in full.  Then adds samples along edges, as render_block() does.
+ * ************************************************************************************************/
+template <typename R, SimdFloat S>
+void complete_block(const R& renderer, int x, int y, int w, int h, BlockOutput<S>& out, const DraftFrame& frame) {
+	if (frame.pattern == DraftPattern::all || !frame.contains(x, y, w, h)) {
+		render_block(renderer, x, y, w, h, out);
+		return;
+	}
+	out.resize(x, y, w, h);
+	if (out.width == 0 || out.height == 0) return;
+	frame.load(out);
+	draft_detail::render_pixels(renderer, out, frame.pattern, true);
+#ifdef _DEBUG
+	check_block(renderer, out);
+#endif
+
+	//Extra samples along edges
+	if constexpr (requires { renderer.antialias_settings(); }) {
+		antialias_block(renderer, out, renderer.antialias_settings());
+	}
+}
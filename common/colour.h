@@ -289,9 +289,9 @@ inline static constexpr uint8_t float_to_8bit(std::floating_point auto c) noexce
     return static_cast<uint8_t>(a);
 }
 
+//(The first element, for fallback types of either precision)
 inline static uint8_t float_to_8bit(SimdFloat auto c) noexcept {
-    const decltype(c) a = clamp(c * white8, 0.0, white8);
-    return static_cast<uint8_t>(a.v);
+    return float_to_8bit(c.element(0));
 }
 
 
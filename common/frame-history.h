@@ -0,0 +1,134 @@
+/********************************************************************************************************
+
+Authors:		(c) 2023 Maths Town
+
+Licence:		The MIT License
+
+*********************************************************************************************************
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************
+
+Description:
+
+	The depth and camera of a rendered frame, kept so the next frame can reuse the depth.
+
+	Renderers that march rays with a pinhole camera record the distance to the surface for each pixel.
+	Hosts that render frames in sequence hold on to the history and give it back for the next frame.
+	reproject_depth() moves each pixel's surface point into the new camera, giving the distance
+	that the new rays can expect to find a surface at.  (Split into rows, so hosts can spread it over
+	threads)
+
+	The history is immutable once made, so hosts can share it between threads.
+
+Types:
+
+	FrameHistory	- Camera, size and the depth of each pixel.
+
+*******************************************************************************************************/
+#pragma once
+
+#include "simd-concepts.h"
+#include "linear-algebra.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+
+/**************************************************************************************************
+ * Camera and depth of one frame.
+ * Pixel x,y looks along normalize(forward + right * u + up * v), where u and v run from -1 to 1
+ * across the frame and are scaled by tan_half_fov (and the aspect ratio for u).
+ * ************************************************************************************************/
+struct FrameHistory {
+	int width{};
+	int height{};
+	vec3<double> camera_position{};
+	vec3<double> camera_forward{};
+	vec3<double> camera_right{};
+	vec3<double> camera_up{};
+	double tan_half_fov{};
+	uint64_t scene{};				//Set by the renderer.  The depth is only reused when it matches. (e.g. the shape being rendered)
+	std::vector<float> depth{};		//Distance along each pixel's ray.  Infinity if no surface was found (or not rendered).
+
+	double aspect() const noexcept { return (height > 0) ? static_cast<double>(width) / static_cast<double>(height) : 1.0; }
+};
+
+
+/**************************************************************************************************
+ * Distance from the camera of 'current' to each surface point in rows first_row..last_row-1 of
+ * 'previous', stored at the nearest pixel of 'current' (and the pixels around it, to fill the gaps
+ * as the surface gets closer).  The nearest point is kept where several land on a pixel.
+ * out must hold a value for each pixel of 'current', set to infinity before the first rows.  Pixels
+ * no point lands on (newly visible or outside the previous frame) are left at infinity.
+ * Different rows can be done on different threads at the same time.
+ * ************************************************************************************************/
+inline void reproject_depth(const FrameHistory& previous, const FrameHistory& current, int first_row, int last_row, std::vector<float>& out) noexcept {
+	constexpr float none = std::numeric_limits<float>::infinity();
+	if (previous.depth.size() != static_cast<size_t>(previous.width) * static_cast<size_t>(previous.height)) return;
+	if (out.size() != static_cast<size_t>(current.width) * static_cast<size_t>(current.height)) return;
+
+	//The previous camera's position and axes, in the current camera's coordinates (right, up, forward).
+	//The previous ray for u,v is forward + right * u + up * v, with length sqrt(1 + u^2 + v^2).
+	const vec3<double> delta = previous.camera_position - current.camera_position;
+	const auto to_current = [&](const vec3<double>& a) { return vec3<double>(dot(a, current.camera_right), dot(a, current.camera_up), dot(a, current.camera_forward)); };
+	const vec3<double> origin = to_current(delta);
+	const vec3<double> forward = to_current(previous.camera_forward);
+	const vec3<double> right = to_current(previous.camera_right);
+	const vec3<double> up = to_current(previous.camera_up);
+
+	const double previous_u_scale = previous.aspect() * previous.tan_half_fov;
+	const double current_x_scale = 0.5 * current.width / (current.aspect() * current.tan_half_fov);
+	const double current_y_scale = 0.5 * current.height / current.tan_half_fov;
+
+	for (int y = std::max(first_row, 0); y < std::min(last_row, previous.height); y++) {
+		const double v = (1.0 - 2.0 * (y + 0.5) / previous.height) * previous.tan_half_fov;
+		const vec3<double> row_ray = forward + up * v;
+		for (int x = 0; x < previous.width; x++) {
+			const float depth = previous.depth[static_cast<size_t>(y) * previous.width + x];
+			if (!(depth < none)) continue;
+
+			//Surface point, relative to the current camera
+			const double u = (2.0 * (x + 0.5) / previous.width - 1.0) * previous_u_scale;
+			const double scale = static_cast<double>(depth) / std::sqrt(1.0 + u * u + v * v);
+			const vec3<double> point = origin + (row_ray + right * u) * scale;
+
+			//Project into the current frame.  (Skip points behind the camera)
+			if (point.z <= 0.0) continue;
+			const double inverse_z = 1.0 / point.z;
+			const double px = point.x * inverse_z * current_x_scale + 0.5 * current.width - 0.5;
+			const double py = 0.5 * current.height - 0.5 - point.y * inverse_z * current_y_scale;
+			if (!(px > -1.0 && py > -1.0 && px < current.width && py < current.height)) continue;
+
+			//Made slightly smaller than float rounding can add, so the distance is never past the point
+			const float d = static_cast<float>(std::sqrt(dot(point, point)) * (1.0 - 1e-6));
+
+			//The 2x2 pixels around the point.  (Other rows may be writing the same pixels)
+			const int x0 = static_cast<int>(std::floor(px));
+			const int y0 = static_cast<int>(std::floor(py));
+			for (int j = std::max(y0, 0); j <= std::min(y0 + 1, current.height - 1); j++) {
+				for (int i = std::max(x0, 0); i <= std::min(x0 + 1, current.width - 1); i++) {
+					std::atomic_ref<float> target(out[static_cast<size_t>(j) * current.width + i]);
+					float nearest = target.load(std::memory_order_relaxed);
+					while (d < nearest && !target.compare_exchange_weak(nearest, d, std::memory_order_relaxed)) {}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,219 @@
+/********************************************************************************************************
+
+Authors:		(c) 2023 Maths Town
+
+Licence:		The MIT License
+
+*********************************************************************************************************
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************
+
+Description:
+
+	Statistics for a whole input frame, gathered by the host before rendering.
+	(e.g. Used for automatic exposure)
+
+	Each thread fills its own ImageStatisticsAccumulator, then the host merges the results once
+	all threads are done.  No locks or atomics are needed.
+
+	Per channel min/max/sum are kept in SIMD vectors, and only reduced to a single value at the end.
+	Sums are moved into doubles at the end of each row so large frames don't lose precision.
+
+Types:
+
+	ImageStatistics					- Results (min/max/mean per channel and a log2 luminance histogram)
+	ImageStatisticsAccumulator<S>	- Gathers statistics for one thread.
+
+*******************************************************************************************************/
+#pragma once
+
+#include "colour.h"
+#include "simd-concepts.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+
+/**************************************************************************************************
+ * ImageStatistics
+ * ************************************************************************************************/
+struct ImageStatistics {
+	//Luminance histogram range (log2).  Each bin covers 3/16 of a stop.
+	static constexpr int histogram_bins = 128;
+	static constexpr float histogram_min_log2 = -16.0f;
+	static constexpr float histogram_max_log2 = 8.0f;
+	static constexpr float histogram_bins_per_stop = static_cast<float>(histogram_bins) / (histogram_max_log2 - histogram_min_log2);
+
+	uint64_t count{};
+	std::array<float, 3> minimum{ std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity() };
+	std::array<float, 3> maximum{ -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity() };
+	std::array<double, 3> sum{};
+	std::array<uint32_t, histogram_bins> histogram{};	//Rec.709 luminance, log2 scale.
+
+	void merge(const ImageStatistics& other) noexcept;
+	float mean(int channel) const noexcept;
+	float log_average_luminance(float low_fraction, float high_fraction) const noexcept;
+};
+
+
+/**************************************************************************************************
+ * Combine statistics (e.g. from another thread)
+ * ************************************************************************************************/
+inline void ImageStatistics::merge(const ImageStatistics& other) noexcept {
+	count += other.count;
+	for (int i = 0; i < 3; i++) {
+		minimum[i] = std::min(minimum[i], other.minimum[i]);
+		maximum[i] = std::max(maximum[i], other.maximum[i]);
+		sum[i] += other.sum[i];
+	}
+	for (int i = 0; i < histogram_bins; i++) histogram[i] += other.histogram[i];
+}
+
+
+/**************************************************************************************************
+ * Mean value of a channel (0=red, 1=green, 2=blue)
+ * ************************************************************************************************/
+inline float ImageStatistics::mean(int channel) const noexcept {
+	if (count == 0) return 0.0f;
+	return static_cast<float>(sum[channel] / static_cast<double>(count));
+}
+
+
+/**************************************************************************************************
+ * Geometric mean luminance of the pixels between two fractions of the histogram.
+ * e.g. (0.05, 0.95) ignores the darkest and brightest 5% of pixels.
+ * Returns zero if there are no pixels.
+ * ************************************************************************************************/
+inline float ImageStatistics::log_average_luminance(float low_fraction, float high_fraction) const noexcept {
+	const double low = static_cast<double>(count) * low_fraction;
+	const double high = static_cast<double>(count) * high_fraction;
+
+	double total_log = 0.0;
+	double total_weight = 0.0;
+	double seen = 0.0;
+	for (int i = 0; i < histogram_bins; i++) {
+		const double start = seen;
+		seen += histogram[i];
+		const double weight = std::min(seen, high) - std::max(start, low);
+		if (weight <= 0.0) continue;
+		const double centre = histogram_min_log2 + (i + 0.5) / histogram_bins_per_stop;
+		total_log += centre * weight;
+		total_weight += weight;
+	}
+	if (total_weight <= 0.0) return 0.0f;
+	return static_cast<float>(std::exp2(total_log / total_weight));
+}
+
+
+
+
+/**************************************************************************************************
+ * ImageStatisticsAccumulator
+ * Call add() for each vector of pixels, end_row() after each row, then finish().
+ * ************************************************************************************************/
+template <SimdFloat S>
+class ImageStatisticsAccumulator {
+public:
+	void add(const ColourRGBA<S>& c, int first_lane = 0) noexcept;
+	void end_row() noexcept;
+	ImageStatistics finish() noexcept;
+
+private:
+	typedef typename S::F F;
+
+	ImageStatistics stats{};
+	S min_red{ std::numeric_limits<F>::infinity() };
+	S min_green{ std::numeric_limits<F>::infinity() };
+	S min_blue{ std::numeric_limits<F>::infinity() };
+	S max_red{ -std::numeric_limits<F>::infinity() };
+	S max_green{ -std::numeric_limits<F>::infinity() };
+	S max_blue{ -std::numeric_limits<F>::infinity() };
+	S sum_red{ 0.0f };		//Current row only
+	S sum_green{ 0.0f };
+	S sum_blue{ 0.0f };
+};
+
+
+/**************************************************************************************************
+ * Add a vector of pixels.
+ * Lanes before first_lane are ignored.  (Used at the end of a row where the last vector overlaps the
+ * previous one)
+ * ************************************************************************************************/
+template <SimdFloat S>
+inline void ImageStatisticsAccumulator<S>::add(const ColourRGBA<S>& c, int first_lane) noexcept {
+	if (first_lane == 0) [[likely]] {
+		min_red = min(min_red, c.red);
+		min_green = min(min_green, c.green);
+		min_blue = min(min_blue, c.blue);
+		max_red = max(max_red, c.red);
+		max_green = max(max_green, c.green);
+		max_blue = max(max_blue, c.blue);
+		sum_red += c.red;
+		sum_green += c.green;
+		sum_blue += c.blue;
+	}
+	else {
+		const auto valid = compare_greater_equal(S::make_sequential(0.0f), S(static_cast<F>(first_lane)));
+		min_red = blend(min_red, min(min_red, c.red), valid);
+		min_green = blend(min_green, min(min_green, c.green), valid);
+		min_blue = blend(min_blue, min(min_blue, c.blue), valid);
+		max_red = blend(max_red, max(max_red, c.red), valid);
+		max_green = blend(max_green, max(max_green, c.green), valid);
+		max_blue = blend(max_blue, max(max_blue, c.blue), valid);
+		sum_red += blend(S(0.0f), c.red, valid);
+		sum_green += blend(S(0.0f), c.green, valid);
+		sum_blue += blend(S(0.0f), c.blue, valid);
+	}
+	stats.count += S::number_of_elements() - first_lane;
+
+	//Histogram bin of the luminance.  Dark values (and NaN) go in the first bin.
+	constexpr F darkest = static_cast<F>(1.0f / 65536.0f);	//2^histogram_min_log2
+	S luminance = c.red * 0.2126f + c.green * 0.7152f + c.blue * 0.0722f;
+	luminance = blend(S(darkest), luminance, compare_greater(luminance, S(darkest)));
+	const S bin = min((log2(luminance) - ImageStatistics::histogram_min_log2) * ImageStatistics::histogram_bins_per_stop, S(static_cast<F>(ImageStatistics::histogram_bins - 1)));
+	for (int i = first_lane; i < S::number_of_elements(); i++) {
+		stats.histogram[static_cast<int>(bin.element(i))]++;
+	}
+}
+
+
+/**************************************************************************************************
+ * Move the row's sums into double precision.
+ * ************************************************************************************************/
+template <SimdFloat S>
+inline void ImageStatisticsAccumulator<S>::end_row() noexcept {
+	stats.sum[0] += reduce_add(sum_red);
+	stats.sum[1] += reduce_add(sum_green);
+	stats.sum[2] += reduce_add(sum_blue);
+	sum_red = S(0.0f);
+	sum_green = S(0.0f);
+	sum_blue = S(0.0f);
+}
+
+
+/**************************************************************************************************
+ * Reduce the vectors and return the statistics.
+ * ************************************************************************************************/
+template <SimdFloat S>
+inline ImageStatistics ImageStatisticsAccumulator<S>::finish() noexcept {
+	end_row();
+	stats.minimum = { reduce_min(min_red), reduce_min(min_green), reduce_min(min_blue) };
+	stats.maximum = { reduce_max(max_red), reduce_max(max_green), reduce_max(max_blue) };
+	return stats;
+}
@@ -23,20 +23,54 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 Description:
 
-    
-
-Types:
+	Input space transforms shared by several projects.  Pixel positions are moved (translate,
+	rotate & scale) then optionally passed through a special (non-linear) transform.
 
+	The parameters are resolved once per frame by make_input_transform().  Renderers pick a kernel
+	for the special transform with pick_input_transform(), so there is no per pixel branch.
 
+Types:
 
+	InputTransform				- The special transforms, in list order.
+	InputTransformSettings<F>	- A transform resolved for one frame.
 
 *******************************************************************************************************/
 #include "parameters.h"
 #include "simd-concepts.h"
 #include "linear-algebra.h"
 
+#include <array>
+#include <cmath>
+#include <limits>
 #include <numbers>
 
+/**************************************************************************************************
+ * The special transforms, in the order they are listed.  (The list index is stored in the snapshot)
+ * ************************************************************************************************/
+enum class InputTransform {
+	none,
+	wave,
+	sqrt_r,
+	abs,
+	sqrt_abs,
+	complex_cosine,
+	complex_cosine_sqrt_r,
+	cartesian_to_polar,
+};
+
+inline constexpr std::array<const char*, 8> input_transform_names{
+	"None",
+	"Wave",
+	"Sqrt(r)",
+	"Abs(x,y)",
+	"Sqrt(Abs(x,y))",
+	"Complex Cosine",
+	"Complex Cosine Sqrt(r)",
+	"Cartesian to Polar",
+};
+
+
+
 /**************************************************************************************************
  *
  * ************************************************************************************************/
@@ -46,20 +80,10 @@ inline void build_input_transforms_parameter_list(ParameterList& params) {
 	params.add_entry(ParameterEntry::make_number(ParameterID::input_transform_translate_x, "Translate x (%)", -100000.0, 100000.0, 0.0, -100.0, 100.0, 2));
 	params.add_entry(ParameterEntry::make_number(ParameterID::input_transform_translate_y, "Translate y(%)", -100000.0, 100000.0, 0.0, -100.0, 100.0, 2));
 	params.add_entry(ParameterEntry::make_number(ParameterID::input_transform_scale,"Scale",0.0,10000.0,1.0,0.0,10.0,2));
+	params.add_entry(ParameterEntry::make_number(ParameterID::input_transform_rotation, "Rotation (degrees)", -100000.0, 100000.0, 0.0, -180.0, 180.0, 2));
 	
 
-	std::vector<std::string> input_list{};
-	input_list.push_back("None");	
-	input_list.push_back("Wave");
-	input_list.push_back("Sqrt(r)");
-	
-	input_list.push_back("Abs(x,y)");
-	input_list.push_back("Sqrt(Abs(x,y))");
-
-	input_list.push_back("Complex Cosine");
-	input_list.push_back("Complex Cosine Sqrt(r)");
-
-	input_list.push_back("Cartesian to Polar");
+	std::vector<std::string> input_list{ input_transform_names.begin(), input_transform_names.end() };
 	params.add_entry(ParameterEntry::make_list(ParameterID::input_transform_type, "Special Transform", std::move(input_list)));
 
 	params.add_entry(ParameterEntry::make_number(ParameterID::input_transform_special1, "Special Parameter 1", -100000.0, 100000.0, 1.0, -50.0, 50.0, 2));
@@ -74,98 +98,160 @@ inline void build_input_transforms_parameter_list(ParameterList& params) {
 
 
 /**************************************************************************************************
- *
+ * An input transform, resolved once per frame.
+ * The translate, rotate & scale parameters are folded into one affine map, together with the
+ * pixel to normalised coordinate step (height -1..1, width proportional and zero centred).
+ * Where the special transform allows it, its own linear steps are folded in too.
  * ************************************************************************************************/
-template <SimdFloat S>
-vec2<S> perform_input_transform(const std::string& transform_name, vec2<S> p, const ParameterList& params) {
-	constexpr typename S::F pi = 3.1415926535897932384626433832795;
-	
-	using namespace std::numbers;
+template <typename F>
+struct InputTransformSettings {
+	InputTransform type{ InputTransform::none };
 
+	//Pixel (x,y) to the special transform's input: (xx * x + xy * y + x0, yx * x + yy * y + y0)
+	F xx{ 1 }, xy{ 0 }, x0{ 0 };
+	F yx{ 0 }, yy{ 1 }, y0{ 0 };
 
+	vec2<F> post{ 1, 1 };		//Scale applied after the special transform
+	vec2<F> cosine_scale{ 1, 1 };
+	F wave_frequency{};
+	F wave_amplitude{};
+};
 
-	//Pre-Transform (don't compute null-ops as they can affect image quality)
-	const auto tx = params.get_value(ParameterID::input_transform_translate_x);
-	if (tx != 0.0) {
-		p.x += static_cast<typename S::F>(tx / 100.0f);
-	}
-	const auto ty = params.get_value(ParameterID::input_transform_translate_y);
-	if (ty != 0.0) {
-		p.y += static_cast<typename S::F>(ty / 100.0f);
-	}
-	const auto ts = params.get_value(ParameterID::input_transform_scale);
-	if (ts != 1.0 ) {
-		p *= static_cast<typename S::F>(ts);
-	}
-	
 
-	const auto special1 = static_cast<typename S::F>(params.get_value(ParameterID::input_transform_special1));
-	const auto special2 = static_cast<typename S::F>(params.get_value(ParameterID::input_transform_special2));
-
-	
-	if (transform_name == "None") return p;
+/**************************************************************************************************
+ * Resolve the input transform parameters for a frame of width x height pixels.
+ * post is a scale the renderer applies to the result (folded in when the transform is linear).
+ * Translate is in the rotated frame, so the image rotates about the centre of the frame.
+ * ************************************************************************************************/
+template <typename F>
+InputTransformSettings<F> make_input_transform(const ParameterSnapshot<F>& params, double width, double height, vec2<double> post = vec2<double>(1.0, 1.0)) {
+	constexpr double pi = std::numbers::pi;
+	InputTransformSettings<F> t{};
+	t.type = params.template get_list<InputTransform>(ParameterID::input_transform_type);
+
+	//Pixel to normalised coordinates
+	const double aspect = (height > 0.0) ? width / height : 1.0;
+	double xx = (width > 0.0) ? 2.0 * aspect / width : 0.0;
+	double yy = (height > 0.0) ? 2.0 / height : 0.0;
+	double xy = 0.0, yx = 0.0;
+	double x0 = -aspect, y0 = -1.0;
+
+	//Rotate about the centre, translate, then scale
+	const double angle = params.get_value(ParameterID::input_transform_rotation) * (pi / 180.0);
+	const double c = std::cos(angle);
+	const double s = std::sin(angle);
+	const double scale = params.get_value(ParameterID::input_transform_scale);
+	const double tx = params.get_value(ParameterID::input_transform_translate_x) / 100.0;
+	const double ty = params.get_value(ParameterID::input_transform_translate_y) / 100.0;
+	const auto transform = [&](double sx, double sy, double dx, double dy) {
+		const double r[6] = { c * xx - s * yx, c * xy - s * yy, c * x0 - s * y0, s * xx + c * yx, s * xy + c * yy, s * x0 + c * y0 };
+		xx = sx * r[0]; xy = sx * r[1]; x0 = sx * (r[2] + dx);
+		yx = sy * r[3]; yy = sy * r[4]; y0 = sy * (r[5] + dy);
+	};
+	transform(scale, scale, tx, ty);
+
+	//Linear steps of the special transforms
+	const double special1 = params.get_value(ParameterID::input_transform_special1);
+	const double special2 = params.get_value(ParameterID::input_transform_special2);
+	switch (t.type) {
+	case InputTransform::wave:
+		t.wave_frequency = static_cast<F>(2.0 * pi * special1);
+		t.wave_amplitude = static_cast<F>(0.1 * special2);
+		break;
+	case InputTransform::complex_cosine:
+		x0 += 0.000001; y0 += 0.000001;		//Slight offset improves render
+		xx *= pi * special1 * special2; xy *= pi * special1 * special2; x0 *= pi * special1 * special2;
+		yx *= pi; yy *= pi; y0 *= pi;
+		break;
+	case InputTransform::complex_cosine_sqrt_r:
+		x0 += 0.000001; y0 += 0.000001;
+		t.cosine_scale = vec2<F>(static_cast<F>(pi * special1 * special2), static_cast<F>(pi));
+		break;
+	case InputTransform::sqrt_r:
+	case InputTransform::abs:
+	case InputTransform::sqrt_abs:
+	case InputTransform::cartesian_to_polar:
+		break;
+	default:
+		t.type = InputTransform::none;
+		break;
+	}
 
-	if (transform_name == "Wave") {
-		auto x = p.x;
-		auto y = p.y + 0.1f * special2* sin(2.0 * pi * p.x * special1);
-		return vec2{x, y};
+	//The renderer's scale.  (Applied to the affine map if nothing non-linear comes after it)
+	if (t.type == InputTransform::none) {
+		xx *= post.x; xy *= post.x; x0 *= post.x;
+		yx *= post.y; yy *= post.y; y0 *= post.y;
 	}
-	
-	
-	if (transform_name == "Abs(x,y)") {
-		return abs(p);
+	else {
+		t.post = vec2<F>(static_cast<F>(post.x), static_cast<F>(post.y));
 	}
 
-	if (transform_name == "Sqrt(Abs(x,y))") {
-		return sqrt(abs(p));
-	}
+	t.xx = static_cast<F>(xx); t.xy = static_cast<F>(xy); t.x0 = static_cast<F>(x0);
+	t.yx = static_cast<F>(yx); t.yy = static_cast<F>(yy); t.y0 = static_cast<F>(y0);
+	return t;
+}
 
-	if (transform_name == "Sqrt(r)") {
-		auto r = p.magnitude();
-		auto theta = atan2(p.y, p.x);
-		r = sqrt(r);
-		auto x = r * cos(theta);
-		auto y = r * sin(theta);
-		
-		return vec2{ x, y };
-	}
 
+/**************************************************************************************************
+ * Apply the input transform to pixel positions.
+ * The special transform is a template parameter, so each one compiles to its own kernel.
+ * (Use pick_input_transform() to choose the kernel once per frame)
+ * ************************************************************************************************/
+template <InputTransform T, SimdFloat S>
+vec2<S> perform_input_transform(S x, S y, const InputTransformSettings<typename S::F>& t) {
+	typedef typename S::F F;
 
-	if (transform_name == "Complex Cosine") {
-		p += 0.000001; //Slight offset improves render
-		p *= pi;
-		if (special1 != 1.0) p.x *= special1;
-		if (special2 != 1.0) p.x *= special2;
+	vec2<S> p(fma(x, S(t.xx), fma(y, S(t.xy), S(t.x0))), fma(x, S(t.yx), fma(y, S(t.yy), S(t.y0))));
 
-		auto x = cos(p.x) * cosh(p.y);
-		auto y = -sin(p.x) * sinh(p.y);
-		return vec2{ x, y };
+	if constexpr (T == InputTransform::none) {
+		return p;
 	}
-
-	if (transform_name == "Complex Cosine Sqrt(r)") {
-		p += 0.000001; //Slight offset improves render
-		auto r = p.magnitude();
-		auto theta = atan2(p.y, p.x);
-		r = sqrt(r);
-		p.x = r * cos(theta);
-		p.y = r * sin(theta);
-		p *= pi;
-		if (special1 != 1.0) p.x *= special1;
-		if (special2 != 1.0) p.x *= special2;
-		auto x = cos(p.x) * cosh(p.y);
-		auto y = -sin(p.x) * sinh(p.y );
-		return vec2{ x, y };
+	else {
+		if constexpr (T == InputTransform::wave) {
+			p.y = fma(S(t.wave_amplitude), sin(p.x * t.wave_frequency), p.y);
+		}
+		else if constexpr (T == InputTransform::abs) {
+			p = abs(p);
+		}
+		else if constexpr (T == InputTransform::sqrt_abs) {
+			p = sqrt(abs(p));
+		}
+		else if constexpr (T == InputTransform::sqrt_r) {
+			//sqrt(r) at the same angle: p * r^-1/2.  (Zero stays at zero)
+			const S r = max(p.magnitude(), S(std::numeric_limits<F>::min()));
+			p *= S(static_cast<F>(1.0)) / sqrt(r);
+		}
+		else if constexpr (T == InputTransform::complex_cosine) {
+			p = vec2<S>(cos(p.x) * cosh(p.y), -sin(p.x) * sinh(p.y));
+		}
+		else if constexpr (T == InputTransform::complex_cosine_sqrt_r) {
+			const S r = max(p.magnitude(), S(std::numeric_limits<F>::min()));
+			p *= S(static_cast<F>(1.0)) / sqrt(r);
+			p *= vec2<S>(S(t.cosine_scale.x), S(t.cosine_scale.y));
+			p = vec2<S>(cos(p.x) * cosh(p.y), -sin(p.x) * sinh(p.y));
+		}
+		else if constexpr (T == InputTransform::cartesian_to_polar) {
+			p = vec2<S>(p.magnitude(), atan2(p.y, p.x));
+		}
+		return p * vec2<S>(S(t.post.x), S(t.post.y));
 	}
+}
 
 
-	if (transform_name == "Cartesian to Polar") {
-		auto r = p.magnitude();
-		auto theta = atan2(p.y, p.x);
-		return vec2{r,theta };
+/**************************************************************************************************
+ * Choose a kernel for the transform.  pick is called with the transform as a template argument,
+ * e.g. pick_input_transform(type, [&]<InputTransform T>() { return &Renderer::evaluate<T>; })
+ * ************************************************************************************************/
+template <typename Pick>
+auto pick_input_transform(InputTransform transform, Pick&& pick) {
+	switch (transform) {
+	case InputTransform::wave: return pick.template operator()<InputTransform::wave>();
+	case InputTransform::sqrt_r: return pick.template operator()<InputTransform::sqrt_r>();
+	case InputTransform::abs: return pick.template operator()<InputTransform::abs>();
+	case InputTransform::sqrt_abs: return pick.template operator()<InputTransform::sqrt_abs>();
+	case InputTransform::complex_cosine: return pick.template operator()<InputTransform::complex_cosine>();
+	case InputTransform::complex_cosine_sqrt_r: return pick.template operator()<InputTransform::complex_cosine_sqrt_r>();
+	case InputTransform::cartesian_to_polar: return pick.template operator()<InputTransform::cartesian_to_polar>();
+	default: return pick.template operator()<InputTransform::none>();
 	}
-
-
-	return p;
 }
-
-
@@ -27,6 +27,9 @@ Description:
 	The template parameter should be a floating point type.
 	The style of this library mimics the GLSL language
 
+	Matrices are stored by column.  Their elements may be scalars (the same for every lane) or SIMD
+	types (a different matrix for each lane).  A matrix of scalars multiplies SIMD vectors directly.
+
 *********************************************************************************************************/
 #pragma once
 
@@ -35,8 +38,6 @@ Description:
 #include <type_traits>
 		
 
-struct mat3;
-struct mat4;
 
 
 
@@ -179,7 +180,7 @@ struct vec3 {
 	inline F length() const noexcept { return this->magnitude(); }
 	
 	[[nodiscard("Value Calculated and not used (normalize).  Note: This value is not calulated in place")]]
-	inline vec2<F> normalize() const noexcept { const F m = magnitude(); return vec2(x / m, y / m, z / m); }
+	inline vec3<F> normalize() const noexcept { const F m = magnitude(); return vec3(x / m, y / m, z / m); }
 
 
 	inline vec2<F> xy() const noexcept { return vec2<F>(x, y); }
@@ -203,9 +204,9 @@ template <typename F>
 [[nodiscard("Value Calculated and not used (normalize).  Note: This value is not calulated in place")]]
 inline vec3<F> normalize(const vec3<F>& v) noexcept {return v.normalize();}
 
-template <typename F> inline static F dot(const vec3<F>& a, const vec3<F>& b) noexcept {return a.x * b.x + a.y * b.y + a.z + b.z;}
+template <typename F> inline static F dot(const vec3<F>& a, const vec3<F>& b) noexcept {return a.x * b.x + a.y * b.y + a.z * b.z;}
 template <typename F> inline static vec3<F> cross(const vec3<F>& a, const vec3<F>& b) noexcept {return vec3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);}
-template <typename F> inline vec3<F> floor(const vec3<F>& a) { return vec3(std::floor(a.x), std::floor(a.y), std::floor(a.z)); }
+template <typename F> inline vec3<F> floor(const vec3<F>& a) { return vec3(floor(a.x), floor(a.y), floor(a.z)); }
 template <typename F> inline vec3<F> fract(const vec3<F>& a) { return vec3(fract(a.x), fract(a.y), fract(a.z)); }
 template <typename F> inline vec3<F> trunc(const vec3<F>& a) { return vec3(trunc(a.x), trunc(a.y), trunc(a.z)); }
 template <typename F> inline F length(const vec3<F>& a) { return a.magnitude(); }
@@ -271,7 +272,7 @@ template <typename F> inline vec4<F> operator+(F lhs, vec4<F> rhs) noexcept { re
 template <typename F> inline vec4<F> operator-(F lhs, vec4<F> rhs) noexcept { return -rhs + lhs; }
 template <typename F> inline vec4<F> operator*(F lhs, vec4<F> rhs) noexcept { return rhs * lhs; }
 
-template <typename F> inline static F dot(const vec4<F>& a, const vec4<F>& b) noexcept {return a.x * b.x + a.y * b.y + a.z + b.z + a.w * b.w;}
+template <typename F> inline static F dot(const vec4<F>& a, const vec4<F>& b) noexcept {return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;}
 template <typename F> inline vec4<F> normalize(vec4<F> v) noexcept { v.normalize(); return v; }
 template <typename F> inline vec4<F> floor(const vec4<F>& a) { return vec4(floor(a.x), floor(a.y), floor(a.z), floor(a.w)); }
 template <typename F> inline vec4<F> fract(const vec4<F>& a) { return vec4(fract(a.x), fract(a.y), fract(a.z), fract(a.w)); }
@@ -280,269 +281,363 @@ template <typename F> inline F length(const vec4<F>& a) { return a.magnitude();
 
 
 
-/*
-//3x3 matrix.  Access elements using (row, col) operator
-struct mat3 {
-private:
-	double n[3][3]{};
-public:
-	mat3() = default;
-	mat3(double n00, double n01, double n02, double n10, double n11, double n12, double n20, double n21, double n22) noexcept {
-		n[0][0] = n00;  n[0][1] = n10;  n[0][2] = n20;
-		n[1][0] = n01;  n[1][1] = n11;  n[1][2] = n21;
-		n[2][0] = n02;  n[2][1] = n12;  n[2][2] = n22;
-	}
-	//Create with 3 column vectors
-	mat3(const vec3& a, const vec3& b, const vec3& c) noexcept {
-		n[0][0] = a.x;  n[0][1] = a.y;  n[0][2] = a.z;
-		n[1][0] = b.x;  n[1][1] = b.y;  n[1][2] = b.z;
-		n[2][0] = c.x;  n[2][1] = c.y;  n[2][2] = c.z;
-	}
+/**************************************************************************************************
+ * Matrix helpers.
+ * Matrices of scalars can multiply SIMD vectors.  Their elements are broadcast to every lane.
+ * ************************************************************************************************/
+namespace linear_algebra_detail {
 
-	bool operator==(const mat3& rhs) const noexcept {  
-		return
-			n[0][0] == rhs.n[0][0] && n[0][1] == rhs.n[0][1] && n[0][2] == rhs.n[0][2] &&
-			n[1][0] == rhs.n[1][0] && n[1][1] == rhs.n[1][1] && n[1][2] == rhs.n[1][2] &&
-			n[2][0] == rhs.n[2][0] && n[2][1] == rhs.n[2][1] && n[2][2] == rhs.n[2][2];
+	//A constant of type T.  (Broadcast to all lanes for SIMD types)
+	template <typename T, typename V>
+	constexpr inline T constant(V value) noexcept {
+		if constexpr (std::is_arithmetic_v<T>) return static_cast<T>(value);
+		else return T(static_cast<typename T::F>(value));
 	}
 
-	//Access element by row & column
-	inline double& operator()(int row, int col) noexcept { return (n[col][row]); }
-	inline const double& operator()  (int row, int col) const noexcept { return (n[col][row]); }
-	inline vec3& column(int col) noexcept { return *reinterpret_cast<vec3*>(n[col]); }
-
-	mat3 operator-() const noexcept {
-		const mat3& m = (*this);
-		return mat3(
-			-m(0, 0), -m(0, 1), -m(0, 2),
-			-m(1, 0), -m(1, 1), -m(1, 2),
-			-m(2, 0), -m(2, 1), -m(2, 2)
-		);
-		
-		
-	}
-	   
-	mat3& operator+=(const mat3& rhs) noexcept {
-		n[0][0] += rhs.n[0][0];  n[0][1] += rhs.n[0][1];  n[0][2] += rhs.n[0][2];
-		n[1][0] += rhs.n[1][0];  n[1][1] += rhs.n[1][1];  n[1][2] += rhs.n[1][2];
-		n[2][0] += rhs.n[2][0];  n[2][1] += rhs.n[2][1];  n[2][2] += rhs.n[2][2];
-		return *this; 
+	//A matrix element of type M, for use with vectors of type T.
+	template <typename T, typename M>
+	constexpr inline T lanes(const M& value) noexcept {
+		if constexpr (std::is_same_v<T, M>) return value;
+		else return constant<T>(value);
 	}
 
-	mat3& operator-=(const mat3& rhs) noexcept {
-		n[0][0] -= rhs.n[0][0];  n[0][1] -= rhs.n[0][1];  n[0][2] -= rhs.n[0][2];
-		n[1][0] -= rhs.n[1][0];  n[1][1] -= rhs.n[1][1];  n[1][2] -= rhs.n[1][2];
-		n[2][0] -= rhs.n[2][0];  n[2][1] -= rhs.n[2][1];  n[2][2] -= rhs.n[2][2];
-		return *this;
+	//a * b + c.  (Fused for SIMD types)
+	template <typename T>
+	constexpr inline T mul_add(const T& a, const T& b, const T& c) noexcept {
+		if constexpr (std::is_arithmetic_v<T>) return a * b + c;
+		else return fma(a, b, c);
 	}
+}
 
-	mat3& operator+=(const double rhs) noexcept {
-		n[0][0] += rhs;  n[0][1] += rhs;  n[0][2] += rhs;
-		n[1][0] += rhs;  n[1][1] += rhs;  n[1][2] += rhs;
-		n[2][0] += rhs;  n[2][1] += rhs;  n[2][2] += rhs;
-		return *this;
-	}
-	mat3& operator-=(const double rhs) noexcept {
-		n[0][0] -= rhs;  n[0][1] -= rhs;  n[0][2] -= rhs;
-		n[1][0] -= rhs;  n[1][1] -= rhs;  n[1][2] -= rhs;
-		n[2][0] -= rhs;  n[2][1] -= rhs;  n[2][2] -= rhs;
-		return *this;
+
+
+/**************************************************************************************************
+ * A 2x2 matrix.  Access elements using (row, col) operator.
+ * F is a floating point type (one matrix for all lanes) or a SIMD type (a matrix for each lane).
+ * ************************************************************************************************/
+template <typename F>
+struct mat2 {
+private:
+	F n[2][2]{};	//[col][row]
+public:
+	constexpr mat2() = default;
+	//Elements row by row
+	constexpr mat2(F n00, F n01, F n10, F n11) noexcept : n{ { n00, n10 }, { n01, n11 } } {}
+	//Create with 2 column vectors
+	constexpr mat2(const vec2<F>& a, const vec2<F>& b) noexcept : n{ { a.x, a.y }, { b.x, b.y } } {}
+	//Convert each element.  (e.g. broadcast a matrix of scalars to a SIMD type)
+	template <typename M> requires(!std::is_same_v<F, M>)
+	explicit constexpr mat2(const mat2<M>& m) noexcept {
+		for (int col = 0; col < 2; col++) for (int row = 0; row < 2; row++) n[col][row] = linear_algebra_detail::lanes<F>(m(row, col));
 	}
-	mat3& operator*=(const double rhs) noexcept {
-		n[0][0] *= rhs;  n[0][1] *= rhs;  n[0][2] *= rhs;
-		n[1][0] *= rhs;  n[1][1] *= rhs;  n[1][2] *= rhs;
-		n[2][0] *= rhs;  n[2][1] *= rhs;  n[2][2] *= rhs;
-		return *this;
+
+	static constexpr mat2 identity() noexcept {
+		const F one = linear_algebra_detail::constant<F>(1.0);
+		const F zero = linear_algebra_detail::constant<F>(0.0);
+		return mat2(one, zero, zero, one);
 	}
-	mat3& operator/=(const double rhs) noexcept {
-		n[0][0] /= rhs;  n[0][1] /= rhs;  n[0][2] /= rhs;
-		n[1][0] /= rhs;  n[1][1] /= rhs;  n[1][2] /= rhs;
-		n[2][0] /= rhs;  n[2][1] /= rhs;  n[2][2] /= rhs;
-		return *this;
+
+	//Access element by row & column
+	constexpr F& operator()(int row, int col) noexcept { return n[col][row]; }
+	constexpr const F& operator()(int row, int col) const noexcept { return n[col][row]; }
+	vec2<F> column(int col) const noexcept { return vec2<F>(n[col][0], n[col][1]); }
+	vec2<F> row(int row) const noexcept { return vec2<F>(n[0][row], n[1][row]); }
+
+	constexpr bool operator==(const mat2& rhs) const noexcept requires(std::is_arithmetic_v<F>) {
+		for (int col = 0; col < 2; col++) for (int row = 0; row < 2; row++) if (!(n[col][row] == rhs.n[col][row])) return false;
+		return true;
 	}
 
+	constexpr mat2 operator-() const noexcept { mat2 m; for (int col = 0; col < 2; col++) for (int row = 0; row < 2; row++) m.n[col][row] = -n[col][row]; return m; }
+	constexpr mat2& operator+=(const mat2& rhs) noexcept { for (int col = 0; col < 2; col++) for (int row = 0; row < 2; row++) n[col][row] += rhs.n[col][row]; return *this; }
+	constexpr mat2& operator-=(const mat2& rhs) noexcept { for (int col = 0; col < 2; col++) for (int row = 0; row < 2; row++) n[col][row] -= rhs.n[col][row]; return *this; }
+	constexpr mat2& operator*=(const F& rhs) noexcept { for (int col = 0; col < 2; col++) for (int row = 0; row < 2; row++) n[col][row] *= rhs; return *this; }
 };
-inline mat3 operator+(mat3 lhs, const mat3& rhs) noexcept { lhs += rhs;	return lhs; }
-inline mat3 operator-(mat3 lhs, const mat3& rhs) noexcept { lhs -= rhs;	return lhs; }
-
-
-inline mat3 operator+(mat3 lhs, double rhs) noexcept { lhs += rhs;	return lhs; }
-inline mat3 operator-(mat3 lhs, double rhs) noexcept { lhs -= rhs;	return lhs; }
-inline mat3 operator*(mat3 lhs, double rhs) noexcept { lhs *= rhs;	return lhs; }
-inline mat3 operator/(mat3 lhs, double rhs) noexcept { lhs /= rhs;	return lhs; }
-inline mat3 operator+(double lhs, mat3 rhs) noexcept { return rhs + lhs; }
-inline mat3 operator-(double lhs, mat3 rhs) noexcept { return -rhs + lhs; }
-inline mat3 operator*(double lhs, mat3 rhs) noexcept { return rhs * lhs; }
-
-inline mat3 operator* (const mat3& lhs, const mat3& rhs) noexcept {
-	return mat3(
-		lhs(0, 0) * rhs(0, 0) + lhs(0, 1) * rhs(1, 0) + lhs(0, 2) * rhs(2, 0),
-		lhs(0, 0) * rhs(0, 1) + lhs(0, 1) * rhs(1, 1) + lhs(0, 2) * rhs(2, 1),
-		lhs(0, 0) * rhs(0, 2) + lhs(0, 1) * rhs(1, 2) + lhs(0, 2) * rhs(2, 2),
-		lhs(1, 0) * rhs(0, 0) + lhs(1, 1) * rhs(1, 0) + lhs(1, 2) * rhs(2, 0),
-		lhs(1, 0) * rhs(0, 1) + lhs(1, 1) * rhs(1, 1) + lhs(1, 2) * rhs(2, 1),
-		lhs(1, 0) * rhs(0, 2) + lhs(1, 1) * rhs(1, 2) + lhs(1, 2) * rhs(2, 2),
-		lhs(2, 0) * rhs(0, 0) + lhs(2, 1) * rhs(1, 0) + lhs(2, 2) * rhs(2, 0),
-		lhs(2, 0) * rhs(0, 1) + lhs(2, 1) * rhs(1, 1) + lhs(2, 2) * rhs(2, 1),
-		lhs(2, 0) * rhs(0, 2) + lhs(2, 1) * rhs(1, 2) + lhs(2, 2) * rhs(2, 2)
-	);
-}
-
 
-inline vec3 operator*(const mat3& m, const vec3& v) noexcept {
-	return vec3(
-		m(0, 0) * v.x + m(0, 1) * v.y + m(0, 2) * v.z,
-		m(1, 0) * v.x + m(1, 1) * v.y + m(1, 2) * v.z,
-		m(2, 0) * v.x + m(2, 1) * v.y + m(2, 2) * v.z
-	);
-}
 
 
-//4x4 matrix.  Access elements using (row, col) operator
-struct mat4 {
+/**************************************************************************************************
+ * A 3x3 matrix.  Access elements using (row, col) operator.
+ * F is a floating point type (one matrix for all lanes) or a SIMD type (a matrix for each lane).
+ * ************************************************************************************************/
+template <typename F>
+struct mat3 {
 private:
-	double n[4][4]{};
+	F n[3][3]{};	//[col][row]
 public:
-	mat4() = default;
-	mat4(double n00, double n01, double n02, double n03, double n10, double n11, double n12, double n13, double n20, double n21, double n22, double n23, double n30, double n31, double n32, double n33) noexcept {
-		n[0][0] = n00;  n[0][1] = n10;  n[0][2] = n20; n[0][3] = n30;
-		n[1][0] = n01;  n[1][1] = n11;  n[1][2] = n21; n[1][3] = n31;
-		n[2][0] = n02;  n[2][1] = n12;  n[2][2] = n22; n[2][3] = n32;
-		n[3][0] = n03;  n[3][1] = n13;  n[3][2] = n23; n[3][3] = n33;
+	constexpr mat3() = default;
+	//Elements row by row
+	constexpr mat3(F n00, F n01, F n02, F n10, F n11, F n12, F n20, F n21, F n22) noexcept
+		: n{ { n00, n10, n20 }, { n01, n11, n21 }, { n02, n12, n22 } } {}
+	//Create with 3 column vectors
+	constexpr mat3(const vec3<F>& a, const vec3<F>& b, const vec3<F>& c) noexcept
+		: n{ { a.x, a.y, a.z }, { b.x, b.y, b.z }, { c.x, c.y, c.z } } {}
+	//Convert each element.  (e.g. broadcast a matrix of scalars to a SIMD type)
+	template <typename M> requires(!std::is_same_v<F, M>)
+	explicit constexpr mat3(const mat3<M>& m) noexcept {
+		for (int col = 0; col < 3; col++) for (int row = 0; row < 3; row++) n[col][row] = linear_algebra_detail::lanes<F>(m(row, col));
 	}
-	//Create with 4 column vectors
-	mat4(const vec4<F>& a, const vec4<F>& b, const vec4<F>& c, const vec4<F>& d) noexcept {
-		n[0][0] = a.x;  n[0][1] = a.y;  n[0][2] = a.z;  n[0][3] = a.w;
-		n[1][0] = b.x;  n[1][1] = b.y;  n[1][2] = b.z;  n[1][3] = b.w;
-		n[2][0] = c.x;  n[2][1] = c.y;  n[2][2] = c.z;  n[2][3] = c.w;
-		n[3][0] = d.x;  n[3][1] = d.y;  n[3][2] = d.z;  n[3][3] = d.w;
+
+	static constexpr mat3 identity() noexcept {
+		const F one = linear_algebra_detail::constant<F>(1.0);
+		const F zero = linear_algebra_detail::constant<F>(0.0);
+		return mat3(one, zero, zero, zero, one, zero, zero, zero, one);
 	}
 
 	//Access element by row & column
-	inline double& operator()(int row, int col) noexcept { return (n[col][row]); }
-	inline const double& operator()  (int row, int col) const noexcept { return (n[col][row]); }
-	inline vec4<F>& column(int col) noexcept { return *reinterpret_cast<vec4<F>*>(n[col]); }
-
-	bool operator==(const mat4& rhs) const noexcept {
-		return
-			n[0][0] == rhs.n[0][0] && n[0][1] == rhs.n[0][1] && n[0][2] == rhs.n[0][2] && n[0][3] == rhs.n[0][3] &&
-			n[1][0] == rhs.n[1][0] && n[1][1] == rhs.n[1][1] && n[1][2] == rhs.n[1][2] && n[1][3] == rhs.n[1][3] &&
-			n[2][0] == rhs.n[2][0] && n[2][1] == rhs.n[2][1] && n[2][2] == rhs.n[2][2] && n[2][3] == rhs.n[2][3] &&
-			n[3][0] == rhs.n[3][0] && n[3][1] == rhs.n[3][1] && n[3][2] == rhs.n[3][2] && n[3][3] == rhs.n[3][3];
+	constexpr F& operator()(int row, int col) noexcept { return n[col][row]; }
+	constexpr const F& operator()(int row, int col) const noexcept { return n[col][row]; }
+	vec3<F> column(int col) const noexcept { return vec3<F>(n[col][0], n[col][1], n[col][2]); }
+	vec3<F> row(int row) const noexcept { return vec3<F>(n[0][row], n[1][row], n[2][row]); }
+
+	constexpr bool operator==(const mat3& rhs) const noexcept requires(std::is_arithmetic_v<F>) {
+		for (int col = 0; col < 3; col++) for (int row = 0; row < 3; row++) if (!(n[col][row] == rhs.n[col][row])) return false;
+		return true;
 	}
 
-	mat4 operator-() const noexcept {
-		const mat4& m = (*this);
-		return mat4(
-			-m(0, 0), -m(0, 1), -m(0, 2), -m(0, 3),
-			-m(1, 0), -m(1, 1), -m(1, 2), -m(1, 3),
-			-m(2, 0), -m(2, 1), -m(2, 2), -m(2, 3),
-			-m(3, 0), -m(3, 1), -m(3, 2), -m(3, 3)
-		);
+	constexpr mat3 operator-() const noexcept { mat3 m; for (int col = 0; col < 3; col++) for (int row = 0; row < 3; row++) m.n[col][row] = -n[col][row]; return m; }
+	constexpr mat3& operator+=(const mat3& rhs) noexcept { for (int col = 0; col < 3; col++) for (int row = 0; row < 3; row++) n[col][row] += rhs.n[col][row]; return *this; }
+	constexpr mat3& operator-=(const mat3& rhs) noexcept { for (int col = 0; col < 3; col++) for (int row = 0; row < 3; row++) n[col][row] -= rhs.n[col][row]; return *this; }
+	constexpr mat3& operator*=(const F& rhs) noexcept { for (int col = 0; col < 3; col++) for (int row = 0; row < 3; row++) n[col][row] *= rhs; return *this; }
+};
 
-	}
 
-	mat4& operator+=(const mat4& rhs) noexcept {
-		n[0][0] += rhs.n[0][0];  n[0][1] += rhs.n[0][1];  n[0][2] += rhs.n[0][2]; n[0][3] += rhs.n[0][3];
-		n[1][0] += rhs.n[1][0];  n[1][1] += rhs.n[1][1];  n[1][2] += rhs.n[1][2]; n[1][3] += rhs.n[1][3];
-		n[2][0] += rhs.n[2][0];  n[2][1] += rhs.n[2][1];  n[2][2] += rhs.n[2][2]; n[2][3] += rhs.n[2][3];
-		n[3][0] += rhs.n[3][0];  n[3][1] += rhs.n[3][1];  n[3][2] += rhs.n[3][2]; n[3][3] += rhs.n[3][3];
-		return *this;
-	}
 
-	mat4& operator-=(const mat4& rhs) noexcept {
-		n[0][0] -= rhs.n[0][0];  n[0][1] -= rhs.n[0][1];  n[0][2] -= rhs.n[0][2]; n[0][3] -= rhs.n[0][3];
-		n[1][0] -= rhs.n[1][0];  n[1][1] -= rhs.n[1][1];  n[1][2] -= rhs.n[1][2]; n[1][3] -= rhs.n[1][3];
-		n[2][0] -= rhs.n[2][0];  n[2][1] -= rhs.n[2][1];  n[2][2] -= rhs.n[2][2]; n[2][3] -= rhs.n[2][3];
-		n[3][0] -= rhs.n[3][0];  n[3][1] -= rhs.n[3][1];  n[3][2] -= rhs.n[3][2]; n[3][3] -= rhs.n[3][3];
-		return *this;
+/**************************************************************************************************
+ * A 4x4 matrix.  Access elements using (row, col) operator.
+ * F is a floating point type (one matrix for all lanes) or a SIMD type (a matrix for each lane).
+ * ************************************************************************************************/
+template <typename F>
+struct mat4 {
+private:
+	F n[4][4]{};	//[col][row]
+public:
+	constexpr mat4() = default;
+	//Elements row by row
+	constexpr mat4(F n00, F n01, F n02, F n03, F n10, F n11, F n12, F n13, F n20, F n21, F n22, F n23, F n30, F n31, F n32, F n33) noexcept
+		: n{ { n00, n10, n20, n30 }, { n01, n11, n21, n31 }, { n02, n12, n22, n32 }, { n03, n13, n23, n33 } } {}
+	//Create with 4 column vectors
+	constexpr mat4(const vec4<F>& a, const vec4<F>& b, const vec4<F>& c, const vec4<F>& d) noexcept
+		: n{ { a.x, a.y, a.z, a.w }, { b.x, b.y, b.z, b.w }, { c.x, c.y, c.z, c.w }, { d.x, d.y, d.z, d.w } } {}
+	//Convert each element.  (e.g. broadcast a matrix of scalars to a SIMD type)
+	template <typename M> requires(!std::is_same_v<F, M>)
+	explicit constexpr mat4(const mat4<M>& m) noexcept {
+		for (int col = 0; col < 4; col++) for (int row = 0; row < 4; row++) n[col][row] = linear_algebra_detail::lanes<F>(m(row, col));
 	}
 
-	mat4& operator+=(const double rhs) noexcept {
-		n[0][0] += rhs;  n[0][1] += rhs;  n[0][2] += rhs; n[0][3] += rhs;
-		n[1][0] += rhs;  n[1][1] += rhs;  n[1][2] += rhs; n[1][3] += rhs;
-		n[2][0] += rhs;  n[2][1] += rhs;  n[2][2] += rhs; n[2][3] += rhs;
-		n[3][0] += rhs;  n[3][1] += rhs;  n[3][2] += rhs; n[3][3] += rhs;
-		return *this;
-	}
-	mat4& operator-=(const double rhs) noexcept {
-		n[0][0] -= rhs;  n[0][1] -= rhs;  n[0][2] -= rhs; n[0][3] -= rhs;
-		n[1][0] -= rhs;  n[1][1] -= rhs;  n[1][2] -= rhs; n[1][3] -= rhs;
-		n[2][0] -= rhs;  n[2][1] -= rhs;  n[2][2] -= rhs; n[2][3] -= rhs;
-		n[3][0] -= rhs;  n[3][1] -= rhs;  n[3][2] -= rhs; n[3][3] -= rhs;
-		return *this;
-	}
-	mat4& operator*=(const double rhs) noexcept {
-		n[0][0] *= rhs;  n[0][1] *= rhs;  n[0][2] *= rhs; n[0][3] *= rhs;
-		n[1][0] *= rhs;  n[1][1] *= rhs;  n[1][2] *= rhs; n[1][3] *= rhs;
-		n[2][0] *= rhs;  n[2][1] *= rhs;  n[2][2] *= rhs; n[2][3] *= rhs;
-		n[3][0] *= rhs;  n[3][1] *= rhs;  n[3][2] *= rhs; n[3][3] *= rhs;
-		return *this;
-	}
-	mat4& operator/=(const double rhs) noexcept {
-		n[0][0] /= rhs;  n[0][1] /= rhs;  n[0][2] /= rhs; n[0][3] /= rhs;
-		n[1][0] /= rhs;  n[1][1] /= rhs;  n[1][2] /= rhs; n[1][3] /= rhs;
-		n[2][0] /= rhs;  n[2][1] /= rhs;  n[2][2] /= rhs; n[2][3] /= rhs;
-		n[3][0] /= rhs;  n[3][1] /= rhs;  n[3][2] /= rhs; n[3][3] /= rhs;
-		return *this;
+	static constexpr mat4 identity() noexcept {
+		const F one = linear_algebra_detail::constant<F>(1.0);
+		const F zero = linear_algebra_detail::constant<F>(0.0);
+		return mat4(one, zero, zero, zero, zero, one, zero, zero, zero, zero, one, zero, zero, zero, zero, one);
 	}
 
+	//Access element by row & column
+	constexpr F& operator()(int row, int col) noexcept { return n[col][row]; }
+	constexpr const F& operator()(int row, int col) const noexcept { return n[col][row]; }
+	vec4<F> column(int col) const noexcept { return vec4<F>(n[col][0], n[col][1], n[col][2], n[col][3]); }
+	vec4<F> row(int row) const noexcept { return vec4<F>(n[0][row], n[1][row], n[2][row], n[3][row]); }
+
+	constexpr bool operator==(const mat4& rhs) const noexcept requires(std::is_arithmetic_v<F>) {
+		for (int col = 0; col < 4; col++) for (int row = 0; row < 4; row++) if (!(n[col][row] == rhs.n[col][row])) return false;
+		return true;
+	}
 
+	constexpr mat4 operator-() const noexcept { mat4 m; for (int col = 0; col < 4; col++) for (int row = 0; row < 4; row++) m.n[col][row] = -n[col][row]; return m; }
+	constexpr mat4& operator+=(const mat4& rhs) noexcept { for (int col = 0; col < 4; col++) for (int row = 0; row < 4; row++) n[col][row] += rhs.n[col][row]; return *this; }
+	constexpr mat4& operator-=(const mat4& rhs) noexcept { for (int col = 0; col < 4; col++) for (int row = 0; row < 4; row++) n[col][row] -= rhs.n[col][row]; return *this; }
+	constexpr mat4& operator*=(const F& rhs) noexcept { for (int col = 0; col < 4; col++) for (int row = 0; row < 4; row++) n[col][row] *= rhs; return *this; }
 };
-inline mat4 operator+(mat4 lhs, const mat4& rhs) noexcept { lhs += rhs;	return lhs; }
-inline mat4 operator-(mat4 lhs, const mat4& rhs) noexcept { lhs -= rhs;	return lhs; }
-inline mat4 operator* (const mat4& lhs, const mat4& rhs) noexcept {
-	return mat4(
-		lhs(0, 0) * rhs(0, 0) + lhs(0, 1) * rhs(1, 0) + lhs(0, 2) * rhs(2, 0) + lhs(0, 3) * rhs(3, 0),
-		lhs(0, 0) * rhs(0, 1) + lhs(0, 1) * rhs(1, 1) + lhs(0, 2) * rhs(2, 1) + lhs(0, 3) * rhs(3, 1),
-		lhs(0, 0) * rhs(0, 2) + lhs(0, 1) * rhs(1, 2) + lhs(0, 2) * rhs(2, 2) + lhs(0, 3) * rhs(3, 2),
-		lhs(0, 0) * rhs(0, 3) + lhs(0, 1) * rhs(1, 3) + lhs(0, 2) * rhs(2, 3) + lhs(0, 3) * rhs(3, 3),
-
-		lhs(1, 0) * rhs(0, 0) + lhs(1, 1) * rhs(1, 0) + lhs(1, 2) * rhs(2, 0) + lhs(1, 3) * rhs(3, 0),
-		lhs(1, 0) * rhs(0, 1) + lhs(1, 1) * rhs(1, 1) + lhs(1, 2) * rhs(2, 1) + lhs(1, 3) * rhs(3, 1),
-		lhs(1, 0) * rhs(0, 2) + lhs(1, 1) * rhs(1, 2) + lhs(1, 2) * rhs(2, 2) + lhs(1, 3) * rhs(3, 2),
-		lhs(1, 0) * rhs(0, 3) + lhs(1, 1) * rhs(1, 3) + lhs(1, 2) * rhs(2, 3) + lhs(1, 3) * rhs(3, 3),
-
-		lhs(2, 0) * rhs(0, 0) + lhs(2, 1) * rhs(1, 0) + lhs(2, 2) * rhs(2, 0) + lhs(2, 3) * rhs(3, 0),
-		lhs(2, 0) * rhs(0, 1) + lhs(2, 1) * rhs(1, 1) + lhs(2, 2) * rhs(2, 1) + lhs(2, 3) * rhs(3, 1),
-		lhs(2, 0) * rhs(0, 2) + lhs(2, 1) * rhs(1, 2) + lhs(2, 2) * rhs(2, 2) + lhs(2, 3) * rhs(3, 2),
-		lhs(2, 0) * rhs(0, 3) + lhs(2, 1) * rhs(1, 3) + lhs(2, 2) * rhs(2, 3) + lhs(2, 3) * rhs(3, 3),
-
-		lhs(3, 0) * rhs(0, 0) + lhs(3, 1) * rhs(1, 0) + lhs(3, 2) * rhs(2, 0) + lhs(3, 3) * rhs(3, 0),
-		lhs(3, 0) * rhs(0, 1) + lhs(3, 1) * rhs(1, 1) + lhs(3, 2) * rhs(2, 1) + lhs(3, 3) * rhs(3, 1),
-		lhs(3, 0) * rhs(0, 2) + lhs(3, 1) * rhs(1, 2) + lhs(3, 2) * rhs(2, 2) + lhs(3, 3) * rhs(3, 2),
-		lhs(3, 0) * rhs(0, 3) + lhs(3, 1) * rhs(1, 3) + lhs(3, 2) * rhs(2, 3) + lhs(3, 3) * rhs(3, 3)
+
+
+template <typename F> constexpr inline mat2<F> operator+(mat2<F> lhs, const mat2<F>& rhs) noexcept { lhs += rhs; return lhs; }
+template <typename F> constexpr inline mat2<F> operator-(mat2<F> lhs, const mat2<F>& rhs) noexcept { lhs -= rhs; return lhs; }
+template <typename F> constexpr inline mat2<F> operator*(mat2<F> lhs, const std::type_identity_t<F>& rhs) noexcept { lhs *= rhs; return lhs; }
+template <typename F> constexpr inline mat2<F> operator*(const std::type_identity_t<F>& lhs, mat2<F> rhs) noexcept { rhs *= lhs; return rhs; }
+template <typename F> constexpr inline mat3<F> operator+(mat3<F> lhs, const mat3<F>& rhs) noexcept { lhs += rhs; return lhs; }
+template <typename F> constexpr inline mat3<F> operator-(mat3<F> lhs, const mat3<F>& rhs) noexcept { lhs -= rhs; return lhs; }
+template <typename F> constexpr inline mat3<F> operator*(mat3<F> lhs, const std::type_identity_t<F>& rhs) noexcept { lhs *= rhs; return lhs; }
+template <typename F> constexpr inline mat3<F> operator*(const std::type_identity_t<F>& lhs, mat3<F> rhs) noexcept { rhs *= lhs; return rhs; }
+template <typename F> constexpr inline mat4<F> operator+(mat4<F> lhs, const mat4<F>& rhs) noexcept { lhs += rhs; return lhs; }
+template <typename F> constexpr inline mat4<F> operator-(mat4<F> lhs, const mat4<F>& rhs) noexcept { lhs -= rhs; return lhs; }
+template <typename F> constexpr inline mat4<F> operator*(mat4<F> lhs, const std::type_identity_t<F>& rhs) noexcept { lhs *= rhs; return lhs; }
+template <typename F> constexpr inline mat4<F> operator*(const std::type_identity_t<F>& lhs, mat4<F> rhs) noexcept { rhs *= lhs; return rhs; }
+
+
+/**************************************************************************************************
+ * Matrix * Vector.  (A sum of the columns, scaled by each element of the vector)
+ * M may be the vector's type, or a scalar (broadcast to each lane).
+ * ************************************************************************************************/
+template <typename M, typename F>
+inline vec2<F> operator*(const mat2<M>& m, const vec2<F>& v) noexcept {
+	using namespace linear_algebra_detail;
+	return vec2<F>(
+		mul_add(lanes<F>(m(0, 1)), v.y, lanes<F>(m(0, 0)) * v.x),
+		mul_add(lanes<F>(m(1, 1)), v.y, lanes<F>(m(1, 0)) * v.x)
 	);
 }
 
-inline mat4 operator+(mat4 lhs, double rhs) noexcept { lhs += rhs;	return lhs; }
-inline mat4 operator-(mat4 lhs, double rhs) noexcept { lhs -= rhs;	return lhs; }
-inline mat4 operator*(mat4 lhs, double rhs) noexcept { lhs *= rhs;	return lhs; }
-inline mat4 operator/(mat4 lhs, double rhs) noexcept { lhs /= rhs;	return lhs; }
-inline mat4 operator+(double lhs, mat4 rhs) noexcept { return rhs + lhs; }
-inline mat4 operator-(double lhs, mat4 rhs) noexcept { return -rhs + lhs; }
-inline mat4 operator*(double lhs, mat4 rhs) noexcept { return rhs * lhs; }
+template <typename M, typename F>
+inline vec3<F> operator*(const mat3<M>& m, const vec3<F>& v) noexcept {
+	using namespace linear_algebra_detail;
+	return vec3<F>(
+		mul_add(lanes<F>(m(0, 2)), v.z, mul_add(lanes<F>(m(0, 1)), v.y, lanes<F>(m(0, 0)) * v.x)),
+		mul_add(lanes<F>(m(1, 2)), v.z, mul_add(lanes<F>(m(1, 1)), v.y, lanes<F>(m(1, 0)) * v.x)),
+		mul_add(lanes<F>(m(2, 2)), v.z, mul_add(lanes<F>(m(2, 1)), v.y, lanes<F>(m(2, 0)) * v.x))
+	);
+}
 
-//Multiply a 4x4 matrix. Access elements using (row, col) operator
-inline vec4<F> operator * (const mat4& m, const vec4<F>& v) noexcept {
+template <typename M, typename F>
+inline vec4<F> operator*(const mat4<M>& m, const vec4<F>& v) noexcept {
+	using namespace linear_algebra_detail;
 	return vec4<F>(
-		m(0, 0) * v.x + m(0, 1) * v.y + m(0, 2) * v.z + m(0, 3) * v.w,
-		m(1, 0) * v.x + m(1, 1) * v.y + m(1, 2) * v.z + m(1, 3) * v.w,
-		m(2, 0) * v.x + m(2, 1) * v.y + m(2, 2) * v.z + m(2, 3) * v.w,
-		m(3, 0) * v.x + m(3, 1) * v.y + m(3, 2) * v.z + m(3, 3) * v.w
+		mul_add(lanes<F>(m(0, 3)), v.w, mul_add(lanes<F>(m(0, 2)), v.z, mul_add(lanes<F>(m(0, 1)), v.y, lanes<F>(m(0, 0)) * v.x))),
+		mul_add(lanes<F>(m(1, 3)), v.w, mul_add(lanes<F>(m(1, 2)), v.z, mul_add(lanes<F>(m(1, 1)), v.y, lanes<F>(m(1, 0)) * v.x))),
+		mul_add(lanes<F>(m(2, 3)), v.w, mul_add(lanes<F>(m(2, 2)), v.z, mul_add(lanes<F>(m(2, 1)), v.y, lanes<F>(m(2, 0)) * v.x))),
+		mul_add(lanes<F>(m(3, 3)), v.w, mul_add(lanes<F>(m(3, 2)), v.z, mul_add(lanes<F>(m(3, 1)), v.y, lanes<F>(m(3, 0)) * v.x)))
+	);
+}
+
+//A point (w = 1) transformed by a 4x4 matrix.  Discards w.
+template <typename M, typename F>
+inline vec3<F> transform_point(const mat4<M>& m, const vec3<F>& v) noexcept {
+	using namespace linear_algebra_detail;
+	return vec3<F>(
+		mul_add(lanes<F>(m(0, 2)), v.z, mul_add(lanes<F>(m(0, 1)), v.y, mul_add(lanes<F>(m(0, 0)), v.x, lanes<F>(m(0, 3))))),
+		mul_add(lanes<F>(m(1, 2)), v.z, mul_add(lanes<F>(m(1, 1)), v.y, mul_add(lanes<F>(m(1, 0)), v.x, lanes<F>(m(1, 3))))),
+		mul_add(lanes<F>(m(2, 2)), v.z, mul_add(lanes<F>(m(2, 1)), v.y, mul_add(lanes<F>(m(2, 0)), v.x, lanes<F>(m(2, 3)))))
 	);
 }
 
-//Multiply mat4 by vec3. An
-//An optimised version assuming w entry is 0, discards w in return value.
-inline vec3 operator * (const mat4& m, const vec3& v) noexcept {
-	return vec3(
-		m(0, 0) * v.x + m(0, 1) * v.y + m(0, 2) * v.z,
-		m(1, 0) * v.x + m(1, 1) * v.y + m(1, 2) * v.z,
-		m(2, 0) * v.x + m(2, 1) * v.y + m(2, 2) * v.z
+//A direction (w = 0) transformed by a 4x4 matrix.  Ignores the translation.
+template <typename M, typename F>
+inline vec3<F> transform_direction(const mat4<M>& m, const vec3<F>& v) noexcept {
+	using namespace linear_algebra_detail;
+	return vec3<F>(
+		mul_add(lanes<F>(m(0, 2)), v.z, mul_add(lanes<F>(m(0, 1)), v.y, lanes<F>(m(0, 0)) * v.x)),
+		mul_add(lanes<F>(m(1, 2)), v.z, mul_add(lanes<F>(m(1, 1)), v.y, lanes<F>(m(1, 0)) * v.x)),
+		mul_add(lanes<F>(m(2, 2)), v.z, mul_add(lanes<F>(m(2, 1)), v.y, lanes<F>(m(2, 0)) * v.x))
+	);
+}
+
+
+/**************************************************************************************************
+ * Matrix * Matrix.  (Each column of rhs transformed by lhs)
+ * ************************************************************************************************/
+template <typename F> inline mat2<F> operator*(const mat2<F>& lhs, const mat2<F>& rhs) noexcept { return mat2<F>(lhs * rhs.column(0), lhs * rhs.column(1)); }
+template <typename F> inline mat3<F> operator*(const mat3<F>& lhs, const mat3<F>& rhs) noexcept { return mat3<F>(lhs * rhs.column(0), lhs * rhs.column(1), lhs * rhs.column(2)); }
+template <typename F> inline mat4<F> operator*(const mat4<F>& lhs, const mat4<F>& rhs) noexcept { return mat4<F>(lhs * rhs.column(0), lhs * rhs.column(1), lhs * rhs.column(2), lhs * rhs.column(3)); }
+
+
+/**************************************************************************************************
+ * Transpose.  (Also the inverse of a rotation, which is much cheaper than inverse())
+ * ************************************************************************************************/
+template <typename F>
+constexpr inline mat2<F> transpose(const mat2<F>& m) noexcept {
+	return mat2<F>(m(0, 0), m(1, 0), m(0, 1), m(1, 1));
+}
+template <typename F>
+constexpr inline mat3<F> transpose(const mat3<F>& m) noexcept {
+	return mat3<F>(m(0, 0), m(1, 0), m(2, 0), m(0, 1), m(1, 1), m(2, 1), m(0, 2), m(1, 2), m(2, 2));
+}
+template <typename F>
+constexpr inline mat4<F> transpose(const mat4<F>& m) noexcept {
+	return mat4<F>(m(0, 0), m(1, 0), m(2, 0), m(3, 0), m(0, 1), m(1, 1), m(2, 1), m(3, 1), m(0, 2), m(1, 2), m(2, 2), m(3, 2), m(0, 3), m(1, 3), m(2, 3), m(3, 3));
+}
+
+
+/**************************************************************************************************
+ * Determinant
+ * ************************************************************************************************/
+template <typename F>
+constexpr inline F determinant(const mat2<F>& m) noexcept {
+	return m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+}
+template <typename F>
+constexpr inline F determinant(const mat3<F>& m) noexcept {
+	return m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1))
+		- m(0, 1) * (m(1, 0) * m(2, 2) - m(1, 2) * m(2, 0))
+		+ m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+}
+template <typename F>
+constexpr inline F determinant(const mat4<F>& m) noexcept {
+	const F s0 = m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1);
+	const F s1 = m(0, 0) * m(1, 2) - m(1, 0) * m(0, 2);
+	const F s2 = m(0, 0) * m(1, 3) - m(1, 0) * m(0, 3);
+	const F s3 = m(0, 1) * m(1, 2) - m(1, 1) * m(0, 2);
+	const F s4 = m(0, 1) * m(1, 3) - m(1, 1) * m(0, 3);
+	const F s5 = m(0, 2) * m(1, 3) - m(1, 2) * m(0, 3);
+	const F c5 = m(2, 2) * m(3, 3) - m(3, 2) * m(2, 3);
+	const F c4 = m(2, 1) * m(3, 3) - m(3, 1) * m(2, 3);
+	const F c3 = m(2, 1) * m(3, 2) - m(3, 1) * m(2, 2);
+	const F c2 = m(2, 0) * m(3, 3) - m(3, 0) * m(2, 3);
+	const F c1 = m(2, 0) * m(3, 2) - m(3, 0) * m(2, 2);
+	const F c0 = m(2, 0) * m(3, 1) - m(3, 0) * m(2, 1);
+	return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+
+/**************************************************************************************************
+ * Inverse.  The adjugate scaled by one reciprocal of the determinant.
+ * The matrix must not be singular.  (No check is made.  SIMD lanes are inverted separately)
+ * ************************************************************************************************/
+template <typename F>
+constexpr inline mat2<F> inverse(const mat2<F>& m) noexcept {
+	const F r = linear_algebra_detail::constant<F>(1.0) / determinant(m);
+	return mat2<F>(m(1, 1) * r, -m(0, 1) * r, -m(1, 0) * r, m(0, 0) * r);
+}
+
+template <typename F>
+constexpr inline mat3<F> inverse(const mat3<F>& m) noexcept {
+	//Cofactors of the first row
+	const F c00 = m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1);
+	const F c01 = m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2);
+	const F c02 = m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0);
+	const F r = linear_algebra_detail::constant<F>(1.0) / (m(0, 0) * c00 + m(0, 1) * c01 + m(0, 2) * c02);
+	return mat3<F>(
+		c00 * r, (m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2)) * r, (m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1)) * r,
+		c01 * r, (m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0)) * r, (m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2)) * r,
+		c02 * r, (m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1)) * r, (m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0)) * r
+	);
+}
+
+template <typename F>
+constexpr inline mat4<F> inverse(const mat4<F>& m) noexcept {
+	//2x2 determinants of the top two rows (s) and the bottom two rows (c)
+	const F s0 = m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1);
+	const F s1 = m(0, 0) * m(1, 2) - m(1, 0) * m(0, 2);
+	const F s2 = m(0, 0) * m(1, 3) - m(1, 0) * m(0, 3);
+	const F s3 = m(0, 1) * m(1, 2) - m(1, 1) * m(0, 2);
+	const F s4 = m(0, 1) * m(1, 3) - m(1, 1) * m(0, 3);
+	const F s5 = m(0, 2) * m(1, 3) - m(1, 2) * m(0, 3);
+	const F c5 = m(2, 2) * m(3, 3) - m(3, 2) * m(2, 3);
+	const F c4 = m(2, 1) * m(3, 3) - m(3, 1) * m(2, 3);
+	const F c3 = m(2, 1) * m(3, 2) - m(3, 1) * m(2, 2);
+	const F c2 = m(2, 0) * m(3, 3) - m(3, 0) * m(2, 3);
+	const F c1 = m(2, 0) * m(3, 2) - m(3, 0) * m(2, 2);
+	const F c0 = m(2, 0) * m(3, 1) - m(3, 0) * m(2, 1);
+	const F r = linear_algebra_detail::constant<F>(1.0) / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+	return mat4<F>(
+		(m(1, 1) * c5 - m(1, 2) * c4 + m(1, 3) * c3) * r,
+		(m(0, 2) * c4 - m(0, 1) * c5 - m(0, 3) * c3) * r,
+		(m(3, 1) * s5 - m(3, 2) * s4 + m(3, 3) * s3) * r,
+		(m(2, 2) * s4 - m(2, 1) * s5 - m(2, 3) * s3) * r,
+
+		(m(1, 2) * c2 - m(1, 0) * c5 - m(1, 3) * c1) * r,
+		(m(0, 0) * c5 - m(0, 2) * c2 + m(0, 3) * c1) * r,
+		(m(3, 2) * s2 - m(3, 0) * s5 - m(3, 3) * s1) * r,
+		(m(2, 0) * s5 - m(2, 2) * s2 + m(2, 3) * s1) * r,
+
+		(m(1, 0) * c4 - m(1, 1) * c2 + m(1, 3) * c0) * r,
+		(m(0, 1) * c2 - m(0, 0) * c4 - m(0, 3) * c0) * r,
+		(m(3, 0) * s4 - m(3, 1) * s2 + m(3, 3) * s0) * r,
+		(m(2, 1) * s2 - m(2, 0) * s4 - m(2, 3) * s0) * r,
+
+		(m(1, 1) * c1 - m(1, 0) * c3 - m(1, 2) * c0) * r,
+		(m(0, 0) * c3 - m(0, 1) * c1 + m(0, 2) * c0) * r,
+		(m(3, 1) * s1 - m(3, 0) * s3 - m(3, 2) * s0) * r,
+		(m(2, 0) * s3 - m(2, 1) * s1 + m(2, 2) * s0) * r
 	);
 }
-*/
 
 /**************************************************************************************************
  * Reflect function.  Normal must be normalised.
@@ -0,0 +1,214 @@
+/********************************************************************************************************
+
+Authors:		(c) 2023 Maths Town
+
+Licence:		The MIT License
+
+*********************************************************************************************************
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************
+
+Description:
+
+	A 1D lookup table used to bake a per-channel function (a transfer curve) and apply it with SIMD.
+
+	Uniform tables sample the function evenly over 0..domain_max.
+	 - lookup_nearest() returns the closest entry.  Exact when inputs lie on the samples (8/16-bit input).
+	 - lookup_linear() interpolates between entries.
+	 - lookup_linear_extended() also continues the first and last segments past the ends.
+
+	Logarithmic tables sample the function at a fixed number of points per octave, from 2^-16 to 2^8, plus an entry for zero.
+	The index is taken directly from the bits of the float, so no log() is required.
+	Suits curves that are applied in a log space (e.g. scene linear to display).
+	 - lookup_logarithmic() interpolates, and reports lanes that are outside the table.
+
+Types:
+
+	Lut1D		- The lookup table.
+
+*******************************************************************************************************/
+#pragma once
+
+#include "simd-concepts.h"
+
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+
+/**************************************************************************************************
+ * Load one float per element from table[index].  (index holds whole numbers)
+ * Uses the type's gather when it has one, otherwise loads each element.
+ * ************************************************************************************************/
+template <SimdFloat S>
+inline static S gather_from_table(const float* table, const S& index) noexcept {
+	if constexpr (requires { S::make_gather(table, index.truncate_to_uint()); }) {
+		return S::make_gather(table, index.truncate_to_uint());
+	}
+	else {
+		S r{};
+		for (int i = 0; i < S::number_of_elements(); i++) {
+			r.set_element(i, static_cast<typename S::F>(table[static_cast<size_t>(index.element(i))]));
+		}
+		return r;
+	}
+}
+
+
+/**************************************************************************************************
+ * Lut1D
+ * ************************************************************************************************/
+class Lut1D {
+public:
+	Lut1D() = default;
+
+	//Logarithmic table range.  (2^log_min_exponent .. 2^log_max_exponent, with 2^log_bits entries per octave)
+	static constexpr int log_min_exponent = -16;
+	static constexpr int log_max_exponent = 8;
+	static constexpr int log_bits = 10;
+
+	//Building
+	template <typename Function> static Lut1D make_uniform(Function f, int entries, float domain_max);
+	template <typename Function> static Lut1D make_logarithmic(Function f);
+
+	//Information
+	bool is_empty() const noexcept { return table.empty(); }
+	int get_size() const noexcept { return static_cast<int>(table.size()); }
+	const float* data() const noexcept { return table.data(); }
+
+	//Lookup
+	template <SimdFloat S> S lookup_nearest(S x) const noexcept;
+	template <SimdFloat S> S lookup_linear(S x) const noexcept;
+	template <SimdFloat S> S lookup_linear_extended(S x) const noexcept;
+	template <SimdFloat32 S> S lookup_logarithmic(S x, S& out_of_range) const noexcept;
+
+private:
+	static constexpr int log_mantissa_shift = 23 - log_bits;
+	static constexpr uint32_t log_first_bits = static_cast<uint32_t>(127 + log_min_exponent) << 23;
+	static constexpr uint32_t log_first_index = static_cast<uint32_t>(127 + log_min_exponent) << log_bits;
+
+	std::vector<float> table{};
+	float scale{};		//Uniform tables: (entries-1)/domain_max
+	float zero{};		//Logarithmic tables: f(0)
+
+	template <SimdFloat S> S to_index(S x) const noexcept;
+};
+
+
+/**************************************************************************************************
+ * Sample f evenly over 0..domain_max.
+ * ************************************************************************************************/
+template <typename Function>
+inline Lut1D Lut1D::make_uniform(Function f, int entries, float domain_max) {
+	Lut1D lut{};
+	lut.table.resize(entries);
+	lut.scale = static_cast<float>(entries - 1) / domain_max;
+	for (int i = 0; i < entries; i++) {
+		lut.table[i] = f(static_cast<float>(i) / lut.scale);
+	}
+	return lut;
+}
+
+
+/**************************************************************************************************
+ * Sample f at 2^log_bits points per octave between 2^log_min_exponent and 2^log_max_exponent, and at zero.
+ * Sample points are the floats with the lowest mantissa bits zero, so lookups are a shift of the bits.
+ * ************************************************************************************************/
+template <typename Function>
+inline Lut1D Lut1D::make_logarithmic(Function f) {
+	constexpr int entries = ((log_max_exponent - log_min_exponent) << log_bits) + 1;
+	Lut1D lut{};
+	lut.table.resize(entries);
+	for (int i = 0; i < entries; i++) {
+		const uint32_t bits = log_first_bits + (static_cast<uint32_t>(i) << log_mantissa_shift);
+		lut.table[i] = f(std::bit_cast<float>(bits));
+	}
+	lut.zero = f(0.0f);
+	return lut;
+}
+
+
+/**************************************************************************************************
+ * Convert x to a table position (0..size-1).  NaN is mapped to zero.
+ * ************************************************************************************************/
+template <SimdFloat S>
+inline S Lut1D::to_index(S x) const noexcept {
+	x *= scale;
+	x = blend(S(0.0f), x, compare_greater(x, S(0.0f)));
+	return min(x, S(static_cast<typename S::F>(table.size() - 1)));
+}
+
+
+/**************************************************************************************************
+ * Uniform table.  Return the closest entry.
+ * ************************************************************************************************/
+template <SimdFloat S>
+inline S Lut1D::lookup_nearest(S x) const noexcept {
+	return gather_from_table(table.data(), to_index(x + static_cast<typename S::F>(0.5f / scale)));
+}
+
+
+/**************************************************************************************************
+ * Uniform table.  Interpolate between entries.  Inputs outside the domain are clamped.
+ * ************************************************************************************************/
+template <SimdFloat S>
+inline S Lut1D::lookup_linear(S x) const noexcept {
+	const S position = to_index(x);
+	const S index = min(floor(position), S(static_cast<typename S::F>(table.size() - 2)));
+	const S t = position - index;
+	const S v0 = gather_from_table(table.data(), index);
+	const S v1 = gather_from_table(table.data() + 1, index);
+	return fma(v1 - v0, t, v0);
+}
+
+
+/**************************************************************************************************
+ * Uniform table.  Interpolate between entries.
+ * Inputs outside the domain continue along the first or last segment (rather than being clamped).
+ * ************************************************************************************************/
+template <SimdFloat S>
+inline S Lut1D::lookup_linear_extended(S x) const noexcept {
+	const S index = min(floor(to_index(x)), S(static_cast<typename S::F>(table.size() - 2)));
+	const S t = x * scale - index;
+	const S v0 = gather_from_table(table.data(), index);
+	const S v1 = gather_from_table(table.data() + 1, index);
+	return fma(v1 - v0, t, v0);
+}
+
+
+/**************************************************************************************************
+ * Logarithmic table.  Interpolate between entries.
+ * Zero has its own entry.  (It is common, e.g. black borders)
+ * Lanes that are negative, NaN, below 2^log_min_exponent (but not zero) or not less than
+ * 2^log_max_exponent are set to 1.0 in out_of_range.
+ * ************************************************************************************************/
+template <SimdFloat32 S>
+inline S Lut1D::lookup_logarithmic(S x, S& out_of_range) const noexcept {
+	typedef typename S::U U;
+	const auto last = static_cast<uint32_t>(table.size() - 1);
+
+	const U bits = max(x.bitcast_to_uint(), U(log_first_bits));
+	const U index = (bits >> log_mantissa_shift) - U(log_first_index);
+	out_of_range = blend(S(0.0f), S(1.0f), compare_greater_equal(S::make_from_int32(index), S(static_cast<float>(last))));
+	out_of_range = blend(out_of_range, S(1.0f), compare_less(x, S(std::bit_cast<float>(log_first_bits))));
+	out_of_range = blend(out_of_range, S(0.0f), compare_equal(x, S(0.0f)));
+
+	const U safe_index = min(index, U(last - 1));
+	const S t = S::make_from_int32(bits & U((1u << log_mantissa_shift) - 1)) * (1.0f / static_cast<float>(1u << log_mantissa_shift));
+	const S v0 = S::make_gather(table.data(), safe_index);
+	const S v1 = S::make_gather(table.data() + 1, safe_index);
+	return blend(fma(v1 - v0, t, v0), S(zero), compare_equal(x, S(0.0f)));
+}
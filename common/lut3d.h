@@ -0,0 +1,387 @@
+/********************************************************************************************************
+
+Authors:		(c) 2023 Maths Town
+
+Licence:		The MIT License
+
+*********************************************************************************************************
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************
+
+Description:
+
+	A 3D colour lookup table, loaded from a ".cube" file.
+
+	- The parser reads the file one line at a time, so large (65^3) tables are never held as text.
+	- Lattice points are stored as 4 floats (r,g,b,unused) with the red index changing fastest.
+	  Each point is 16 bytes, so a point never crosses a cache line, and one index finds all channels.
+	- Lookups use tetrahedral interpolation on whole SIMD vectors, using gather loads where available.
+
+Types:
+
+	Lut3D		- The lookup table.  Use apply() to transform a colour.
+
+*******************************************************************************************************/
+#pragma once
+
+#include "colour.h"
+#include "lut1d.h"
+#include "simd-concepts.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+class Lut3D {
+public:
+	Lut3D() = default;
+
+	//Loading
+	static Lut3D load_cube(std::istream& stream);
+	static Lut3D load_cube_file(const std::string& filename);
+	static std::shared_ptr<const Lut3D> load_cube_file_cached(const std::string& filename, std::string& error) noexcept;
+
+	//Information
+	int get_size() const noexcept { return size; }
+	bool is_empty() const noexcept { return size < 2; }
+	const std::string& get_title() const noexcept { return title; }
+
+	//Apply the table to a colour.  Alpha is unchanged.
+	template <SimdFloat S>
+	ColourRGBA<S> apply(const ColourRGBA<S>& c) const noexcept;
+
+private:
+	static constexpr int stride_point = 4;	//Floats per lattice point.
+
+	int size{};
+	std::string title{};
+	std::array<float, 3> domain_min{ 0.0f, 0.0f, 0.0f };
+	std::array<float, 3> domain_max{ 1.0f, 1.0f, 1.0f };
+	std::array<float, 3> input_scale{};		//(size-1) / (domain_max - domain_min)
+	std::vector<float> lattice{};			//size^3 points.  Red index changes fastest, then green, then blue.
+
+	template <SimdFloat S>
+	S lattice_coordinate(S value, int channel) const noexcept;
+
+	void check_interpolation() const;	//Debug builds only
+};
+
+
+
+/**************************************************************************************************
+ * Helpers for the .cube parser
+ * ************************************************************************************************/
+namespace lut3d_detail {
+
+	//Read up to 'count' floats from a line.  Returns the number read.
+	inline int read_floats(const char* text, float* out, int count) noexcept {
+		int n = 0;
+		char* end{};
+		while (n < count) {
+			const float f = std::strtof(text, &end);
+			if (end == text) break;
+			out[n++] = f;
+			text = end;
+		}
+		return n;
+	}
+
+	//True if line starts with the keyword (followed by whitespace)
+	inline bool starts_with_keyword(const std::string& line, const char* keyword) noexcept {
+		const auto len = std::char_traits<char>::length(keyword);
+		if (line.compare(0, len, keyword) != 0) return false;
+		return line.size() == len || line[len] == ' ' || line[len] == '\t';
+	}
+}
+
+
+/**************************************************************************************************
+ * Load a .cube file from a stream.
+ * Supports TITLE, LUT_3D_SIZE, DOMAIN_MIN, DOMAIN_MAX and LUT_3D_INPUT_RANGE.
+ * 1D tables are not supported.
+ * ************************************************************************************************/
+inline Lut3D Lut3D::load_cube(std::istream& stream) {
+	Lut3D lut{};
+	std::string line{};
+	size_t points_expected{};
+	size_t points_read{};
+	float values[3]{};
+
+	while (std::getline(stream, line)) {
+		//Strip trailing whitespace (and carriage returns from windows files)
+		while (!line.empty() && (line.back() == '\r' || line.back() == ' ' || line.back() == '\t')) line.pop_back();
+		if (line.empty() || line[0] == '#') continue;
+
+		//Data line
+		if ((line[0] >= '0' && line[0] <= '9') || line[0] == '-' || line[0] == '+' || line[0] == '.') {
+			if (points_expected == 0) throw std::runtime_error("3D LUT: Data found before LUT_3D_SIZE.");
+			if (points_read >= points_expected) throw std::runtime_error("3D LUT: Too many data lines.");
+			if (lut3d_detail::read_floats(line.c_str(), values, 3) != 3) throw std::runtime_error("3D LUT: Invalid data line.");
+			float* p = lut.lattice.data() + points_read * stride_point;
+			p[0] = values[0];
+			p[1] = values[1];
+			p[2] = values[2];
+			points_read++;
+			continue;
+		}
+
+		//Keywords
+		if (lut3d_detail::starts_with_keyword(line, "TITLE")) {
+			const auto first = line.find('"');
+			const auto last = line.rfind('"');
+			if (first != std::string::npos && last > first) lut.title = line.substr(first + 1, last - first - 1);
+		}
+		else if (lut3d_detail::starts_with_keyword(line, "LUT_3D_SIZE")) {
+			const int n = std::atoi(line.c_str() + 11);
+			if (n < 2 || n > 256) throw std::runtime_error("3D LUT: LUT_3D_SIZE must be between 2 and 256.");
+			lut.size = n;
+			points_expected = static_cast<size_t>(n) * n * n;
+			lut.lattice.assign(points_expected * stride_point, 0.0f);
+		}
+		else if (lut3d_detail::starts_with_keyword(line, "DOMAIN_MIN")) {
+			if (lut3d_detail::read_floats(line.c_str() + 10, lut.domain_min.data(), 3) != 3) throw std::runtime_error("3D LUT: Invalid DOMAIN_MIN.");
+		}
+		else if (lut3d_detail::starts_with_keyword(line, "DOMAIN_MAX")) {
+			if (lut3d_detail::read_floats(line.c_str() + 10, lut.domain_max.data(), 3) != 3) throw std::runtime_error("3D LUT: Invalid DOMAIN_MAX.");
+		}
+		else if (lut3d_detail::starts_with_keyword(line, "LUT_3D_INPUT_RANGE")) {
+			//Resolve extension.  Same range for all channels.
+			float range[2]{};
+			if (lut3d_detail::read_floats(line.c_str() + 18, range, 2) != 2) throw std::runtime_error("3D LUT: Invalid LUT_3D_INPUT_RANGE.");
+			lut.domain_min = { range[0], range[0], range[0] };
+			lut.domain_max = { range[1], range[1], range[1] };
+		}
+		else if (lut3d_detail::starts_with_keyword(line, "LUT_1D_SIZE")) {
+			throw std::runtime_error("3D LUT: 1D .cube files are not supported.");
+		}
+		//Unknown keywords are ignored, as required by the specification.
+	}
+
+	if (points_expected == 0) throw std::runtime_error("3D LUT: LUT_3D_SIZE not found.");
+	if (points_read != points_expected) throw std::runtime_error("3D LUT: Not enough data lines.");
+
+	for (int i = 0; i < 3; i++) {
+		if (!(lut.domain_max[i] > lut.domain_min[i])) throw std::runtime_error("3D LUT: DOMAIN_MAX must be greater than DOMAIN_MIN.");
+		lut.input_scale[i] = static_cast<float>(lut.size - 1) / (lut.domain_max[i] - lut.domain_min[i]);
+	}
+#ifdef _DEBUG
+	lut.check_interpolation();
+#endif
+	return lut;
+}
+
+
+/**************************************************************************************************
+ * Debug check of apply() on every lattice point and cell.
+ * Lattice points must come back unchanged.  The centre of a cell is on the diagonal that all 6
+ * tetrahedra share, so it must be the mean of the diagonal's 2 ends.
+ * ************************************************************************************************/
+inline void Lut3D::check_interpolation() const {
+	typedef FallbackFloat32 S;
+	const auto input = [&](int i, int channel, float offset) { return S(domain_min[channel] + (static_cast<float>(i) + offset) / input_scale[channel]); };
+	const auto point = [&](int r, int g, int b) { return lattice.data() + stride_point * ((static_cast<size_t>(b) * size + g) * size + r); };
+	const auto matches = [](const ColourRGBA<S>& c, const float* expected) {
+		const float found[3]{ c.red.element(0), c.green.element(0), c.blue.element(0) };
+		for (int i = 0; i < 3; i++) {
+			if (!(std::abs(found[i] - expected[i]) <= 1e-4f * std::max(1.0f, std::abs(expected[i])))) return false;
+		}
+		return true;
+	};
+	for (int b = 0; b < size; b++) {
+		for (int g = 0; g < size; g++) {
+			for (int r = 0; r < size; r++) {
+				if (!matches(apply(ColourRGBA<S>(input(r, 0, 0.0f), input(g, 1, 0.0f), input(b, 2, 0.0f))), point(r, g, b))) {
+					throw std::logic_error("3D LUT: Interpolation doesn't return the lattice points.");
+				}
+				if (r == size - 1 || g == size - 1 || b == size - 1) continue;
+				const float* near = point(r, g, b);
+				const float* far = point(r + 1, g + 1, b + 1);
+				const float centre[3]{ (near[0] + far[0]) * 0.5f, (near[1] + far[1]) * 0.5f, (near[2] + far[2]) * 0.5f };
+				if (!matches(apply(ColourRGBA<S>(input(r, 0, 0.5f), input(g, 1, 0.5f), input(b, 2, 0.5f))), centre)) {
+					throw std::logic_error("3D LUT: Interpolation at a cell centre isn't the mean of its diagonal.");
+				}
+			}
+		}
+	}
+}
+
+
+/**************************************************************************************************
+ * Load a .cube file from disk.
+ * ************************************************************************************************/
+inline Lut3D Lut3D::load_cube_file(const std::string& filename) {
+	std::ifstream file(filename);
+	if (!file) throw std::runtime_error("3D LUT: Unable to open file '" + filename + "'.");
+	return load_cube(file);
+}
+
+
+/**************************************************************************************************
+ * Load a .cube file from disk, reusing the table loaded before if the file is unchanged.
+ * Renderers are set up every frame, so this stops a sequence render re-parsing the file each frame.
+ * Tables are kept by filename, so instances using different files don't reload each other's.
+ * (Up to cache_size files.  The one used least recently is dropped to make room)
+ * Returns nullptr if the filename is empty, or if the file can't be loaded (error gives the reason).
+ * A file that failed is only tried again once it changes.
+ * ************************************************************************************************/
+inline std::shared_ptr<const Lut3D> Lut3D::load_cube_file_cached(const std::string& filename, std::string& error) noexcept {
+	error.clear();
+	if (filename.empty()) return nullptr;
+
+	struct Entry {
+		std::filesystem::file_time_type time{};
+		std::shared_ptr<const Lut3D> lut{};
+		std::string error{};
+		uint64_t last_used{};
+	};
+	constexpr size_t cache_size = 8;
+	static std::mutex cache_mutex{};
+	static std::map<std::string, Entry> cache{};
+	static uint64_t uses{};
+
+	try {
+		std::error_code time_error{};
+		const auto time = std::filesystem::last_write_time(filename, time_error);
+
+		std::lock_guard<std::mutex> lock(cache_mutex);
+		uses++;
+		const auto found = cache.find(filename);
+		if (found != cache.end() && found->second.time == time) {
+			found->second.last_used = uses;
+			error = found->second.error;
+			return found->second.lut;
+		}
+
+		if (found == cache.end() && cache.size() >= cache_size) {
+			cache.erase(std::min_element(cache.begin(), cache.end(), [](const auto& a, const auto& b) { return a.second.last_used < b.second.last_used; }));
+		}
+
+		Entry entry{ time, nullptr, {}, uses };
+		try {
+			entry.lut = std::make_shared<const Lut3D>(load_cube_file(filename));
+		}
+		catch (const std::exception& e) {
+			entry.error = e.what();
+		}
+		cache[filename] = entry;
+		error = entry.error;
+		return entry.lut;
+	}
+	catch (const std::exception& e) {
+		error = e.what();
+		return nullptr;
+	}
+}
+
+
+/**************************************************************************************************
+ * Convert a channel value to a lattice co-ordinate (0..size-1).
+ * NaN is mapped to zero so it can never produce an out of range index.
+ * ************************************************************************************************/
+template <SimdFloat S>
+inline S Lut3D::lattice_coordinate(S value, int channel) const noexcept {
+	value = (value - domain_min[channel]) * input_scale[channel];
+	value = blend(S(0.0f), value, compare_greater(value, S(0.0f)));
+	return min(value, S(static_cast<typename S::F>(size - 1)));
+}
+
+
+/**************************************************************************************************
+ * Apply the table using tetrahedral interpolation.
+ *
+ * The cell containing the colour is split into 6 tetrahedra that share the diagonal from the
+ * cell origin to the far corner.  The path along that diagonal steps first along the axis with the
+ * largest fraction, then the middle one.  The 4 vertices are weighted by the differences between
+ * the sorted fractions.  Sorting is done with min/max and blends, so there are no branches.
+ * ************************************************************************************************/
+template <SimdFloat S>
+ColourRGBA<S> Lut3D::apply(const ColourRGBA<S>& c) const noexcept {
+	if (is_empty()) return c;
+
+	typedef typename S::F F;
+	const S max_cell = S(static_cast<F>(size - 2));
+
+	//Lattice co-ordinates
+	const S r = lattice_coordinate(c.red, 0);
+	const S g = lattice_coordinate(c.green, 1);
+	const S b = lattice_coordinate(c.blue, 2);
+
+	//Cell origin (the last cell is used for values on the upper edge)
+	const S r0 = min(floor(r), max_cell);
+	const S g0 = min(floor(g), max_cell);
+	const S b0 = min(floor(b), max_cell);
+
+	//Position within the cell
+	const S fr = r - r0;
+	const S fg = g - g0;
+	const S fb = b - b0;
+
+	//Distance (in floats) between neighbouring lattice points along each axis
+	const F step_r = static_cast<F>(stride_point);
+	const F step_g = static_cast<F>(stride_point * size);
+	const F step_b = static_cast<F>(stride_point * size * size);
+	const F step_rgb = step_r + step_g + step_b;
+
+	//Sort the fractions
+	const S f_max = max(fr, max(fg, fb));
+	const S f_min = min(fr, min(fg, fb));
+	const S f_mid = fr + fg + fb - f_max - f_min;
+
+	//Step along the axis of the largest fraction, then remove the step of the smallest.
+	const S step_largest = blend(blend(S(step_b), S(step_g), compare_greater_equal(fg, fb)), S(step_r), compare_greater_equal(fr, max(fg, fb)));
+	const S step_smallest = blend(blend(S(step_r), S(step_g), compare_less_equal(fg, fr)), S(step_b), compare_less_equal(fb, min(fr, fg)));
+
+	//Vertex weights
+	const S w0 = 1.0f - f_max;
+	const S w1 = f_max - f_mid;
+	const S w2 = f_mid - f_min;
+	const S w3 = f_min;
+
+	//Vertex indexes.  Indexes go up to 4*size^3, which a float only holds exactly for sizes up to 161,
+	//so they are found with integers where the type has them.  (Doubles are exact)
+	const float* data = lattice.data();
+	ColourRGBA<S> out{};
+	const auto interpolate = [&](const auto& i0, const auto& i1, const auto& i2, const auto& i3, const auto& load) {
+		out.red = w0 * load(data, i0) + w1 * load(data, i1) + w2 * load(data, i2) + w3 * load(data, i3);
+		out.green = w0 * load(data + 1, i0) + w1 * load(data + 1, i1) + w2 * load(data + 1, i2) + w3 * load(data + 1, i3);
+		out.blue = w0 * load(data + 2, i0) + w1 * load(data + 2, i1) + w2 * load(data + 2, i2) + w3 * load(data + 2, i3);
+	};
+	if constexpr (requires { S::make_gather(data, r0.truncate_to_uint()); }) {
+		const auto i0 = b0.truncate_to_uint() * static_cast<uint32_t>(step_b) + g0.truncate_to_uint() * static_cast<uint32_t>(step_g) + r0.truncate_to_uint() * static_cast<uint32_t>(step_r);
+		const auto i1 = i0 + step_largest.truncate_to_uint();
+		const auto i3 = i0 + static_cast<uint32_t>(step_rgb);
+		const auto i2 = i3 - step_smallest.truncate_to_uint();
+		interpolate(i0, i1, i2, i3, [](const float* table, const auto& index) { return S::make_gather(table, index); });
+	}
+	else {
+		const S i0 = fma(b0, S(step_b), fma(g0, S(step_g), r0 * step_r));
+		interpolate(i0, i0 + step_largest, i0 + step_rgb - step_smallest, i0 + step_rgb, [](const float* table, const S& index) { return gather_from_table(table, index); });
+	}
+	out.alpha = c.alpha;
+	return out;
+}
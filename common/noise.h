@@ -174,8 +174,8 @@ inline S hash(const vec4<S>& coordinate, uint32_t seed ) {
 
 template <SimdFloat64 S>
 inline S hash(const S& coordinate, uint64_t seed = 1) {
-    auto seed64 = S::U64(seed);
-    seed64 ^= coordinate.x.bitcast_to_uint64();
+    auto seed64 = typename S::U64(seed);
+    seed64 ^= coordinate.bitcast_to_uint();
     auto r = split_mix_64(seed64);
     auto f = S::make_from_uints_52bits(r);
     return f / S(static_cast<double>(bits_52));
@@ -183,9 +183,9 @@ inline S hash(const S& coordinate, uint64_t seed = 1) {
 
 template <SimdFloat64 S>
 inline S hash(const vec2<S>& coordinate, uint64_t seed = 1) {
-    auto seed64 = S::U64(seed);
-    seed64 ^= coordinate.x.bitcast_to_uint64();
-    seed64 ^= rotr(coordinate.y.bitcast_to_uint64(), 32);
+    auto seed64 = typename S::U64(seed);
+    seed64 ^= coordinate.x.bitcast_to_uint();
+    seed64 ^= rotr(coordinate.y.bitcast_to_uint(), 32);
     auto r = split_mix_64(seed64);
     auto f = S::make_from_uints_52bits(r);
     return f / S(static_cast<double>(bits_52));
@@ -193,10 +193,10 @@ inline S hash(const vec2<S>& coordinate, uint64_t seed = 1) {
 
 template <SimdFloat64 S>
 inline S hash(const vec3<S>& coordinate, uint64_t seed = 1) {
-    auto seed64 = S::U64(seed);
-    seed64 ^= coordinate.x.bitcast_to_uint64();
-    seed64 ^= rotr(coordinate.y.bitcast_to_uint64(), 21);
-    seed64 ^= rotr(coordinate.z.bitcast_to_uint64(), 42);
+    auto seed64 = typename S::U64(seed);
+    seed64 ^= coordinate.x.bitcast_to_uint();
+    seed64 ^= rotr(coordinate.y.bitcast_to_uint(), 21);
+    seed64 ^= rotr(coordinate.z.bitcast_to_uint(), 42);
     auto r = split_mix_64(seed64);
     auto f = S::make_from_uints_52bits(r);
     return f / S(static_cast<double>(bits_52));
@@ -204,11 +204,11 @@ inline S hash(const vec3<S>& coordinate, uint64_t seed = 1) {
 
 template <SimdFloat64 S>
 inline S hash(const vec4<S> & coordinate, uint64_t seed = 1){
-    auto seed64 = S::U64(seed);
-    seed64 ^= coordinate.x.bitcast_to_uint64();
-    seed64 ^= rotr(coordinate.y.bitcast_to_uint64(), 16);
-    seed64 ^= rotr(coordinate.z.bitcast_to_uint64(), 32);
-    seed64 ^= rotr(coordinate.w.bitcast_to_uint64(), 48);        
+    auto seed64 = typename S::U64(seed);
+    seed64 ^= coordinate.x.bitcast_to_uint();
+    seed64 ^= rotr(coordinate.y.bitcast_to_uint(), 16);
+    seed64 ^= rotr(coordinate.z.bitcast_to_uint(), 32);
+    seed64 ^= rotr(coordinate.w.bitcast_to_uint(), 48);        
     auto r = split_mix_64(seed64);
     auto f = S::make_from_uints_52bits(r); 
     return f / S(static_cast<double>(bits_52));
@@ -31,6 +31,10 @@ Description:
 //Project Specific Includes
 #include "parameter-id.h"
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <stdexcept>
@@ -48,6 +52,7 @@ enum class ParameterType {
 	check,
 	group_start,
 	group_end,
+	file,
 	
 };
 
@@ -121,6 +126,15 @@ struct ParameterEntry {
 		p.list = list;
 		return p;
 	}
+
+	//A file name, stored in value_string.  (Hosts without a file parameter leave it empty)
+	static ParameterEntry make_file(ParameterID parameter_id, std::string parameter_name) {
+		ParameterEntry p{};
+		p.id = parameter_id;
+		p.name = parameter_name;
+		p.type = ParameterType::file;
+		return p;
+	}
 };
 
 
@@ -183,4 +197,95 @@ struct ParameterList {
 		throw(std::runtime_error("Parameter not found."));
 	}
 
+	//Hash of the values.  (FNV-1a.  Tells whether the parameters have changed between renders)
+	uint64_t hash() const noexcept {
+		uint64_t h = 0xcbf29ce484222325ull;
+		const auto add = [&h](const void* data, size_t size) {
+			const auto bytes = static_cast<const unsigned char*>(data);
+			for (size_t i = 0; i < size; i++) {
+				h ^= bytes[i];
+				h *= 0x100000001b3ull;
+			}
+		};
+		for (const auto& e : entries) {
+			add(&e.id, sizeof(e.id));
+			add(&e.value, sizeof(e.value));
+			add(&e.value_integer, sizeof(e.value_integer));
+			add(e.value_string.data(), e.value_string.size());
+			add("", 1);
+		}
+		return h;
+	}
+
+};
+
+
+/*********************************************************************************************************
+A flat snapshot of a parameter list, made once per frame (after the host has read the values).
+Renderers read from this rather than the list, so there is no search or string compare per pixel.
+Indexed by ParameterID.  Numbers are kept as double and pre-cast to F (the renderer's float type).
+Lists hold the index of the selected item (-1 if the value is not in the list).
+Fixed size with no heap allocation, so it is cheap to copy and safe to share between threads.
+*********************************************************************************************************/
+template <typename F>
+struct ParameterSnapshot {
+	static constexpr int size = parameter_id_to_int(ParameterID::__last);
+
+	std::array<double, size> values{};
+	std::array<F, size> values_f{};
+	std::array<int, size> integers{};		//value_integer, or the list index for list parameters
+	std::array<bool, size> present{};
+
+	//Make from a parameter list
+	static ParameterSnapshot make(const ParameterList& list) {
+		ParameterSnapshot s{};
+		for (const auto& e : list.entries) {
+			const int i = parameter_id_to_int(e.id);
+			if (i < 0 || i >= size) continue;
+			s.present[i] = true;
+			s.values[i] = e.value;
+			s.values_f[i] = static_cast<F>(e.value);
+			s.integers[i] = e.value_integer;
+			if (e.type == ParameterType::list) {
+				s.integers[i] = -1;
+				for (size_t j = 0; j < e.list.size(); j++) {
+					if (e.list[j] == e.value_string) { s.integers[i] = static_cast<int>(j); break; }
+				}
+			}
+		}
+#ifdef _DEBUG
+		s.check(list);
+#endif
+		return s;
+	}
+
+	//Debug check that every entry reads back the same as from the list.  (e.g. Catches an ID used twice)
+	void check(const ParameterList& list) const {
+		for (const auto& e : list.entries) {
+			const int i = parameter_id_to_int(e.id);
+			if (i < 0 || i >= size) throw std::logic_error("Parameter snapshot: ID out of range.");
+			const double value = list.get_value(e.id);
+			int integer = list.get_value_integer(e.id);
+			if (e.type == ParameterType::list) {
+				const auto found = std::find(e.list.begin(), e.list.end(), list.get_string(e.id));
+				integer = (found != e.list.end()) ? static_cast<int>(found - e.list.begin()) : -1;
+			}
+			if (!present[i] || values[i] != value || values_f[i] != static_cast<F>(value) || integers[i] != integer) throw std::logic_error("Parameter snapshot: '" + e.name + "' doesn't match the parameter list.");
+		}
+	}
+
+	bool contains(ParameterID id) const noexcept { return present[parameter_id_to_int(id)]; }
+
+	//Get a value (as a double float)
+	double get_value(ParameterID id) const noexcept { return values[parameter_id_to_int(id)]; }
+
+	//Get a value (as the renderer's float type)
+	F get_value_f(ParameterID id) const noexcept { return values_f[parameter_id_to_int(id)]; }
+
+	//Get a value (as an integer)
+	int get_value_integer(ParameterID id) const noexcept { return integers[parameter_id_to_int(id)]; }
+
+	//Get the selected item of a list, as an enum with the items in list order.  (-1 if not in the list)
+	template <typename E>
+	E get_list(ParameterID id) const noexcept { return static_cast<E>(integers[parameter_id_to_int(id)]); }
 };
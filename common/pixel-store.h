@@ -0,0 +1,166 @@
+/********************************************************************************************************
+
+Authors:		(c) 2023 Maths Town
+
+Licence:		The MIT License
+
+*********************************************************************************************************
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************
+
+Description:
+
+	Helpers used by hosts to move pixels between interleaved frame buffers and SIMD colours.
+
+	- store_pixels_float() writes a SIMD vector's worth of pixels as interleaved 32-bit floats.
+	  Groups of 4 pixels are transposed in registers and written with 16 byte stores.  (Float64
+	  vectors are narrowed to floats 4 at a time first)
+	  Optionally uses non-temporal (streaming) stores, which bypass the cache.  Use these when the
+	  frame is larger than the last level cache, as the output would only push the input out of the
+	  cache before it is read.  Call streaming_store_fence() when a thread is finished storing.
+	- prefetch_pixels() asks for memory that will be needed soon (e.g. the next line of input).
+	- use_streaming_stores() decides if a frame is large enough to benefit.
+
+	x86_64 only (used by the After Effects and OpenFX hosts).
+
+*******************************************************************************************************/
+#pragma once
+
+#include "colour.h"
+#include "simd-concepts.h"
+#include "simd-cpuid.h"
+#include "simd-f32.h"
+#include "simd-f64.h"
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+
+//Order of channels in memory
+enum class PixelOrder {
+	rgba,	//OpenFX
+	argb,	//After Effects
+};
+
+
+namespace pixel_store_detail {
+
+	//Elements 4q .. 4q+3 of a vector
+	inline __m128 quarter(const Simd128Float32& v, int) noexcept { return v.v; }
+	inline __m128 quarter(const Simd256Float32& v, int q) noexcept {
+		return (q == 0) ? _mm256_castps256_ps128(v.v) : _mm256_extractf128_ps(v.v, 1);
+	}
+	inline __m128 quarter(const Simd512Float32& v, int q) noexcept {
+		switch (q) {
+		case 0: return _mm512_castps512_ps128(v.v);
+		case 1: return _mm512_extractf32x4_ps(v.v, 1);
+		case 2: return _mm512_extractf32x4_ps(v.v, 2);
+		default: return _mm512_extractf32x4_ps(v.v, 3);
+		}
+	}
+	inline __m128 quarter(const Simd256Float64& v, int) noexcept { return _mm256_cvtpd_ps(v.v); }
+	inline __m128 quarter(const Simd512Float64& v, int q) noexcept {
+		const __m256 f = _mm512_cvtpd_ps(v.v);
+		return (q == 0) ? _mm256_castps256_ps128(f) : _mm256_extractf128_ps(f, 1);
+	}
+
+	//Transpose 4 channels of 4 pixels and store them interleaved.  (dest must be 16 byte aligned if streaming)
+	inline void store4(float* dest, __m128 c0, __m128 c1, __m128 c2, __m128 c3, bool streaming) noexcept {
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+		if (streaming) {
+			_mm_stream_ps(dest, c0);
+			_mm_stream_ps(dest + 4, c1);
+			_mm_stream_ps(dest + 8, c2);
+			_mm_stream_ps(dest + 12, c3);
+		}
+		else {
+			_mm_storeu_ps(dest, c0);
+			_mm_storeu_ps(dest + 4, c1);
+			_mm_storeu_ps(dest + 8, c2);
+			_mm_storeu_ps(dest + 12, c3);
+		}
+	}
+}
+
+
+/**************************************************************************************************
+ * Store a SIMD vector's worth of pixels as interleaved 32-bit floats (4 channels).
+ * Streaming stores are only used with a 16 byte aligned destination.
+ * ************************************************************************************************/
+template <PixelOrder order, SimdFloat S>
+inline void store_pixels_float(float* dest, const ColourRGBA<S>& c, bool streaming = false) noexcept {
+	constexpr int n = S::number_of_elements();
+	if constexpr (n >= 4) {
+		streaming = streaming && (reinterpret_cast<uintptr_t>(dest) & 15) == 0;
+		for (int q = 0; q < n / 4; q++) {
+			const auto r = pixel_store_detail::quarter(c.red, q);
+			const auto g = pixel_store_detail::quarter(c.green, q);
+			const auto b = pixel_store_detail::quarter(c.blue, q);
+			const auto a = pixel_store_detail::quarter(c.alpha, q);
+			if constexpr (order == PixelOrder::rgba) pixel_store_detail::store4(dest + q * 16, r, g, b, a, streaming);
+			else pixel_store_detail::store4(dest + q * 16, a, r, g, b, streaming);
+		}
+		return;
+	}
+	for (int i = 0; i < n; i++) {
+		float* p = dest + i * 4;
+		if constexpr (order == PixelOrder::rgba) {
+			p[0] = static_cast<float>(c.red.element(i));
+			p[1] = static_cast<float>(c.green.element(i));
+			p[2] = static_cast<float>(c.blue.element(i));
+			p[3] = static_cast<float>(c.alpha.element(i));
+		}
+		else {
+			p[0] = static_cast<float>(c.alpha.element(i));
+			p[1] = static_cast<float>(c.red.element(i));
+			p[2] = static_cast<float>(c.green.element(i));
+			p[3] = static_cast<float>(c.blue.element(i));
+		}
+	}
+}
+
+
+/**************************************************************************************************
+ * Make streaming stores from this thread visible to other threads.
+ * ************************************************************************************************/
+inline void streaming_store_fence() noexcept {
+	_mm_sfence();
+}
+
+
+/**************************************************************************************************
+ * Prefetch a range of memory into the level 2 cache (one request per 64 byte cache line).
+ * ************************************************************************************************/
+inline void prefetch_pixels(const void* address, size_t bytes) noexcept {
+	const auto p = static_cast<const char*>(address);
+	for (size_t offset = 0; offset < bytes; offset += 64) {
+		_mm_prefetch(p + offset, _MM_HINT_T1);
+	}
+}
+
+
+/**************************************************************************************************
+ * True if a frame (input + output) won't fit in the last level cache.
+ * The cache size is read once.  If it can't be found, assumes 32MB.
+ * ************************************************************************************************/
+inline bool use_streaming_stores(size_t frame_bytes) noexcept {
+	static const size_t cache_size = [] {
+		const auto size = CpuInformation().last_level_cache_size();
+		return (size > 0) ? size : size_t{ 32 * 1024 * 1024 };
+	}();
+	return frame_bytes > cache_size;
+}
@@ -0,0 +1,119 @@
+/********************************************************************************************************
+
+Authors:		(c) 2023 Maths Town
+
+Licence:		The MIT License
+
+*********************************************************************************************************
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************
+
+Description:
+
+	Quality tiers.  Previews at a lower resolution, or while the user is dragging a slider, don't need
+	every octave or march step of the final render.
+
+	Hosts pass the render's downsample factor (2 for half resolution) and whether it is a draft to
+		void set_preview(double downsample, bool draft);
+	before set_parameters().  Each step down in tier does less work per pixel as well as there being
+	fewer pixels, so a half resolution preview is more than 4 times quicker.  The project's "Quality"
+	parameter can choose a tier rather than leaving it automatic.
+
+	What a tier changes is up to the renderer (octaves, warp depth, march steps).  All tiers cap the
+	anti-aliasing samples, as edges in a preview are smaller and move as the user drags.
+
+	The automatic tier only depends on the frame's size (through the downsample) and the parameters,
+	except for the draft step.  Renderers that draft with a DraftPattern (checkerboard.h) leave the draft
+	step out, so a draft can still be completed at full quality.
+
+Types:
+
+	QualityTier		- Full, high, medium or low.
+
+Functions:
+
+	automatic_quality_tier()	- The tier for a downsample factor, and whether it is a draft.
+	choose_quality_tier()		- The tier for an item of quality_tier_names.  (Or the automatic tier)
+	quality_steps()				- Steps down from full quality.  (0 to 3)
+	quality_max_samples()		- Most anti-aliasing samples for a tier.
+
+*******************************************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <array>
+
+
+//Quality tiers, from the final render down.
+enum class QualityTier {
+	full,
+	high,
+	medium,
+	low,
+};
+
+//Items for the project's parameter list.  (Automatic, then the tiers in order)
+inline constexpr std::array<const char*, 5> quality_tier_names{
+	"Automatic",
+	"Full",
+	"High",
+	"Medium",
+	"Low",
+};
+
+
+/**************************************************************************************************
+ * The automatic tier.  One step down for each halving of the resolution, and one for drafts.
+ * (Downsample is the larger of the x & y factors.  1 at full resolution)
+ * ************************************************************************************************/
+inline constexpr QualityTier automatic_quality_tier(double downsample, bool draft) noexcept {
+	int steps = draft ? 1 : 0;
+	for (double d = downsample; d > 1.5 && steps < 3; d *= 0.5) steps++;
+	return static_cast<QualityTier>(std::min(steps, 3));
+}
+
+
+/**************************************************************************************************
+ * The tier for an item of quality_tier_names.  (Automatic, or an index not in the list, gives 'automatic')
+ * ************************************************************************************************/
+inline constexpr QualityTier choose_quality_tier(int list_index, QualityTier automatic) noexcept {
+	return (list_index >= 1 && list_index < static_cast<int>(quality_tier_names.size())) ? static_cast<QualityTier>(list_index - 1) : automatic;
+}
+
+
+//Steps down from full quality.  (0 to 3)
+inline constexpr int quality_steps(QualityTier tier) noexcept { return static_cast<int>(tier); }
+
+
+//Most anti-aliasing samples for a tier.  (Including the first)
+inline constexpr int quality_max_samples(QualityTier tier) noexcept {
+	constexpr std::array<int, 4> samples{ 16, 8, 4, 1 };
+	return samples[std::clamp(quality_steps(tier), 0, 3)];
+}
+
+
+//Checks of the tier mapping.  (At compile time)
+static_assert(automatic_quality_tier(1.0, false) == QualityTier::full && automatic_quality_tier(1.25, false) == QualityTier::full);
+static_assert(automatic_quality_tier(0.5, false) == QualityTier::full, "Upsampled renders are at full quality");
+static_assert(automatic_quality_tier(2.0, false) == QualityTier::high && automatic_quality_tier(4.0, false) == QualityTier::medium);
+static_assert(automatic_quality_tier(8.0, false) == QualityTier::low && automatic_quality_tier(64.0, false) == QualityTier::low);
+static_assert(automatic_quality_tier(1.0, true) == QualityTier::high && automatic_quality_tier(2.0, true) == QualityTier::medium);
+static_assert(automatic_quality_tier(4.0, true) == QualityTier::low && automatic_quality_tier(64.0, true) == QualityTier::low);
+static_assert(quality_tier_names.size() == 5 && choose_quality_tier(0, QualityTier::medium) == QualityTier::medium);
+static_assert(choose_quality_tier(1, QualityTier::low) == QualityTier::full && choose_quality_tier(4, QualityTier::full) == QualityTier::low);
+static_assert(choose_quality_tier(-1, QualityTier::high) == QualityTier::high && choose_quality_tier(5, QualityTier::high) == QualityTier::high);
+static_assert(quality_max_samples(QualityTier::full) == 16 && quality_max_samples(QualityTier::low) == 1);
+static_assert(quality_max_samples(QualityTier::high) <= quality_max_samples(QualityTier::full) && quality_max_samples(QualityTier::medium) <= quality_max_samples(QualityTier::high));
@@ -0,0 +1,212 @@
+/********************************************************************************************************
+
+Authors:		(c) 2023 Maths Town
+
+Licence:		The MIT License
+
+*********************************************************************************************************
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************
+
+Description:
+
+	A rectangle of rendered pixels, kept in planar (structure of arrays) scratch buffers.
+
+	Renderers that have render_block(x, y, w, h, out) fill one of these a block at a time.  Checks,
+	frame constants and the choice of kernel are done once per block rather than once per vector,
+	and the pixel positions are stepped along each row instead of being rebuilt for every vector.
+	Hosts keep a block per thread (so the buffers are reused) and copy it to their own pixel format.
+
+	render_block() (the free function) uses the renderer's render_block() if it has one, otherwise it
+	calls render_pixel() for each vector.  (Debug builds check a renderer's own render_block() against
+	render_pixel() on the first and last vectors of each block)  Renderers that declare
+		static constexpr PacketLayout packet_layout = PacketLayout::quads;
+	are given quads (see simd-quad.h) instead of runs along a row.  set_quad() swizzles each quad into
+	the rows, so hosts copy the block the same way for either layout.
+
+	Each row is a whole number of vectors, so the last vector of a row can go past the block.  Those
+	pixels are rendered but hosts don't copy them.
+
+	Renderers with antialias_settings() have samples added along edges once the block is rendered.
+	(See antialiasing.h)
+
+Types:
+
+	BlockOutput<S>	- Red, green, blue & alpha planes for one block.
+	PacketLayout	- The shape of the pixels in a vector given to render_pixel().
+
+*******************************************************************************************************/
+#pragma once
+
+#include "antialiasing.h"
+#include "colour.h"
+#include "simd-concepts.h"
+#include "simd-quad.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+//The shape of the pixels in a vector given to render_pixel()
+enum class PacketLayout {
+	rows,		//A run along a row. (make_sequential())
+	quads,		//A quad.  (make_quad_x() and make_quad_y())
+};
+
+
+/**************************************************************************************************
+ * Planar output for a block.  Vector i of row j covers pixels x + i * S::number_of_elements() ..
+ * (one vector's worth) on line y + j.
+ * ************************************************************************************************/
+template <SimdFloat S>
+struct BlockOutput {
+	int x{};
+	int y{};
+	int width{};
+	int height{};
+	int vectors_per_row{};
+	std::vector<S> red{};
+	std::vector<S> green{};
+	std::vector<S> blue{};
+	std::vector<S> alpha{};
+
+	//Set the rectangle.  (Memory from earlier blocks is reused)
+	void resize(int block_x, int block_y, int block_width, int block_height) {
+		x = block_x;
+		y = block_y;
+		width = std::max(block_width, 0);
+		height = std::max(block_height, 0);
+		vectors_per_row = (width + S::number_of_elements() - 1) / S::number_of_elements();
+		const size_t size = static_cast<size_t>(vectors_per_row) * height;
+		if (red.size() < size) {
+			red.resize(size);
+			green.resize(size);
+			blue.resize(size);
+			alpha.resize(size);
+		}
+	}
+
+	void set(int i, int j, const ColourRGBA<S>& c) noexcept {
+		const size_t index = static_cast<size_t>(j) * vectors_per_row + i;
+		red[index] = c.red;
+		green[index] = c.green;
+		blue[index] = c.blue;
+		alpha[index] = c.alpha;
+	}
+
+	ColourRGBA<S> get(int i, int j) const noexcept {
+		const size_t index = static_cast<size_t>(j) * vectors_per_row + i;
+		return ColourRGBA<S>(red[index], green[index], blue[index], alpha[index]);
+	}
+
+	//Quads.  Quad i of quad row j covers pixels x + i * QuadShape<S>::width, y + j * QuadShape<S>::height (one
+	//quad's worth).  The lanes are moved to their rows.  (Rows past the block are dropped)
+	int quads_per_row() const noexcept { return (width + QuadShape<S>::width - 1) / QuadShape<S>::width; }
+	int quad_rows() const noexcept { return (height + QuadShape<S>::height - 1) / QuadShape<S>::height; }
+
+	void set_quad(int i, int j, const ColourRGBA<S>& c) noexcept {
+		constexpr int n = S::number_of_elements();
+		constexpr int qw = QuadShape<S>::width;
+		const int column = i * qw;
+		for (int r = 0; r < QuadShape<S>::height; r++) {
+			const int row = j * QuadShape<S>::height + r;
+			if (row >= height) break;
+			const size_t index = static_cast<size_t>(row) * vectors_per_row + column / n;
+			for (int k = 0; k < qw; k++) {
+				const int lane = column % n + k;
+				red[index].set_element(lane, c.red.element(r * qw + k));
+				green[index].set_element(lane, c.green.element(r * qw + k));
+				blue[index].set_element(lane, c.blue.element(r * qw + k));
+				alpha[index].set_element(lane, c.alpha.element(r * qw + k));
+			}
+		}
+	}
+
+	//Set every pixel to one colour
+	void fill(const ColourRGBA<S>& c) noexcept {
+		for (int j = 0; j < height; j++) {
+			for (int i = 0; i < vectors_per_row; i++) set(i, j, c);
+		}
+	}
+};
+
+
+/**************************************************************************************************
+ * Debug check of a block from a renderer's own render_block(), or completed from a draft.  The first
+ * and last vectors of the block must be the same as render_pixel() gives for them.  (Before anti-aliasing.  Lanes past the block are skipped)
+ * ************************************************************************************************/
+template <typename R, SimdFloat S>
+void check_block(const R& renderer, const BlockOutput<S>& out) {
+	typedef typename S::F F;
+	constexpr int n = S::number_of_elements();
+	if (out.width <= 0 || out.height <= 0) return;
+	const auto same = [](F a, F b) { return a == b || (a != a && b != b); };
+	for (const auto [i, j] : { std::pair<int, int>(0, 0), std::pair<int, int>(out.vectors_per_row - 1, out.height - 1) }) {
+		const ColourRGBA<S> expected = renderer.render_pixel(S::make_sequential(static_cast<F>(out.x + i * n)), S(static_cast<F>(out.y + j)));
+		const ColourRGBA<S> found = out.get(i, j);
+		for (int k = 0; k < std::min(n, out.width - i * n); k++) {
+			if (!same(found.red.element(k), expected.red.element(k)) || !same(found.green.element(k), expected.green.element(k)) ||
+				!same(found.blue.element(k), expected.blue.element(k)) || !same(found.alpha.element(k), expected.alpha.element(k))) {
+				throw std::logic_error("render_block: The block doesn't match render_pixel().");
+			}
+		}
+	}
+}
+
+
+/**************************************************************************************************
+ * Render a block with the renderer's render_block(), or a vector at a time with render_pixel().
+ * (A quad at a time if the renderer's packet_layout is PacketLayout::quads)
+ * Then adds samples along edges, if the renderer has antialias_settings().
+ * ************************************************************************************************/
+template <typename R, SimdFloat S>
+void render_block(const R& renderer, int x, int y, int w, int h, BlockOutput<S>& out) {
+	if constexpr (requires { renderer.render_block(x, y, w, h, out); }) {
+		renderer.render_block(x, y, w, h, out);
+#ifdef _DEBUG
+		check_block(renderer, out);
+#endif
+	}
+	else if constexpr (requires { requires R::packet_layout == PacketLayout::quads; }) {
+		typedef typename S::F F;
+		out.resize(x, y, w, h);
+		for (int j = 0; j < out.quad_rows(); j++) {
+			const S py = make_quad_y<S>(static_cast<F>(y + j * QuadShape<S>::height));
+			for (int i = 0; i < out.quads_per_row(); i++) {
+				out.set_quad(i, j, renderer.render_pixel(make_quad_x<S>(static_cast<F>(x + i * QuadShape<S>::width)), py));
+			}
+		}
+	}
+	else {
+		typedef typename S::F F;
+		out.resize(x, y, w, h);
+		const S step{ static_cast<F>(S::number_of_elements()) };
+		for (int j = 0; j < out.height; j++) {
+			const S py{ static_cast<F>(y + j) };
+			S px = S::make_sequential(static_cast<F>(x));
+			for (int i = 0; i < out.vectors_per_row; i++, px += step) {
+				out.set(i, j, renderer.render_pixel(px, py));
+			}
+		}
+	}
+
+	//Extra samples along edges
+	if constexpr (requires { renderer.antialias_settings(); }) {
+		antialias_block(renderer, out, renderer.antialias_settings());
+	}
+}
@@ -0,0 +1,256 @@
+/********************************************************************************************************
+
+Authors:		(c) 2023 Maths Town
+
+Licence:		The MIT License
+
+*********************************************************************************************************
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************
+
+Description:
+
+	Keeps SIMD lanes busy in iterative renderers, where each pixel takes a different number of steps.
+
+	Rendering a fixed run of pixels per vector keeps going until the slowest lane finishes, with the
+	other lanes idle.  Instead, each lane holds the state of one pixel (its ray) and as lanes finish
+	they are handed the next rays from a queue.  The vector keeps stepping with busy lanes.
+
+	Rays are started a whole vector at a time, and the ones worth marching are packed onto the end
+	of a LaneQueue (one array per field of the ray's state).  Idle lanes take rays from the front.
+	Packing is a compress, and filling idle lanes is an expand: compress/expand on AVX-512, and
+	permute tables indexed by the mask on AVX2.  As a ray is already started when it is taken,
+	idle lanes can be refilled as soon as they finish.
+
+	Results of finished lanes are packed into arrays with compress_lanes(), so a later pass can work
+	on whole vectors of them.  scatter_lanes() writes values back to arrays indexed by item.
+
+	Only the lanes of the outer loop are kept busy.  A loop inside each step (e.g. the escape-time
+	iterations of a distance estimator) still runs until its slowest lane finishes, so the time saved
+	is less than the idle lanes removed.
+
+Types:
+
+	LaneQueue<S, fields>	- Queue of items (each with fields values) waiting for a lane of S.
+
+Functions:
+
+	lane_bits()			- A compare mask (of any SIMD type) as one bit per lane.
+	compress_lanes()	- Store the masked lanes of a vector next to each other.
+	expand_lanes()		- Load consecutive values into the masked lanes of a vector.
+	scatter_lanes()		- Store the masked lanes of a vector at base[item].
+	load_lanes()		- Load a vector from consecutive floats.
+
+*******************************************************************************************************/
+#pragma once
+
+#include "simd-concepts.h"
+#include "simd-f32.h"
+#include "simd-f64.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+
+/**************************************************************************************************
+ * A compare mask as one bit per lane.  (Lane 0 is the lowest bit)
+ * ************************************************************************************************/
+inline int lane_bits(bool mask) noexcept { return mask ? 1 : 0; }
+#if defined(_M_X64) || defined(__x86_64)
+inline int lane_bits(__mmask8 mask) noexcept { return static_cast<int>(mask); }
+inline int lane_bits(__mmask16 mask) noexcept { return static_cast<int>(mask); }
+inline int lane_bits(__m128 mask) noexcept { return _mm_movemask_ps(mask); }
+inline int lane_bits(__m128d mask) noexcept { return _mm_movemask_pd(mask); }
+inline int lane_bits(__m256 mask) noexcept { return _mm256_movemask_ps(mask); }
+inline int lane_bits(__m256d mask) noexcept { return _mm256_movemask_pd(mask); }
+#endif
+
+
+namespace simd_compaction_detail {
+
+	//For each 8 bit mask, the number of set bits below each lane.  (-1 for lanes not set)
+	struct LaneRanks {
+		alignas(32) int32_t rank[256][8];
+	};
+	constexpr LaneRanks make_lane_ranks() noexcept {
+		LaneRanks r{};
+		for (int mask = 0; mask < 256; mask++) {
+			int set = 0;
+			for (int i = 0; i < 8; i++) r.rank[mask][i] = ((mask >> i) & 1) ? set++ : -1;
+		}
+		return r;
+	}
+	inline constexpr LaneRanks lane_ranks = make_lane_ranks();
+
+	//For each 8 bit mask, the lanes that are set, in order.  (Then 0 for the rest)
+	struct LaneOrder {
+		alignas(32) int32_t lane[256][8];
+	};
+	constexpr LaneOrder make_lane_order() noexcept {
+		LaneOrder r{};
+		for (int mask = 0; mask < 256; mask++) {
+			int set = 0;
+			for (int i = 0; i < 8; i++) if ((mask >> i) & 1) r.lane[mask][set++] = i;
+		}
+		return r;
+	}
+	inline constexpr LaneOrder lane_order = make_lane_order();
+}
+
+
+/**************************************************************************************************
+ * base[items[i]] = values[i] for each lane i set in mask.
+ * ************************************************************************************************/
+template <SimdFloat S, typename Mask>
+inline void scatter_lanes(typename S::F* base, const S& items, Mask mask, const S& values) noexcept {
+#if defined(_M_X64) || defined(__x86_64)
+	if constexpr (std::is_same_v<S, Simd512Float32>) {
+		_mm512_mask_i32scatter_ps(base, static_cast<__mmask16>(lane_bits(mask)), _mm512_cvttps_epi32(items.v), values.v, sizeof(float));
+		return;
+	}
+	if constexpr (std::is_same_v<S, Simd512Float64>) {
+		_mm512_mask_i32scatter_pd(base, static_cast<__mmask8>(lane_bits(mask)), _mm512_cvttpd_epi32(items.v), values.v, sizeof(double));
+		return;
+	}
+#endif
+	for (int bits = lane_bits(mask); bits != 0; bits &= bits - 1) {
+		const int i = std::countr_zero(static_cast<unsigned>(bits));
+		base[static_cast<int>(items.element(i))] = values.element(i);
+	}
+}
+
+
+/**************************************************************************************************
+ * Store the lanes set in mask at base[0], base[1], ... in lane order.  Returns how many were stored.
+ * base must have room for a whole vector.  (Entries past those stored may be overwritten)
+ * ************************************************************************************************/
+template <SimdFloat S, typename Mask>
+inline int compress_lanes(typename S::F* base, Mask mask, const S& values) noexcept {
+	const int bits = lane_bits(mask);
+#if defined(_M_X64) || defined(__x86_64)
+	if constexpr (std::is_same_v<S, Simd512Float32>) {
+		_mm512_mask_compressstoreu_ps(base, static_cast<__mmask16>(bits), values.v);
+		return std::popcount(static_cast<unsigned>(bits));
+	}
+	if constexpr (std::is_same_v<S, Simd512Float64>) {
+		_mm512_mask_compressstoreu_pd(base, static_cast<__mmask8>(bits), values.v);
+		return std::popcount(static_cast<unsigned>(bits));
+	}
+	if constexpr (std::is_same_v<S, Simd256Float32>) {
+		const __m256i order = _mm256_load_si256(reinterpret_cast<const __m256i*>(simd_compaction_detail::lane_order.lane[bits]));
+		_mm256_storeu_ps(base, _mm256_permutevar8x32_ps(values.v, order));
+		return std::popcount(static_cast<unsigned>(bits));
+	}
+#endif
+	int stored = 0;
+	for (int remaining = bits; remaining != 0; remaining &= remaining - 1) {
+		base[stored++] = values.element(std::countr_zero(static_cast<unsigned>(remaining)));
+	}
+	return stored;
+}
+
+
+/**************************************************************************************************
+ * Load base[0], base[1], ... into the lanes set in bits, in lane order.  Other lanes keep values.
+ * (The opposite of compress_lanes)  base must have room for a whole vector.
+ * ************************************************************************************************/
+template <SimdFloat S>
+inline S expand_lanes(const typename S::F* base, int bits, const S& values) noexcept {
+#if defined(_M_X64) || defined(__x86_64)
+	if constexpr (std::is_same_v<S, Simd512Float32>) {
+		return Simd512Float32(_mm512_mask_expandloadu_ps(values.v, static_cast<__mmask16>(bits), base));
+	}
+	if constexpr (std::is_same_v<S, Simd512Float64>) {
+		return Simd512Float64(_mm512_mask_expandloadu_pd(values.v, static_cast<__mmask8>(bits), base));
+	}
+	if constexpr (std::is_same_v<S, Simd256Float32>) {
+		//Lanes not set have a rank of -1, so the sign bit keeps their value
+		const __m256i rank = _mm256_load_si256(reinterpret_cast<const __m256i*>(simd_compaction_detail::lane_ranks.rank[bits]));
+		const __m256 loaded = _mm256_permutevar8x32_ps(_mm256_loadu_ps(base), rank);
+		return Simd256Float32(_mm256_blendv_ps(loaded, values.v, _mm256_castsi256_ps(rank)));
+	}
+#endif
+	S r = values;
+	int loaded = 0;
+	for (int remaining = bits; remaining != 0; remaining &= remaining - 1) {
+		r.set_element(std::countr_zero(static_cast<unsigned>(remaining)), base[loaded++]);
+	}
+	return r;
+}
+
+
+/**************************************************************************************************
+ * Items waiting for a lane, each with fields values.  (e.g. a ray's pixel, direction and start)
+ * The values are packed in an array for each field.  push() adds the masked lanes of a vector to
+ * the end.  pop() fills idle lanes from the front.
+ * Push while fewer than a vector of items are waiting, so there are at most 2 vectors of them.
+ * ************************************************************************************************/
+template <SimdFloat S, int fields>
+class LaneQueue {
+	typedef typename S::F F;
+	static constexpr int lanes = S::number_of_elements();
+	static constexpr int capacity = 3 * lanes;		//2 vectors of items, with room for a whole vector past them
+	static_assert(lanes <= 16);
+
+public:
+	int size() const noexcept { return count; }
+	bool empty() const noexcept { return count == 0; }
+
+	//Add the lanes set in mask (a compare mask of S) to the end.
+	template <typename Mask>
+	void push(Mask mask, const std::array<S, fields>& values) noexcept {
+		if (first > 0) {
+			for (auto& field : data) std::copy_n(field.begin() + first, count, field.begin());
+			first = 0;
+		}
+		int added = 0;
+		for (int f = 0; f < fields; f++) added = compress_lanes(data[f].data() + count, mask, values[f]);
+		count += added;
+	}
+
+	//Fill the lanes set in idle (lane bits) from the front, in lane order.  Other lanes keep their values.
+	//Returns the lanes filled.  (Fewer than idle once the queue runs out)
+	int pop(int idle, std::array<S, fields>& values) noexcept {
+		int bits = idle & ((1 << lanes) - 1);
+		while (std::popcount(static_cast<unsigned>(bits)) > count) bits &= ~(1 << (std::bit_width(static_cast<unsigned>(bits)) - 1));
+		if (bits == 0) return 0;
+
+		for (int f = 0; f < fields; f++) values[f] = expand_lanes(data[f].data() + first, bits, values[f]);
+		const int taken = std::popcount(static_cast<unsigned>(bits));
+		first += taken;
+		count -= taken;
+		return bits;
+	}
+
+private:
+	std::array<std::array<F, capacity>, fields> data{};
+	int first{};
+	int count{};
+};
+
+
+/**************************************************************************************************
+ * Load a vector from base[0..number_of_elements-1].
+ * ************************************************************************************************/
+template <SimdFloat S>
+inline S load_lanes(const typename S::F* base) noexcept {
+	S r{};
+	for (int i = 0; i < S::number_of_elements(); i++) r.set_element(i, base[i]);
+	return r;
+}
@@ -43,7 +43,9 @@ This is x86_64 only.
 
 #include <stdint.h>
 #include <intrin.h>
+#include <algorithm>
 #include <bitset>
+#include <cstring>
 #include <string>
 
 #include "environment.h"
@@ -167,6 +169,94 @@ public:
 
 
 
+	/**************************************************************************************************
+	* Size of the largest cache (in bytes).  Returns 0 if it can't be found.
+	* Uses the deterministic cache parameters (function 4), then AMD's extended function 0x80000006.
+	* (Performs CPUIDs on each call)
+	* ************************************************************************************************/
+	size_t last_level_cache_size() const noexcept {
+		int data[4];
+		size_t largest = 0;
+
+		__cpuid(data, 0);
+		if (data[0] >= 4) {
+			for (int i = 0; i < 16; i++) {
+				__cpuidex(data, 4, i);
+				if ((data[0] & 0x1f) == 0) break;		//No more caches
+				const auto ebx = static_cast<uint32_t>(data[1]);
+				const size_t ways = ((ebx >> 22) & 0x3ff) + 1;
+				const size_t partitions = ((ebx >> 12) & 0x3ff) + 1;
+				const size_t line_size = (ebx & 0xfff) + 1;
+				const size_t sets = static_cast<size_t>(static_cast<uint32_t>(data[2])) + 1;
+				largest = std::max(largest, ways * partitions * line_size * sets);
+			}
+		}
+		if (largest == 0) {
+			__cpuid(data, static_cast<int>(0x80000000));
+			if (static_cast<uint32_t>(data[0]) >= 0x80000006) {
+				__cpuid(data, static_cast<int>(0x80000006));
+				const size_t l2 = (static_cast<uint32_t>(data[2]) >> 16) * size_t{ 1024 };
+				const size_t l3 = (static_cast<uint32_t>(data[3]) >> 18) * size_t{ 512 * 1024 };
+				largest = std::max(l2, l3);
+			}
+		}
+		return largest;
+	}
+
+
+	/**************************************************************************************************
+	* Size of the level 2 cache (in bytes).  Returns 0 if it can't be found.
+	* Uses the deterministic cache parameters (function 4), then AMD's extended function 0x80000006.
+	* (Performs CPUIDs on each call)
+	* ************************************************************************************************/
+	size_t level_2_cache_size() const noexcept {
+		int data[4];
+
+		__cpuid(data, 0);
+		if (data[0] >= 4) {
+			for (int i = 0; i < 16; i++) {
+				__cpuidex(data, 4, i);
+				const int type = data[0] & 0x1f;
+				if (type == 0) break;							//No more caches
+				if (type == 2 || ((data[0] >> 5) & 0x7) != 2) continue;	//Level 2, data or unified
+				const auto ebx = static_cast<uint32_t>(data[1]);
+				const size_t ways = ((ebx >> 22) & 0x3ff) + 1;
+				const size_t partitions = ((ebx >> 12) & 0x3ff) + 1;
+				const size_t line_size = (ebx & 0xfff) + 1;
+				const size_t sets = static_cast<size_t>(static_cast<uint32_t>(data[2])) + 1;
+				return ways * partitions * line_size * sets;
+			}
+		}
+		__cpuid(data, static_cast<int>(0x80000000));
+		if (static_cast<uint32_t>(data[0]) >= 0x80000006) {
+			__cpuid(data, static_cast<int>(0x80000006));
+			return (static_cast<uint32_t>(data[2]) >> 16) * size_t{ 1024 };
+		}
+		return 0;
+	}
+
+
+	/**************************************************************************************************
+	* The processor's name (brand string), e.g. "Intel(R) Xeon(R) Gold 6248 CPU @ 2.50GHz".
+	* Returns an empty string if it can't be found.
+	* ************************************************************************************************/
+	std::string brand_string() const {
+		int data[4];
+		__cpuid(data, static_cast<int>(0x80000000));
+		if (static_cast<uint32_t>(data[0]) < 0x80000004) return {};
+
+		char name[49]{};
+		for (int i = 0; i < 3; i++) {
+			__cpuid(data, static_cast<int>(0x80000002 + i));
+			std::memcpy(name + i * 16, data, 16);
+		}
+		std::string s(name);
+		const auto first = s.find_first_not_of(' ');
+		const auto last = s.find_last_not_of(' ');
+		return (first == std::string::npos) ? std::string{} : s.substr(first, last - first + 1);
+	}
+
+
 	//Returns a multiline string to show user their supported features.
 	std::string to_string(){
 		std::string s{};
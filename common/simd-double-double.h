@@ -0,0 +1,237 @@
+/********************************************************************************************************
+
+Authors:		(c) 2023 Maths Town
+
+Licence:		The MIT License
+
+*********************************************************************************************************
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************
+
+Description:
+
+	Double-double arithmetic on SIMD types.
+
+	Each element is stored as an unevaluated sum hi + lo, where |lo| <= half an ulp of hi.
+	With double elements this gives about 106 bits of precision (~32 decimal digits).
+	Built from error-free transforms (two_sum, and two_prod using FMA), so it is exact on any
+	SimdFloat type that has a true fused multiply add.
+
+	Provides the arithmetic operators, sqrt, min/max, blend and comparisons (on hi).  It does not
+	implement the Simd concept (an element is a pair of values) and has no transcendental functions.
+
+	Roughly 10-20x the cost of the underlying type, so only use it where the extra precision is needed.
+
+Types:
+
+	DoubleDouble<S>		- A SIMD vector of double-double values.
+
+*******************************************************************************************************/
+#pragma once
+
+#include "simd-concepts.h"
+
+
+
+/**************************************************************************************************
+ * Error free transforms.  Return a + b (or a * b) as the rounded result and the rounding error.
+ * (Inputs are copies, so the outputs may be the same variables)
+ * ************************************************************************************************/
+namespace double_double_detail {
+
+	//s + e == a + b exactly
+	template <SimdFloat S>
+	inline void two_sum(const S a, const S b, S& s, S& e) noexcept {
+		s = a + b;
+		const S bb = s - a;
+		e = (a - (s - bb)) + (b - bb);
+	}
+
+	//s + e == a + b exactly.  (Requires |a| >= |b|)
+	template <SimdFloat S>
+	inline void quick_two_sum(const S a, const S b, S& s, S& e) noexcept {
+		s = a + b;
+		e = b - (s - a);
+	}
+
+	//p + e == a * b exactly.  (Requires FMA)
+	template <SimdFloat S>
+	inline void two_prod(const S& a, const S& b, S& p, S& e) noexcept {
+		p = a * b;
+		e = fms(a, b, p);
+	}
+}
+
+
+
+/**************************************************************************************************
+ * DoubleDouble
+ * ************************************************************************************************/
+template <SimdFloat S>
+struct DoubleDouble {
+	typedef typename S::F F;
+
+	S hi{};
+	S lo{};
+
+	//*****Constructors*****
+	DoubleDouble() = default;
+	DoubleDouble(const S& value) noexcept : hi(value), lo(static_cast<F>(0.0)) {}
+	DoubleDouble(F value) noexcept : hi(value), lo(static_cast<F>(0.0)) {}
+	DoubleDouble(const S& high, const S& low) noexcept : hi(high), lo(low) {}
+
+	//*****Elements*****
+	static constexpr int number_of_elements() { return S::number_of_elements(); }
+
+	//Round to the underlying type
+	S round() const noexcept { return hi; }
+
+	//*****Operators*****
+	DoubleDouble operator-() const noexcept { return DoubleDouble(-hi, -lo); }
+
+	DoubleDouble& operator+=(const DoubleDouble& rhs) noexcept {
+		using namespace double_double_detail;
+		S s, e, t, f;
+		two_sum(hi, rhs.hi, s, e);
+		two_sum(lo, rhs.lo, t, f);
+		e += t;
+		quick_two_sum(s, e, s, e);
+		e += f;
+		quick_two_sum(s, e, hi, lo);
+		return *this;
+	}
+	DoubleDouble& operator+=(const S& rhs) noexcept {
+		using namespace double_double_detail;
+		S s, e;
+		two_sum(hi, rhs, s, e);
+		e += lo;
+		quick_two_sum(s, e, hi, lo);
+		return *this;
+	}
+
+	DoubleDouble& operator-=(const DoubleDouble& rhs) noexcept { return *this += -rhs; }
+	DoubleDouble& operator-=(const S& rhs) noexcept { return *this += -rhs; }
+
+	DoubleDouble& operator*=(const DoubleDouble& rhs) noexcept {
+		using namespace double_double_detail;
+		S p, e;
+		two_prod(hi, rhs.hi, p, e);
+		e = fma(hi, rhs.lo, e);
+		e = fma(lo, rhs.hi, e);
+		quick_two_sum(p, e, hi, lo);
+		return *this;
+	}
+	DoubleDouble& operator*=(const S& rhs) noexcept {
+		using namespace double_double_detail;
+		S p, e;
+		two_prod(hi, rhs, p, e);
+		e = fma(lo, rhs, e);
+		quick_two_sum(p, e, hi, lo);
+		return *this;
+	}
+
+	//Long division.  Three quotient terms, each from the remainder of the last.
+	DoubleDouble& operator/=(const DoubleDouble& rhs) noexcept {
+		using namespace double_double_detail;
+		const S q1 = hi / rhs.hi;
+		DoubleDouble r = *this - rhs * q1;
+		const S q2 = r.hi / rhs.hi;
+		r -= rhs * q2;
+		const S q3 = r.hi / rhs.hi;
+		quick_two_sum(q1, q2, hi, lo);
+		return *this += q3;
+	}
+	DoubleDouble& operator/=(const S& rhs) noexcept { return *this /= DoubleDouble(rhs); }
+
+	friend DoubleDouble operator+(DoubleDouble lhs, const DoubleDouble& rhs) noexcept { lhs += rhs; return lhs; }
+	friend DoubleDouble operator+(DoubleDouble lhs, const S& rhs) noexcept { lhs += rhs; return lhs; }
+	friend DoubleDouble operator+(const S& lhs, DoubleDouble rhs) noexcept { rhs += lhs; return rhs; }
+	friend DoubleDouble operator+(DoubleDouble lhs, F rhs) noexcept { lhs += S(rhs); return lhs; }
+	friend DoubleDouble operator-(DoubleDouble lhs, const DoubleDouble& rhs) noexcept { lhs -= rhs; return lhs; }
+	friend DoubleDouble operator-(DoubleDouble lhs, const S& rhs) noexcept { lhs -= rhs; return lhs; }
+	friend DoubleDouble operator-(const S& lhs, const DoubleDouble& rhs) noexcept { return -rhs + lhs; }
+	friend DoubleDouble operator-(DoubleDouble lhs, F rhs) noexcept { lhs -= S(rhs); return lhs; }
+	friend DoubleDouble operator*(DoubleDouble lhs, const DoubleDouble& rhs) noexcept { lhs *= rhs; return lhs; }
+	friend DoubleDouble operator*(DoubleDouble lhs, const S& rhs) noexcept { lhs *= rhs; return lhs; }
+	friend DoubleDouble operator*(const S& lhs, DoubleDouble rhs) noexcept { rhs *= lhs; return rhs; }
+	friend DoubleDouble operator*(DoubleDouble lhs, F rhs) noexcept { lhs *= S(rhs); return lhs; }
+	friend DoubleDouble operator/(DoubleDouble lhs, const DoubleDouble& rhs) noexcept { lhs /= rhs; return lhs; }
+	friend DoubleDouble operator/(DoubleDouble lhs, const S& rhs) noexcept { lhs /= rhs; return lhs; }
+};
+
+
+/**************************************************************************************************
+ * Functions
+ * ************************************************************************************************/
+
+//a * b + c  (Not fused.  Each step is rounded to double-double)
+template <SimdFloat S>
+[[nodiscard("Value calculated and not used (fma)")]]
+inline DoubleDouble<S> fma(const DoubleDouble<S>& a, const DoubleDouble<S>& b, const DoubleDouble<S>& c) noexcept {
+	return a * b + c;
+}
+
+//Square root.  One Newton step from the square root of hi.  (sqrt(0) is 0)
+template <SimdFloat S>
+[[nodiscard("Value calculated and not used (sqrt)")]]
+inline DoubleDouble<S> sqrt(const DoubleDouble<S>& a) noexcept {
+	using namespace double_double_detail;
+	typedef typename S::F F;
+	const S x = sqrt(a.hi);
+	S p, e;
+	two_prod(x, x, p, e);
+	const DoubleDouble<S> residual = a - DoubleDouble<S>(p, e);
+	const S safe_x = blend(x, S(static_cast<F>(1.0)), compare_equal(x, S(static_cast<F>(0.0))));
+	const S correction = blend(residual.hi / (safe_x + safe_x), S(static_cast<F>(0.0)), compare_equal(x, S(static_cast<F>(0.0))));
+	DoubleDouble<S> r;
+	quick_two_sum(x, correction, r.hi, r.lo);
+	return r;
+}
+
+//Select per element.  (The mask comes from the underlying type's compare functions)
+template <SimdFloat S, typename Mask>
+[[nodiscard("Value calculated and not used (blend)")]]
+inline DoubleDouble<S> blend(const DoubleDouble<S>& if_false, const DoubleDouble<S>& if_true, Mask mask) noexcept {
+	return DoubleDouble<S>(blend(if_false.hi, if_true.hi, mask), blend(if_false.lo, if_true.lo, mask));
+}
+
+//Comparisons.  The sign of the difference decides.
+template <SimdFloat S>
+[[nodiscard("Value calculated and not used (compare_less)")]]
+inline auto compare_less(const DoubleDouble<S>& a, const DoubleDouble<S>& b) noexcept {
+	const auto d = a - b;
+	return compare_less(d.hi, S(static_cast<typename S::F>(0.0)));
+}
+template <SimdFloat S>
+[[nodiscard("Value calculated and not used (compare_greater)")]]
+inline auto compare_greater(const DoubleDouble<S>& a, const DoubleDouble<S>& b) noexcept {
+	const auto d = a - b;
+	return compare_greater(d.hi, S(static_cast<typename S::F>(0.0)));
+}
+
+template <SimdFloat S>
+[[nodiscard("Value calculated and not used (min)")]]
+inline DoubleDouble<S> min(const DoubleDouble<S>& a, const DoubleDouble<S>& b) noexcept { return blend(a, b, compare_less(b, a)); }
+
+template <SimdFloat S>
+[[nodiscard("Value calculated and not used (max)")]]
+inline DoubleDouble<S> max(const DoubleDouble<S>& a, const DoubleDouble<S>& b) noexcept { return blend(a, b, compare_greater(b, a)); }
+
+template <SimdFloat S>
+[[nodiscard("Value calculated and not used (abs)")]]
+inline DoubleDouble<S> abs(const DoubleDouble<S>& a) noexcept {
+	return blend(a, -a, compare_less(a.hi, S(static_cast<typename S::F>(0.0))));
+}
@@ -0,0 +1,411 @@
+/********************************************************************************************************
+
+Authors:		(c) 2023 Maths Town
+
+Licence:		The MIT License
+
+*********************************************************************************************************
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************
+
+Description:
+
+	Forward mode automatic differentiation on SIMD types.
+
+	A dual number carries a value and its derivatives with respect to N inputs.  Each operation
+	applies the chain rule, so evaluating a function once on dual numbers gives its value and
+	gradient at the same time, exact to rounding.  (Rather than estimating it by evaluating
+	the function again at nearby points)
+
+	Set up the inputs with variable() (or variables() for a point), evaluate as usual, and read the
+	value and derivatives from the result.  Works in vec2/3/4, e.g. vec3<Dual3<S>>.
+
+	Provides the arithmetic operators, sqrt, cbrt, exp, log, pow, the trig and hyperbolic functions,
+	hypot, min/max/clamp, floor etc, blend and comparisons (on the value).  Like DoubleDouble<S>, it
+	does not implement the Simd concept.
+
+	Each operation costs about N + 1 times the underlying type (more for division and the
+	transcendental functions, which also need a derivative), so it pays where a finite difference
+	gradient would need N + 1 or more evaluations.  Functions with a kink (abs, min, max, floor)
+	use the derivative of the side they take.
+
+Types:
+
+	DualNumber<S, N>	- Value and N derivatives.
+	Dual<S>				- One derivative.
+	Dual3<S>			- Three derivatives (a gradient in 3D).
+
+*******************************************************************************************************/
+#pragma once
+
+#include "simd-concepts.h"
+#include "linear-algebra.h"
+
+#include <numbers>
+#include <utility>
+
+
+namespace dual_detail {
+	//fn(0) ... fn(N - 1), written out.  (So the derivatives stay in registers, even where the compiler wouldn't unroll a loop)
+	template <int N, typename Fn>
+	inline void unroll(Fn&& fn) noexcept {
+		[&]<int... I>(std::integer_sequence<int, I...>) { (fn(I), ...); }(std::make_integer_sequence<int, N>{});
+	}
+}
+
+
+/**************************************************************************************************
+ * DualNumber
+ * ************************************************************************************************/
+template <SimdFloat S, int N>
+struct DualNumber {
+	static_assert(N >= 1);
+	typedef typename S::F F;
+
+	S v{};		//Value
+	S d[N]{};	//Derivatives
+
+	//*****Constructors*****
+	DualNumber() = default;
+	DualNumber(const S& value) noexcept : v(value) {}
+	DualNumber(F value) noexcept : v(value) {}
+
+	//An input.  (The derivative with respect to input 'index' is 1)
+	static DualNumber variable(const S& value, int index = 0) noexcept {
+		DualNumber r(value);
+		r.d[index] = S(static_cast<F>(1.0f));
+		return r;
+	}
+
+	//*****Elements*****
+	static constexpr int number_of_elements() { return S::number_of_elements(); }
+	static constexpr int number_of_derivatives() { return N; }
+
+	//Value and derivatives
+	S value() const noexcept { return v; }
+	S derivative(int index = 0) const noexcept { return d[index]; }
+	vec3<S> gradient() const noexcept requires(N == 3) { return vec3<S>(d[0], d[1], d[2]); }
+
+	//*****Operators*****
+	DualNumber operator-() const noexcept {
+		DualNumber r(-v);
+		dual_detail::unroll<N>([&](int i) { r.d[i] = -d[i]; });
+		return r;
+	}
+
+	DualNumber& operator+=(const DualNumber& rhs) noexcept {
+		v += rhs.v;
+		dual_detail::unroll<N>([&](int i) { d[i] += rhs.d[i]; });
+		return *this;
+	}
+	DualNumber& operator+=(const S& rhs) noexcept { v += rhs; return *this; }
+
+	DualNumber& operator-=(const DualNumber& rhs) noexcept {
+		v -= rhs.v;
+		dual_detail::unroll<N>([&](int i) { d[i] -= rhs.d[i]; });
+		return *this;
+	}
+	DualNumber& operator-=(const S& rhs) noexcept { v -= rhs; return *this; }
+
+	//(uv)' = u'v + uv'
+	DualNumber& operator*=(const DualNumber& rhs) noexcept {
+		dual_detail::unroll<N>([&](int i) { d[i] = fma(d[i], rhs.v, v * rhs.d[i]); });
+		v *= rhs.v;
+		return *this;
+	}
+	DualNumber& operator*=(const S& rhs) noexcept {
+		v *= rhs;
+		dual_detail::unroll<N>([&](int i) { d[i] *= rhs; });
+		return *this;
+	}
+
+	//(u/v)' = (u' - (u/v)v') / v
+	DualNumber& operator/=(const DualNumber& rhs) noexcept {
+		const S inverse = S(static_cast<F>(1.0f)) / rhs.v;
+		v *= inverse;
+		dual_detail::unroll<N>([&](int i) { d[i] = (d[i] - v * rhs.d[i]) * inverse; });
+		return *this;
+	}
+	DualNumber& operator/=(const S& rhs) noexcept { return *this *= S(static_cast<F>(1.0f)) / rhs; }
+
+	friend DualNumber operator+(DualNumber lhs, const DualNumber& rhs) noexcept { lhs += rhs; return lhs; }
+	friend DualNumber operator+(DualNumber lhs, const S& rhs) noexcept { lhs += rhs; return lhs; }
+	friend DualNumber operator+(const S& lhs, DualNumber rhs) noexcept { rhs += lhs; return rhs; }
+	friend DualNumber operator+(DualNumber lhs, F rhs) noexcept { lhs += S(rhs); return lhs; }
+	friend DualNumber operator-(DualNumber lhs, const DualNumber& rhs) noexcept { lhs -= rhs; return lhs; }
+	friend DualNumber operator-(DualNumber lhs, const S& rhs) noexcept { lhs -= rhs; return lhs; }
+	friend DualNumber operator-(const S& lhs, const DualNumber& rhs) noexcept { return -rhs + lhs; }
+	friend DualNumber operator-(DualNumber lhs, F rhs) noexcept { lhs -= S(rhs); return lhs; }
+	friend DualNumber operator*(DualNumber lhs, const DualNumber& rhs) noexcept { lhs *= rhs; return lhs; }
+	friend DualNumber operator*(DualNumber lhs, const S& rhs) noexcept { lhs *= rhs; return lhs; }
+	friend DualNumber operator*(const S& lhs, DualNumber rhs) noexcept { rhs *= lhs; return rhs; }
+	friend DualNumber operator*(DualNumber lhs, F rhs) noexcept { lhs *= S(rhs); return lhs; }
+	friend DualNumber operator/(DualNumber lhs, const DualNumber& rhs) noexcept { lhs /= rhs; return lhs; }
+	friend DualNumber operator/(DualNumber lhs, const S& rhs) noexcept { lhs /= rhs; return lhs; }
+	friend DualNumber operator/(const S& lhs, const DualNumber& rhs) noexcept { return DualNumber(lhs) / rhs; }
+	friend DualNumber operator/(DualNumber lhs, F rhs) noexcept { lhs /= S(rhs); return lhs; }
+};
+
+template <SimdFloat S> using Dual = DualNumber<S, 1>;
+template <SimdFloat S> using Dual3 = DualNumber<S, 3>;
+
+
+/**************************************************************************************************
+ * The inputs for a point, so functions of it return their gradient.
+ * ************************************************************************************************/
+template <SimdFloat S>
+inline vec3<Dual3<S>> variables(const vec3<S>& p) noexcept {
+	return vec3<Dual3<S>>(Dual3<S>::variable(p.x, 0), Dual3<S>::variable(p.y, 1), Dual3<S>::variable(p.z, 2));
+}
+
+
+namespace dual_detail {
+	//f(a), given f(a.v) and f'(a.v)
+	template <SimdFloat S, int N>
+	inline DualNumber<S, N> chain(const DualNumber<S, N>& a, const S& value, const S& slope) noexcept {
+		DualNumber<S, N> r(value);
+		dual_detail::unroll<N>([&](int i) { r.d[i] = a.d[i] * slope; });
+		return r;
+	}
+}
+
+
+/**************************************************************************************************
+ * Functions
+ * ************************************************************************************************/
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (fma)")]]
+inline DualNumber<S, N> fma(const DualNumber<S, N>& a, const DualNumber<S, N>& b, const DualNumber<S, N>& c) noexcept {
+	DualNumber<S, N> r(fma(a.v, b.v, c.v));
+	dual_detail::unroll<N>([&](int i) { r.d[i] = fma(a.d[i], b.v, fma(a.v, b.d[i], c.d[i])); });
+	return r;
+}
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (sqrt)")]]
+inline DualNumber<S, N> sqrt(const DualNumber<S, N>& a) noexcept {
+	typedef typename S::F F;
+	const S root = sqrt(a.v);
+	return dual_detail::chain(a, root, S(static_cast<F>(0.5f)) / root);
+}
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (cbrt)")]]
+inline DualNumber<S, N> cbrt(const DualNumber<S, N>& a) noexcept {
+	typedef typename S::F F;
+	const S root = cbrt(a.v);
+	return dual_detail::chain(a, root, S(static_cast<F>(1.0f / 3.0f)) / (root * root));
+}
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (exp)")]]
+inline DualNumber<S, N> exp(const DualNumber<S, N>& a) noexcept {
+	const S e = exp(a.v);
+	return dual_detail::chain(a, e, e);
+}
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (exp2)")]]
+inline DualNumber<S, N> exp2(const DualNumber<S, N>& a) noexcept {
+	typedef typename S::F F;
+	const S e = exp2(a.v);
+	return dual_detail::chain(a, e, e * static_cast<F>(std::numbers::ln2));
+}
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (log)")]]
+inline DualNumber<S, N> log(const DualNumber<S, N>& a) noexcept {
+	typedef typename S::F F;
+	return dual_detail::chain(a, log(a.v), S(static_cast<F>(1.0f)) / a.v);
+}
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (log2)")]]
+inline DualNumber<S, N> log2(const DualNumber<S, N>& a) noexcept {
+	typedef typename S::F F;
+	return dual_detail::chain(a, log2(a.v), S(static_cast<F>(std::numbers::log2e)) / a.v);
+}
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (log10)")]]
+inline DualNumber<S, N> log10(const DualNumber<S, N>& a) noexcept {
+	typedef typename S::F F;
+	return dual_detail::chain(a, log10(a.v), S(static_cast<F>(std::numbers::log10e)) / a.v);
+}
+
+//a^b for a constant exponent
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (pow)")]]
+inline DualNumber<S, N> pow(const DualNumber<S, N>& a, const S& b) noexcept {
+	typedef typename S::F F;
+	const S p = pow(a.v, b - static_cast<F>(1.0f));
+	return dual_detail::chain(a, p * a.v, p * b);
+}
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (pow)")]]
+inline DualNumber<S, N> pow(const DualNumber<S, N>& a, typename S::F b) noexcept { return pow(a, S(b)); }
+
+//a^b = exp(b log a).  (a > 0)
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (pow)")]]
+inline DualNumber<S, N> pow(const DualNumber<S, N>& a, const DualNumber<S, N>& b) noexcept {
+	const S p = pow(a.v, b.v);
+	const S log_a = log(a.v);
+	const S slope = p * b.v / a.v;
+	DualNumber<S, N> r(p);
+	dual_detail::unroll<N>([&](int i) { r.d[i] = fma(a.d[i], slope, p * log_a * b.d[i]); });
+	return r;
+}
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (sin)")]]
+inline DualNumber<S, N> sin(const DualNumber<S, N>& a) noexcept { return dual_detail::chain(a, sin(a.v), cos(a.v)); }
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (cos)")]]
+inline DualNumber<S, N> cos(const DualNumber<S, N>& a) noexcept { return dual_detail::chain(a, cos(a.v), -sin(a.v)); }
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (tan)")]]
+inline DualNumber<S, N> tan(const DualNumber<S, N>& a) noexcept {
+	typedef typename S::F F;
+	const S t = tan(a.v);
+	return dual_detail::chain(a, t, fma(t, t, S(static_cast<F>(1.0f))));
+}
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (asin)")]]
+inline DualNumber<S, N> asin(const DualNumber<S, N>& a) noexcept {
+	typedef typename S::F F;
+	const S one{ static_cast<F>(1.0f) };
+	return dual_detail::chain(a, asin(a.v), one / sqrt(one - a.v * a.v));
+}
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (acos)")]]
+inline DualNumber<S, N> acos(const DualNumber<S, N>& a) noexcept {
+	typedef typename S::F F;
+	const S one{ static_cast<F>(1.0f) };
+	return dual_detail::chain(a, acos(a.v), -one / sqrt(one - a.v * a.v));
+}
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (atan)")]]
+inline DualNumber<S, N> atan(const DualNumber<S, N>& a) noexcept {
+	typedef typename S::F F;
+	const S one{ static_cast<F>(1.0f) };
+	return dual_detail::chain(a, atan(a.v), one / fma(a.v, a.v, one));
+}
+
+//Angle of (x, y).  d = (x dy - y dx) / (x^2 + y^2)
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (atan2)")]]
+inline DualNumber<S, N> atan2(const DualNumber<S, N>& y, const DualNumber<S, N>& x) noexcept {
+	typedef typename S::F F;
+	const S inverse = S(static_cast<F>(1.0f)) / fma(x.v, x.v, y.v * y.v);
+	DualNumber<S, N> r(atan2(y.v, x.v));
+	dual_detail::unroll<N>([&](int i) { r.d[i] = fms(x.v, y.d[i], y.v * x.d[i]) * inverse; });
+	return r;
+}
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (sinh)")]]
+inline DualNumber<S, N> sinh(const DualNumber<S, N>& a) noexcept { return dual_detail::chain(a, sinh(a.v), cosh(a.v)); }
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (cosh)")]]
+inline DualNumber<S, N> cosh(const DualNumber<S, N>& a) noexcept { return dual_detail::chain(a, cosh(a.v), sinh(a.v)); }
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (tanh)")]]
+inline DualNumber<S, N> tanh(const DualNumber<S, N>& a) noexcept {
+	typedef typename S::F F;
+	const S t = tanh(a.v);
+	return dual_detail::chain(a, t, S(static_cast<F>(1.0f)) - t * t);
+}
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (hypot)")]]
+inline DualNumber<S, N> hypot(const DualNumber<S, N>& a, const DualNumber<S, N>& b) noexcept {
+	const S h = hypot(a.v, b.v);
+	const S inverse = S(static_cast<typename S::F>(1.0f)) / h;
+	DualNumber<S, N> r(h);
+	dual_detail::unroll<N>([&](int i) { r.d[i] = fma(a.v, a.d[i], b.v * b.d[i]) * inverse; });
+	return r;
+}
+
+//Select per element.  (The mask comes from the underlying type's compare functions)
+template <SimdFloat S, int N, typename Mask>
+[[nodiscard("Value calculated and not used (blend)")]]
+inline DualNumber<S, N> blend(const DualNumber<S, N>& if_false, const DualNumber<S, N>& if_true, Mask mask) noexcept {
+	DualNumber<S, N> r(blend(if_false.v, if_true.v, mask));
+	dual_detail::unroll<N>([&](int i) { r.d[i] = blend(if_false.d[i], if_true.d[i], mask); });
+	return r;
+}
+
+//Comparisons are on the value
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (compare_equal)")]]
+inline auto compare_equal(const DualNumber<S, N>& a, const DualNumber<S, N>& b) noexcept { return compare_equal(a.v, b.v); }
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (compare_less)")]]
+inline auto compare_less(const DualNumber<S, N>& a, const DualNumber<S, N>& b) noexcept { return compare_less(a.v, b.v); }
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (compare_less_equal)")]]
+inline auto compare_less_equal(const DualNumber<S, N>& a, const DualNumber<S, N>& b) noexcept { return compare_less_equal(a.v, b.v); }
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (compare_greater)")]]
+inline auto compare_greater(const DualNumber<S, N>& a, const DualNumber<S, N>& b) noexcept { return compare_greater(a.v, b.v); }
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (compare_greater_equal)")]]
+inline auto compare_greater_equal(const DualNumber<S, N>& a, const DualNumber<S, N>& b) noexcept { return compare_greater_equal(a.v, b.v); }
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (abs)")]]
+inline DualNumber<S, N> abs(const DualNumber<S, N>& a) noexcept {
+	return blend(a, -a, compare_less(a.v, S(static_cast<typename S::F>(0.0f))));
+}
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (min)")]]
+inline DualNumber<S, N> min(const DualNumber<S, N>& a, const DualNumber<S, N>& b) noexcept { return blend(a, b, compare_less(b.v, a.v)); }
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (max)")]]
+inline DualNumber<S, N> max(const DualNumber<S, N>& a, const DualNumber<S, N>& b) noexcept { return blend(a, b, compare_greater(b.v, a.v)); }
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (clamp)")]]
+inline DualNumber<S, N> clamp(const DualNumber<S, N>& a, const DualNumber<S, N>& low, const DualNumber<S, N>& high) noexcept { return min(max(a, low), high); }
+
+//Steps.  The derivative is 0 (except at the steps, where it is undefined).
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (floor)")]]
+inline DualNumber<S, N> floor(const DualNumber<S, N>& a) noexcept { return DualNumber<S, N>(floor(a.v)); }
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (ceil)")]]
+inline DualNumber<S, N> ceil(const DualNumber<S, N>& a) noexcept { return DualNumber<S, N>(ceil(a.v)); }
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (trunc)")]]
+inline DualNumber<S, N> trunc(const DualNumber<S, N>& a) noexcept { return DualNumber<S, N>(trunc(a.v)); }
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (round)")]]
+inline DualNumber<S, N> round(const DualNumber<S, N>& a) noexcept { return DualNumber<S, N>(round(a.v)); }
+
+template <SimdFloat S, int N>
+[[nodiscard("Value calculated and not used (fract)")]]
+inline DualNumber<S, N> fract(const DualNumber<S, N>& a) noexcept { return a - floor(a.v); }
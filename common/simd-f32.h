@@ -147,9 +147,15 @@ struct FallbackFloat32 {
 	static FallbackFloat32 make_sequential(F first) { return FallbackFloat32(first); }
 	static FallbackFloat32 make_from_int32(FallbackUInt32 i) { return FallbackFloat32(static_cast<float>(i.v)); }
 
+	//Load each element from base[index].
+	static FallbackFloat32 make_gather(const F* base, FallbackUInt32 index) { return FallbackFloat32(base[index.v]); }
+
 	//*****Cast Functions****
 	FallbackUInt32 bitcast_to_uint() const noexcept { return FallbackUInt32(std::bit_cast<uint32_t>(this->v)); }
 
+	//Converts to an unsigned integer, truncating towards zero.  Elements must be in the range 0..2^31.
+	FallbackUInt32 truncate_to_uint() const noexcept { return FallbackUInt32(static_cast<uint32_t>(this->v)); }
+
 	
 
 };
@@ -237,6 +243,11 @@ inline static FallbackFloat32 clamp(const FallbackFloat32 a, const float min_f,
 	return std::min(std::max(a.v, min_f), max_f);
 }
 
+//*****Horizontal Reductions*****
+inline static float reduce_add(FallbackFloat32 a) noexcept { return a.v; }
+inline static float reduce_min(FallbackFloat32 a) noexcept { return a.v; }
+inline static float reduce_max(FallbackFloat32 a) noexcept { return a.v; }
+
 
 
 //*****Approximate Functions*****
@@ -387,10 +398,16 @@ struct Simd512Float32 {
 
 	static Simd512Float32 make_from_int32(Simd512UInt32 i) { return Simd512Float32(_mm512_cvtepu32_ps(i.v)); }
 
+	//Load each element from base[index].
+	static Simd512Float32 make_gather(const F* base, Simd512UInt32 index) { return Simd512Float32(_mm512_i32gather_ps(index.v, base, sizeof(F))); }
+
 	//*****Cast Functions****
 
 	//Converts to an unsigned integer.  No check is performed to see if that type is supported. Use cpu_level_supported() for safety. 
 	Simd512UInt32 bitcast_to_uint() const { return Simd512UInt32(_mm512_castps_si512(this->v)); }
+
+	//Converts to an unsigned integer, truncating towards zero.  Elements must be in the range 0..2^32.
+	Simd512UInt32 truncate_to_uint() const { return Simd512UInt32(_mm512_cvttps_epu32(this->v)); }
 	
 
 	
@@ -485,6 +502,14 @@ inline static Simd512Float32 clamp(const Simd512Float32 a, const float min_f, co
 	return _mm512_min_ps(_mm512_max_ps(a.v, min), max);
 }
 
+//*****Horizontal Reductions*****
+[[nodiscard("Value calculated and not used (reduce_add)")]]
+inline static float reduce_add(const Simd512Float32 a) noexcept { return _mm512_reduce_add_ps(a.v); }
+[[nodiscard("Value calculated and not used (reduce_min)")]]
+inline static float reduce_min(const Simd512Float32 a) noexcept { return _mm512_reduce_min_ps(a.v); }
+[[nodiscard("Value calculated and not used (reduce_max)")]]
+inline static float reduce_max(const Simd512Float32 a) noexcept { return _mm512_reduce_max_ps(a.v); }
+
 
 
 //*****Approximate Functions*****
@@ -707,10 +732,17 @@ struct Simd256Float32 {
 
 	static Simd256Float32 make_from_int32(Simd256UInt32 i) {return Simd256Float32(_mm256_cvtepi32_ps(i.v));}
 
+	//Load each element from base[index].
+	//Warning: Requires additional CPU features (AVX2)
+	static Simd256Float32 make_gather(const F* base, Simd256UInt32 index) { return Simd256Float32(_mm256_i32gather_ps(base, index.v, sizeof(F))); }
+
 	//*****Cast Functions****
 	
 	//Warning: Requires additional CPU features (AVX2)
 	Simd256UInt32 bitcast_to_uint() const { return Simd256UInt32(_mm256_castps_si256(this->v)); } 
+
+	//Converts to an unsigned integer, truncating towards zero.  Elements must be in the range 0..2^31.
+	Simd256UInt32 truncate_to_uint() const { return Simd256UInt32(_mm256_cvttps_epi32(this->v)); }
 	
 
 	
@@ -810,6 +842,30 @@ inline static Simd256Float32 clamp(const Simd256Float32 a, const float min_f, co
 	return _mm256_min_ps(_mm256_max_ps(a.v, min), max);
 }
 
+//*****Horizontal Reductions*****
+//Combine the two 128 bit halves, then halve again twice.
+[[nodiscard("Value calculated and not used (reduce_add)")]]
+inline static float reduce_add(const Simd256Float32 a) noexcept {
+	auto v = _mm_add_ps(_mm256_castps256_ps128(a.v), _mm256_extractf128_ps(a.v, 1));
+	v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+	v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 1));
+	return _mm_cvtss_f32(v);
+}
+[[nodiscard("Value calculated and not used (reduce_min)")]]
+inline static float reduce_min(const Simd256Float32 a) noexcept {
+	auto v = _mm_min_ps(_mm256_castps256_ps128(a.v), _mm256_extractf128_ps(a.v, 1));
+	v = _mm_min_ps(v, _mm_movehl_ps(v, v));
+	v = _mm_min_ss(v, _mm_shuffle_ps(v, v, 1));
+	return _mm_cvtss_f32(v);
+}
+[[nodiscard("Value calculated and not used (reduce_max)")]]
+inline static float reduce_max(const Simd256Float32 a) noexcept {
+	auto v = _mm_max_ps(_mm256_castps256_ps128(a.v), _mm256_extractf128_ps(a.v, 1));
+	v = _mm_max_ps(v, _mm_movehl_ps(v, v));
+	v = _mm_max_ss(v, _mm_shuffle_ps(v, v, 1));
+	return _mm_cvtss_f32(v);
+}
+
 
 
 //*****Approximate Functions*****
@@ -1021,8 +1077,21 @@ struct Simd128Float32 {
 
 	static Simd128Float32 make_from_int32(Simd128UInt32 i) { return Simd128Float32(_mm_cvtepi32_ps(i.v)); } //SSE2
 
+	//Load each element from base[index].
+	static Simd128Float32 make_gather(const F* base, Simd128UInt32 index) {
+		if constexpr (mt::environment::compiler_has_avx2) {
+			return Simd128Float32(_mm_i32gather_ps(base, index.v, sizeof(F))); //AVX2
+		}
+		else {
+			return Simd128Float32(_mm_set_ps(base[index.element(3)], base[index.element(2)], base[index.element(1)], base[index.element(0)]));
+		}
+	}
+
 	//*****Cast Functions****
 	Simd128UInt32 bitcast_to_uint() const { return Simd128UInt32(_mm_castps_si128(this->v)); } //SSE2
+
+	//Converts to an unsigned integer, truncating towards zero.  Elements must be in the range 0..2^31.
+	Simd128UInt32 truncate_to_uint() const { return Simd128UInt32(_mm_cvttps_epi32(this->v)); } //SSE2
 	
 
 	
@@ -1165,6 +1234,26 @@ inline static Simd128Float32 clamp(const Simd128Float32 a, const float min_f, co
 	return _mm_min_ps(_mm_max_ps(a.v, min), max);
 }
 
+//*****Horizontal Reductions*****
+[[nodiscard("Value calculated and not used (reduce_add)")]]
+inline static float reduce_add(const Simd128Float32 a) noexcept {
+	auto v = _mm_add_ps(a.v, _mm_movehl_ps(a.v, a.v));   //SSE1
+	v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 1));
+	return _mm_cvtss_f32(v);
+}
+[[nodiscard("Value calculated and not used (reduce_min)")]]
+inline static float reduce_min(const Simd128Float32 a) noexcept {
+	auto v = _mm_min_ps(a.v, _mm_movehl_ps(a.v, a.v));
+	v = _mm_min_ss(v, _mm_shuffle_ps(v, v, 1));
+	return _mm_cvtss_f32(v);
+}
+[[nodiscard("Value calculated and not used (reduce_max)")]]
+inline static float reduce_max(const Simd128Float32 a) noexcept {
+	auto v = _mm_max_ps(a.v, _mm_movehl_ps(a.v, a.v));
+	v = _mm_max_ss(v, _mm_shuffle_ps(v, v, 1));
+	return _mm_cvtss_f32(v);
+}
+
 
 
 //*****Approximate Functions*****
@@ -186,7 +186,7 @@ inline static FallbackFloat64 operator*(double lhs, FallbackFloat64 rhs) noexcep
 //*****Division Operators*****
 inline static FallbackFloat64 operator/(FallbackFloat64  lhs, const FallbackFloat64& rhs) noexcept { lhs /= rhs;	return lhs; }
 inline static FallbackFloat64 operator/(FallbackFloat64  lhs, double rhs) noexcept { lhs /= rhs; return lhs; }
-inline static FallbackFloat64 operator/(const double lhs, const FallbackFloat64& rhs) noexcept { return FallbackFloat64(lhs - rhs.v); }
+inline static FallbackFloat64 operator/(const double lhs, const FallbackFloat64& rhs) noexcept { return FallbackFloat64(lhs / rhs.v); }
 
 //*****Fused Multiply Add Fallbacks*****
 // Fused Multiply Add (a*b+c)
@@ -225,6 +225,11 @@ inline static FallbackFloat64 fract(FallbackFloat64 a) { return a - floor(a); }
 inline static FallbackFloat64 min(FallbackFloat64 a, FallbackFloat64 b) { return FallbackFloat64(std::min(a.v, b.v)); }
 inline static FallbackFloat64 max(FallbackFloat64 a, FallbackFloat64 b) { return FallbackFloat64(std::max(a.v, b.v)); }
 
+//*****Horizontal Reductions*****
+inline static double reduce_add(FallbackFloat64 a) noexcept { return a.v; }
+inline static double reduce_min(FallbackFloat64 a) noexcept { return a.v; }
+inline static double reduce_max(FallbackFloat64 a) noexcept { return a.v; }
+
 //*****Approximate Functions*****
 inline static FallbackFloat64 reciprocal_approx(FallbackFloat64 a) { return FallbackFloat64(1.0f / a.v); }
 
@@ -316,6 +321,7 @@ struct Simd512Float64 {
 
 	typedef double F;	
 	typedef Simd512UInt64 U;
+	typedef Simd512UInt64 U64;
 	
 
 	Simd512Float64() = default;
@@ -463,6 +469,14 @@ inline static Simd512Float64 min(Simd512Float64 a, Simd512Float64 b) { return Si
 inline static Simd512Float64 max(Simd512Float64 a, Simd512Float64 b) { return Simd512Float64(_mm512_max_pd(a.v, b.v)); }
 
 
+//*****Horizontal Reductions*****
+[[nodiscard("Value calculated and not used (reduce_add)")]]
+inline static double reduce_add(const Simd512Float64 a) noexcept { return _mm512_reduce_add_pd(a.v); }
+[[nodiscard("Value calculated and not used (reduce_min)")]]
+inline static double reduce_min(const Simd512Float64 a) noexcept { return _mm512_reduce_min_pd(a.v); }
+[[nodiscard("Value calculated and not used (reduce_max)")]]
+inline static double reduce_max(const Simd512Float64 a) noexcept { return _mm512_reduce_max_pd(a.v); }
+
 //*****Approximate Functions*****
 inline static Simd512Float64 reciprocal_approx(Simd512Float64 a) { return Simd512Float64(_mm512_rcp14_pd(a.v)); }
 
@@ -745,6 +759,24 @@ inline static Simd256Float64 max(Simd256Float64 a, Simd256Float64 b) { return Si
 
 
 
+//*****Horizontal Reductions*****
+//Combine the two 128 bit halves, then the two elements.
+[[nodiscard("Value calculated and not used (reduce_add)")]]
+inline static double reduce_add(const Simd256Float64 a) noexcept {
+	const auto v = _mm_add_pd(_mm256_castpd256_pd128(a.v), _mm256_extractf128_pd(a.v, 1));
+	return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+}
+[[nodiscard("Value calculated and not used (reduce_min)")]]
+inline static double reduce_min(const Simd256Float64 a) noexcept {
+	const auto v = _mm_min_pd(_mm256_castpd256_pd128(a.v), _mm256_extractf128_pd(a.v, 1));
+	return _mm_cvtsd_f64(_mm_min_sd(v, _mm_unpackhi_pd(v, v)));
+}
+[[nodiscard("Value calculated and not used (reduce_max)")]]
+inline static double reduce_max(const Simd256Float64 a) noexcept {
+	const auto v = _mm_max_pd(_mm256_castpd256_pd128(a.v), _mm256_extractf128_pd(a.v, 1));
+	return _mm_cvtsd_f64(_mm_max_sd(v, _mm_unpackhi_pd(v, v)));
+}
+
 //*****Approximate Functions*****
 inline static Simd256Float64 reciprocal_approx(Simd256Float64 a) { return Simd256Float64(1.0 / a); } //No AVX for packed doubles.
 
@@ -865,7 +897,7 @@ inline static Simd256Float64 blend(const Simd256Float64 if_false, const Simd256F
 struct Simd128Float64 {
 	__m128d v;
 	typedef double F;
-	typedef Simd128UInt32 U;
+	typedef Simd128UInt64 U;
 	typedef Simd128UInt64 U64;
 
 
@@ -909,7 +941,7 @@ struct Simd128Float64 {
 	}
 
 
-	static constexpr int size_of_element() { return sizeof(float); }
+	static constexpr int size_of_element() { return sizeof(double); }
 	static constexpr int number_of_elements() { return 2; }
 
 	//*****Access Elements*****
@@ -918,26 +950,34 @@ struct Simd128Float64 {
 
 	//*****Addition Operators*****
 	Simd128Float64& operator+=(const Simd128Float64& rhs) noexcept { v = _mm_add_pd(v, rhs.v); return *this; } //SSE1
-	Simd128Float64& operator+=(float rhs) noexcept { v = _mm_add_pd(v, _mm_set1_pd(rhs));	return *this; }
+	Simd128Float64& operator+=(double rhs) noexcept { v = _mm_add_pd(v, _mm_set1_pd(rhs));	return *this; }
 
 	//*****Subtraction Operators*****
 	Simd128Float64& operator-=(const Simd128Float64& rhs) noexcept { v = _mm_sub_pd(v, rhs.v); return *this; }//SSE1
-	Simd128Float64& operator-=(float rhs) noexcept { v = _mm_sub_pd(v, _mm_set1_pd(rhs));	return *this; }
+	Simd128Float64& operator-=(double rhs) noexcept { v = _mm_sub_pd(v, _mm_set1_pd(rhs));	return *this; }
 
 	//*****Multiplication Operators*****
 	Simd128Float64& operator*=(const Simd128Float64& rhs) noexcept { v = _mm_mul_pd(v, rhs.v); return *this; } //SSE1
-	Simd128Float64& operator*=(float rhs) noexcept { v = _mm_mul_pd(v, _mm_set1_pd(rhs)); return *this; }
+	Simd128Float64& operator*=(double rhs) noexcept { v = _mm_mul_pd(v, _mm_set1_pd(rhs)); return *this; }
 
 	//*****Division Operators*****
 	Simd128Float64& operator/=(const Simd128Float64& rhs) noexcept { v = _mm_div_pd(v, rhs.v); return *this; } //SSE1
-	Simd128Float64& operator/=(float rhs) noexcept { v = _mm_div_pd(v, _mm_set1_pd(rhs));	return *this; }
+	Simd128Float64& operator/=(double rhs) noexcept { v = _mm_div_pd(v, _mm_set1_pd(rhs));	return *this; }
 
 	//*****Negate Operators*****
 	Simd128Float64 operator-() const noexcept { return Simd128Float64(_mm_sub_pd(_mm_setzero_pd(), v)); }
 
 
 	//*****Make Functions****
-	static Simd128Float64 make_sequential(F first) { return Simd128Float64(_mm_set_pd(first + 1.0f, first)); }
+	static Simd128Float64 make_sequential(F first) { return Simd128Float64(_mm_set_pd(first + 1.0, first)); }
+
+	//Convert uints that are less than 2^52 to double (this is quicker than full range)
+	static Simd128Float64 make_from_uints_52bits(Simd128UInt64 i) {
+		auto x = _mm_and_si128(i.v, _mm_set1_epi64x(0b0000000000001111111111111111111111111111111111111111111111111111)); //mask of 52-bits.
+		x = _mm_or_si128(x, _mm_castpd_si128(_mm_set1_pd(0x0010000000000000)));
+		auto u = _mm_sub_pd(_mm_castsi128_pd(x), _mm_set1_pd(0x0010000000000000));
+		return Simd128Float64(u);
+	}
 
 
 	//static Simd128Float64 make_from_int64(Simd128UInt64 i) { return Simd128Float64(_mm_cvtepi64_pd(i.v)); } //SSE2
@@ -953,23 +993,23 @@ struct Simd128Float64 {
 
 //*****Addition Operators*****
 inline static Simd128Float64 operator+(Simd128Float64  lhs, const Simd128Float64& rhs) noexcept { lhs += rhs; return lhs; }
-inline static Simd128Float64 operator+(Simd128Float64  lhs, float rhs) noexcept { lhs += rhs; return lhs; }
-inline static Simd128Float64 operator+(float lhs, Simd128Float64 rhs) noexcept { rhs += lhs; return rhs; }
+inline static Simd128Float64 operator+(Simd128Float64  lhs, double rhs) noexcept { lhs += rhs; return lhs; }
+inline static Simd128Float64 operator+(double lhs, Simd128Float64 rhs) noexcept { rhs += lhs; return rhs; }
 
 //*****Subtraction Operators*****
 inline static Simd128Float64 operator-(Simd128Float64  lhs, const Simd128Float64& rhs) noexcept { lhs -= rhs; return lhs; }
-inline static Simd128Float64 operator-(Simd128Float64  lhs, float rhs) noexcept { lhs -= rhs; return lhs; }
-inline static Simd128Float64 operator-(const float lhs, const Simd128Float64& rhs) noexcept { return Simd128Float64(_mm_sub_pd(_mm_set1_pd(lhs), rhs.v)); }
+inline static Simd128Float64 operator-(Simd128Float64  lhs, double rhs) noexcept { lhs -= rhs; return lhs; }
+inline static Simd128Float64 operator-(const double lhs, const Simd128Float64& rhs) noexcept { return Simd128Float64(_mm_sub_pd(_mm_set1_pd(lhs), rhs.v)); }
 
 //*****Multiplication Operators*****
 inline static Simd128Float64 operator*(Simd128Float64  lhs, const Simd128Float64& rhs) noexcept { lhs *= rhs; return lhs; }
-inline static Simd128Float64 operator*(Simd128Float64  lhs, float rhs) noexcept { lhs *= rhs; return lhs; }
-inline static Simd128Float64 operator*(float lhs, Simd128Float64 rhs) noexcept { rhs *= lhs; return rhs; }
+inline static Simd128Float64 operator*(Simd128Float64  lhs, double rhs) noexcept { lhs *= rhs; return lhs; }
+inline static Simd128Float64 operator*(double lhs, Simd128Float64 rhs) noexcept { rhs *= lhs; return rhs; }
 
 //*****Division Operators*****
 inline static Simd128Float64 operator/(Simd128Float64  lhs, const Simd128Float64& rhs) noexcept { lhs /= rhs;	return lhs; }
-inline static Simd128Float64 operator/(Simd128Float64  lhs, float rhs) noexcept { lhs /= rhs; return lhs; }
-inline static Simd128Float64 operator/(const float lhs, const Simd128Float64& rhs) noexcept { return Simd128Float64(_mm_div_pd(_mm_set1_pd(lhs), rhs.v)); }
+inline static Simd128Float64 operator/(Simd128Float64  lhs, double rhs) noexcept { lhs /= rhs; return lhs; }
+inline static Simd128Float64 operator/(const double lhs, const Simd128Float64& rhs) noexcept { return Simd128Float64(_mm_div_pd(_mm_set1_pd(lhs), rhs.v)); }
 
 //*****Rounding Functions*****
 [[nodiscard("Value calculated and not used (floor)")]]
@@ -1089,6 +1129,14 @@ inline static Simd128Float64 clamp(const Simd128Float64 a, const float min_f, co
 
 
 
+//*****Horizontal Reductions*****
+[[nodiscard("Value calculated and not used (reduce_add)")]]
+inline static double reduce_add(const Simd128Float64 a) noexcept { return _mm_cvtsd_f64(_mm_add_sd(a.v, _mm_unpackhi_pd(a.v, a.v))); }	//SSE2
+[[nodiscard("Value calculated and not used (reduce_min)")]]
+inline static double reduce_min(const Simd128Float64 a) noexcept { return _mm_cvtsd_f64(_mm_min_sd(a.v, _mm_unpackhi_pd(a.v, a.v))); }
+[[nodiscard("Value calculated and not used (reduce_max)")]]
+inline static double reduce_max(const Simd128Float64 a) noexcept { return _mm_cvtsd_f64(_mm_max_sd(a.v, _mm_unpackhi_pd(a.v, a.v))); }
+
 //*****Approximate Functions*****
 [[nodiscard("Value calculated and not used (reciprocal_approx)")]]
 inline static Simd128Float64 reciprocal_approx(const Simd128Float64 a) noexcept { return Simd128Float64(1.0/a.v); }
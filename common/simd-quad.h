@@ -0,0 +1,150 @@
+/********************************************************************************************************
+
+Authors:		(c) 2023 Maths Town
+
+Licence:		The MIT License
+
+*********************************************************************************************************
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************
+
+Description:
+
+	SIMD packets shaped as a small 2D block of pixels (a quad) rather than a run along a row.
+
+	With make_sequential() a 16 lane vector covers 16x1 pixels.  A quad packet covers 4x4 pixels, so
+	the lanes are closer together on screen.  Neighbouring pixels tend to take the same branches and
+	finish ray marches (or escape-time loops) at about the same step, so lanes finish together.  Like
+	a GPU, the lanes of a quad can also be compared to give screen space derivatives (ddx/ddy), e.g.
+	to filter detail that is smaller than a pixel.
+
+	Lane i is pixel (i % width, i / width) of the quad.
+		1 lane		1x1
+		2 lanes		2x1
+		4 lanes		2x2
+		8 lanes		4x2
+		16 lanes	4x4
+
+	ddx() and ddy() are coarse derivatives.  Each pair of lanes gets the difference between its two
+	pixels (to the right, and down), like ddx_coarse in HLSL.  They are zero when the quad is only
+	one pixel wide (or high).  Float32 types use permutes within the register.  Other types use
+	element access.
+
+	See BlockOutput::set_quad() for writing quads into a block.
+
+Types:
+
+	QuadShape<S>	- Width and height of a quad for S.
+
+Functions:
+
+	make_quad_x()	- x positions of the lanes of a quad.  (make_sequential() for quads)
+	make_quad_y()	- y positions of the lanes of a quad.
+	ddx()			- Difference to the pixel on the right (within each pair).
+	ddy()			- Difference to the pixel below (within each pair).
+
+*******************************************************************************************************/
+#pragma once
+
+#include "simd-concepts.h"
+#include "simd-f32.h"
+
+#include <type_traits>
+
+
+/**************************************************************************************************
+ * Width and height of a quad for S.
+ * ************************************************************************************************/
+template <SimdFloat S>
+struct QuadShape {
+	static constexpr int lanes = S::number_of_elements();
+	static constexpr int height = (lanes >= 16) ? 4 : (lanes >= 4) ? 2 : 1;
+	static constexpr int width = lanes / height;
+};
+
+
+namespace simd_quad_detail {
+
+	//A vector with f(i) in lane i
+	template <SimdFloat S, typename Function>
+	inline S make_lanes(Function f) noexcept {
+		S r{};
+		for (int i = 0; i < S::number_of_elements(); i++) r.set_element(i, static_cast<typename S::F>(f(i)));
+		return r;
+	}
+
+	//Made on first use.  (Not at load time, as the CPU may not support S)
+	template <SimdFloat S> inline const S& column() noexcept { static const S c = make_lanes<S>([](int i) { return i % QuadShape<S>::width; }); return c; }
+	template <SimdFloat S> inline const S& row() noexcept { static const S c = make_lanes<S>([](int i) { return i / QuadShape<S>::width; }); return c; }
+
+	//+1 in the first lane of each pair, -1 in the second
+	template <SimdFloat S> inline const S& sign_x() noexcept { static const S c = make_lanes<S>([](int i) { return (i & 1) ? -1 : 1; }); return c; }
+	template <SimdFloat S> inline const S& sign_y() noexcept { static const S c = make_lanes<S>([](int i) { return (i & QuadShape<S>::width) ? -1 : 1; }); return c; }
+
+	//Lane i ^ 1 (the other pixel in the row pair)
+	template <SimdFloat S>
+	inline S partner_x(const S& v) noexcept {
+#if defined(_M_X64) || defined(__x86_64)
+		if constexpr (std::is_same_v<S, Simd128Float32>) return S(_mm_shuffle_ps(v.v, v.v, _MM_SHUFFLE(2, 3, 0, 1)));
+		if constexpr (std::is_same_v<S, Simd256Float32>) return S(_mm256_permute_ps(v.v, _MM_SHUFFLE(2, 3, 0, 1)));
+		if constexpr (std::is_same_v<S, Simd512Float32>) return S(_mm512_permute_ps(v.v, _MM_SHUFFLE(2, 3, 0, 1)));
+#endif
+		S r{};
+		for (int i = 0; i < S::number_of_elements(); i++) r.set_element(i, v.element(i ^ 1));
+		return r;
+	}
+
+	//Lane i ^ width (the other pixel in the column pair)
+	template <SimdFloat S>
+	inline S partner_y(const S& v) noexcept {
+#if defined(_M_X64) || defined(__x86_64)
+		if constexpr (std::is_same_v<S, Simd128Float32>) return S(_mm_shuffle_ps(v.v, v.v, _MM_SHUFFLE(1, 0, 3, 2)));
+		if constexpr (std::is_same_v<S, Simd256Float32>) return S(_mm256_permute2f128_ps(v.v, v.v, 0x01));
+		if constexpr (std::is_same_v<S, Simd512Float32>) return S(_mm512_shuffle_f32x4(v.v, v.v, _MM_SHUFFLE(2, 3, 0, 1)));
+#endif
+		S r{};
+		for (int i = 0; i < S::number_of_elements(); i++) r.set_element(i, v.element(i ^ QuadShape<S>::width));
+		return r;
+	}
+}
+
+
+/**************************************************************************************************
+ * Positions of the lanes of a quad whose top left pixel is x,y.
+ * ************************************************************************************************/
+template <SimdFloat S>
+inline S make_quad_x(typename S::F x) noexcept { return simd_quad_detail::column<S>() + x; }
+
+template <SimdFloat S>
+inline S make_quad_y(typename S::F y) noexcept { return simd_quad_detail::row<S>() + y; }
+
+
+/**************************************************************************************************
+ * Screen space derivatives of a value computed for a quad.  (Per pixel, to the right and down)
+ * ************************************************************************************************/
+template <SimdFloat S>
+[[nodiscard("Value calculated and not used (ddx)")]]
+inline S ddx(const S& v) noexcept {
+	if constexpr (QuadShape<S>::width < 2) return S{ static_cast<typename S::F>(0) };
+	else return (simd_quad_detail::partner_x(v) - v) * simd_quad_detail::sign_x<S>();
+}
+
+template <SimdFloat S>
+[[nodiscard("Value calculated and not used (ddy)")]]
+inline S ddy(const S& v) noexcept {
+	if constexpr (QuadShape<S>::height < 2) return S{ static_cast<typename S::F>(0) };
+	else return (simd_quad_detail::partner_y(v) - v) * simd_quad_detail::sign_y<S>();
+}
@@ -0,0 +1,332 @@
+/********************************************************************************************************
+
+Authors:		(c) 2023 Maths Town
+
+Licence:		The MIT License
+
+*********************************************************************************************************
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************
+
+Description:
+
+	Chooses the SIMD width to render with, by timing each width on this machine.
+
+	Wider vectors aren't always faster.  Some processors lower their clock speed while running AVX-512
+	code, and projects that spend their time on gathers or divergent loops gain little from the extra
+	lanes.  So instead of always taking the widest type, the hosts time a small tile at each width the
+	build and CPU support, the first time a plugin renders, and keep the fastest.
+
+	- The tile is from a fixed frame (calibration_width x calibration_height) with the project's
+	  default parameters, so the choice doesn't depend on whichever frame happened to render first.
+	- Timing stops once it has taken calibration_time_limit.  The widths not yet timed are skipped,
+	  and the choice isn't saved, so a later run times them all.
+
+	- Each width is warmed up for a while before it is timed, so the timing is taken at the clock
+	  speed the processor settles at for that width (and not just after another width ran).
+	- The choice is kept in a cache file in the temp directory, one line per plugin, version and
+	  processor ("key=bits").  Later runs read it instead of timing again.  Delete the file (or the
+	  line) to time again, or edit the number to choose a width by hand.
+	- The environment variable EFFECTS_TOWN_SIMD_WIDTH (128, 256 or 512) overrides both, if the
+	  width is available.
+
+	Widths are in bits.  512 is only available in builds compiled for AVX-512 (as before).  256 is
+	available in AVX2 builds, or when the CPU supports it.
+
+	Elements are float or double (the project's Precision in config.h).  Each is timed separately,
+	as the key names the precision.
+
+	x86_64 only (used by the After Effects and OpenFX hosts).
+
+Functions:
+
+	available_simd_widths()		- Widths this build can use on this CPU.  (Widest first)
+	with_simd_width()			- Calls a function template with the SIMD type for a width and precision.
+	calibration_parameters()	- The project's default parameters, to time each width with.
+	time_render_tile()			- Time to render a small tile with a renderer.
+	simd_width_key()			- Names the plugin, version and processor in the cache file.
+	tune_simd_width()			- The width to use.  (Override, cache file, or timing each width)
+
+*******************************************************************************************************/
+#pragma once
+
+#include "colour.h"
+#include "environment.h"
+#include "parameter-list.h"
+#include "render-block.h"
+#include "simd-concepts.h"
+#include "simd-cpuid.h"
+#include "simd-f32.h"
+#include "simd-f64.h"
+#include "simd-uint32.h"
+#include "simd-uint64.h"
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+/**************************************************************************************************
+ * Widths (in bits) this build can render with on this CPU.  Widest first.
+ * ************************************************************************************************/
+inline std::vector<int> available_simd_widths() {
+	if constexpr (mt::environment::compiler_has_avx512dq && mt::environment::compiler_has_avx512f) {
+		return { 512, 256, 128 };
+	}
+	else if constexpr (mt::environment::compiler_has_avx2 && mt::environment::compiler_has_avx && mt::environment::compiler_has_fma) {
+		return { 256, 128 };
+	}
+	else {
+		//Runtime check for AVX2
+		CpuInformation cpu_info{};
+		if (Simd256Float32::cpu_supported(cpu_info) && Simd256UInt32::cpu_supported(cpu_info) && Simd256UInt64::cpu_supported(cpu_info)) return { 256, 128 };
+		return { 128 };
+	}
+}
+
+
+/**************************************************************************************************
+ * Calls f.template operator()<S>() where S is the SIMD type for the width, with elements of type F.
+ * (Only widths from available_simd_widths().  Anything else is 128 bits)
+ * ************************************************************************************************/
+template <std::floating_point F = float, typename Function>
+void with_simd_width(int bits, Function&& f) {
+	if constexpr (std::same_as<F, double>) {
+		if constexpr (mt::environment::compiler_has_avx512dq && mt::environment::compiler_has_avx512f) {
+			if (bits == 512) return f.template operator()<Simd512Float64>();
+		}
+		if (bits == 256) return f.template operator()<Simd256Float64>();
+		return f.template operator()<Simd128Float64>();
+	}
+	else {
+		if constexpr (mt::environment::compiler_has_avx512dq && mt::environment::compiler_has_avx512f) {
+			if (bits == 512) return f.template operator()<Simd512Float32>();
+		}
+		if (bits == 256) return f.template operator()<Simd256Float32>();
+		return f.template operator()<Simd128Float32>();
+	}
+}
+
+
+//Size of the frame the widths are timed on.  (Hosts set up the renderer at this size)
+constexpr int calibration_width = 1920;
+constexpr int calibration_height = 1080;
+
+//Timing all the widths stops after this long.
+constexpr auto calibration_time_limit = std::chrono::milliseconds(500);
+
+
+/**************************************************************************************************
+ * Parameters to time each width with.  The project's defaults, with the first item of each list.
+ * ************************************************************************************************/
+inline ParameterList calibration_parameters(ParameterList params) {
+	for (auto& p : params.entries) {
+		if (p.type == ParameterType::list && p.value_string.empty() && !p.list.empty()) p.value_string = p.list.front();
+	}
+	return params;
+}
+
+
+/**************************************************************************************************
+ * Seconds to render a small tile at the centre of the frame.  (The best of a few, after warming up)
+ * Pixels are rendered with render_pixel_with_input() (given mid grey) if with_input, otherwise as a
+ * block.  Use the same frame size for each width, so the times can be compared.
+ * ************************************************************************************************/
+template <SimdFloat S, typename R>
+double time_render_tile(const R& renderer, int width, int height, bool with_input) {
+	typedef typename S::F F;
+	typedef std::chrono::steady_clock Clock;
+	constexpr int tile_width = 128;
+	constexpr int tile_height = 16;
+	constexpr auto warm_up = std::chrono::milliseconds(20);
+	constexpr auto max_time = std::chrono::milliseconds(100);	//Fewer runs for slow tiles
+	constexpr int runs = 3;
+
+	const int w = std::clamp(width, 1, tile_width);
+	const int h = std::clamp(height, 1, tile_height);
+	const int x = std::max(0, (width - w) / 2);
+	const int y = std::max(0, (height - h) / 2);
+
+	BlockOutput<S> block{};
+	const auto render = [&]() {
+		if constexpr (requires { renderer.render_pixel_with_input(S{}, S{}, ColourRGBA<S>{}); }) {
+			if (with_input) {
+				const S grey{ static_cast<F>(0.5f) };
+				const ColourRGBA<S> input(grey, grey, grey, S{ static_cast<F>(1.0f) });
+				block.resize(x, y, w, h);
+				for (int j = 0; j < block.height; j++) {
+					for (int i = 0; i < block.vectors_per_row; i++) {
+						block.set(i, j, renderer.render_pixel_with_input(S::make_sequential(static_cast<F>(x + i * S::number_of_elements())), S(static_cast<F>(y + j)), input));
+					}
+				}
+				return;
+			}
+		}
+		render_block(renderer, x, y, w, h, block);
+	};
+
+	//Run until the clock speed has settled
+	const auto start = Clock::now();
+	do { render(); } while (Clock::now() - start < warm_up);
+
+	double best = std::numeric_limits<double>::infinity();
+	for (int i = 0; i < runs; i++) {
+		const auto t0 = Clock::now();
+		render();
+		best = std::min(best, std::chrono::duration<double>(Clock::now() - t0).count());
+		if (Clock::now() - start > max_time) break;
+	}
+	return best;
+}
+
+
+namespace simd_width_detail {
+
+	constexpr const char* override_variable = "EFFECTS_TOWN_SIMD_WIDTH";
+	constexpr const char* cache_file_name = "effects-town-simd-width.txt";
+
+	//Value of an environment variable.  (Empty if not set)
+	inline std::string environment_variable(const char* name) {
+#if defined(_MSC_VER)
+		char* value{};
+		size_t length{};
+		if (_dupenv_s(&value, &length, name) != 0 || !value) return {};
+		std::string s(value);
+		std::free(value);
+		return s;
+#else
+		const char* value = std::getenv(name);
+		return value ? std::string(value) : std::string{};
+#endif
+	}
+
+	//Width from a string, if it is one of the available widths.  (0 if not)
+	inline int parse_width(const std::string& s, const std::vector<int>& widths) {
+		int bits{};
+		try { bits = std::stoi(s); }
+		catch (...) { return 0; }
+		return (std::find(widths.begin(), widths.end(), bits) != widths.end()) ? bits : 0;
+	}
+
+	inline std::filesystem::path cache_path() {
+		std::error_code error{};
+		const auto directory = std::filesystem::temp_directory_path(error);
+		if (error) return {};
+		return directory / cache_file_name;
+	}
+
+	//Lines of the cache file.  (Empty if there is no file)
+	inline std::vector<std::string> read_cache(const std::filesystem::path& path) {
+		std::vector<std::string> lines{};
+		if (path.empty()) return lines;
+		std::ifstream file(path);
+		std::string line{};
+		while (std::getline(file, line)) {
+			if (!line.empty()) lines.push_back(line);
+		}
+		return lines;
+	}
+
+	//Debug check of the cache file format.  The key's line must read back as the width saved, a
+	//hand edited line (with a windows line ending) must still read, and other text must not.
+	inline void check_cache(const std::filesystem::path& path, const std::string& prefix, int bits, const std::vector<int>& widths) {
+		int found{};
+		for (const auto& line : read_cache(path)) {
+			if (line.starts_with(prefix)) found = parse_width(line.substr(prefix.size()), widths);
+		}
+		if (found != bits) throw std::logic_error("SIMD width: The cache file doesn't read back as the width saved.");
+		for (const int w : widths) {
+			if (parse_width(std::to_string(w) + "\r", widths) != w) throw std::logic_error("SIMD width: A cache line with a windows line ending doesn't read.");
+		}
+		for (const char* text : { "", "abc", "64", "1024", "-256" }) {
+			if (parse_width(text, widths) != 0) throw std::logic_error("SIMD width: Text that isn't an available width reads as one.");
+		}
+	}
+}
+
+
+/**************************************************************************************************
+ * Key for the cache file.  Plugin, version, precision and processor.  (e.g. after an update, a plugin
+ * is timed again)  Float32 keys don't name the precision.  (So they are the same as before)
+ * ************************************************************************************************/
+inline std::string simd_width_key(const std::string& plugin, int major, int minor, int bug, int build, int element_bits = 32) {
+	const std::string precision = (element_bits == 32) ? "" : " f" + std::to_string(element_bits);
+	return plugin + " " + std::to_string(major) + "." + std::to_string(minor) + "." + std::to_string(bug) + "." + std::to_string(build) + precision + " " + CpuInformation().brand_string();
+}
+
+
+/**************************************************************************************************
+ * The width to render with.  The override (EFFECTS_TOWN_SIMD_WIDTH), then the cache file, then
+ * measure(bits) for each width (seconds, lower is better), which is saved to the cache file.
+ * key names the plugin, its version and the processor.  (See simd_width_key())
+ * Call once per process.  (e.g. from a function static)  Measuring stops at calibration_time_limit.
+ * ************************************************************************************************/
+template <typename Measure>
+int tune_simd_width(const std::string& key, const std::vector<int>& widths, Measure&& measure) {
+	using namespace simd_width_detail;
+	if (widths.empty()) return 128;
+	if (widths.size() == 1) return widths.front();
+
+	//Override
+	if (const int bits = parse_width(environment_variable(override_variable), widths)) return bits;
+
+	//Cache file
+	const auto path = cache_path();
+	auto lines = read_cache(path);
+	const std::string prefix = key + "=";
+	for (const auto& line : lines) {
+		if (line.starts_with(prefix)) {
+			if (const int bits = parse_width(line.substr(prefix.size()), widths)) return bits;
+		}
+	}
+
+	//Time each width (widest first), until the time limit
+	const auto start = std::chrono::steady_clock::now();
+	int best = widths.front();
+	double best_seconds = std::numeric_limits<double>::infinity();
+	bool timed_all = true;
+	for (const int bits : widths) {
+		if (std::chrono::steady_clock::now() - start > calibration_time_limit) {
+			timed_all = false;
+			break;
+		}
+		const double seconds = measure(bits);
+		if (seconds < best_seconds) {
+			best = bits;
+			best_seconds = seconds;
+		}
+	}
+
+	//Save it.  (Replaces any line for this key.  Nothing is lost if the file can't be written)
+	if (timed_all && !path.empty()) {
+		std::erase_if(lines, [&](const std::string& line) { return line.starts_with(prefix); });
+		lines.push_back(prefix + std::to_string(best));
+		std::ofstream file(path, std::ios::trunc);
+		for (const auto& line : lines) file << line << "\n";
+#ifdef _DEBUG
+		file.close();
+		if (file) check_cache(path, prefix, best, widths);
+#endif
+	}
+	return best;
+}
@@ -0,0 +1,222 @@
+/********************************************************************************************************
+
+Authors:		(c) 2023 Maths Town
+
+Licence:		The MIT License
+
+*********************************************************************************************************
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************
+
+Description:
+
+	Hands out the tiles of a frame to render threads.
+
+	The frame is cut into 2D tiles sized so a tile's pixels (output, and input if used) fit in half
+	of the level 2 cache.  Tiles are numbered in Morton (Z) order, so tiles next to each other in the
+	list are also next to each other in the frame, and each thread's queue starts with a contiguous
+	run of them.  (Neighbouring tiles share cache lines of input and the renderer's tables)
+
+	Each thread takes tiles from the front of its own queue.  A thread whose queue is empty steals
+	the back half of another thread's queue, so threads that finish early help with expensive areas
+	(e.g. the surface of a fractal) instead of waiting.
+
+	A queue is a range of tile numbers packed into one 64 bit atomic, so taking a tile is a single
+	compare and swap and no locks are needed.  Ranges only ever shrink (or are refilled by their own
+	thread once empty), so a compare and swap can't succeed on a stale range.
+
+	The tiles are made before any thread starts and don't change, so threads only share the queues.
+
+Types:
+
+	Tile			- A rectangle of pixels.  (x1,y1 inclusive, x2,y2 exclusive, like OfxRectI)
+	TileSize		- Width and height of tiles.
+	TileScheduler	- The tiles of a frame and a queue for each thread.
+
+*******************************************************************************************************/
+#pragma once
+
+#include "environment.h"
+#if defined(_M_X64) || defined(__x86_64)
+#include "simd-cpuid.h"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+//A rectangle of pixels
+struct Tile {
+	int x1{};
+	int y1{};
+	int x2{};
+	int y2{};
+};
+
+//Size of tiles
+struct TileSize {
+	int width{};
+	int height{};
+};
+
+
+/**************************************************************************************************
+ * Tiles of a frame and a work stealing queue for each thread.
+ * ************************************************************************************************/
+class TileScheduler {
+public:
+	//Cut the rectangle left,top - right,bottom into tiles, shared between a number of queues (one per thread)
+	TileScheduler(int left, int top, int right, int bottom, int queues, TileSize size) {
+		const int width = std::max(right - left, 0);
+		const int height = std::max(bottom - top, 0);
+		size.width = std::max(size.width, 1);
+		size.height = std::max(size.height, 1);
+		const int across = (width + size.width - 1) / size.width;
+		const int down = (height + size.height - 1) / size.height;
+
+		//Tiles in Morton order
+		std::vector<std::pair<uint64_t, Tile>> ordered;
+		ordered.reserve(static_cast<size_t>(across) * down);
+		for (int ty = 0; ty < down; ty++) {
+			for (int tx = 0; tx < across; tx++) {
+				const Tile t{ left + tx * size.width, top + ty * size.height, std::min(left + (tx + 1) * size.width, right), std::min(top + (ty + 1) * size.height, bottom) };
+				ordered.emplace_back(morton_key(static_cast<uint32_t>(tx), static_cast<uint32_t>(ty)), t);
+			}
+		}
+		std::sort(ordered.begin(), ordered.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+		tiles.reserve(ordered.size());
+		for (const auto& o : ordered) tiles.push_back(o.second);
+
+		//Each queue starts with a contiguous run of tiles
+		queue_count = std::max(queues, 1);
+		queue = std::make_unique<Queue[]>(queue_count);
+		const uint64_t n = tiles.size();
+		for (int q = 0; q < queue_count; q++) {
+			queue[q].range.store(pack(static_cast<uint32_t>(n * q / queue_count), static_cast<uint32_t>(n * (q + 1) / queue_count)), std::memory_order_relaxed);
+		}
+	}
+
+	//Number of tiles
+	int size() const noexcept { return static_cast<int>(tiles.size()); }
+
+	//Number of queues
+	int queues() const noexcept { return queue_count; }
+
+	/**************************************************************************************************
+	 * Get the next tile for the thread that owns queue q.  Returns false once there are no tiles left.
+	 * Takes from the front of its own queue, then steals from the others.
+	 * ************************************************************************************************/
+	bool next(int q, Tile& tile) noexcept {
+		if (q < 0 || q >= queue_count) return false;
+
+		//Own queue
+		auto& own = queue[q].range;
+		uint64_t r = own.load(std::memory_order_relaxed);
+		while (front(r) < back(r)) {
+			if (own.compare_exchange_weak(r, pack(front(r) + 1, back(r)), std::memory_order_relaxed)) {
+				tile = tiles[front(r)];
+				return true;
+			}
+		}
+
+		//Steal the back half of another queue.  The first stolen tile is used now, and the rest go in our queue.
+		for (int i = 1; i < queue_count; i++) {
+			auto& victim = queue[(q + i) % queue_count].range;
+			uint64_t v = victim.load(std::memory_order_relaxed);
+			while (front(v) < back(v)) {
+				const uint32_t middle = front(v) + (back(v) - front(v)) / 2;
+				if (victim.compare_exchange_weak(v, pack(front(v), middle), std::memory_order_relaxed)) {
+					own.store(pack(middle + 1, back(v)), std::memory_order_relaxed);	//Our queue is empty, so no one else changes it
+					tile = tiles[middle];
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	/**************************************************************************************************
+	 * Tile size for a frame.  The tile's pixels (bytes_per_pixel each) should fit in half of the level 2
+	 * cache.  Widths are a multiple of 64 pixels (whole cache lines, and whole SIMD vectors), and tiles
+	 * get smaller until there are at least 4 per thread (so stealing can balance the work).
+	 * ************************************************************************************************/
+	static TileSize choose_tile_size(int width, int height, int threads, int bytes_per_pixel) noexcept {
+		constexpr int minimum_width = 64;
+		constexpr int minimum_height = 8;
+		width = std::max(width, 1);
+		height = std::max(height, 1);
+		const size_t pixels = std::max(level_2_cache_size() / 2 / static_cast<size_t>(std::max(bytes_per_pixel, 1)), size_t{ minimum_width * minimum_height });
+
+		//Squarish, rounded down to a multiple of 64 wide
+		int w = minimum_width;
+		while (static_cast<size_t>(w) * 2 * w * 2 <= pixels && w < width) w *= 2;
+		w = std::min(w, (width + minimum_width - 1) / minimum_width * minimum_width);
+		int h = std::clamp(static_cast<int>(pixels / w), minimum_height, std::max(height, minimum_height));
+
+		//Enough tiles for every thread
+		const auto count = [&]() { return static_cast<int64_t>((width + w - 1) / w) * ((height + h - 1) / h); };
+		const int64_t wanted = int64_t{ 4 } * std::max(threads, 1);
+		while (count() < wanted && (h > minimum_height || w > minimum_width)) {
+			if (h > minimum_height && (h >= w / 4 || w <= minimum_width)) h = std::max(h / 2, minimum_height);
+			else w = std::max(w / 2 / minimum_width * minimum_width, minimum_width);
+		}
+		return TileSize{ w, h };
+	}
+
+private:
+	//A range of tile numbers (front inclusive, back exclusive), on its own cache line
+	struct alignas(64) Queue {
+		std::atomic<uint64_t> range{};
+	};
+
+	std::vector<Tile> tiles{};
+	std::unique_ptr<Queue[]> queue{};
+	int queue_count{};
+
+	static constexpr uint64_t pack(uint32_t f, uint32_t b) noexcept { return (static_cast<uint64_t>(f) << 32) | b; }
+	static constexpr uint32_t front(uint64_t r) noexcept { return static_cast<uint32_t>(r >> 32); }
+	static constexpr uint32_t back(uint64_t r) noexcept { return static_cast<uint32_t>(r); }
+
+	//Interleave the bits of x and y (x in the even bits)
+	static constexpr uint64_t morton_key(uint32_t x, uint32_t y) noexcept {
+		const auto spread = [](uint64_t v) {
+			v = (v | (v << 16)) & 0x0000ffff0000ffffull;
+			v = (v | (v << 8)) & 0x00ff00ff00ff00ffull;
+			v = (v | (v << 4)) & 0x0f0f0f0f0f0f0f0full;
+			v = (v | (v << 2)) & 0x3333333333333333ull;
+			v = (v | (v << 1)) & 0x5555555555555555ull;
+			return v;
+		};
+		return spread(x) | (spread(y) << 1);
+	}
+
+	//Size of the level 2 cache.  Read once.  (Assumes 256KB if it can't be found)
+	static size_t level_2_cache_size() noexcept {
+#if defined(_M_X64) || defined(__x86_64)
+		static const size_t size = [] {
+			const auto s = CpuInformation().level_2_cache_size();
+			return (s > 0) ? s : size_t{ 256 * 1024 };
+		}();
+		return size;
+#else
+		return size_t{ 256 * 1024 };
+#endif
+	}
+};
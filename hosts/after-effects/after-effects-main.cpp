@@ -135,15 +135,23 @@ PF_Err EffectMain(PF_Cmd cmd, PF_InData* in_data, PF_OutData* out_data,  PF_Para
 			break;
 
 		case PF_Cmd_SEQUENCE_SETUP:
+			after_effects_sequence_setup(in_data, out_data);
 			break;
 
 		case PF_Cmd_SEQUENCE_RESETUP:
+			after_effects_sequence_resetup(in_data, out_data);
 			break;
 
 		case PF_Cmd_SEQUENCE_FLATTEN:
+			out_data->sequence_data = in_data->sequence_data;	//Already flat (see after-effects-render.cpp)
+			break;
+
+		case PF_Cmd_GET_FLATTENED_SEQUENCE_DATA:
+			after_effects_get_flattened_sequence_data(in_data, out_data);
 			break;
 
 		case PF_Cmd_SEQUENCE_SETDOWN:
+			after_effects_sequence_setdown(in_data, out_data);
 			break;
 
 		case PF_Cmd_SMART_PRE_RENDER:
@@ -253,6 +261,9 @@ static void after_effects_parameter_setup(PF_OutData* out_data) {
 			ParameterHelper::AddList(p.id, p.name, list_string, 1);
 			break;
 		}
+		case ParameterType::file:
+			//No file parameter in After Effects.  (The value is left empty)
+			break;
 
 		default:
 			break;
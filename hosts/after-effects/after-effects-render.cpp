@@ -36,10 +36,31 @@ Description:
 #include "after-effects-render.h"
 #include "after-effects-parameter-helper.h"
 #include "..\..\common\util.h"
+#include "..\..\common\cancellation.h"
+#include "..\..\common\frame-history.h"
+#include "..\..\common\image-statistics.h"
+#include "..\..\common\pixel-store.h"
+#include "..\..\common\render-block.h"
 
 #include "..\..\common\simd-cpuid.h"
 #include "..\..\common\simd-f32.h"
+#include "..\..\common\simd-f64.h"
 #include "..\..\common\simd-uint32.h"
+#include "..\..\common\simd-width-tuner.h"
+#include "..\..\common\tile-scheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 template <SimdFloat S>
 struct RenderData {
@@ -51,6 +72,39 @@ struct RenderData {
 	PF_EffectWorld* output{};
 	uint8_t* input_pixels{};
 	A_u_long rowbytes{};
+	TileScheduler* tiles{};		//Hands out the tiles of the area to threads
+	std::atomic<int> tiles_done{};	//For the progress bar
+	CancellationToken* cancel{};	//Checked between tiles.  (Cancelled by the calling thread if After Effects aborts the render)
+	CancellationToken::Clock::time_point batch_end{};	//Threads stop taking tiles after this, so the calling thread can ask After Effects
+	bool streaming_stores{};	//Write output with non-temporal stores (32-bit only)
+	DraftFrame* draft{};		//Draft quality: only the pattern's pixels are rendered, and kept here (see checkerboard.h)
+	std::shared_ptr<const DraftFrame> complete{};	//Full quality: the pixels a draft of this frame rendered
+};
+
+//Data kept for each instance of the effect.  (Found from the instance id in its sequence data)
+struct InstanceData {
+	//The depth of the last frame rendered, so the next frame's rays can start from it.  (See frame-history.h)
+	std::mutex history_mutex;
+	std::shared_ptr<const FrameHistory> frame_history;
+
+	//The last draft rendered, so a full quality render of the same frame only renders the rest.  (See checkerboard.h)
+	std::mutex draft_mutex;
+	std::shared_ptr<const DraftFrame> draft_frame;
+};
+
+//Sequence data.  It has no pointers, so it is already flat.
+struct SequenceData {
+	uint64_t instance_id{};
+};
+
+//Data for the input statistics pre-pass.
+template <SimdFloat S>
+struct StatisticsData {
+	const PF_EffectWorld* layer{};
+	PF_Rect area{};
+	int bit_depth{};
+	int step{ 1 };		//Measure every step'th line and vector.  (Earlier frames are only sampled)
+	std::vector<ImageStatistics> partial{};	//One per stripe of lines.  Merged once all are done.
 };
 
 constexpr unsigned short adobe_white16 = 0x8000;
@@ -60,11 +114,17 @@ Copies a value to the output buffer. (32-bit components)
 Note: If we are using SIMD the value may contain multiple pixels.
 *******************************************************************************************************/
 template <SimdFloat S>
-void copy_to_output_32(PF_EffectWorld* output, int x, int y, int max_x, const ColourRGBA<S>& c) {
+void copy_to_output_32(PF_EffectWorld* output, int x, int y, int max_x, const ColourRGBA<S>& c, bool streaming = false) {
 	//Advance pointer to correct line (y).  (We must multiply by rowbytes in case the lines are padded.)  
 	auto ptrY = (uint8_t*)output->data;
 	ptrY += y * output->rowbytes;
 
+	//Whole vector.  Transposed to ARGB in registers.
+	if (x + S::number_of_elements() <= max_x) [[likely]] {
+		store_pixels_float<PixelOrder::argb>((float*)(ptrY + x * 4 * sizeof(float)), c, streaming);
+		return;
+	}
+
 	for (int i = 0; i < S::number_of_elements(); i++) {
 		if (x + i >= max_x) break;
 		auto ptrByte = ptrY + (x + i) * 4 * sizeof(float);  //Advance to x location.
@@ -194,6 +254,27 @@ static inline ColourRGBA<Simd512Float32> gather_image_data_avx512(float* in) {
 	return ColourRGBA<Simd512Float32>(red, green, blue, alpha);
 }
 
+/*******************************************************************************************************
+Gathers 32-bit ARGB data into SIMD vectors of type S, returning a ColourRGBA struct.
+Float32 vectors use the functions above.  Others (Float64) load each element.
+*******************************************************************************************************/
+template <SimdFloat S>
+static inline ColourRGBA<S> gather_image_data(float* in) {
+	if constexpr (std::is_same_v<S, Simd128Float32>) return gather_image_data_sse(in);
+	else if constexpr (std::is_same_v<S, Simd256Float32>) return gather_image_data_avx(in);
+	else if constexpr (std::is_same_v<S, Simd512Float32>) return gather_image_data_avx512(in);
+	else {
+		ColourRGBA<S> c{};
+		for (int i = 0; i < S::number_of_elements(); i++) {
+			c.alpha.set_element(i, in[i * 4]);
+			c.red.set_element(i, in[i * 4 + 1]);
+			c.green.set_element(i, in[i * 4 + 2]);
+			c.blue.set_element(i, in[i * 4 + 3]);
+		}
+		return c;
+	}
+}
+
 
 
 
@@ -202,62 +283,55 @@ static inline ColourRGBA<Simd512Float32> gather_image_data_avx512(float* in) {
 8-bit
 *******************************************************************************************************/
 template <SimdFloat S>
-static inline ColourRGBA<S> read_input_pixel8(const RenderData<S>* rd, int x, int y) {	
-	const int sourceOffset = ((rd->inputLayer->rowbytes * y) + (x * 4 * sizeof(uint8_t)));
-	uint8_t* ptr = reinterpret_cast<uint8_t*>(sourceOffset + reinterpret_cast<uint8_t*>(rd->inputLayer->data));
+static inline ColourRGBA<S> read_input_pixel8(const PF_EffectWorld* layer, int x, int y, int count = S::number_of_elements()) {	
+	const int sourceOffset = ((layer->rowbytes * y) + (x * 4 * sizeof(uint8_t)));
+	uint8_t* ptr = reinterpret_cast<uint8_t*>(sourceOffset + reinterpret_cast<uint8_t*>(layer->data));
 
 	//Convert to float data  (probably better to use simd)
 	alignas(sizeof(S)) std::array<float, S::number_of_elements() * 4> float_data;
 	for (int i = 0; i < S::number_of_elements() * 4; i++) {
-		float_data[i] = static_cast<float>(*ptr++) / static_cast<float>(white8);
+		float_data[i] = (i < count * 4) ? static_cast<float>(*ptr++) / static_cast<float>(white8) : 0.0f;
 	}
 
 	//Gather colour data into SIMD vectors
-	if constexpr (sizeof(S) == 16) 	return gather_image_data_sse(&float_data[0]);
-	if constexpr (sizeof(S) == 32) 	return gather_image_data_avx(&float_data[0]);
-	if constexpr (sizeof(S) == 64) 	return gather_image_data_avx512(&float_data[0]);
-	
-
-	return ColourRGBA<S>{};
-	
+	return gather_image_data<S>(&float_data[0]);
 }
 
 /*******************************************************************************************************
 16-bit
 *******************************************************************************************************/
 template <SimdFloat S>
-static inline ColourRGBA<S> read_input_pixel16(const RenderData<S>* rd, int x, int y) {
-	const int sourceOffset = ((rd->inputLayer->rowbytes * y) + (x * 4 * sizeof(uint16_t)));
-	uint16_t* ptr = reinterpret_cast<uint16_t*>(sourceOffset + reinterpret_cast<uint8_t*>(rd->inputLayer->data));
+static inline ColourRGBA<S> read_input_pixel16(const PF_EffectWorld* layer, int x, int y, int count = S::number_of_elements()) {
+	const int sourceOffset = ((layer->rowbytes * y) + (x * 4 * sizeof(uint16_t)));
+	uint16_t* ptr = reinterpret_cast<uint16_t*>(sourceOffset + reinterpret_cast<uint8_t*>(layer->data));
 	
 	//Convert to float data (probably better to use simd)
 	alignas(sizeof(S)) std::array<float, S::number_of_elements() * 4> float_data;
 	for (int i = 0; i < S::number_of_elements() * 4; i++) {
-		float_data[i] = static_cast<float>(*ptr++)/ static_cast<float>(adobe_white16);
+		float_data[i] = (i < count * 4) ? static_cast<float>(*ptr++) / static_cast<float>(adobe_white16) : 0.0f;
 	}	
 
 	//Gather colour data into SIMD vectors
-	if constexpr (sizeof(S) == 16) return gather_image_data_sse(&float_data[0]);
-	if constexpr (sizeof(S) == 32) 	return gather_image_data_avx(&float_data[0]);
-	if constexpr (sizeof(S) == 64) 	return gather_image_data_avx512(&float_data[0]);
-	
-
-	return ColourRGBA<S>{};
+	return gather_image_data<S>(&float_data[0]);
 }
 
 /*******************************************************************************************************
 32-bit
 *******************************************************************************************************/
 template <SimdFloat S>
-static inline ColourRGBA<S> read_input_pixel32(const RenderData<S>* rd, int x, int y) {
-	const int sourceOffset = ((rd->inputLayer->rowbytes * y) + (x * 4 * sizeof(float))) ;
-	float* ptr = reinterpret_cast<float*>(sourceOffset + reinterpret_cast<uint8_t*>(rd->inputLayer->data));
+static inline ColourRGBA<S> read_input_pixel32(const PF_EffectWorld* layer, int x, int y, int count = S::number_of_elements()) {
+	const int sourceOffset = ((layer->rowbytes * y) + (x * 4 * sizeof(float))) ;
+	float* ptr = reinterpret_cast<float*>(sourceOffset + reinterpret_cast<uint8_t*>(layer->data));
+
+	//Part of a vector (the end of a tile).  The pixels past the end are not read, as another thread may be writing them.
+	if (count < S::number_of_elements()) [[unlikely]] {
+		alignas(sizeof(S)) std::array<float, S::number_of_elements() * 4> float_data{};
+		std::copy_n(ptr, count * 4, float_data.begin());
+		return gather_image_data<S>(&float_data[0]);
+	}
 	
 	//Gather colour data into SIMD vectors
-	if constexpr (sizeof(S) == 16) return gather_image_data_sse(ptr);
-	if constexpr (sizeof(S) == 32) 	return gather_image_data_avx(ptr);
-	if constexpr (sizeof(S) == 64) 	return gather_image_data_avx512(ptr);
-	return ColourRGBA<S>{};
+	return gather_image_data<S>(ptr);
 }
 
 
@@ -268,15 +342,15 @@ Renders a pixel (or a simd vector's worth of pixels)
 Passes of to actual project renderer
 *******************************************************************************************************/
 template <SimdFloat S>
-static inline void render_pixel8(const RenderData<S> * rd, int x, int y) {
+static inline void render_pixel8(const RenderData<S> * rd, int x, int y, int max_x) {
 	if constexpr (project_uses_input) {
-		ColourRGBA<S> input_colour = read_input_pixel8(rd,x,y);
+		ColourRGBA<S> input_colour = read_input_pixel8<S>(rd->inputLayer, x, y, std::min(S::number_of_elements(), max_x - x));
 		auto c =  rd->renderer.render_pixel_with_input(S::make_sequential(static_cast<S::F>(x)), S(static_cast<S::F>(y)), input_colour);
-		copy_to_output_8(rd->output, x, y, rd->area.right, c);
+		copy_to_output_8(rd->output, x, y, max_x, c);
 	}
 	else {
 		auto c = rd->renderer.render_pixel(S::make_sequential(static_cast<S::F>(x)), S(static_cast<S::F>(y)));
-		copy_to_output_8(rd->output, x, y, rd->area.right, c);
+		copy_to_output_8(rd->output, x, y, max_x, c);
 	}
 }
 
@@ -286,15 +360,15 @@ Renders a pixel (or a simd vector's worth of pixels)
 Passes of to actual project renderer
 *******************************************************************************************************/
 template <SimdFloat S>
-static inline void render_pixel16(const RenderData<S>* rd, int x, int y) {
+static inline void render_pixel16(const RenderData<S>* rd, int x, int y, int max_x) {
 	if constexpr (project_uses_input) {
-		ColourRGBA<S> input_colour = read_input_pixel16(rd,x,y);
+		ColourRGBA<S> input_colour = read_input_pixel16<S>(rd->inputLayer, x, y, std::min(S::number_of_elements(), max_x - x));
 		auto c = rd->renderer.render_pixel_with_input(S::make_sequential(static_cast<S::F>(x)), S(static_cast<S::F>(y)), input_colour);
-		copy_to_output_16(rd->output, x, y, rd->area.right, c);
+		copy_to_output_16(rd->output, x, y, max_x, c);
 	}
 	else {
 		auto c = rd->renderer.render_pixel(S::make_sequential(static_cast<S::F>(x)), S(static_cast<S::F>(y)));
-		copy_to_output_16(rd->output, x, y, rd->area.right, c);
+		copy_to_output_16(rd->output, x, y, max_x, c);
 	}
 }
 
@@ -304,95 +378,166 @@ Renders a pixel (or a simd vector's worth of pixels)
 Passes of to actual project renderer
 *******************************************************************************************************/
 template <SimdFloat S>
-static inline void render_pixel32(const RenderData<S>* rd, int x, int y) {
+static inline void render_pixel32(const RenderData<S>* rd, int x, int y, int max_x) {
 	if constexpr (project_uses_input) {
-		ColourRGBA<S> input_colour = read_input_pixel32(rd,x,y);
+		ColourRGBA<S> input_colour = read_input_pixel32<S>(rd->inputLayer, x, y, std::min(S::number_of_elements(), max_x - x));
 		auto c = rd->renderer.render_pixel_with_input(S::make_sequential(static_cast<S::F>(x)), S(static_cast<S::F>(y)), input_colour);
-		copy_to_output_32(rd->output, x, y, rd->area.right, c);
+		copy_to_output_32(rd->output, x, y, max_x, c, rd->streaming_stores);
 	}
 	else {
 		auto c = rd->renderer.render_pixel(S::make_sequential(static_cast<S::F>(x)), S(static_cast<S::F>(y)));
-		copy_to_output_32(rd->output, x, y, rd->area.right, c);
+		copy_to_output_32(rd->output, x, y, max_x, c, rd->streaming_stores);
 	}
 }
 
 
 
 /*******************************************************************************************************
-Callback for After Effects Iteration Suite.  Renders an 32-bit line of pixels.
-This thread callback will give us a line to render.
-Note: Adobe uses ARGB colour order, with unmultiplied alpha.
+Renders a pixel (or a simd vector's worth of pixels) at the given bit depth.
 *******************************************************************************************************/
-template <SimdFloat S>
-static PF_Err render_8bit_pixel_callback(void* refcon, A_long thread_idxL, A_long  i,	A_long itrtL) noexcept {
-	const auto rd = static_cast<RenderData<S> *>(refcon);
-	const auto y = i;
-	if (y < rd->area.top || y >= rd->area.bottom) [[unlikely]] return PF_Err_NONE;  //Check vertical bounds
+template <SimdFloat S, int bit_depth>
+static inline void render_pixel(const RenderData<S>* rd, int x, int y, int max_x) {
+	if constexpr (bit_depth == 8) render_pixel8<S>(rd, x, y, max_x);
+	else if constexpr (bit_depth == 16) render_pixel16<S>(rd, x, y, max_x);
+	else render_pixel32<S>(rd, x, y, max_x);
+}
+
 
-	int x = rd->area.left;
-	for (; x < rd->area.right - S::number_of_elements() + 1; x += S::number_of_elements()) {		
-		render_pixel8<S>(rd, x, y);		
+/*******************************************************************************************************
+Renders a tile.  Nothing outside the tile is written, as other threads are rendering the tiles around it.
+Without input, the tile is rendered as a block (see render-block.h).  Each thread keeps its own block,
+so the buffers are reused.  Otherwise each line of the tile is rendered a vector at a time, with the
+input of the next line prefetched.
+*******************************************************************************************************/
+template <SimdFloat S, int bit_depth>
+static void render_tile(const RenderData<S>* rd, const Tile& tile) {
+	constexpr int n = S::number_of_elements();
+	if constexpr (!project_uses_input) {
+		thread_local BlockOutput<S> block{};
+		if (rd->draft) render_block_draft(rd->renderer, tile.x1, tile.y1, tile.x2 - tile.x1, tile.y2 - tile.y1, block, *rd->draft);
+		else if (rd->complete) complete_block(rd->renderer, tile.x1, tile.y1, tile.x2 - tile.x1, tile.y2 - tile.y1, block, *rd->complete);
+		else render_block(rd->renderer, tile.x1, tile.y1, tile.x2 - tile.x1, tile.y2 - tile.y1, block);
+		for (int j = 0; j < block.height; j++) {
+			for (int i = 0; i < block.vectors_per_row; i++) {
+				const int x = tile.x1 + i * n;
+				if constexpr (bit_depth == 8) copy_to_output_8(rd->output, x, tile.y1 + j, tile.x2, block.get(i, j));
+				else if constexpr (bit_depth == 16) copy_to_output_16(rd->output, x, tile.y1 + j, tile.x2, block.get(i, j));
+				else copy_to_output_32(rd->output, x, tile.y1 + j, tile.x2, block.get(i, j), 0, rd->streaming_stores);
+			}
+		}
 	}
-	
-	//Handle the case where the width is not a multiple of S::number_of_elements
-	if (x < rd->area.right && rd->area.right>S::number_of_elements()) [[unlikely]] {		
-		x -= S::number_of_elements() - (rd->area.right - x);		
-		render_pixel8<S>(rd, x, y);		
+	else {
+		constexpr size_t pixel_bytes = 4 * (bit_depth / 8);
+		for (int y = tile.y1; y < tile.y2; y++) {
+			const uint8_t* next_input{ nullptr };
+			if (rd->inputLayer && y + 1 < tile.y2) next_input = reinterpret_cast<const uint8_t*>(rd->inputLayer->data) + (y + 1) * rd->inputLayer->rowbytes;
+
+			int x = tile.x1;
+			for (; x < tile.x2 - n + 1; x += n) {
+				if (next_input) prefetch_pixels(next_input + x * pixel_bytes, n * pixel_bytes);
+				render_pixel<S, bit_depth>(rd, x, y, tile.x2);
+			}
+
+			//Handle the case where the width is not a multiple of S::number_of_elements
+			//The last vector is only partly inside the tile.  Only the pixels inside the tile are read and written,
+			//as other threads are rendering the tiles next to it.  (And the input may be the output)
+			if (x < tile.x2) [[unlikely]] {
+				render_pixel<S, bit_depth>(rd, x, y, tile.x2);
+			}
+		}
 	}
+}
+
 
+/*******************************************************************************************************
+Callback for After Effects Iteration Suite.  Renders tiles until there are none left.
+Iteration i takes tiles from queue i, then steals from the others.  (See tile-scheduler.h)
+Stops taking tiles once the render is cancelled, or at the end of the batch.  (After its first tile)
+Note: Adobe uses ARGB colour order, with unmultiplied alpha.  Adobe 16 bit is not full 16-bit.  White is 0x8000
+*******************************************************************************************************/
+template <SimdFloat S, int bit_depth>
+static PF_Err render_tiles_callback(void* refcon, A_long, A_long i, A_long) noexcept {
+	const auto rd = static_cast<RenderData<S> *>(refcon);
+	Tile tile{};
+	bool first = true;
+	while (!rd->cancel->is_cancelled() && (first || CancellationToken::Clock::now() < rd->batch_end) && rd->tiles->next(static_cast<int>(i), tile)) {
+		render_tile<S, bit_depth>(rd, tile);
+		rd->tiles_done.fetch_add(1, std::memory_order_relaxed);
+		first = false;
+	}
+	if constexpr (bit_depth == 32) {
+		if (rd->streaming_stores) streaming_store_fence();
+	}
 	return PF_Err_NONE;
+}
 
+
+/*******************************************************************************************************
+Callback for After Effects Iteration Suite.  Measures one stripe of the input for the statistics pre-pass.
+Stripe i takes every n'th line (starting at line i) and writes only to partial[i], so no locking is needed.
+*******************************************************************************************************/
+template <SimdFloat S>
+static PF_Err input_statistics_callback(void* refcon, A_long, A_long i, A_long) noexcept {
+	const auto sd = static_cast<StatisticsData<S> *>(refcon);
+	const auto layer = sd->layer;
+	const auto& area = sd->area;
+	const int stripes = static_cast<int>(sd->partial.size());
+	constexpr int n = S::number_of_elements();
+
+	const auto read = [sd, layer](int x, int y) {
+		if (sd->bit_depth == 8) return read_input_pixel8<S>(layer, x, y);
+		if (sd->bit_depth == 16) return read_input_pixel16<S>(layer, x, y);
+		return read_input_pixel32<S>(layer, x, y);
+	};
+
+	ImageStatisticsAccumulator<S> accumulator{};
+	for (int y = area.top + i * sd->step; y < area.bottom; y += stripes * sd->step) {
+		int x = area.left;
+		for (; x < area.right - n + 1; x += n * sd->step) {
+			accumulator.add(read(x, y));
+		}
+		//The last vector overlaps the previous one.  Only the new lanes are counted.
+		if (sd->step == 1 && x < area.right && area.right - area.left >= n) [[unlikely]] {
+			const int start = area.right - n;
+			accumulator.add(read(start, y), x - start);
+		}
+		accumulator.end_row();
+	}
+	sd->partial[i] = accumulator.finish();
+	return PF_Err_NONE;
 }
 
 /*******************************************************************************************************
-Callback for After Effects Iteration Suite.  Renders an 16-bit pixel.
-Note: Adobe 16 bit is not full 16-bit.  White is 0x8000
-Note: Adobe uses ARGB colour order, with unmultiplied alpha.
+Measure an input layer before rendering.  (e.g. for auto exposure)
 *******************************************************************************************************/
 template <SimdFloat S>
-static PF_Err render_16bit_pixel_callback(void* refcon, A_long , A_long  i, A_long itrtL) noexcept {
-	const auto rd = static_cast<RenderData<S> *>(refcon);
-	const auto y = i;
-	if (y < rd->area.top || y >= rd->area.bottom) [[unlikely]] return PF_Err_NONE;  //Check vertical bounds
+static ImageStatistics gather_input_statistics(PF_InData* in_data, const PF_EffectWorld* layer, const PF_Rect& area, int bit_depth, int step = 1) {
+	StatisticsData<S> sd{};
+	sd.layer = layer;
+	sd.area = area;
+	sd.bit_depth = bit_depth;
+	sd.step = step;
+	sd.partial.resize(std::max(1u, std::thread::hardware_concurrency()));
 
-	int x = rd->area.left;
-	for (; x < rd->area.right - S::number_of_elements() + 1; x += S::number_of_elements()) {
-		render_pixel16<S>(rd, x, y);		
-	}
+	AEGP_SuiteHandler suites(in_data->pica_basicP);
+	check_after_effects(suites.Iterate8Suite1()->iterate_generic(static_cast<A_long>(sd.partial.size()), &sd, input_statistics_callback<S>));
 
-	//Handle the case where the width is not a multiple of S::number_of_elements
-	if (x < rd->area.right && rd->area.right>S::number_of_elements()) [[unlikely]] {
-		x -= S::number_of_elements() - (rd->area.right - x);
-		render_pixel16<S>(rd, x, y);		
-	}
-	return PF_Err_NONE;	
+	ImageStatistics stats{};
+	for (const auto& p : sd.partial) stats.merge(p);
+	return stats;
 }
 
 
-
 /*******************************************************************************************************
-Callback for After Effects Iteration Suite.  Renders an 32-bit line of pixels.
-This thread callback will give us a line to render.
-Note: Adobe uses ARGB colour order, with unmultiplied alpha.
+Callback for After Effects Iteration Suite.  Prepares one line of the renderer's pre-pass.
+(Renderers that evaluate something at low resolution before rendering, see begin_prepare())
 *******************************************************************************************************/
 template <SimdFloat S>
-static PF_Err render_32bit_pixel_callback(void* refcon, A_long , A_long  i, A_long itrtL) noexcept {
+static PF_Err prepare_line_callback(void* refcon, A_long, A_long i, A_long) noexcept {
 	const auto rd = static_cast<RenderData<S> *>(refcon);
-	const auto y = i;
-	if (y < rd->area.top || y>= rd->area.bottom) [[unlikely]] return PF_Err_NONE;  //Check vertical bounds
-	
-	int x = rd->area.left;
-	for (; x < rd->area.right - S::number_of_elements() + 1; x += S::number_of_elements()) {
-		render_pixel32<S>(rd, x, y);		
-	}	
-
-	//Handle the case where the width is not a multiple of S::number_of_elements
-	if (x < rd->area.right && rd->area.right>S::number_of_elements()) [[unlikely]] {
-		x -= S::number_of_elements() - (rd->area.right - x);
-		render_pixel32<S>(rd, x, y);		
-	}
+	if (rd->cancel->is_cancelled()) return PF_Err_NONE;
+	rd->renderer.prepare_line(i);
 	return PF_Err_NONE;
-
 }
 
 
@@ -412,6 +557,15 @@ static std::tuple<int, int> calculate_size(const PF_InData* in_data) {
 	return std::tuple<int, int>(width, height);
 }
 
+/*******************************************************************************************************
+The downsample factor of a low resolution render.  (The larger of x & y.  1 at full resolution)
+*******************************************************************************************************/
+static double calculate_downsample(const PF_InData* in_data) {
+	const double x = static_cast<double>(in_data->downsample_x.den) / static_cast<double>(in_data->downsample_x.num);
+	const double y = static_cast<double>(in_data->downsample_y.den) / static_cast<double>(in_data->downsample_y.num);
+	return std::max(x, y);
+}
+
 /*******************************************************************************************************
 Read Parameters from After Effects and put into data into our parameter list.
 *******************************************************************************************************/
@@ -438,9 +592,10 @@ ParameterList read_parameters() {
 
 /*******************************************************************************************************
 Setup Host Independant Renderer
+Returns a hash of the parameter values.  (See draft_frame_key())
 *******************************************************************************************************/
 template <typename S>
-void setup_render(Renderer<S>& renderer, const PF_InData* in_data, int width, int height) {
+uint64_t setup_render(Renderer<S>& renderer, const PF_InData* in_data, int width, int height, int bit_depth) {
 	check_null(in_data);
 	auto params = read_parameters();
 	
@@ -449,9 +604,33 @@ void setup_render(Renderer<S>& renderer, const PF_InData* in_data, int width, in
 	if (params.contains(ParameterID::seed)) {
 		renderer.set_seed_int(static_cast<uint32_t>(params.get_value(ParameterID::seed)));
 	}
+
+	//Renderers that bake tables for the input format need to know it before set_parameters
+	if constexpr (requires { renderer.set_input_bit_depth(bit_depth); }) {
+		renderer.set_input_bit_depth(bit_depth);
+	}
+	//Renderers with quality tiers do less per pixel in low resolution and draft previews (see quality-tier.h)
+	if constexpr (requires { renderer.set_preview(1.0, false); }) {
+		renderer.set_preview(calculate_downsample(in_data), in_data->quality == PF_Quality_LO);
+	}
 	
+	const uint64_t parameter_hash = params.hash();
 	renderer.set_parameters(std::move(params));
-	
+	return parameter_hash;
+}
+
+/*******************************************************************************************************
+The number of earlier input frames the renderer measures.  (e.g. to smooth auto exposure over a sequence)
+*******************************************************************************************************/
+template <typename R>
+static int earlier_input_frames(const ParameterList& params) {
+	if constexpr (requires { R::earlier_input_frames(params); }) return R::earlier_input_frames(params);
+	else return 0;
+}
+
+//Pre-render data: the number of earlier input frames checked out.
+static void delete_earlier_frames(void* pre_render_data) {
+	delete static_cast<int*>(pre_render_data);
 }
 
 /*******************************************************************************************************
@@ -473,6 +652,21 @@ void after_effects_smart_pre_render(const PF_InData* in_data, PF_PreRenderExtra*
 	if constexpr (project_uses_input) {
 		check_after_effects(preRender->cb->checkout_layer(in_data->effect_ref, 0, 0, &preRender->input->output_request, in_data->current_time, in_data->time_step, in_data->time_scale, &inputLayer));
 	}
+	//Checkout earlier input frames the renderer measures (as checkout ids 1, 2, ...).  None before the start of the composition.
+	if constexpr (project_uses_input) {
+		const int earlier = earlier_input_frames<Renderer<FallbackFloat32>>(read_parameters());
+		int frames = 0;
+		for (int k = 1; k <= earlier && in_data->current_time - k * in_data->time_step >= 0; k++) {
+			PF_CheckoutResult earlierLayer{};
+			check_after_effects(preRender->cb->checkout_layer(in_data->effect_ref, 0, k, &preRender->input->output_request, in_data->current_time - k * in_data->time_step, in_data->time_step, in_data->time_scale, &earlierLayer));
+			frames = k;
+		}
+		if (frames > 0) {
+			preRender->output->pre_render_data = new int(frames);
+			preRender->output->delete_pre_render_data_func = delete_earlier_frames;
+		}
+	}
+
 	const auto r = preRender->input->output_request.rect;
 	//const auto in = inputLayer.result_rect;
 	
@@ -495,30 +689,301 @@ void after_effects_smart_pre_render(const PF_InData* in_data, PF_PreRenderExtra*
 }
 
 
+/*******************************************************************************************************
+The data of each instance, by instance id, with the sequence data handles that hold the id.
+Copies of an instance's sequence data keep its id, so they share its data.  (After Effects copies it to the
+threads that render frames.  A duplicated effect is a copy too, which is safe to share with, as the draft
+key and the frame history are checked before they are used)
+*******************************************************************************************************/
+struct InstanceEntry {
+	std::vector<PF_Handle> sequence_data;
+	std::shared_ptr<InstanceData> data;
+};
+static std::mutex instances_mutex;
+static std::unordered_map<uint64_t, InstanceEntry> instances;
+
+/*******************************************************************************************************
+A new instance id.
+Ids start from a random number, so an id saved in a project is unlikely to match another live instance.
+*******************************************************************************************************/
+static uint64_t new_instance_id() {
+	static std::atomic<uint64_t> next_id{ (static_cast<uint64_t>(std::random_device{}()) << 32) | 1 };
+	return next_id.fetch_add(1);
+}
+
+/*******************************************************************************************************
+Adds (or removes) a sequence data handle holding an instance id.
+The instance's data is released once no sequence data holds its id.
+*******************************************************************************************************/
+static void add_sequence_data(uint64_t id, PF_Handle handle) {
+	std::scoped_lock lock(instances_mutex);
+	auto& entry = instances[id];
+	if (!entry.data) entry.data = std::make_shared<InstanceData>();
+	if (std::find(entry.sequence_data.begin(), entry.sequence_data.end(), handle) == entry.sequence_data.end()) entry.sequence_data.push_back(handle);
+}
+
+static void remove_sequence_data(uint64_t id, PF_Handle handle) {
+	std::scoped_lock lock(instances_mutex);
+	const auto found = instances.find(id);
+	if (found == instances.end()) return;
+	auto& handles = found->second.sequence_data;
+	handles.erase(std::remove(handles.begin(), handles.end(), handle), handles.end());
+	if (handles.empty()) instances.erase(found);
+}
+
+/*******************************************************************************************************
+Reads the instance id from the sequence data.  (0 if there is none)
+While rendering, it is read through the const sequence data suite.  (Multi-frame rendering)
+*******************************************************************************************************/
+static uint64_t read_instance_id(const PF_InData* in_data, bool rendering = false) {
+	const void* data = (in_data->sequence_data) ? *in_data->sequence_data : nullptr;
+	const PF_EffectSequenceDataSuite1* suite{ nullptr };
+	if (rendering && in_data->pica_basicP && in_data->pica_basicP->AcquireSuite(kPFEffectSequenceDataSuite, kPFEffectSequenceDataSuiteVersion1, reinterpret_cast<const void**>(&suite)) == kSPNoError && suite) {
+		PF_ConstHandle handle{ nullptr };
+		if (suite->PF_GetConstSequenceData(in_data->effect_ref, &handle) == PF_Err_NONE && handle) data = *handle;
+		in_data->pica_basicP->ReleaseSuite(kPFEffectSequenceDataSuite, kPFEffectSequenceDataSuiteVersion1);
+	}
+	if (!data) return 0;
+	return static_cast<const SequenceData*>(data)->instance_id;
+}
+
+/*******************************************************************************************************
+Finds the data of the instance being rendered.
+Renders without sequence data (or with an id that isn't set up) share the data of id 0.
+*******************************************************************************************************/
+static std::shared_ptr<InstanceData> find_instance_data(const PF_InData* in_data) {
+	const uint64_t id = read_instance_id(in_data, true);
+	std::scoped_lock lock(instances_mutex);
+	auto found = instances.find(id);
+	if (found == instances.end()) found = instances.try_emplace(0).first;
+	if (!found->second.data) found->second.data = std::make_shared<InstanceData>();
+	return found->second.data;
+}
+
+
+/*******************************************************************************************************
+After Effects Sequence Setup Command
+A new instance.  Its sequence data holds its id.
+*******************************************************************************************************/
+void after_effects_sequence_setup(const PF_InData* in_data, PF_OutData* out_data) {
+	check_null(in_data);
+	check_null(out_data);
+	PF_Handle handle = PF_NEW_HANDLE(sizeof(SequenceData));
+	check_null(handle);
+	auto data = static_cast<SequenceData*>(PF_LOCK_HANDLE(handle));
+	data->instance_id = new_instance_id();
+	add_sequence_data(data->instance_id, handle);
+	PF_UNLOCK_HANDLE(handle);
+	out_data->sequence_data = handle;
+}
+
+/*******************************************************************************************************
+After Effects Sequence Resetup Command
+Sequence data that was flattened, saved or copied.  It keeps its id.
+*******************************************************************************************************/
+void after_effects_sequence_resetup(const PF_InData* in_data, PF_OutData* out_data) {
+	check_null(in_data);
+	check_null(out_data);
+	if (!in_data->sequence_data || PF_GET_HANDLE_SIZE(in_data->sequence_data) < sizeof(SequenceData)) {
+		after_effects_sequence_setup(in_data, out_data);
+		return;
+	}
+	PF_Handle handle = in_data->sequence_data;
+	auto data = static_cast<SequenceData*>(PF_LOCK_HANDLE(handle));
+	if (data->instance_id == 0) data->instance_id = new_instance_id();
+	add_sequence_data(data->instance_id, handle);
+	PF_UNLOCK_HANDLE(handle);
+	out_data->sequence_data = handle;
+}
+
+/*******************************************************************************************************
+After Effects Get Flattened Sequence Data Command
+A flat copy of the sequence data.  (e.g. for saving)  The instance keeps its own sequence data.
+*******************************************************************************************************/
+void after_effects_get_flattened_sequence_data(const PF_InData* in_data, PF_OutData* out_data) {
+	check_null(in_data);
+	check_null(out_data);
+	PF_Handle flat = PF_NEW_HANDLE(sizeof(SequenceData));
+	check_null(flat);
+	auto flat_data = static_cast<SequenceData*>(PF_LOCK_HANDLE(flat));
+	*flat_data = SequenceData{ read_instance_id(in_data) };
+	PF_UNLOCK_HANDLE(flat);
+	out_data->sequence_data = flat;
+}
+
+/*******************************************************************************************************
+After Effects Sequence Setdown Command
+This copy of the sequence data is gone.  (Renders still using the instance's data hold a reference)
+*******************************************************************************************************/
+void after_effects_sequence_setdown(const PF_InData* in_data, PF_OutData* out_data) {
+	check_null(in_data);
+	check_null(out_data);
+	if (!in_data->sequence_data) return;
+	remove_sequence_data(read_instance_id(in_data), in_data->sequence_data);
+	PF_DISPOSE_HANDLE(in_data->sequence_data);
+	out_data->sequence_data = nullptr;
+}
+
+
+/*******************************************************************************************************
+Shows a problem the renderer found (e.g. a 3D LUT file that can't be loaded).  The render still goes ahead.
+Each message is shown once, rather than on every frame.
+*******************************************************************************************************/
+static void show_renderer_message(PF_OutData* out_data, const std::string& message) {
+	static std::mutex mutex{};
+	static std::string last_message{};
+	std::scoped_lock lock(mutex);
+	if (message == last_message) return;
+	last_message = message;
+	if (message.empty() || !out_data) return;
+
+	std::ostringstream ss;
+	ss << "Error in \"" << PluginName << "\"\n\n" << message;
+	strncpy_s(out_data->return_msg, ss.str().c_str(), sizeof(out_data->return_msg) - 1);
+	out_data->out_flags |= PF_OutFlag_DISPLAY_ERROR_MESSAGE;
+}
+
+
 /*******************************************************************************************************
 Template function built based on SIMD type (which is CPU dependant)
 *******************************************************************************************************/
 template <SimdFloat S>
-void after_effect_cpu_dispatch(int width, int height, PF_InData* in_data, const PF_Rect& area, int bit_depth, PF_EffectWorld* inputLayer, PF_EffectWorld* output, RenderData<S>& rd) {
-	setup_render(rd.renderer, in_data, width, height);
+void after_effect_cpu_dispatch(int width, int height, PF_InData* in_data, PF_OutData* out_data, const PF_Rect& area, int bit_depth, PF_EffectWorld* inputLayer, const std::vector<PF_EffectWorld*>& earlierLayers, PF_EffectWorld* output, RenderData<S>& rd) {
+	[[maybe_unused]] const uint64_t parameter_hash = setup_render(rd.renderer, in_data, width, height, bit_depth);
+	if constexpr (requires { rd.renderer.error_message(); }) {
+		show_renderer_message(out_data, rd.renderer.error_message());
+	}
+
+	//Stops the render if After Effects aborts it, and updates the progress bar.
+	//After Effects is only called from this thread, between passes and batches of tiles.  The worker threads only
+	//read the token.  The error it gives is returned to After Effects (by throwing it).
+	PF_Err host_error = PF_Err_NONE;
+	CancellationToken cancel{};
+	rd.cancel = &cancel;
+
+	//Large 32-bit frames are written with streaming stores, so the output doesn't push the input out of the cache.
+	//Not used when rendering in place (input is output), as the lines are already in the cache.
+	//(After Effects isn't asked to render in place, so this only guards against it passing the same world for both)
+	const bool in_place = inputLayer && inputLayer->data == output->data;
+	if (bit_depth == 32 && !in_place) {
+		const size_t frame_bytes = static_cast<size_t>(output->rowbytes) * output->height * (inputLayer ? 2 : 1);
+		rd.streaming_stores = use_streaming_stores(frame_bytes);
+	}
+
+	//Pre-pass over the whole input (e.g. for auto exposure).  Earlier frames are only sampled (every 4th line and vector).
+	if constexpr (project_uses_input && requires { rd.renderer.set_input_statistics(ImageStatistics{}); }) {
+		if (rd.renderer.uses_input_statistics() && inputLayer) {
+			std::vector<ImageStatistics> earlier{};
+			for (const auto layer : earlierLayers) {
+				if (!layer) break;
+				PF_Rect whole;
+				whole.left = 0;
+				whole.right = layer->width;
+				whole.top = 0;
+				whole.bottom = layer->height;
+				earlier.push_back(gather_input_statistics<S>(in_data, layer, whole, bit_depth, 4));
+			}
+			rd.renderer.set_input_statistics(gather_input_statistics<S>(in_data, inputLayer, rd.area, bit_depth), earlier);
+		}
+	}
 	
 	AEGP_SuiteHandler suites(in_data->pica_basicP);
-	switch (bit_depth) {
-	case 8:
-	{
-		check_after_effects(suites.Iterate8Suite1()->iterate_generic(rd.height, &rd , render_8bit_pixel_callback<S>));
-		break;
+
+	[[maybe_unused]] const auto instance = find_instance_data(in_data);
+
+	//Start from the last frame's depth (renderers that march rays)
+	if constexpr (requires { rd.renderer.set_previous_frame(nullptr); }) {
+		std::scoped_lock lock(instance->history_mutex);
+		rd.renderer.set_previous_frame(instance->frame_history);
 	}
-	case 16: {
-		check_after_effects(suites.Iterate8Suite1()->iterate_generic(rd.height, &rd, render_16bit_pixel_callback<S>));
-		break;
+
+	//Renderer pre-pass (e.g. low resolution evaluation)
+	if constexpr (requires { rd.renderer.begin_prepare(); }) {
+		if constexpr (requires { rd.renderer.set_render_window(0, 0, 0, 0); }) {
+			rd.renderer.set_render_window(rd.area.left, rd.area.top, rd.area.right, rd.area.bottom);
+		}
+		const int lines = rd.renderer.begin_prepare();
+		if (lines > 0) {
+			check_after_effects(suites.Iterate8Suite1()->iterate_generic(lines, &rd, prepare_line_callback<S>));
+		}
+		rd.renderer.end_prepare();
+		check_after_effects(PF_ABORT(in_data));
 	}
-	case 32: {
-		check_after_effects(suites.Iterate8Suite1()->iterate_generic(rd.height, &rd, render_32bit_pixel_callback<S>));
-		break;
+
+	//Draft quality (e.g. while a slider is dragged) only renders some of the pixels.  They are kept, so rendering the
+	//same frame at full quality only renders the rest.  (See checkerboard.h)
+	std::shared_ptr<DraftFrame> draft;
+	if constexpr (!project_uses_input && requires { rd.renderer.draft_pattern(); }) {
+		const uint64_t frame_key = draft_frame_key(parameter_hash, (in_data->time_scale != 0) ? static_cast<double>(in_data->current_time) / in_data->time_scale : 0.0, width, height);
+		if (in_data->quality == PF_Quality_LO && rd.renderer.draft_pattern() != DraftPattern::all) {
+			draft = std::make_shared<DraftFrame>(frame_key, rd.renderer.draft_pattern(), rd.area.left, rd.area.top, rd.area.right, rd.area.bottom);
+			rd.draft = draft.get();
+		}
+		else if (in_data->quality != PF_Quality_LO) {
+			std::scoped_lock lock(instance->draft_mutex);
+			if (instance->draft_frame && instance->draft_frame->key == frame_key) rd.complete = instance->draft_frame;
+		}
 	}
+
+	//Tiles sized for the level 2 cache, with a queue for each thread.  (Output pixels, and input pixels if read)
+	const int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+	const int bytes_per_pixel = 4 * (bit_depth / 8) * (inputLayer ? 2 : 1);
+	const auto tile_size = TileScheduler::choose_tile_size(rd.area.right - rd.area.left, rd.area.bottom - rd.area.top, threads, bytes_per_pixel);
+	TileScheduler tiles(rd.area.left, rd.area.top, rd.area.right, rd.area.bottom, threads, tile_size);
+	rd.tiles = &tiles;
+
+	//Tiles are rendered in batches of about batch_time.  Between them, this thread updates the progress bar and
+	//asks After Effects if the render was aborted.
+	constexpr auto batch_time = std::chrono::milliseconds(50);
+	PF_Err(*callback)(void*, A_long, A_long, A_long) = nullptr;
+	switch (bit_depth) {
+	case 8: callback = render_tiles_callback<S, 8>; break;
+	case 16: callback = render_tiles_callback<S, 16>; break;
+	case 32: callback = render_tiles_callback<S, 32>; break;
 	default: break;
 	}
+	while (callback && !cancel.was_cancelled() && rd.tiles_done.load(std::memory_order_relaxed) < tiles.size()) {
+		rd.batch_end = CancellationToken::Clock::now() + batch_time;
+		check_after_effects(suites.Iterate8Suite1()->iterate_generic(threads, &rd, callback));
+		host_error = PF_PROGRESS(in_data, rd.tiles_done.load(std::memory_order_relaxed), tiles.size());
+		if (host_error != PF_Err_NONE) cancel.cancel();
+	}
+	rd.tiles = nullptr;
+	rd.cancel = nullptr;
+	check_after_effects(host_error);
+
+	//Keep this frame's depth for the next one.  (Not kept if the render was aborted)
+	if constexpr (requires { rd.renderer.take_frame_history(); }) {
+		auto history = rd.renderer.take_frame_history();
+		std::scoped_lock lock(instance->history_mutex);
+		instance->frame_history = std::move(history);
+	}
+
+	//Keep the draft.  (Not kept if the render was aborted)
+	if (draft) {
+		std::scoped_lock lock(instance->draft_mutex);
+		instance->draft_frame = std::move(draft);
+	}
+}
+
+
+/*******************************************************************************************************
+Chooses the SIMD width to render with.  (The override, the cache file, or the fastest at rendering a tile
+with the project's default parameters, see simd-width-tuner.h)
+*******************************************************************************************************/
+static int choose_simd_width() {
+	const auto key = simd_width_key(PluginIdentifier, PluginMajorVersion, PluginMinorVersion, PluginBugVersion, PluginBuildVersion, static_cast<int>(sizeof(Precision) * 8));
+	return tune_simd_width(key, available_simd_widths(), [](int bits) {
+		double seconds{};
+		with_simd_width<Precision>(bits, [&]<SimdFloat S>() {
+			Renderer<S> renderer{};
+			renderer.set_size(calibration_width, calibration_height);
+			renderer.set_seed("After Effects");
+			renderer.set_parameters(calibration_parameters(build_project_parameters()));
+			seconds = time_render_tile<S>(renderer, calibration_width, calibration_height, project_uses_input);
+		});
+		return seconds;
+	});
 }
 
 
@@ -526,54 +991,22 @@ void after_effect_cpu_dispatch(int width, int height, PF_InData* in_data, const
 Common Render Function to Smart and Non-Smart rendering.
 Sets up the renderer and dispatches based on CPU
 *******************************************************************************************************/
-void after_effects_common_render(int width, int height, PF_InData* in_data, const PF_Rect& area, int bit_depth, PF_EffectWorld* inputLayer, PF_EffectWorld* output) {
+void after_effects_common_render(int width, int height, PF_InData* in_data, PF_OutData* out_data, const PF_Rect& area, int bit_depth, PF_EffectWorld* inputLayer, const std::vector<PF_EffectWorld*>& earlierLayers, PF_EffectWorld* output) {
 	AEGP_SuiteHandler suites(in_data->pica_basicP);	
 
+	//The SIMD width is chosen the first time we render.  (The fastest on this machine, see simd-width-tuner.h)
+	//Elements are the project's Precision (config.h).
 	static_assert(mt::environment::is_x64, "Only x86_64 implemented");
-	if constexpr (mt::environment::compiler_has_avx512dq && mt::environment::compiler_has_avx512f) {
-		//Compiler mode supports micro architecture level 4 (AVX-512).  
-		RenderData<Simd512Float32> rd{};
-		rd.width = width;
-		rd.height = height;
-		rd.area = area;
-		rd.output = output;
-		rd.inputLayer = inputLayer;
-		after_effect_cpu_dispatch(width, height, in_data, area, bit_depth, inputLayer, output, rd);
-	}
-	else if constexpr (mt::environment::compiler_has_avx2 && mt::environment::compiler_has_avx && mt::environment::compiler_has_fma) {
-		//Compiler mode supports micro architecture level 3 (AVX2).  
-		RenderData<Simd256Float32> rd{};
+	static const int simd_width = choose_simd_width();
+	with_simd_width<Precision>(simd_width, [&]<SimdFloat S>() {
+		RenderData<S> rd{};
 		rd.width = width;
 		rd.height = height;
 		rd.area = area;
 		rd.output = output;
 		rd.inputLayer = inputLayer;
-		after_effect_cpu_dispatch(width, height, in_data, area, bit_depth, inputLayer, output, rd);
-	}
-	else {
-		//Compiler mode just supports basic x86_64 (SSE2), so we will perform runtime dispatch to AVX2 code if supported..
-		CpuInformation cpu_info{};
-		if (Simd256UInt32::cpu_supported(cpu_info) && Simd256Float32::cpu_supported(cpu_info)) {
-			//AVX & AVX2
-			RenderData<Simd256Float32> rd{};
-			rd.width = width;
-			rd.height = height;
-			rd.area = area;
-			rd.output = output;
-			rd.inputLayer = inputLayer;
-			after_effect_cpu_dispatch(width, height, in_data, area, bit_depth, inputLayer, output, rd);
-		}
-		else {
-			//SSE2 (Generic x86_64)
-			RenderData<Simd128Float32> rd{};
-			rd.width = width;
-			rd.height = height;
-			rd.area = area;
-			rd.output = output;
-			rd.inputLayer = inputLayer;
-			after_effect_cpu_dispatch(width, height, in_data, area, bit_depth, inputLayer, output, rd);
-		}
-	}
+		after_effect_cpu_dispatch(width, height, in_data, out_data, area, bit_depth, inputLayer, earlierLayers, output, rd);
+	});
 }
 
 
@@ -597,6 +1030,17 @@ void after_effects_smart_render(PF_InData* in_data, PF_OutData* out_data, PF_Sma
 		pixel_ptrP = reinterpret_cast<uint8_t*>(inputLayer->data);
 	}
 
+	//Checkout the earlier input frames (see after_effects_smart_pre_render)
+	std::vector<PF_EffectWorld*> earlierLayers{};
+	if constexpr (project_uses_input) {
+		const int frames = (smartRender->input->pre_render_data) ? *static_cast<const int*>(smartRender->input->pre_render_data) : 0;
+		for (int k = 1; k <= frames; k++) {
+			PF_EffectWorld* layer{ nullptr };
+			check_after_effects(smartRender->cb->checkout_layer_pixels(in_data->effect_ref, k, &layer));
+			earlierLayers.push_back(layer);
+		}
+	}
+
 	//Checkout Output buffer
 	PF_EffectWorld* output{ nullptr };
 	check_after_effects(smartRender->cb->checkout_output(in_data->effect_ref, &output));
@@ -611,7 +1055,7 @@ void after_effects_smart_render(PF_InData* in_data, PF_OutData* out_data, PF_Sma
 	
 	
 
-	after_effects_common_render(width, height, in_data, area, smartRender->input->bitdepth, inputLayer, output);	
+	after_effects_common_render(width, height, in_data, out_data, area, smartRender->input->bitdepth, inputLayer, earlierLayers, output);	
 }
 
 /*******************************************************************************************************
@@ -637,5 +1081,6 @@ void after_effects_non_smart_render(PF_InData* in_data, PF_OutData* out_data, PF
 	
 	int bit_depth = (output->world_flags & PF_WorldFlag_DEEP) ? 16 : 8;
 
-	after_effects_common_render(width, height, in_data, area, bit_depth, inputLayer, output);
+	//Earlier frames aren't available here.  (e.g. auto exposure isn't smoothed)
+	after_effects_common_render(width, height, in_data, out_data, area, bit_depth, inputLayer, {}, output);
 }
\ No newline at end of file
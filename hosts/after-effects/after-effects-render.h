@@ -33,4 +33,10 @@ Description:
 
 void after_effects_smart_pre_render(const PF_InData* in_data, PF_PreRenderExtra* preRender);
 void after_effects_smart_render(PF_InData* in_data, PF_OutData* out_data, PF_SmartRenderExtra* smartRender);
-void after_effects_non_smart_render(PF_InData* in_data, PF_OutData* out_data, PF_ParamDef* params[], PF_LayerDef* output);
\ No newline at end of file
+void after_effects_non_smart_render(PF_InData* in_data, PF_OutData* out_data, PF_ParamDef* params[], PF_LayerDef* output);
+
+//Sequence data holds an id for each instance, which finds the data the instance keeps between renders.
+void after_effects_sequence_setup(const PF_InData* in_data, PF_OutData* out_data);
+void after_effects_sequence_resetup(const PF_InData* in_data, PF_OutData* out_data);
+void after_effects_get_flattened_sequence_data(const PF_InData* in_data, PF_OutData* out_data);
+void after_effects_sequence_setdown(const PF_InData* in_data, PF_OutData* out_data);
\ No newline at end of file
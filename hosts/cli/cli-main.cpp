@@ -0,0 +1,573 @@
+/********************************************************************************************************
+
+Authors:		(c) 2023 Maths Town
+
+Licence:		The MIT License
+
+*********************************************************************************************************
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************
+
+Description:
+
+	Command line host.  Renders a project to image files, without After Effects or an OpenFX host.
+	(e.g. to grade a frame with filmic and a 3D LUT, or to render a camera move of a fractal)
+
+	Built like the other hosts, with the project's folder on the include path:
+		cl /std:c++20 /O2 /EHsc /arch:AVX2 /I projects\filmic hosts\cli\cli-main.cpp projects\filmic\parameters.cpp
+
+	Usage:
+		<program> [options] ["Parameter Name=value" ...]
+
+		--input <file>		Image to process (.pfm, or a binary .ppm).  Projects that use input need one.
+		--output <file>		Image to write (.pfm or .ppm).  (Default render.pfm)
+		--size <w>x<h>		Frame size, when there is no input.  (Default 1920x1080)
+		--frames <n>		Render n frames in order.  The frame number is added to the output file name.
+		--seed <text>		Seed text.  (Default "CLI")
+		--threads <n>		Render threads.  (Default: one per core)
+
+	Parameters are named as they are in the hosts.  Numbers take a value, or "first:last" to move in a
+	straight line from the first frame to the last.  Lists take the item's name, and files the file name.
+		filmic --input shot.pfm --output graded.pfm "Filmic Look=Medium Contrast" "3D LUT File=grade.cube"
+
+	Frames are rendered in order, so renderers that reuse the last frame (see frame-history.h) are given
+	it.  The time for each frame is printed.
+
+	The SIMD width is chosen as in the plugins.  (See simd-width-tuner.h.  EFFECTS_TOWN_SIMD_WIDTH overrides it)
+	x86_64 only.
+
+*******************************************************************************************************/
+
+//Project Specific Includes
+#include "config.h"
+#include "renderer.h"
+#include "parameters.h"
+
+#include "../../common/colour.h"
+#include "../../common/frame-history.h"
+#include "../../common/image-statistics.h"
+#include "../../common/render-block.h"
+#include "../../common/simd-f32.h"
+#include "../../common/simd-f64.h"
+#include "../../common/simd-width-tuner.h"
+#include "../../common/tile-scheduler.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+//An RGBA float image.  Rows are padded to whole vectors (of the widest type), so a vector never runs past a row.
+struct Image {
+	static constexpr int row_alignment = 16;
+
+	int width{};
+	int height{};
+	int stride{};		//Pixels per row
+	std::vector<float> pixels{};
+
+	void resize(int w, int h) {
+		width = std::max(w, 0);
+		height = std::max(h, 0);
+		stride = (width + row_alignment - 1) / row_alignment * row_alignment;
+		pixels.assign(static_cast<size_t>(stride) * height * 4, 0.0f);
+	}
+	float* pixel(int x, int y) noexcept { return &pixels[(static_cast<size_t>(y) * stride + x) * 4]; }
+	const float* pixel(int x, int y) const noexcept { return &pixels[(static_cast<size_t>(y) * stride + x) * 4]; }
+};
+
+//Command line options
+struct Options {
+	std::string input{};
+	std::string output{ "render.pfm" };
+	int width{ 1920 };
+	int height{ 1080 };
+	int frames{ 1 };
+	std::string seed{ "CLI" };
+	int threads{};
+	ParameterList first{};		//Parameters on the first frame
+	ParameterList last{};		//...and the last.  (The same unless a number is given as "first:last")
+	bool seed_set{};			//A seed parameter was given
+};
+
+
+/***Forward Declarations***/
+static Options read_options(int argc, char** argv);
+static void read_image(const std::string& filename, Image& image, int& bit_depth);
+static void write_image(const std::string& filename, const Image& image);
+static std::string frame_file_name(const std::string& filename, int frame, int frames);
+static ParameterList parameters_at(const Options& options, double t);
+static int choose_simd_width();
+template <SimdFloat S> static void render_frame(const Options& options, const ParameterList& params, const Image* input, int input_bit_depth, Image& output, std::shared_ptr<const FrameHistory>& history);
+template <typename Function> static void run_threads(int threads, Function&& f);
+
+
+
+/*******************************************************************************************************
+Main Entry Point
+*******************************************************************************************************/
+int main(int argc, char** argv) {
+	try {
+		const auto options = read_options(argc, argv);
+
+		Image input{};
+		int input_bit_depth{ 32 };
+		if constexpr (project_uses_input) {
+			if (options.input.empty()) throw std::runtime_error("This project needs an input image.  (--input)");
+			read_image(options.input, input, input_bit_depth);
+		}
+		Image output{};
+		if (project_uses_input) output.resize(input.width, input.height);
+		else output.resize(options.width, options.height);
+
+		static const int simd_width = choose_simd_width();
+		std::shared_ptr<const FrameHistory> history{};
+		for (int frame = 0; frame < options.frames; frame++) {
+			const auto params = parameters_at(options, options.frames > 1 ? static_cast<double>(frame) / (options.frames - 1) : 0.0);
+			const auto start = std::chrono::steady_clock::now();
+			with_simd_width<Precision>(simd_width, [&]<SimdFloat S>() {
+				render_frame<S>(options, params, project_uses_input ? &input : nullptr, input_bit_depth, output, history);
+			});
+			const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+			const auto filename = frame_file_name(options.output, frame, options.frames);
+			write_image(filename, output);
+			std::printf("%s  %dx%d  %d-bit SIMD  %.3f s\n", filename.c_str(), output.width, output.height, simd_width, seconds);
+		}
+	}
+	catch (const std::exception& e) {
+		std::fprintf(stderr, "%s\n", e.what());
+		return 1;
+	}
+	return 0;
+}
+
+
+/*******************************************************************************************************
+Render a frame to output.  Threads take tiles from a TileScheduler, as in the plugins.
+history is the last frame's, and is replaced by this frame's.  (For renderers that keep one)
+*******************************************************************************************************/
+template <SimdFloat S>
+static void render_frame(const Options& options, const ParameterList& params, const Image* input, int input_bit_depth, Image& output, std::shared_ptr<const FrameHistory>& history) {
+	typedef typename S::F F;
+	constexpr int n = S::number_of_elements();
+	const int threads = options.threads > 0 ? options.threads : static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u));
+
+	Renderer<S> renderer{};
+	renderer.set_size(output.width, output.height);
+	renderer.set_seed(options.seed);
+	if (options.seed_set) renderer.set_seed_int(static_cast<uint32_t>(params.get_value_integer(ParameterID::seed)));
+	if constexpr (requires { renderer.set_input_bit_depth(32); }) {
+		renderer.set_input_bit_depth(input_bit_depth);
+	}
+	renderer.set_parameters(params);
+	if constexpr (requires { renderer.error_message(); }) {
+		if (!renderer.error_message().empty()) std::fprintf(stderr, "%s\n", renderer.error_message().c_str());
+	}
+
+	//Pre-pass over the input (e.g. for auto exposure).  The same image is used for every frame, so there are no earlier frames.
+	if constexpr (requires { renderer.set_input_statistics(ImageStatistics{}); }) {
+		if (input && renderer.uses_input_statistics()) {
+			ImageStatisticsAccumulator<FallbackFloat32> accumulator{};
+			for (int y = 0; y < input->height; y++) {
+				for (int x = 0; x < input->width; x++) {
+					const float* p = input->pixel(x, y);
+					accumulator.add(ColourRGBA<FallbackFloat32>(FallbackFloat32(p[0]), FallbackFloat32(p[1]), FallbackFloat32(p[2]), FallbackFloat32(p[3])));
+				}
+				accumulator.end_row();
+			}
+			renderer.set_input_statistics(accumulator.finish());
+		}
+	}
+
+	if constexpr (requires { renderer.set_previous_frame(nullptr); }) {
+		renderer.set_previous_frame(history);
+	}
+
+	//Renderer pre-pass.  (Each thread takes every threads'th line)
+	if constexpr (requires { renderer.begin_prepare(); }) {
+		if constexpr (requires { renderer.set_render_window(0, 0, 0, 0); }) {
+			renderer.set_render_window(0, 0, output.width, output.height);
+		}
+		const int lines = renderer.begin_prepare();
+		run_threads(threads, [&](int thread) {
+			for (int y = thread; y < lines; y += threads) renderer.prepare_line(y);
+		});
+		renderer.end_prepare();
+	}
+
+	//Tiles sized for the level 2 cache.  (Output pixels, and input pixels if read)
+	const int bytes_per_pixel = static_cast<int>(4 * sizeof(float)) * (input ? 2 : 1);
+	TileScheduler tiles(0, 0, output.width, output.height, threads, TileScheduler::choose_tile_size(output.width, output.height, threads, bytes_per_pixel));
+	run_threads(threads, [&](int thread) {
+		BlockOutput<S> block{};
+		Tile tile{};
+		while (tiles.next(thread, tile)) {
+			//With input, a vector at a time.  (Tiles are whole vectors wide, except at the right, where rows are padded)
+			if constexpr (project_uses_input && requires { renderer.render_pixel_with_input(S{}, S{}, ColourRGBA<S>{}); }) {
+				if (input) {
+					for (int y = tile.y1; y < tile.y2; y++) {
+						for (int x = tile.x1; x < tile.x2; x += n) {
+							const float* p = input->pixel(x, y);
+							ColourRGBA<S> c{};
+							for (int k = 0; k < n; k++, p += 4) {
+								c.red.set_element(k, static_cast<F>(p[0]));
+								c.green.set_element(k, static_cast<F>(p[1]));
+								c.blue.set_element(k, static_cast<F>(p[2]));
+								c.alpha.set_element(k, static_cast<F>(p[3]));
+							}
+							c = renderer.render_pixel_with_input(S::make_sequential(static_cast<F>(x)), S(static_cast<F>(y)), c);
+							float* q = output.pixel(x, y);
+							for (int k = 0; k < n; k++, q += 4) {
+								q[0] = static_cast<float>(c.red.element(k));
+								q[1] = static_cast<float>(c.green.element(k));
+								q[2] = static_cast<float>(c.blue.element(k));
+								q[3] = static_cast<float>(c.alpha.element(k));
+							}
+						}
+					}
+					continue;
+				}
+			}
+
+			//Without input, as a block
+			render_block(renderer, tile.x1, tile.y1, tile.x2 - tile.x1, tile.y2 - tile.y1, block);
+			for (int j = 0; j < block.height; j++) {
+				for (int i = 0; i < block.width; i++) {
+					const auto c = block.get(i / n, j);
+					float* q = output.pixel(tile.x1 + i, tile.y1 + j);
+					q[0] = static_cast<float>(c.red.element(i % n));
+					q[1] = static_cast<float>(c.green.element(i % n));
+					q[2] = static_cast<float>(c.blue.element(i % n));
+					q[3] = static_cast<float>(c.alpha.element(i % n));
+				}
+			}
+		}
+	});
+
+	//Keep this frame's depth for the next one
+	if constexpr (requires { renderer.take_frame_history(); }) {
+		history = renderer.take_frame_history();
+	}
+}
+
+
+/*******************************************************************************************************
+Calls f(thread) on each of threads threads, and waits for them all.
+*******************************************************************************************************/
+template <typename Function>
+static void run_threads(int threads, Function&& f) {
+	if (threads <= 1) {
+		f(0);
+		return;
+	}
+	std::vector<std::thread> pool{};
+	pool.reserve(threads);
+	for (int i = 0; i < threads; i++) pool.emplace_back([&f, i]() { f(i); });
+	for (auto& t : pool) t.join();
+}
+
+
+/*******************************************************************************************************
+Chooses the SIMD width to render with.  (As the plugins do, see simd-width-tuner.h)
+*******************************************************************************************************/
+static int choose_simd_width() {
+	const auto key = simd_width_key(PluginIdentifier, PluginMajorVersion, PluginMinorVersion, PluginBugVersion, PluginBuildVersion, static_cast<int>(sizeof(Precision) * 8));
+	return tune_simd_width(key, available_simd_widths(), [](int bits) {
+		double seconds{};
+		with_simd_width<Precision>(bits, [&]<SimdFloat S>() {
+			Renderer<S> renderer{};
+			renderer.set_size(calibration_width, calibration_height);
+			renderer.set_seed("CLI");
+			renderer.set_parameters(calibration_parameters(build_project_parameters()));
+			seconds = time_render_tile<S>(renderer, calibration_width, calibration_height, project_uses_input && !project_overlay_on_input);
+		});
+		return seconds;
+	});
+}
+
+
+/*******************************************************************************************************
+Read the command line.  Throws std::runtime_error if it can't be understood.
+*******************************************************************************************************/
+static Options read_options(int argc, char** argv) {
+	Options options{};
+	options.first = calibration_parameters(build_project_parameters());	//Defaults, with the first item of each list
+
+	const auto next = [&](int& i) -> std::string {
+		if (i + 1 >= argc) throw std::runtime_error(std::string("Missing value after ") + argv[i]);
+		return argv[++i];
+	};
+	const auto to_int = [](const std::string& s) {
+		try { return std::stoi(s); }
+		catch (...) { throw std::runtime_error("Not a whole number: '" + s + "'"); }
+	};
+	const auto to_double = [](const std::string& s) {
+		try { return std::stod(s); }
+		catch (...) { throw std::runtime_error("Not a number: '" + s + "'"); }
+	};
+
+	std::vector<std::pair<std::string, std::string>> assignments{};
+	for (int i = 1; i < argc; i++) {
+		const std::string arg = argv[i];
+		if (arg == "--input") options.input = next(i);
+		else if (arg == "--output") options.output = next(i);
+		else if (arg == "--seed") options.seed = next(i);
+		else if (arg == "--frames") options.frames = std::max(to_int(next(i)), 1);
+		else if (arg == "--threads") options.threads = std::max(to_int(next(i)), 0);
+		else if (arg == "--size") {
+			const auto size = next(i);
+			const auto x = size.find('x');
+			if (x == std::string::npos) throw std::runtime_error("Size must be <width>x<height>: '" + size + "'");
+			options.width = to_int(size.substr(0, x));
+			options.height = to_int(size.substr(x + 1));
+			if (options.width < 1 || options.height < 1) throw std::runtime_error("Size must be at least 1x1.");
+		}
+		else if (arg.find('=') != std::string::npos && !arg.starts_with("--")) {
+			const auto equals = arg.find('=');
+			assignments.emplace_back(arg.substr(0, equals), arg.substr(equals + 1));
+		}
+		else throw std::runtime_error("Unknown option '" + arg + "'.  (Parameters are \"Name=value\")");
+	}
+
+	//Parameters
+	options.last = options.first;
+	for (const auto& [name, value] : assignments) {
+		bool found = false;
+		for (size_t k = 0; k < options.first.entries.size(); k++) {
+			auto& first = options.first.entries[k];
+			auto& last = options.last.entries[k];
+			if (first.name != name || first.type == ParameterType::group_start || first.type == ParameterType::group_end) continue;
+			found = true;
+			switch (first.type) {
+			case ParameterType::list:
+				if (std::find(first.list.begin(), first.list.end(), value) == first.list.end()) {
+					std::string items{};
+					for (const auto& item : first.list) items += "\n  " + item;
+					throw std::runtime_error("'" + value + "' isn't an item of '" + name + "'.  Items are:" + items);
+				}
+				first.value_string = last.value_string = value;
+				break;
+			case ParameterType::file:
+				first.value_string = last.value_string = value;
+				break;
+			case ParameterType::seed:
+				first.value_integer = last.value_integer = to_int(value);
+				first.value = last.value = first.value_integer;
+				options.seed_set = true;
+				break;
+			default:
+			{
+				const auto colon = value.find(':');
+				first.value = to_double(value.substr(0, colon));
+				last.value = (colon == std::string::npos) ? first.value : to_double(value.substr(colon + 1));
+				break;
+			}
+			}
+		}
+		if (!found) {
+			std::string names{};
+			for (const auto& e : options.first.entries) {
+				if (!e.name.empty() && e.type != ParameterType::group_start) names += "\n  " + e.name;
+			}
+			throw std::runtime_error("No parameter named '" + name + "'.  Parameters are:" + names);
+		}
+	}
+	return options;
+}
+
+
+/*******************************************************************************************************
+The parameters at t (0 on the first frame, 1 on the last).  Numbers move in a straight line.
+*******************************************************************************************************/
+static ParameterList parameters_at(const Options& options, double t) {
+	auto params = options.first;
+	for (size_t k = 0; k < params.entries.size(); k++) {
+		auto& e = params.entries[k];
+		e.value = e.value + (options.last.entries[k].value - e.value) * t;
+	}
+	return params;
+}
+
+
+/*******************************************************************************************************
+The output file name for a frame.  With more than one frame, the frame number is added before the
+extension.  (render.pfm -> render-0001.pfm)
+*******************************************************************************************************/
+static std::string frame_file_name(const std::string& filename, int frame, int frames) {
+	if (frames <= 1) return filename;
+	char number[16]{};
+	std::snprintf(number, sizeof(number), "-%04d", frame);
+	const auto dot = filename.find_last_of('.');
+	const auto slash = filename.find_last_of("/\\");
+	if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) return filename + number;
+	return filename.substr(0, dot) + number + filename.substr(dot);
+}
+
+
+namespace cli_detail {
+
+	inline bool ends_with(const std::string& s, const char* ending) {
+		const std::string e(ending);
+		if (s.size() < e.size()) return false;
+		return std::equal(e.rbegin(), e.rend(), s.rbegin(), [](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) == b; });
+	}
+
+	//The next number in a .ppm or .pfm header.  (Skips whitespace and comments)
+	inline std::string header_token(std::istream& file) {
+		std::string token{};
+		int c{};
+		while ((c = file.get()) != EOF) {
+			if (c == '#') {
+				while ((c = file.get()) != EOF && c != '\n');
+				continue;
+			}
+			if (std::isspace(c)) {
+				if (!token.empty()) break;
+				continue;
+			}
+			token.push_back(static_cast<char>(c));
+		}
+		return token;
+	}
+
+	inline bool little_endian() noexcept {
+		const uint16_t one = 1;
+		uint8_t first{};
+		std::memcpy(&first, &one, 1);
+		return first == 1;
+	}
+}
+
+
+/*******************************************************************************************************
+Read an image.  .pfm (float RGB), or a binary .ppm (8 or 16-bit).  Alpha is 1.
+bit_depth is 8 for 8-bit files and 32 otherwise.  (16-bit files aren't on Adobe's 16-bit scale)
+Throws std::runtime_error if the file can't be read.
+*******************************************************************************************************/
+static void read_image(const std::string& filename, Image& image, int& bit_depth) {
+	using namespace cli_detail;
+	std::ifstream file(filename, std::ios::binary);
+	if (!file) throw std::runtime_error("Unable to open '" + filename + "'.");
+
+	const auto magic = header_token(file);
+	int width{}, height{};
+	try {
+		width = std::stoi(header_token(file));
+		height = std::stoi(header_token(file));
+	}
+	catch (...) {
+		throw std::runtime_error("'" + filename + "' has an invalid header.");
+	}
+	if (width < 1 || height < 1) throw std::runtime_error("'" + filename + "' has an invalid size.");
+	image.resize(width, height);
+
+	if (magic == "PF") {
+		//Rows are bottom to top.  A negative scale means little endian.
+		const bool swap = (std::stod(header_token(file)) < 0.0) != little_endian();
+		std::vector<float> row(static_cast<size_t>(width) * 3);
+		for (int y = height - 1; y >= 0; y--) {
+			if (!file.read(reinterpret_cast<char*>(row.data()), row.size() * sizeof(float))) throw std::runtime_error("'" + filename + "' is too short.");
+			for (int x = 0; x < width; x++) {
+				float* p = image.pixel(x, y);
+				for (int c = 0; c < 3; c++) {
+					float v = row[static_cast<size_t>(x) * 3 + c];
+					if (swap) {
+						uint32_t u{};
+						std::memcpy(&u, &v, 4);
+						u = (u >> 24) | ((u >> 8) & 0xff00u) | ((u << 8) & 0xff0000u) | (u << 24);
+						std::memcpy(&v, &u, 4);
+					}
+					p[c] = v;
+				}
+				p[3] = 1.0f;
+			}
+		}
+		bit_depth = 32;
+		return;
+	}
+
+	if (magic == "P6") {
+		int maximum{};
+		try { maximum = std::stoi(header_token(file)); }
+		catch (...) { maximum = 0; }
+		if (maximum < 1 || maximum > 65535) throw std::runtime_error("'" + filename + "' has an invalid maximum value.");
+		const int bytes = (maximum > 255) ? 2 : 1;
+		const float scale = 1.0f / static_cast<float>(maximum);
+		std::vector<uint8_t> row(static_cast<size_t>(width) * 3 * bytes);
+		for (int y = 0; y < height; y++) {
+			if (!file.read(reinterpret_cast<char*>(row.data()), row.size())) throw std::runtime_error("'" + filename + "' is too short.");
+			for (int x = 0; x < width; x++) {
+				float* p = image.pixel(x, y);
+				for (int c = 0; c < 3; c++) {
+					const size_t i = (static_cast<size_t>(x) * 3 + c) * bytes;
+					const int v = (bytes == 2) ? (row[i] << 8 | row[i + 1]) : row[i];	//16-bit is big endian
+					p[c] = static_cast<float>(v) * scale;
+				}
+				p[3] = 1.0f;
+			}
+		}
+		bit_depth = (maximum == 255) ? 8 : 32;
+		return;
+	}
+	throw std::runtime_error("'" + filename + "' isn't a .pfm or binary .ppm file.");
+}
+
+
+/*******************************************************************************************************
+Write an image.  .ppm files are 8-bit (clamped), anything else is .pfm (float RGB).  Alpha is dropped.
+Throws std::runtime_error if the file can't be written.
+*******************************************************************************************************/
+static void write_image(const std::string& filename, const Image& image) {
+	using namespace cli_detail;
+	std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+	if (!file) throw std::runtime_error("Unable to write '" + filename + "'.");
+
+	if (ends_with(filename, ".ppm")) {
+		file << "P6\n" << image.width << " " << image.height << "\n255\n";
+		std::vector<uint8_t> row(static_cast<size_t>(image.width) * 3);
+		for (int y = 0; y < image.height; y++) {
+			for (int x = 0; x < image.width; x++) {
+				const float* p = image.pixel(x, y);
+				for (int c = 0; c < 3; c++) row[static_cast<size_t>(x) * 3 + c] = float_to_8bit(p[c]);
+			}
+			file.write(reinterpret_cast<const char*>(row.data()), row.size());
+		}
+	}
+	else {
+		//Rows are bottom to top, in this machine's byte order
+		file << "PF\n" << image.width << " " << image.height << "\n" << (little_endian() ? "-1.0" : "1.0") << "\n";
+		std::vector<float> row(static_cast<size_t>(image.width) * 3);
+		for (int y = image.height - 1; y >= 0; y--) {
+			for (int x = 0; x < image.width; x++) {
+				const float* p = image.pixel(x, y);
+				for (int c = 0; c < 3; c++) row[static_cast<size_t>(x) * 3 + c] = p[c];
+			}
+			file.write(reinterpret_cast<const char*>(row.data()), row.size() * sizeof(float));
+		}
+	}
+	if (!file) throw std::runtime_error("Unable to write '" + filename + "'.");
+}
@@ -36,6 +36,7 @@ Description:
 #include "ofxProperty.h"
 #include "ofxImageEffect.h"
 #include "ofxParam.h"
+#include "ofxMessage.h"
 
 
 #include <cstring>
@@ -52,6 +53,7 @@ extern const OfxImageEffectSuiteV1* global_EffectSuite;
 extern const OfxPropertySuiteV1* global_PropertySuite;
 extern const OfxParameterSuiteV1* global_ParameterSuite;
 extern const OfxMultiThreadSuiteV1* global_MultiThreadSuite;
+extern const OfxMessageSuiteV2* global_MessageSuite;		//Optional (nullptr if the host doesn't have it)
 extern HostData global_hostData;
 
 
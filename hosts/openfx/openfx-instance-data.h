@@ -28,9 +28,20 @@ A struct for the instance data.
 
 #include "openfx-helper.h"
 #include "openfx-parameter-helper.h"
+#include "../../common/checkerboard.h"
+#include "../../common/frame-history.h"
+
+#include <memory>
+#include <mutex>
 
 struct InstanceData {
 	ParameterHelper parameter_helper;
 
+	//The last frame rendered, for renderers that reuse its depth.  (Frames may render on different threads)
+	std::mutex history_mutex;
+	std::shared_ptr<const FrameHistory> frame_history;
 
+	//The last draft rendered, so a full quality render of the same frame only renders the rest.  (See checkerboard.h)
+	std::mutex draft_mutex;
+	std::shared_ptr<const DraftFrame> draft_frame;
 };
\ No newline at end of file
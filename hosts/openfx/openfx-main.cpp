@@ -52,6 +52,7 @@ const OfxImageEffectSuiteV1* global_EffectSuite{ nullptr };
 const OfxPropertySuiteV1* global_PropertySuite{ nullptr };
 const OfxParameterSuiteV1* global_ParameterSuite{ nullptr };
 const OfxMultiThreadSuiteV1* global_MultiThreadSuite{ nullptr };
+const OfxMessageSuiteV2* global_MessageSuite{ nullptr };
 
 //TODO:  To be safe we should copy this for each instance.  It should be done on the create instance action.
 ParameterHelper master_parameter_helper{};
@@ -154,6 +155,7 @@ static OfxStatus openfx_plugin_main(const char* action, const void* handle,  Ofx
         if (strcmp(action, kOfxActionDescribe) == 0) return openfx_describe_action(effect);
         if (strcmp(action, kOfxImageEffectActionDescribeInContext) == 0) return openfx_describe_in_context_action(effect, inArgs);
         if (strcmp(action, kOfxImageEffectActionGetClipPreferences) == 0) return openfx_image_effect_action_get_clip_preferences(effect, out_args);
+        if (strcmp(action, kOfxImageEffectActionGetFramesNeeded) == 0) return openfx_get_frames_needed(effect, inArgs, out_args);
 
 
         return kOfxStatReplyDefault;
@@ -202,6 +204,9 @@ static OfxStatus openfx_on_load_action(void) {
     global_MultiThreadSuite = static_cast<const OfxMultiThreadSuiteV1*>(global_OFXHost->fetchSuite(global_OFXHost->host, kOfxMultiThreadSuite, 1));
     if (!global_ParameterSuite) return kOfxStatErrMissingHostFeature;
 
+    //Optional.  (Used to show problems with the parameters, e.g. a file that can't be loaded)
+    global_MessageSuite = static_cast<const OfxMessageSuiteV2*>(global_OFXHost->fetchSuite(global_OFXHost->host, kOfxMessageSuite, 2));
+
     char* cstr;
     int count;
     int v;
@@ -319,6 +324,10 @@ static OfxStatus openfx_describe_action(const OfxImageEffectHandle effect) {
     check_openfx(global_PropertySuite->propSetInt(effectProperties, kOfxImageEffectPluginPropHostFrameThreading, 0, true));
     check_openfx(global_PropertySuite->propSetInt(effectProperties, kOfxImageEffectPluginPropFieldRenderTwiceAlways, 0, false));
     check_openfx(global_PropertySuite->propSetInt(effectProperties, kOfxImageEffectPropSupportsMultiResolution, 0, false));
+    global_PropertySuite->propSetInt(effectProperties, kOfxImageEffectPropRenderQualityDraft, 0, true);                                  //Draft renders (OpenFX 1.4.  Not checked, as older hosts don't have it)
+    if constexpr (project_uses_input) {
+        if (global_hostData.supportsTemporalClipAccess) check_openfx(global_PropertySuite->propSetInt(effectProperties, kOfxImageEffectPropTemporalClipAccess, 0, true));   //Earlier input frames (e.g. to smooth auto exposure)
+    }
 
 
     //Indicate which bit depths we can support.
@@ -361,6 +370,10 @@ void add_parameters(const OfxImageEffectHandle effect) {
             master_parameter_helper.add_list(p.id,p.name,p.list);
             break;
 
+        case ParameterType::file:
+            master_parameter_helper.add_file(p.id, p.name);
+            break;
+
         default:
             break;
         }
@@ -412,6 +425,7 @@ static OfxStatus openfx_describe_in_context_action(const OfxImageEffectHandle ef
             check_openfx(global_EffectSuite->clipDefine(effect, "Source", &properties));
             if (global_hostData.supportsComponentRGBA) check_openfx(global_PropertySuite->propSetString(properties, kOfxImageEffectPropSupportedComponents, 0, kOfxImageComponentRGBA)); //RGBA format
             //if (global_hostData.supportsComponentRGB) check_openfx(global_PropertySuite->propSetString(properties, kOfxImageEffectPropSupportedComponents, 1, kOfxImageComponentRGB)); //RGB format
+            if (global_hostData.supportsTemporalClipAccess) check_openfx(global_PropertySuite->propSetInt(properties, kOfxImageEffectPropTemporalClipAccess, 0, true));   //Earlier frames
         }
     }
     
@@ -159,3 +159,34 @@ int ParameterHelper::read_list(ParameterID id, OfxTime time) {
 	global_ParameterSuite->paramGetValueAtTime(param_handle.at(parameter_id_to_int(id)), time, &value);
 	return value;
 }
+
+
+/********************************************************************************************************
+* Add a file name parameter. (A string parameter displayed as a file chooser)
+*******************************************************************************************************/
+void ParameterHelper::add_file(ParameterID id, const std::string& name) {
+	check_null(paramset);
+
+	//Add the parameter
+	OfxPropertySetHandle param_properties{};
+	global_ParameterSuite->paramDefine(paramset, kOfxParamTypeString, name.c_str(), &param_properties);
+
+	//Set the properties of this parameter
+	global_PropertySuite->propSetString(param_properties, kOfxParamPropStringMode, 0, kOfxParamStringIsFilePath);
+	global_PropertySuite->propSetInt(param_properties, kOfxParamPropStringFilePathExists, 0, 1);
+	global_PropertySuite->propSetInt(param_properties, kOfxParamPropAnimates, 0, 0);
+
+	//Add to lookup
+	param_is_added.at(parameter_id_to_int(id)) = true;
+	param_name.at(parameter_id_to_int(id)) = name;
+}
+
+/********************************************************************************************************
+* Read a string (or file name) parmater.
+*******************************************************************************************************/
+std::string ParameterHelper::read_string(ParameterID id, OfxTime time) {
+	char* value{};
+	global_ParameterSuite->paramGetValueAtTime(param_handle.at(parameter_id_to_int(id)), time, &value);
+	if (!value) return std::string();
+	return std::string(value);
+}
@@ -59,6 +59,10 @@ public:
 
 	int read_list(ParameterID id, OfxTime time);
 
+	void add_file(ParameterID id, const std::string& name);
+
+	std::string read_string(ParameterID id, OfxTime time);
+
 	
 
 	
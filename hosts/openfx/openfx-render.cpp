@@ -39,14 +39,25 @@ TODO: 8-BIT Support
 #include "config.h"
 
 
+#include "..\..\common\cancellation.h"
+#include "..\..\common\image-statistics.h"
 #include "..\..\common\linear-algebra.h"
+#include "..\..\common\pixel-store.h"
+#include "..\..\common\render-block.h"
 #include "..\..\common\simd-cpuid.h"
 #include "..\..\common\simd-f32.h"
 #include "..\..\common\simd-uint32.h"
+#include "..\..\common\simd-width-tuner.h"
+#include "..\..\common\tile-scheduler.h"
 
 
+#include <algorithm>
 #include <bit>
+#include <cstdlib>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 
 //Contains data that will be sent to different threads.
@@ -56,6 +67,27 @@ struct RenderThreadData {
     ClipHolder* output{};
     std::unique_ptr<ClipHolder> input{};
     OfxRectI* render_window{};
+    TileScheduler* tiles{};         //Hands out the tiles of the render window to threads
+    CancellationToken* cancel{};    //Checked between tiles (asks the host if the render was aborted)
+    bool streaming_stores{};        //Write output with non-temporal stores
+    DraftFrame* draft{};            //Draft quality: only the pattern's pixels are rendered, and kept here (see checkerboard.h)
+    std::shared_ptr<const DraftFrame> complete{};   //Full quality: the pixels a draft of this frame rendered
+};
+
+//Contains data for the input statistics pre-pass.
+template <SimdFloat S>
+struct StatisticsThreadData {
+    ClipHolder* input{};
+    int step{ 1 };                              //Measure every step'th line and vector.  (Earlier frames are only sampled)
+    std::vector<ImageStatistics> partial{};     //One per thread.  Merged after all threads finish.
+};
+
+//Contains data for the renderer's pre-pass.
+template <SimdFloat S>
+struct PrepareThreadData {
+    Renderer<S>* renderer{};
+    int lines{};
+    CancellationToken* cancel{};
 };
 
 
@@ -63,11 +95,19 @@ struct RenderThreadData {
 static void ReplaceTransparentWithSource(OfxRectI renderWindow, ClipHolder& source, ClipHolder& output) noexcept;
 static ParameterList read_parameters(ParameterHelper& parameter_helper, OfxTime time);
 template <SimdFloat S> void thread_entry_pixel_render(unsigned int threadIndex, [[maybe_unused]] unsigned int threadMax, void* customArg);
-template <SimdFloat S> static void render_line(RenderThreadData<S>* rd, int y);
-template <SimdFloat S> static void do_render(OfxImageEffectHandle instance, OfxRectI& render_window, Renderer<S>& renderer, [[maybe_unused]] int width, [[maybe_unused]] int height, ClipHolder& output, const OfxTime& time);
-template <SimdFloat S> static void setup_render(Renderer<S>& renderer, int width, int height, ParameterHelper& parameter_helper, OfxTime time);
-template <SimdFloat S> static inline void render_pixel32(RenderThreadData<S>* rd, int x, int y);
-template <SimdFloat S> static void render_line32(RenderThreadData<S>* rd, int y);
+template <SimdFloat S> static void render_tile(RenderThreadData<S>* rd, const Tile& tile);
+template <SimdFloat S> static void do_render(OfxImageEffectHandle instance, InstanceData& instance_data, OfxRectI& render_window, Renderer<S>& renderer, [[maybe_unused]] int width, [[maybe_unused]] int height, ClipHolder& output, const OfxTime& time, [[maybe_unused]] bool draft, [[maybe_unused]] uint64_t frame_key);
+static void show_renderer_message(OfxImageEffectHandle instance, const std::string& message);
+template <SimdFloat S> static uint64_t setup_render(Renderer<S>& renderer, int width, int height, ParameterHelper& parameter_helper, OfxTime time);
+static int choose_simd_width();
+template <SimdFloat S> static inline void render_pixel32(RenderThreadData<S>* rd, int x, int y, int max_x);
+template <SimdFloat S> static inline ColourRGBA<S> read_input_pixel32(ClipHolder& input, int x, int y, int count = S::number_of_elements());
+template <SimdFloat S> static ImageStatistics gather_input_statistics(ClipHolder& input, int step = 1);
+template <typename R> static int earlier_input_frames(const ParameterList& params);
+template <SimdFloat S> void thread_entry_input_statistics(unsigned int threadIndex, unsigned int threadMax, void* customArg);
+template <SimdFloat S> static void render_tile32(RenderThreadData<S>* rd, const Tile& tile);
+template <SimdFloat S> static void render_block32(RenderThreadData<S>* rd, const OfxRectI& area);
+template <SimdFloat S> void thread_entry_prepare(unsigned int threadIndex, unsigned int threadMax, void* customArg);
 
 
 
@@ -100,6 +140,15 @@ OfxStatus openfx_render(const OfxImageEffectHandle instance, OfxPropertySetHandl
     OfxRectI renderWindow;
     check_openfx(global_PropertySuite->propGetIntN(in_args, kOfxImageEffectPropRenderWindow, 4, &renderWindow.x1));
 
+    //Draft quality (e.g. while a slider is dragged).  (OpenFX 1.4.  Older hosts don't have it, and always render at full quality)
+    int draft{};
+    if (global_PropertySuite->propGetInt(in_args, kOfxImageEffectPropRenderQualityDraft, 0, &draft) != kOfxStatOK) draft = 0;
+
+    //Render scale (below 1 for proxy / low resolution renders).  Lowers the renderer's quality tier, with draft.  (See quality-tier.h)
+    OfxPointD render_scale{ 1.0, 1.0 };
+    if (global_PropertySuite->propGetDoubleN(in_args, kOfxImageEffectPropRenderScale, 2, &render_scale.x) != kOfxStatOK) render_scale = OfxPointD{ 1.0, 1.0 };
+    const double downsample = 1.0 / std::clamp(std::min(render_scale.x, render_scale.y), 0.001, 1.0);
+
     //Get the output clip handle 
     ClipHolder output_clip(instance, "Output", time);
 
@@ -114,34 +163,21 @@ OfxStatus openfx_render(const OfxImageEffectHandle instance, OfxPropertySetHandl
 
 
     //CPU Dispatch (assuming x86_64 for now)
+    //The SIMD width is chosen the first time we render.  (The fastest on this machine, see simd-width-tuner.h)
+    //Elements are the project's Precision (config.h).
     static_assert(mt::environment::is_x64, "Only x86_64 implemented");
-    if constexpr (mt::environment::compiler_has_avx512dq && mt::environment::compiler_has_avx512f) {
-        //AVX-512 & AVX-512DQ supported by compiler.
-        Renderer<Simd512Float32> renderer{};
-        setup_render(renderer, width, height, instance_data->parameter_helper, time);
-        do_render(instance, renderWindow, renderer, width, height, output_clip, time);
-    }
-    else if constexpr (mt::environment::compiler_has_avx2 && mt::environment::compiler_has_avx && mt::environment::compiler_has_fma) {
-        Renderer<Simd256Float32> renderer{};
-        setup_render(renderer, width, height, instance_data->parameter_helper, time);
-        do_render(instance, renderWindow, renderer, width, height, output_clip, time);
-    }
-    else {
-        //Compiler mode just supports basic x86_64 (SSE2), so we will perform runtime dispatch to AVX2 code if supported.
-        CpuInformation cpu_info{};
-        if (Simd256UInt64::cpu_supported(cpu_info) && Simd256Float32::cpu_supported(cpu_info) && Simd256UInt32::cpu_supported(cpu_info)) {
-            //AVX & AVX2
-            Renderer<Simd256Float32> renderer{};
-            setup_render(renderer, width, height, instance_data->parameter_helper, time);
-            do_render(instance, renderWindow, renderer, width, height, output_clip, time);
+    static const int simd_width = choose_simd_width();
+    with_simd_width<Precision>(simd_width, [&]<SimdFloat S>() {
+        Renderer<S> renderer{};
+        if constexpr (requires { renderer.set_preview(downsample, true); }) {
+            renderer.set_preview(downsample, draft != 0);
         }
-        else {
-            //SSE2 (Generic x86_64)
-            Renderer<Simd128Float32> renderer{};
-            setup_render(renderer, width, height, instance_data->parameter_helper, time);
-            do_render(instance, renderWindow, renderer, width, height, output_clip, time);
+        const uint64_t frame_key = draft_frame_key(setup_render(renderer, width, height, instance_data->parameter_helper, time), time, width, height);
+        if constexpr (requires { renderer.error_message(); }) {
+            show_renderer_message(instance, renderer.error_message());
         }
-    }
+        do_render(instance, *instance_data, renderWindow, renderer, width, height, output_clip, time, draft != 0, frame_key);
+    });
 
 
     //Get & Mix Souce image.
@@ -164,12 +200,46 @@ OfxStatus openfx_render(const OfxImageEffectHandle instance, OfxPropertySetHandl
 }
 
 
+/*******************************************************************************************************
+Get Frames Needed
+Asks the host for the earlier input frames the renderer measures, as well as the current frame.
+*******************************************************************************************************/
+OfxStatus openfx_get_frames_needed(const OfxImageEffectHandle instance, OfxPropertySetHandle in_args, OfxPropertySetHandle out_args) {
+    InstanceData* instance_data{ nullptr };
+    OfxPropertySetHandle effectProps;
+    global_EffectSuite->getPropertySet(instance, &effectProps);
+    global_PropertySuite->propGetPointer(effectProps, kOfxPropInstanceData, 0, (void**)&instance_data);
+    if (!instance_data) return kOfxStatReplyDefault;
+
+    OfxTime time{};
+    check_openfx(global_PropertySuite->propGetDouble(in_args, kOfxPropTime, 0, &time));
+
+    const int earlier = earlier_input_frames<Renderer<FallbackFloat32>>(read_parameters(instance_data->parameter_helper, time));
+    if (earlier == 0) return kOfxStatReplyDefault;
+    const double range[2]{ time - earlier, time };
+    const std::string property = std::string(kOfxImageClipPropFramesNeeded) + "_Source";
+    check_openfx(global_PropertySuite->propSetDoubleN(out_args, property.c_str(), 2, range));
+    return kOfxStatOK;
+}
+
+
+/*******************************************************************************************************
+The number of earlier input frames the renderer measures.  (e.g. to smooth auto exposure over a sequence)
+*******************************************************************************************************/
+template <typename R>
+static int earlier_input_frames(const ParameterList& params) {
+    if constexpr (requires { R::earlier_input_frames(params); }) return R::earlier_input_frames(params);
+    else return 0;
+}
+
+
 /*******************************************************************************************************
 Sets up the host-independant renderer object. 
 Templated on the datatype
+Returns a hash of the parameter values.  (See draft_frame_key())
 *******************************************************************************************************/
 template <SimdFloat S>
-static void setup_render(Renderer<S>& renderer, int width, int height, ParameterHelper& parameter_helper, OfxTime time) {
+static uint64_t setup_render(Renderer<S>& renderer, int width, int height, ParameterHelper& parameter_helper, OfxTime time) {
     auto params = read_parameters(parameter_helper, time);
 
     renderer.set_size(width, height);
@@ -178,7 +248,40 @@ static void setup_render(Renderer<S>& renderer, int width, int height, Parameter
         renderer.set_seed_int(static_cast<uint64_t>(std::bit_cast<uint32_t>(params.get_value_integer(ParameterID::seed))));
     }
 
+    const uint64_t parameter_hash = params.hash();
     renderer.set_parameters(std::move(params));
+    return parameter_hash;
+}
+
+
+/*******************************************************************************************************
+Shows a problem the renderer found (e.g. a 3D LUT file that can't be loaded) as a persistent message on
+the effect, or clears it.  The render still goes ahead.  (Hosts without the message suite show nothing)
+*******************************************************************************************************/
+static void show_renderer_message(OfxImageEffectHandle instance, const std::string& message) {
+    if (!global_MessageSuite) return;
+    if (message.empty()) global_MessageSuite->clearPersistentMessage(instance);
+    else global_MessageSuite->setPersistentMessage(instance, kOfxMessageError, "", "%s", message.c_str());
+}
+
+
+/*******************************************************************************************************
+Chooses the SIMD width to render with.  (The override, the cache file, or the fastest at rendering a tile
+with the project's default parameters, see simd-width-tuner.h)
+*******************************************************************************************************/
+static int choose_simd_width() {
+    const auto key = simd_width_key(PluginIdentifier, PluginMajorVersion, PluginMinorVersion, PluginBugVersion, PluginBuildVersion, static_cast<int>(sizeof(Precision) * 8));
+    return tune_simd_width(key, available_simd_widths(), [](int bits) {
+        double seconds{};
+        with_simd_width<Precision>(bits, [&]<SimdFloat S>() {
+            Renderer<S> renderer{};
+            renderer.set_size(calibration_width, calibration_height);
+            renderer.set_seed("OpenFX");
+            renderer.set_parameters(calibration_parameters(build_project_parameters()));
+            seconds = time_render_tile<S>(renderer, calibration_width, calibration_height, project_uses_input && !project_overlay_on_input);
+        });
+        return seconds;
+    });
 }
 
 
@@ -202,6 +305,9 @@ static ParameterList read_parameters(ParameterHelper& parameter_helper, OfxTime
             p.value_string = p.list[i];
             break;
         }
+        case ParameterType::file:
+            p.value_string = parameter_helper.read_string(p.id, time);
+            break;
 
         default:
             break;
@@ -214,7 +320,7 @@ static ParameterList read_parameters(ParameterHelper& parameter_helper, OfxTime
 
 *******************************************************************************************************/
 template <SimdFloat S>
-inline static void copy_pixel_to_output_buffer(ClipHolder& output, int x, int y, int max_x, ColourRGBA<S> c) {
+inline static void copy_pixel_to_output_buffer(ClipHolder& output, int x, int y, int max_x, ColourRGBA<S> c, bool streaming = false) {
     const bool hasAlpha = output.componentsPerPixel == 4;
 
     if constexpr (!project_is_solid_render) {
@@ -226,22 +332,30 @@ inline static void copy_pixel_to_output_buffer(ClipHolder& output, int x, int y,
     case 8:
          {
             //TODO: Code not tested.
-            constexpr auto w8 = static_cast<Precision>(white8);
+            constexpr auto w8 = static_cast<typename S::F>(white8);
+            constexpr auto zero = static_cast<typename S::F>(0.0);
             
             for (int i = 0; i < S::number_of_elements(); i++) {
                 if (x + i >= max_x) break;
                 const auto ptrDest = output.pixelAddress8(x+i, y);
-                ptrDest[0] = static_cast<uint8_t>(clamp(c.red.element(i) * w8,0.0f,w8));
-                ptrDest[1] = static_cast<uint8_t>(clamp(c.green.element(i) * w8, 0.0f, w8));
-                ptrDest[2] = static_cast<uint8_t>(clamp(c.blue.element(i) * w8, 0.0f, w8));
-                if (hasAlpha) ptrDest[3] = static_cast<uint8_t>(clamp(c.alpha.element(i) * w8, 0.0f, w8));
+                ptrDest[0] = static_cast<uint8_t>(clamp(c.red.element(i) * w8, zero, w8));
+                ptrDest[1] = static_cast<uint8_t>(clamp(c.green.element(i) * w8, zero, w8));
+                ptrDest[2] = static_cast<uint8_t>(clamp(c.blue.element(i) * w8, zero, w8));
+                if (hasAlpha) ptrDest[3] = static_cast<uint8_t>(clamp(c.alpha.element(i) * w8, zero, w8));
             }
             break;
          }
     case 32:
         {
-            //TODO: Use SIMD       
-            
+            //Whole vector of RGBA pixels.  Transposed in registers.
+            if (hasAlpha && x + S::number_of_elements() <= max_x) [[likely]] {
+                const auto ptrDest = output.pixelAddressFloat(x, y);
+                if (ptrDest) {
+                    store_pixels_float<PixelOrder::rgba>(ptrDest, c, streaming);
+                    break;
+                }
+            }
+
             for (int i = 0; i < S::number_of_elements(); i++) {
                 if (x + i >= max_x) break;
                 const auto ptrDest = output.pixelAddressFloat(x+i, y);
@@ -296,27 +410,44 @@ static void ReplaceTransparentWithSource(OfxRectI renderWindow, ClipHolder& sour
 Thread Entry Point for rendering.
 Used as a callback by OpenFX host.
 
-Currently just balances worklaod using % operator.
+Renders tiles until there are none left, or the render is cancelled.  (See tile-scheduler.h)
 *******************************************************************************************************/
 template <SimdFloat S>
 void thread_entry_pixel_render(unsigned int threadIndex, [[maybe_unused]] unsigned int threadMax, void* customArg) {
     RenderThreadData<S>* rd = static_cast<RenderThreadData<S>*>(customArg);
-    for (int y = rd->render_window->y1; y < rd->render_window->y2; y++) {
-        if (y % threadMax == threadIndex) {
-            render_line(rd, y);
-        }
+    Tile tile{};
+    while (!rd->cancel->is_cancelled() && rd->tiles->next(static_cast<int>(threadIndex), tile)) {
+        render_tile(rd, tile);
+    }
+}
+
+/*******************************************************************************************************
+Thread Entry Point for the renderer's pre-pass.  (See begin_prepare())
+Takes every threadMax'th line.
+*******************************************************************************************************/
+template <SimdFloat S>
+void thread_entry_prepare(unsigned int threadIndex, unsigned int threadMax, void* customArg) {
+    auto pd = static_cast<PrepareThreadData<S>*>(customArg);
+    for (int y = static_cast<int>(threadIndex); y < pd->lines; y += static_cast<int>(threadMax)) {
+        if (pd->cancel->is_cancelled()) return;
+        pd->renderer->prepare_line(y);
     }
 }
 
 /*******************************************************************************************************
 Do a full render.
-Dispatches lines to worker threads.
+Dispatches tiles to worker threads.
+Draft renders may leave out pixels (see checkerboard.h).  frame_key names the image.  (See draft_frame_key())
 (Called on a worker thread)
 *******************************************************************************************************/
 template <SimdFloat S>
-static void do_render(OfxImageEffectHandle instance, OfxRectI& render_window, Renderer<S>& renderer, [[maybe_unused]] int width, [[maybe_unused]] int height, ClipHolder& output, const OfxTime& time) {
+static void do_render(OfxImageEffectHandle instance, InstanceData& instance_data, OfxRectI& render_window, Renderer<S>& renderer, [[maybe_unused]] int width, [[maybe_unused]] int height, ClipHolder& output, const OfxTime& time, [[maybe_unused]] bool draft, [[maybe_unused]] uint64_t frame_key) {
+
+    //Stops the render if the host aborts it.  (e.g. the user has moved to another frame)
+    CancellationToken cancel([instance]() { return global_EffectSuite->abort(instance) != 0; });
 
     RenderThreadData<S> rd{};
+    rd.cancel = &cancel;
     rd.renderer = &renderer;
     rd.output = &output;
     rd.render_window = &render_window;
@@ -325,86 +456,269 @@ static void do_render(OfxImageEffectHandle instance, OfxRectI& render_window, Re
     //Get input clup handle (if input will be used at rendering phase)
     if constexpr (project_uses_input && !project_overlay_on_input) {
         rd.input = std::make_unique<ClipHolder>(instance, "Source", time);
+
+        //Pre-pass over the whole input frame (e.g. for auto exposure)
+        //Earlier frames are only sampled (every 4th line and vector).  Stops at the first one the host can't give.
+        if constexpr (requires { renderer.set_input_statistics(ImageStatistics{}); }) {
+            if (renderer.uses_input_statistics() && rd.input->bitDepth == 32 && rd.input->componentsPerPixel == 4) {
+                std::vector<ImageStatistics> earlier{};
+                const int frames = earlier_input_frames<Renderer<FallbackFloat32>>(read_parameters(instance_data.parameter_helper, time));
+                for (int k = 1; k <= frames; k++) {
+                    try {
+                        ClipHolder clip(instance, "Source", time - k);
+                        if (clip.bitDepth != 32 || clip.componentsPerPixel != 4) break;
+                        earlier.push_back(gather_input_statistics<S>(clip, 4));
+                    }
+                    catch (const OfxStatus) {
+                        break;
+                    }
+                }
+                renderer.set_input_statistics(gather_input_statistics<S>(*rd.input), earlier);
+            }
+        }
     }
 
     unsigned int num_threads;
     global_MultiThreadSuite->multiThreadNumCPUs(&num_threads);
     //dev_log(std::string("Number of threads : ") + std::to_string(num_threads));
 
+    //Large frames are written with streaming stores, so the output doesn't push the input out of the cache.
+    //Not used when rendering in place (input is output), as the lines are already in the cache.
+    //(No in-place property is set, so a host should never alias the clips.  This is a guard)
+    const bool in_place = rd.input && rd.input->baseAddress == output.baseAddress;
+    if (output.bitDepth == 32 && !in_place) {
+        const auto frame_bytes = static_cast<size_t>(std::abs(output.rowBytes)) * static_cast<size_t>(output.bounds.y2 - output.bounds.y1) * (rd.input ? 2 : 1);
+        rd.streaming_stores = use_streaming_stores(frame_bytes);
+    }
+
+    //Renderers that reuse the depth of the last frame rendered.  (Useful when frames are rendered in sequence)
+    if constexpr (requires { renderer.set_previous_frame(nullptr); }) {
+        std::scoped_lock lock(instance_data.history_mutex);
+        renderer.set_previous_frame(instance_data.frame_history);
+    }
+
+    //Renderer pre-pass (e.g. low resolution evaluation)
+    if constexpr (requires { renderer.begin_prepare(); }) {
+        if constexpr (requires { renderer.set_render_window(0, 0, 0, 0); }) {
+            renderer.set_render_window(render_window.x1, render_window.y1, render_window.x2, render_window.y2);
+        }
+        PrepareThreadData<S> pd{ &renderer, renderer.begin_prepare(), &cancel };
+        if (pd.lines > 0) {
+            if (num_threads > 1) [[likely]] {
+                global_MultiThreadSuite->multiThread(thread_entry_prepare<S>, num_threads, &pd);
+            }
+            else {
+                thread_entry_prepare<S>(0, 1, &pd);
+            }
+        }
+        renderer.end_prepare();
+        if (cancel.was_cancelled()) return;
+    }
+
+    //Draft renders only render some of the pixels.  They are kept, so rendering the same frame at full quality only
+    //renders the rest.
+    std::shared_ptr<DraftFrame> draft_frame;
+    if constexpr (!project_uses_input && requires { renderer.draft_pattern(); }) {
+        if (draft && renderer.draft_pattern() != DraftPattern::all) {
+            draft_frame = std::make_shared<DraftFrame>(frame_key, renderer.draft_pattern(), render_window.x1, render_window.y1, render_window.x2, render_window.y2);
+            rd.draft = draft_frame.get();
+        }
+        else if (!draft) {
+            std::scoped_lock lock(instance_data.draft_mutex);
+            if (instance_data.draft_frame && instance_data.draft_frame->key == frame_key) rd.complete = instance_data.draft_frame;
+        }
+    }
+
+    //Tiles sized for the level 2 cache.  (Output pixels, and input pixels if read)
+    if (num_threads < 1) num_threads = 1;
+    const int bytes_per_pixel = static_cast<int>(4 * sizeof(float)) * (rd.input ? 2 : 1);
+    const auto tile_size = TileScheduler::choose_tile_size(render_window.x2 - render_window.x1, render_window.y2 - render_window.y1, static_cast<int>(num_threads), bytes_per_pixel);
+    TileScheduler tiles(render_window.x1, render_window.y1, render_window.x2, render_window.y2, static_cast<int>(num_threads), tile_size);
+    rd.tiles = &tiles;
+
     if (num_threads > 1) [[likely]] {
         global_MultiThreadSuite->multiThread(thread_entry_pixel_render<S>, num_threads, &rd);
     }
     else {
-        for (int y = render_window.y1; y < render_window.y2; y++) {
-            if (global_EffectSuite->abort(instance)) return;
-            render_line(&rd, y);
-        }
+        thread_entry_pixel_render<S>(0, 1, &rd);
+    }
+    if (cancel.was_cancelled()) return;
+
+    //Keep this frame's depth for the next one.  (Not kept if the render was aborted)
+    if constexpr (requires { renderer.take_frame_history(); }) {
+        auto history = renderer.take_frame_history();
+        std::scoped_lock lock(instance_data.history_mutex);
+        instance_data.frame_history = std::move(history);
+    }
+
+    //Keep the draft.  (Not kept if the render was aborted)
+    if (draft_frame) {
+        std::scoped_lock lock(instance_data.draft_mutex);
+        instance_data.draft_frame = std::move(draft_frame);
     }
 }
 
 
 /*******************************************************************************************************
-Render a line.
+Render a tile.
 (Called on a worker thread)
 *******************************************************************************************************/
 template <SimdFloat S>
-static void render_line(RenderThreadData<S>* rd, int y) {
+static void render_tile(RenderThreadData<S>* rd, const Tile& tile) {
     if (rd->output->bitDepth == 32 && rd->output->componentsPerPixel == 4) {
-        render_line32(rd, y);
+        render_tile32(rd, tile);
     }
     //TODO.  Other Bit Depths
 }
 
 /*******************************************************************************************************
-Render a line.  
+Render a tile.  
+Nothing outside the tile is written, as other threads are rendering the tiles around it.
 (Called on a worker thread)
 *******************************************************************************************************/
 template <SimdFloat S>
-static void render_line32(RenderThreadData<S>* rd, int y) {
-    //dev_log("Render Line " + std::to_string(y));
-
-    int x = rd->render_window->x1;
-    for (; x < rd->render_window->x2 - S::number_of_elements() + 1; x += S::number_of_elements()) {
-        render_pixel32(rd, x, y);
+static void render_tile32(RenderThreadData<S>* rd, const Tile& tile) {
+    //Without input, the tile is rendered as a block.
+    if constexpr (!project_uses_input) {
+        render_block32(rd, OfxRectI{ tile.x1, tile.y1, tile.x2, tile.y2 });
+        return;
     }
-    //Handle the case where the width is not a multiple of S::number_of_elements
-    if (x < rd->render_window->x2 && rd->render_window->x2 > S::number_of_elements()) [[unlikely]] {
-        x -= S::number_of_elements() - (rd->render_window->x2 - x);
-        render_pixel32(rd, x, y);
 
+    for (int y = tile.y1; y < tile.y2; y++) {
+        //The next line of the tile.  Its input is prefetched while this line renders.
+        const float* next_input{ nullptr };
+        if (rd->input && y + 1 < tile.y2) next_input = rd->input->pixelAddressFloat(tile.x1, y + 1);
+
+        int x = tile.x1;
+        for (; x < tile.x2 - S::number_of_elements() + 1; x += S::number_of_elements()) {
+            if (next_input) prefetch_pixels(next_input + (x - tile.x1) * 4, S::number_of_elements() * 4 * sizeof(float));
+            render_pixel32(rd, x, y, tile.x2);
+        }
+        //Handle the case where the width is not a multiple of S::number_of_elements
+        //The last vector is only partly inside the tile.  Only the pixels inside the tile are read and written,
+        //as other threads are rendering the tiles next to it.  (And the input may be the output)
+        if (x < tile.x2) [[unlikely]] {
+            render_pixel32(rd, x, y, tile.x2);
+        }
     }
+    if (rd->streaming_stores) streaming_store_fence();
 }
 
 
 
+/*******************************************************************************************************
+Render an area as a block (see render-block.h), then copy it to the output.  (No input)
+Each thread keeps its own block, so the buffers are reused.
+(Called on a worker thread)
+*******************************************************************************************************/
+template <SimdFloat S>
+static void render_block32(RenderThreadData<S>* rd, const OfxRectI& area) {
+    thread_local BlockOutput<S> block{};
+    if (area.x2 <= area.x1 || area.y2 <= area.y1) return;
+
+    if (rd->draft) render_block_draft(*rd->renderer, area.x1, area.y1, area.x2 - area.x1, area.y2 - area.y1, block, *rd->draft);
+    else if (rd->complete) complete_block(*rd->renderer, area.x1, area.y1, area.x2 - area.x1, area.y2 - area.y1, block, *rd->complete);
+    else render_block(*rd->renderer, area.x1, area.y1, area.x2 - area.x1, area.y2 - area.y1, block);
+    for (int j = 0; j < block.height; j++) {
+        for (int i = 0; i < block.vectors_per_row; i++) {
+            copy_pixel_to_output_buffer(*rd->output, area.x1 + i * S::number_of_elements(), area.y1 + j, area.x2, block.get(i, j), rd->streaming_stores);
+        }
+    }
+    if (rd->streaming_stores) streaming_store_fence();
+}
+
+
 /*******************************************************************************************************
 32-bit
 Renders a pixel (or a simd vector's worth of pixels)
 Passes of to actual project renderer
 *******************************************************************************************************/
 template <SimdFloat S>
-static inline void render_pixel32(RenderThreadData<S>* rd, int x, int y) {
+static inline void render_pixel32(RenderThreadData<S>* rd, int x, int y, int max_x) {
     ColourRGBA<S> c;
     if constexpr (project_uses_input) {
-        
-        //Loads pixels from input buffer. 
-        auto ptr = rd->input->pixelAddressFloat(x, y);
-        ColourRGBA<S> input_colour;
-        if (ptr) {
-            for (int i = 0; i < S::number_of_elements(); i++) {
-                input_colour.red.set_element(i, *(ptr++));
-                input_colour.green.set_element(i, *(ptr++));
-                input_colour.blue.set_element(i, *(ptr++));
-                input_colour.alpha.set_element(i, *(ptr++));
-            }
-        }
+        const auto input_colour = read_input_pixel32<S>(*rd->input, x, y, std::min(S::number_of_elements(), max_x - x));
         c = rd->renderer->render_pixel_with_input(S::make_sequential(static_cast<S::F>(x)), S(static_cast<S::F>(y)), input_colour);        
     }
     else {
         c = rd->renderer->render_pixel(S::make_sequential(static_cast<S::F>(x)), S(static_cast<S::F>(y)));        
     }
-    copy_pixel_to_output_buffer(*rd->output, x, y, rd->render_window->x2, c);
+    copy_pixel_to_output_buffer(*rd->output, x, y, max_x, c, rd->streaming_stores);
+}
+
+
+/*******************************************************************************************************
+32-bit
+Loads a simd vector's worth of pixels from the input buffer (RGBA).
+Only count pixels are read (the end of a tile).  The other lanes are left as opaque black.
+*******************************************************************************************************/
+template <SimdFloat S>
+static inline ColourRGBA<S> read_input_pixel32(ClipHolder& input, int x, int y, int count) {
+    auto ptr = input.pixelAddressFloat(x, y);
+    ColourRGBA<S> input_colour;
+    if (ptr) {
+        for (int i = 0; i < count; i++) {
+            input_colour.red.set_element(i, *(ptr++));
+            input_colour.green.set_element(i, *(ptr++));
+            input_colour.blue.set_element(i, *(ptr++));
+            input_colour.alpha.set_element(i, *(ptr++));
+        }
+    }
+    return input_colour;
 }
 
 
+/*******************************************************************************************************
+Measure an input frame before rendering.  (32-bit RGBA only)
+Each thread fills its own partial result, which are merged once all threads are done.
+(Called on a worker thread)
+*******************************************************************************************************/
+template <SimdFloat S>
+static ImageStatistics gather_input_statistics(ClipHolder& input, int step) {
+    StatisticsThreadData<S> sd{};
+    sd.input = &input;
+    sd.step = step;
+
+    unsigned int num_threads{};
+    global_MultiThreadSuite->multiThreadNumCPUs(&num_threads);
+    if (num_threads < 1) num_threads = 1;
+    sd.partial.resize(num_threads);
 
+    if (num_threads > 1) [[likely]] {
+        global_MultiThreadSuite->multiThread(thread_entry_input_statistics<S>, num_threads, &sd);
+    }
+    else {
+        thread_entry_input_statistics<S>(0, 1, &sd);
+    }
+
+    ImageStatistics stats{};
+    for (const auto& p : sd.partial) stats.merge(p);
+    return stats;
+}
+
+
+/*******************************************************************************************************
+Thread Entry Point for the input statistics pre-pass.
+Takes every threadMax'th line (of the lines measured).
+*******************************************************************************************************/
+template <SimdFloat S>
+void thread_entry_input_statistics(unsigned int threadIndex, unsigned int threadMax, void* customArg) {
+    auto sd = static_cast<StatisticsThreadData<S>*>(customArg);
+    const auto& bounds = sd->input->bounds;
+    constexpr int n = S::number_of_elements();
+
+    ImageStatisticsAccumulator<S> accumulator{};
+    for (int y = bounds.y1 + static_cast<int>(threadIndex) * sd->step; y < bounds.y2; y += static_cast<int>(threadMax) * sd->step) {
+        int x = bounds.x1;
+        for (; x < bounds.x2 - n + 1; x += n * sd->step) {
+            accumulator.add(read_input_pixel32<S>(*sd->input, x, y));
+        }
+        //The last vector overlaps the previous one.  Only the new lanes are counted.
+        if (sd->step == 1 && x < bounds.x2 && bounds.x2 - bounds.x1 >= n) [[unlikely]] {
+            const int start = bounds.x2 - n;
+            accumulator.add(read_input_pixel32<S>(*sd->input, start, y), x - start);
+        }
+        accumulator.end_row();
+    }
+    sd->partial[threadIndex] = accumulator.finish();
+}
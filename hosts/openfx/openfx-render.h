@@ -29,4 +29,5 @@ Description:
 #include "openfx-helper.h"
 #include "openfx-parameter-helper.h"
 
-OfxStatus openfx_render(const OfxImageEffectHandle instance, OfxPropertySetHandle in_args);
\ No newline at end of file
+OfxStatus openfx_render(const OfxImageEffectHandle instance, OfxPropertySetHandle in_args);
+OfxStatus openfx_get_frames_needed(const OfxImageEffectHandle instance, OfxPropertySetHandle in_args, OfxPropertySetHandle out_args);
\ No newline at end of file
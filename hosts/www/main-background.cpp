@@ -110,6 +110,10 @@ EM_JS (emscripten::EM_VAL, setup_workers, (), {
         lineNumber=0;
         linesRendered=0;
         
+        //Workers skip any lines of older jobs they haven't started.
+        for (let i=0; i< workerCount; i++){
+            workers[i].postMessage({'cancel':true, 'jobNumber':jobNumber});
+        }
 
         for (let i=0; i< workerCount; i++){
             startWorkerRender(workers[i]);
@@ -32,15 +32,21 @@ Description:
 #include <emscripten/val.h>
 #include <emscripten/bind.h>
 
+#include <type_traits>
+
+#include "../../projects/watercolour-texture/config.h"
 #include "../../projects/watercolour-texture/parameters.h"
 #include "../../common/simd-f32.h"
+#include "../../common/simd-f64.h"
 
 #include "../../projects/watercolour-texture/renderer.h"
 #include "../../common/colour.h"
+#include "../../common/render-block.h"
 #include "jsutil.h"
 
-//We force the renderer to use the fallback type because we are in WASM.
-thread_local Renderer<FallbackFloat32> renderer {};
+//We force the renderer to use the fallback type because we are in WASM.  (Of the project's precision)
+typedef std::conditional_t<std::is_same_v<Precision, double>, FallbackFloat64, FallbackFloat32> WasmFloat;
+thread_local Renderer<WasmFloat> renderer {};
 
 /**************************************************************************************************
  * [Inline Javascript]
@@ -57,18 +63,43 @@ EM_JS (bool, run_javascipt, (), {
         Module["setup_renderer"](data['width'], data['height']);
         Module["set_seed"](data['seed']);
         //console.log(data['seed']);
-        for (let x=0; x< data['width']; x++){
-            u32[x] = Module["render_pixel"](x, data['line']);
-        }        
+        u32.set(Module["render_line"](data['line']));
     
         postMessage({'result':true, 'buffer':buf, 'jobNumber': data['jobNumber'], 'line':data['line']},[buf]);
     }
     
+    //***Lines waiting to be rendered.  Lines from jobs older than the newest we have heard of are skipped.***
+    let latestJob = 0;
+    let queue = [];
+    let scheduled = false;
+    const channel = new MessageChannel();   //Used to render the next line after any waiting messages are handled.  (setTimeout adds a delay)
+    channel.port1.onmessage = renderNext;
+
+    function scheduleNext(){
+        if (scheduled || queue.length == 0) return;
+        scheduled = true;
+        channel.port2.postMessage(null);
+    }
+
+    function renderNext(){
+        scheduled = false;
+        const data = queue.shift();
+        if (typeof(data) != "undefined" && data['jobNumber'] >= latestJob) render_line(data);
+        scheduleNext();
+    }
+
     //*** Handel incoming messages ***
     function handelMessage(msg){ 
+        //A new job has started (e.g. a resize), so lines from older jobs aren't needed.
+        if(msg.data.hasOwnProperty('cancel')){
+            latestJob = Math.max(latestJob, msg.data['jobNumber']);
+            return;
+        }
         if(msg.data.hasOwnProperty('render')){  
             //console.log("Render Request Line : ", msg.data.line);
-            render_line(msg.data);
+            latestJob = Math.max(latestJob, msg.data['jobNumber']);
+            queue.push(msg.data);
+            scheduleNext();
             return;
         }        
     }
@@ -114,6 +145,25 @@ uint32_t render_pixel(uint32_t x, uint32_t y){
 
 }
 
+/**************************************************************************************************
+ * Render Line
+ * Renders a whole line as a block (one call from JS rather than one per pixel).
+ * Returns a view of the pixels, which is valid until the next call.
+ * Exported to JS
+ * ************************************************************************************************/
+emscripten::val render_line(uint32_t y){
+    thread_local BlockOutput<WasmFloat> block {};
+    thread_local std::vector<uint32_t> line {};
+
+    const int width = std::max(renderer.get_width(), 0);
+    line.assign(width, 0xff0000ff); //Red if caller has not set size.
+    if (width > 0 && renderer.get_height() > 0) {
+        render_block(renderer, 0, static_cast<int>(y), width, 1, block);
+        for (int x = 0; x < width; x++) line[x] = block.get(x, 0).to_colour8().to_uint32_keep_memory_layout();
+    }
+    return emscripten::val(emscripten::typed_memory_view(line.size(), line.data()));
+}
+
 
 /**************************************************************************************************
  * Main Entry Point for WebWorker
@@ -130,6 +180,7 @@ int main(){
 using namespace emscripten;
 EMSCRIPTEN_BINDINGS(main_render_worker){
     function("render_pixel", &render_pixel);
+    function("render_line", &render_line);
     function("setup_renderer", &setup_renderer); 
     function("set_seed", &set_seed); 
 }
@@ -47,7 +47,8 @@ constexpr bool project_overlay_on_input = false;  // Does the project perform a
 //Indicates that a project will not return any transparent pixels.
 constexpr bool project_is_solid_render = false;
 
-//Floating point precesion to use for this project.
+//Floating point precesion to use for this project.  (float or double)
+//Hosts render with the SIMD types of this precision (Float32 or Float64).
 typedef float Precision;
 
 
@@ -63,6 +63,10 @@ enum class ParameterID {
 	colourspace_out,
 	exposure,
 	gamma,
+	lut3d_file,
+	lut3d_amount,
+	exposure_mode,
+	auto_exposure_smoothing,
 
 
 
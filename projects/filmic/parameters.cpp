@@ -66,9 +66,20 @@ ParameterList build_project_parameters() {
 
 	params.add_entry(ParameterEntry::make_number(ParameterID::mix_amount, "Apply %",0.0,200.0,100.0,0.0,200.0,2));
 	
+	//Auto exposure measures the input frame.  The exposure slider is then added as compensation.
+	std::vector<std::string> exposure_mode_list{};
+	exposure_mode_list.push_back("Manual");
+	exposure_mode_list.push_back("Auto");
+	params.add_entry(ParameterEntry::make_list(ParameterID::exposure_mode, "Exposure Mode", std::move(exposure_mode_list)));
+
 	params.add_entry(ParameterEntry::make_number(ParameterID::exposure, "Exposure", -10.0, +10.0, 0.0, 0.0, 100.0, 3));
+	params.add_entry(ParameterEntry::make_number(ParameterID::auto_exposure_smoothing, "Auto Exposure Smoothing %", 0.0, 99.0, 80.0, 0.0, 99.0, 1));
 	params.add_entry(ParameterEntry::make_number(ParameterID::gamma, "Gamma (Extra)", 0.0, +10.0, 1.0, 0.0, 10.0, 2));
 
+	//Optional 3D LUT (.cube) applied after the look.
+	params.add_entry(ParameterEntry::make_file(ParameterID::lut3d_file, "3D LUT File"));
+	params.add_entry(ParameterEntry::make_number(ParameterID::lut3d_amount, "3D LUT Apply %", 0.0, 100.0, 100.0, 0.0, 100.0, 2));
+
 	
 	
 	//params.add_entry(ParameterEntry::make_list(ParameterID::colourspace_out, "Output Colour Space", std::move(colourspace_list)));
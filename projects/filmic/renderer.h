@@ -41,11 +41,18 @@ Description:
 #include <numbers>
 #include <typeinfo>
 #include <array>
+#include <memory>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
 
 #include "../../common/colour.h"
+#include "../../common/image-statistics.h"
 #include "../../common/linear-algebra.h"
 #include "../../common/noise.h"
 #include "../../common/parameter-list.h"
+#include "../../common/lut1d.h"
+#include "../../common/lut3d.h"
 #include "..\..\common\input-transforms.h"
 
 #include "..\..\common\simd-cpuid.h"
@@ -55,6 +62,7 @@ Description:
 
 
 constexpr size_t lut_size = 4096;
+constexpr int inverse_lut_size = 16384;
 constexpr std::array<float, lut_size> very_low_contrast {0.0000000000000E+0, 5.9973202403113E-5, 1.2000306906271E-4, 1.8008965102724E-4, 2.4023299938559E-4, 3.0043316526705E-4, 3.6069019984138E-4, 4.2100415431882E-4, 4.8137507995013E-4, 5.4180302802653E-4, 6.0228804987980E-4, 6.6283019688233E-4, 7.2342952044696E-4, 7.8408607202724E-4, 8.4479990311727E-4, 9.0557106525180E-4, 9.6639961000620E-4, 1.0272855889965E-3, 1.0882290538796E-3, 1.1492300563527E-3, 1.2102886481541E-3, 1.2714048810628E-3, 1.3325788068983E-3, 1.3938104775212E-3, 1.4550999448326E-3, 1.5164472607748E-3, 1.5778524773305E-3, 1.6393156465236E-3, 1.7008368204186E-3, 1.7624160511211E-3, 1.8240533907776E-3, 1.8857488915754E-3, 1.9475026057429E-3, 2.0093145855492E-3, 2.0711848833048E-3, 2.1331135513608E-3, 2.1951006421096E-3, 2.2571462079845E-3, 2.3192503014598E-3, 2.3814129750512E-3, 2.4436342813150E-3, 2.5059142728491E-3, 2.5682530022922E-3, 2.6306505223243E-3, 2.6931068856665E-3, 2.7556221450811E-3, 2.8181963533717E-3, 2.8808295633830E-3, 2.9435218280009E-3, 3.0062732001529E-3, 3.0690837328073E-3, 3.1319534789740E-3, 3.1948824917040E-3, 3.2578708240900E-3, 3.3209185292657E-3, 3.3840256604063E-3, 3.4471922707282E-3, 3.5104184134897E-3, 3.5737041419898E-3, 3.6370495095697E-3, 3.7004545696114E-3, 3.7639193755388E-3, 3.8274439808172E-3, 3.8910284389532E-3, 3.9546728034951E-3, 4.0183771280329E-3, 4.0821414661979E-3, 4.1459658716630E-3, 4.2098503981429E-3, 4.2737950993937E-3, 4.3378000292132E-3, 4.4018652414409E-3, 4.4659907899580E-3, 4.5301767286872E-3, 4.5944231115931E-3, 4.6587299926820E-3, 4.7230974260017E-3, 4.7875254656421E-3, 4.8520141657346E-3, 4.9165635804526E-3, 4.9811737640110E-3, 5.0458447706670E-3, 5.1105766547191E-3, 5.1753694705080E-3, 5.2402232724162E-3, 5.3051381148681E-3, 5.3701140523299E-3, 5.4351511393100E-3, 5.5002494303583E-3, 5.5654089800672E-3, 5.6306298430705E-3, 5.6959120740444E-3, 5.7612557277071E-3, 5.8266608588185E-3, 5.8921275221809E-3, 5.9576557726385E-3, 6.0232456650775E-3, 6.0888972544263E-3, 6.1546105956555E-3, 6.2203857437777E-3, 6.2862227538475E-3, 6.3521216809619E-3, 6.4180825802601E-3, 6.4841055069232E-3, 6.5501905161748E-3, 6.6163376632805E-3, 6.6825470035484E-3, 6.7488185923286E-3, 6.8151524850137E-3, 6.8815487370383E-3, 6.9480074038796E-3, 7.0145285410569E-3, 7.0811122041319E-3, 7.1477584487089E-3, 7.2144673304341E-3, 7.2812389049965E-3, 7.3480732281273E-3, 7.4149703556001E-3, 7.4819303432310E-3, 7.5489532468785E-3, 7.6160391224437E-3, 7.6831880258701E-3, 7.7504000131435E-3, 7.8176751402925E-3, 7.8850134633882E-3, 7.9524150385439E-3, 8.0198799219160E-3, 8.0874081697030E-3, 8.1549998381462E-3, 8.2226549835295E-3, 8.2903736621794E-3, 8.3581559304651E-3, 8.4260018447983E-3, 8.4939114616334E-3, 8.5618848374677E-3, 8.6299220288409E-3, 8.6980230923356E-3, 8.7661880845770E-3, 8.8344170622331E-3, 8.9027100820148E-3, 8.9710672006755E-3, 9.0394884750116E-3, 9.1079739618622E-3, 9.1765237181092E-3, 9.2451378006774E-3, 9.3138162665344E-3, 9.3825591726908E-3, 9.4513665761998E-3, 9.5202385341577E-3, 9.5891751037037E-3, 9.6581763420198E-3, 9.7272423063310E-3, 9.7963730539053E-3, 9.8655686420537E-3, 9.9348291281299E-3, 1.0004154569531E-2, 1.0073545023697E-2, 1.0143000548110E-2, 1.0212521200297E-2, 1.0282107037826E-2, 1.0351758118310E-2, 1.0421474499403E-2, 1.0491256238805E-2, 1.0561103394256E-2, 1.0631016023541E-2, 1.0700994184487E-2, 1.0771037934965E-2, 1.0841147332889E-2, 1.0911322436216E-2, 1.0981563302946E-2, 1.1051869991123E-2, 1.1122242558834E-2, 1.1192681064208E-2, 1.1263185565418E-2, 1.1333756120682E-2, 1.1404392788258E-2, 1.1475095626449E-2, 1.1545864693603E-2, 1.1616700048108E-2, 1.1687601748397E-2, 1.1758569852947E-2, 1.1829604420276E-2, 1.1900705508950E-2, 1.1971873177572E-2, 1.2043107484794E-2, 1.2114408489308E-2, 1.2185776249850E-2, 1.2257210825202E-2, 1.2328712274186E-2, 1.2400280655669E-2, 1.2471916028561E-2, 1.2543618451817E-2, 1.2615387984433E-2, 1.2687224685451E-2, 1.2759128613954E-2, 1.2831099829071E-2, 1.2903138389973E-2, 1.2975244355875E-2, 1.3047417786035E-2, 1.3119658739757E-2, 1.3191967276384E-2, 1.3264343455307E-2, 1.3336787335959E-2, 1.3409298977816E-2, 1.3481878440399E-2, 1.3554525783271E-2, 1.3627241066040E-2, 1.3700024348356E-2, 1.3772875689916E-2, 1.3845795150457E-2, 1.3918782789763E-2, 1.3991838667658E-2, 1.4064962844013E-2, 1.4138155378741E-2, 1.4211416331800E-2, 1.4284745763190E-2, 1.4358143732957E-2, 1.4431610301190E-2, 1.4505145528019E-2, 1.4578749473623E-2, 1.4652422198221E-2, 1.4726163762077E-2, 1.4799974225499E-2, 1.4873853648838E-2, 1.4947802092490E-2, 1.5021819616895E-2, 1.5095906282535E-2, 1.5170062149939E-2, 1.5244287279676E-2, 1.5318581732363E-2, 1.5392945568659E-2, 1.5467378849265E-2, 1.5541881634930E-2, 1.5616453986444E-2, 1.5691095964643E-2, 1.5765807630404E-2, 1.5840589044651E-2, 1.5915440268351E-2, 1.5990361362514E-2, 1.6065352388196E-2, 1.6140413406496E-2, 1.6215544478557E-2, 1.6290745665566E-2, 1.6366017028754E-2, 1.6441358629396E-2, 1.6516770528812E-2, 1.6592252788366E-2, 1.6667805469465E-2, 1.6743428633560E-2, 1.6819122342148E-2, 1.6894886656769E-2, 1.6970721639007E-2, 1.7046627350490E-2, 1.7122603852891E-2, 1.7198651207926E-2, 1.7274769477357E-2, 1.7350958722988E-2, 1.7427219006669E-2, 1.7503550390293E-2, 1.7579952935799E-2, 1.7656426705167E-2, 1.7732971760425E-2, 1.7809588163643E-2, 1.7886275976936E-2, 1.7963035262462E-2, 1.8039866082426E-2, 1.8116768499074E-2, 1.8193742574699E-2, 1.8270788371636E-2, 1.8347905952268E-2, 1.8425095379017E-2, 1.8502356714354E-2, 1.8579690020793E-2, 1.8657095360890E-2, 1.8734572797249E-2, 1.8812122392515E-2, 1.8889744209381E-2, 1.8967438310581E-2, 1.9045204758896E-2, 1.9123043617149E-2, 1.9200954948208E-2, 1.9278938814988E-2, 1.9356995280446E-2, 1.9435124407583E-2, 1.9513326259446E-2, 1.9591600899125E-2, 1.9669948389756E-2, 1.9748368794518E-2, 1.9826862176636E-2, 1.9905428599378E-2, 1.9984068126058E-2, 2.0062780820032E-2, 2.0141566744704E-2, 2.0220425963519E-2, 2.0299358539969E-2, 2.0378364537589E-2, 2.0457444019960E-2, 2.0536597050706E-2, 2.0615823693497E-2, 2.0695124012046E-2, 2.0774498070112E-2, 2.0853945931498E-2, 2.0933467660050E-2, 2.1013063319662E-2, 2.1092732974269E-2, 2.1172476687853E-2, 2.1252294524440E-2, 2.1332186548100E-2, 2.1412152822948E-2, 2.1492193413143E-2, 2.1572308382891E-2, 2.1652497796439E-2, 2.1732761718081E-2, 2.1813100212156E-2, 2.1893513343045E-2, 2.1974001175177E-2, 2.2054563773024E-2, 2.2135201201101E-2, 2.2215913523971E-2, 2.2296700806239E-2, 2.2377563112556E-2, 2.2458500507618E-2, 2.2539513056164E-2, 2.2620600822980E-2, 2.2701763872893E-2, 2.2783002270780E-2, 2.2864316081558E-2, 2.2945705370191E-2, 2.3027170201687E-2, 2.3108710641099E-2, 2.3190326753525E-2, 2.3272018604107E-2, 2.3353786258032E-2, 2.3435629780532E-2, 2.3517549236884E-2, 2.3599544692409E-2, 2.3681616212472E-2, 2.3763763862485E-2, 2.3845987707903E-2, 2.3928287814227E-2, 2.4010664247002E-2, 2.4093117071816E-2, 2.4175646354306E-2, 2.4258252160150E-2, 2.4340934555072E-2, 2.4423693604842E-2, 2.4506529375272E-2, 2.4589441932223E-2, 2.4672431341595E-2, 2.4755497669339E-2, 2.4838640981446E-2, 2.4921861343954E-2, 2.5005158822946E-2, 2.5088533484548E-2, 2.5171985394934E-2, 2.5255514620319E-2, 2.5339121226965E-2, 2.5422805281179E-2, 2.5506566849312E-2, 2.5590405997761E-2, 2.5674322792965E-2, 2.5758317301410E-2, 2.5842389589629E-2, 2.5926539724194E-2, 2.6010767771727E-2, 2.6095073798894E-2, 2.6179457872402E-2, 2.6263920059008E-2, 2.6348460425511E-2, 2.6433079038755E-2, 2.6517775965629E-2, 2.6602551273067E-2, 2.6687405028048E-2, 2.6772337297597E-2, 2.6857348148780E-2, 2.6942437648712E-2, 2.7027605864551E-2, 2.7112852863500E-2, 2.7198178712807E-2, 2.7283583479764E-2, 2.7369067231710E-2, 2.7454630036025E-2, 2.7540271960139E-2, 2.7625993071523E-2, 2.7711793437693E-2, 2.7797673126212E-2, 2.7883632204686E-2, 2.7969670740767E-2, 2.8055788802152E-2, 2.8141986456580E-2, 2.8228263771839E-2, 2.8314620815759E-2, 2.8401057656216E-2, 2.8487574361130E-2, 2.8574170998467E-2, 2.8660847636237E-2, 2.8747604342496E-2, 2.8834441185342E-2, 2.8921358232922E-2, 2.9008355553424E-2, 2.9095433215082E-2, 2.9182591286177E-2, 2.9269829835033E-2, 2.9357148930017E-2, 2.9444548639545E-2, 2.9532029032074E-2, 2.9619590176108E-2, 2.9707232140196E-2, 2.9794954992929E-2, 2.9882758802948E-2, 2.9970643638933E-2, 3.0058609569612E-2, 3.0146656663759E-2, 3.0234784990190E-2, 3.0322994617767E-2, 3.0411285615396E-2, 3.0499658052030E-2, 3.0588111996665E-2, 3.0676647518342E-2, 3.0765264686147E-2, 3.0853963569211E-2, 3.0942744236709E-2, 3.1031606757862E-2, 3.1120551201935E-2, 3.1209577638238E-2, 3.1298686136126E-2, 3.1387876764997E-2, 3.1477149594297E-2, 3.1566504693515E-2, 3.1655942132183E-2, 3.1745461979882E-2, 3.1835064306233E-2, 3.1924749180905E-2, 3.2014516673612E-2, 3.2104366854109E-2, 3.2194299792201E-2, 3.2284315557733E-2, 3.2374414220598E-2, 3.2464595850731E-2, 3.2554860518115E-2, 3.2645208292775E-2, 3.2735639244781E-2, 3.2826153444249E-2, 3.2916750961340E-2, 3.3007431866257E-2, 3.3098196229250E-2, 3.3189044120613E-2, 3.3279975610685E-2, 3.3370990769850E-2, 3.3462089668535E-2, 3.3553272377213E-2, 3.3644538966402E-2, 3.3735889506663E-2, 3.3827324068604E-2, 3.3918842722875E-2, 3.4010445540173E-2, 3.4102132591238E-2, 3.4193903946855E-2, 3.4285759677855E-2, 3.4377699855111E-2, 3.4469724549543E-2, 3.4561833832114E-2, 3.4654027773832E-2, 3.4746306445750E-2, 3.4838669918966E-2, 3.4931118264620E-2, 3.5023651553901E-2, 3.5116269858038E-2, 3.5208973248307E-2, 3.5301761796028E-2, 3.5394635572565E-2, 3.5487594649329E-2, 3.5580639097771E-2, 3.5673768989391E-2, 3.5766984395730E-2, 3.5860285388376E-2, 3.5953672038960E-2, 3.6047144419159E-2, 3.6140702600692E-2, 3.6234346655324E-2, 3.6328076654865E-2, 3.6421892671168E-2, 3.6515794776131E-2, 3.6609783041698E-2, 3.6703857539854E-2, 3.6798018342631E-2, 3.6892265522105E-2, 3.6986599150396E-2, 3.7081019299667E-2, 3.7175526042129E-2, 3.7270119450033E-2, 3.7364799595678E-2, 3.7459566551404E-2, 3.7554420389599E-2, 3.7649361182692E-2, 3.7744389003157E-2, 3.7839503923515E-2, 3.7934706016327E-2, 3.8029995354201E-2, 3.8125372009789E-2, 3.8220836055786E-2, 3.8316387564934E-2, 3.8412026610015E-2, 3.8507753263858E-2, 3.8603567599337E-2, 3.8699469689367E-2, 3.8795459606909E-2, 3.8891537424970E-2, 3.8987703216597E-2, 3.9083957054885E-2, 3.9180299012971E-2, 3.9276729164036E-2, 3.9373247581306E-2, 3.9469854338050E-2, 3.9566549507583E-2, 3.9663333163262E-2, 3.9760205378489E-2, 3.9857166226710E-2, 3.9954215781415E-2, 4.0051354116138E-2, 4.0148581304455E-2, 4.0245897419990E-2, 4.0343302536408E-2, 4.0440796727418E-2, 4.0538380066774E-2, 4.0636052628274E-2, 4.0733814485759E-2, 4.0831665713114E-2, 4.0929606384268E-2, 4.1027636573194E-2, 4.1125756353910E-2, 4.1223965800475E-2, 4.1322264986994E-2, 4.1420653987615E-2, 4.1519132876530E-2, 4.1617701727976E-2, 4.1716360616230E-2, 4.1815109615618E-2, 4.1913948800504E-2, 4.2012878245301E-2, 4.2111898024462E-2, 4.2211008212485E-2, 4.2310208883911E-2, 4.2409500113327E-2, 4.2508881975360E-2, 4.2608354544684E-2, 4.2707917896013E-2, 4.2807572104108E-2, 4.2907317243771E-2, 4.3007153389850E-2, 4.3107080617234E-2, 4.3207099000857E-2, 4.3307208615696E-2, 4.3407409536771E-2, 4.3507701839147E-2, 4.3608085597930E-2, 4.3708560888272E-2, 4.3809127785366E-2, 4.3909786364451E-2, 4.4010536700806E-2, 4.4111378869757E-2, 4.4212312946670E-2, 4.4313339006956E-2, 4.4414457126070E-2, 4.4515667379509E-2, 4.4616969842812E-2, 4.4718364591565E-2, 4.4819851701393E-2, 4.4921431247967E-2, 4.5023103307000E-2, 4.5124867954248E-2, 4.5226725265511E-2, 4.5328675316632E-2, 4.5430718183496E-2, 4.5532853942031E-2, 4.5635082668209E-2, 4.5737404438046E-2, 4.5839819327598E-2, 4.5942327412967E-2, 4.6044928770296E-2, 4.6147623475770E-2, 4.6250411605621E-2, 4.6353293236120E-2, 4.6456268443582E-2, 4.6559337304365E-2, 4.6662499894871E-2, 4.6765756291541E-2, 4.6869106570864E-2, 4.6972550809367E-2, 4.7076089083623E-2, 4.7179721470247E-2, 4.7283448045894E-2, 4.7387268887266E-2, 4.7491184071104E-2, 4.7595193674194E-2, 4.7699297773363E-2, 4.7803496445482E-2, 4.7907789767462E-2, 4.8012177816260E-2, 4.8116660668873E-2, 4.8221238402342E-2, 4.8325911093748E-2, 4.8430678820217E-2, 4.8535541658916E-2, 4.8640499687054E-2, 4.8745552981885E-2, 4.8850701620703E-2, 4.8955945680843E-2, 4.9061285239686E-2, 4.9166720374652E-2, 4.9272251163204E-2, 4.9377877682849E-2, 4.9483600011133E-2, 4.9589418225647E-2, 4.9695332404023E-2, 4.9801342623935E-2, 4.9907448963098E-2, 5.0013651499271E-2, 5.0119950310255E-2, 5.0226345473890E-2, 5.0332837068061E-2, 5.0439425170695E-2, 5.0546109859758E-2, 5.0652891213261E-2, 5.0759769309254E-2, 5.0866744225832E-2, 5.0973816041129E-2, 5.1080984833322E-2, 5.1188250680629E-2, 5.1295613661312E-2, 5.1403073853671E-2, 5.1510631336050E-2, 5.1618286186835E-2, 5.1726038484451E-2, 5.1833888307368E-2, 5.1941835734094E-2, 5.2049880843182E-2, 5.2158023713223E-2, 5.2266264422852E-2, 5.2374603050744E-2, 5.2483039675616E-2, 5.2591574376227E-2, 5.2700207231375E-2, 5.2808938319902E-2, 5.2917767720689E-2, 5.3026695512659E-2, 5.3135721774778E-2, 5.3244846586049E-2, 5.3354070025521E-2, 5.3463392172280E-2, 5.3572813105456E-2, 5.3682332904217E-2, 5.3791951647775E-2, 5.3901669415382E-2, 5.4011486286329E-2, 5.4121402339951E-2, 5.4231417655622E-2, 5.4341532312756E-2, 5.4451746390810E-2, 5.4562059969280E-2, 5.4672473127705E-2, 5.4782985945661E-2, 5.4893598502767E-2, 5.5004310878683E-2, 5.5115123153109E-2, 5.5226035405785E-2, 5.5337047716492E-2, 5.5448160165052E-2, 5.5559372831325E-2, 5.5670685795216E-2, 5.5782099136665E-2, 5.5893612935657E-2, 5.6005227272214E-2, 5.6116942226400E-2, 5.6228757878319E-2, 5.6340674308115E-2, 5.6452691595971E-2, 5.6564809822111E-2, 5.6677029066801E-2, 5.6789349410345E-2, 5.6901770933086E-2, 5.7014293715410E-2, 5.7126917837739E-2, 5.7239643380539E-2, 5.7352470424314E-2, 5.7465399049606E-2, 5.7578429337000E-2, 5.7691561367119E-2, 5.7804795220626E-2, 5.7918130978224E-2, 5.8031568720654E-2, 5.8145108528699E-2, 5.8258750483181E-2, 5.8372494664959E-2, 5.8486341154934E-2, 5.8600290034047E-2, 5.8714341383276E-2, 5.8828495283640E-2, 5.8942751816197E-2, 5.9057111062043E-2, 5.9171573102316E-2, 5.9286138018190E-2, 5.9400805890880E-2, 5.9515576801640E-2, 5.9630450831762E-2, 5.9745428062580E-2, 5.9860508575462E-2, 5.9975692451819E-2, 6.0090979773100E-2, 6.0206370620792E-2, 6.0321865076421E-2, 6.0437463221552E-2, 6.0553165137790E-2, 6.0668970906775E-2, 6.0784880610190E-2, 6.0900894329754E-2, 6.1017012147225E-2, 6.1133234144399E-2, 6.1249560403113E-2, 6.1365991005239E-2, 6.1482526032689E-2, 6.1599165567414E-2, 6.1715909691402E-2, 6.1832758486680E-2, 6.1949712035312E-2, 6.2066770419402E-2, 6.2183933721091E-2, 6.2301202023558E-2, 6.2418575406020E-2, 6.2536053953733E-2, 6.2653637747989E-2, 6.2771326871119E-2, 6.2889121405493E-2, 6.3007021433517E-2, 6.3125027037634E-2, 6.3243138300327E-2, 6.3361355304116E-2, 6.3479678131558E-2, 6.3598106865246E-2, 6.3716641587814E-2, 6.3835282381931E-2, 6.3954029330304E-2, 6.4072882515677E-2, 6.4191842020832E-2, 6.4310907928588E-2, 6.4430080321800E-2, 6.4549359283363E-2, 6.4668744896205E-2, 6.4788237243296E-2, 6.4907836407637E-2, 6.5027542472272E-2, 6.5147355520278E-2, 6.5267275634770E-2, 6.5387302898901E-2, 6.5507437395857E-2, 6.5627679208865E-2, 6.5748028421186E-2, 6.5868485116119E-2, 6.5989049376999E-2, 6.6109721287197E-2, 6.6230500930120E-2, 6.6351388389214E-2, 6.6472383747959E-2, 6.6593487089870E-2, 6.6714698498503E-2, 6.6836018057444E-2, 6.6957445850321E-2, 6.7078981960794E-2, 6.7200626472560E-2, 6.7322379469353E-2, 6.7444241034941E-2, 6.7566211253131E-2, 6.7688290207762E-2, 6.7810477982711E-2, 6.7932774661891E-2, 6.8055180329248E-2, 6.8177695068767E-2, 6.8300318964465E-2, 6.8423052100398E-2, 6.8545894560656E-2, 6.8668846429362E-2, 6.8791907790677E-2, 6.8915078728798E-2, 6.9038359327953E-2, 6.9161749672410E-2, 6.9285249846469E-2, 6.9408859934466E-2, 6.9532580020770E-2, 6.9656410189789E-2, 6.9780350525962E-2, 6.9904401113765E-2, 7.0028562037707E-2, 7.0152833382333E-2, 7.0277215232222E-2, 7.0401707671987E-2, 7.0526310786276E-2, 7.0651024659772E-2, 7.0775849377192E-2, 7.0900785023286E-2, 7.1025831682840E-2, 7.1150989440673E-2, 7.1276258381638E-2, 7.1401638590624E-2, 7.1527130152551E-2, 7.1652733152375E-2, 7.1778447675086E-2, 7.1904273805705E-2, 7.2030211629290E-2, 7.2156261230931E-2, 7.2282422695753E-2, 7.2408696108912E-2, 7.2535081555599E-2, 7.2661579121040E-2, 7.2788188890491E-2, 7.2914910949243E-2, 7.3041745382621E-2, 7.3168692275982E-2, 7.3295751714717E-2, 7.3422923784248E-2, 7.3550208570033E-2, 7.3677606157560E-2, 7.3805116632351E-2, 7.3932740079961E-2, 7.4060476585978E-2, 7.4188326236022E-2, 7.4316289115745E-2, 7.4444365310833E-2, 7.4572554907003E-2, 7.4700857990005E-2, 7.4829274645621E-2, 7.4957804959665E-2, 7.5086449017985E-2, 7.5215206906458E-2, 7.5344078710996E-2, 7.5473064517540E-2, 7.5602164412066E-2, 7.5731378480579E-2, 7.5860706809117E-2, 7.5990149483751E-2, 7.6119706590581E-2, 7.6249378215739E-2, 7.6379164445391E-2, 7.6509065365732E-2, 7.6639081062988E-2, 7.6769211623417E-2, 7.6899457133310E-2, 7.7029817678985E-2, 7.7160293346796E-2, 7.7290884223123E-2, 7.7421590394380E-2, 7.7552411947011E-2, 7.7683348967491E-2, 7.7814401542325E-2, 7.7945569758049E-2, 7.8076853701229E-2, 7.8208253458463E-2, 7.8339769116378E-2, 7.8471400761630E-2, 7.8603148480909E-2, 7.8735012360932E-2, 7.8866992488446E-2, 7.8999088950230E-2, 7.9131301833091E-2, 7.9263631223868E-2, 7.9396077209427E-2, 7.9528639876666E-2, 7.9661319312511E-2, 7.9794115603919E-2, 7.9927028837875E-2, 8.0060059101394E-2, 8.0193206481521E-2, 8.0326471065330E-2, 8.0459852939922E-2, 8.0593352192430E-2, 8.0726968910014E-2, 8.0860703179864E-2, 8.0994555089199E-2, 8.1128524725265E-2, 8.1262612175338E-2, 8.1396817526724E-2, 8.1531140866754E-2, 8.1665582282790E-2, 8.1800141862222E-2, 8.1934819692468E-2, 8.2069615860973E-2, 8.2204530455213E-2, 8.2339563562688E-2, 8.2474715270930E-2, 8.2609985667496E-2, 8.2745374839973E-2, 8.2880882875972E-2, 8.3016509863137E-2, 8.3152255889134E-2, 8.3288121041660E-2, 8.3424105408439E-2, 8.3560209077220E-2, 8.3696432135782E-2, 8.3832774671930E-2, 8.3969236773495E-2, 8.4105818528336E-2, 8.4242520024338E-2, 8.4379341349414E-2, 8.4516282591504E-2, 8.4653343838572E-2, 8.4790525178611E-2, 8.4927826699638E-2, 8.5065248489700E-2, 8.5202790636867E-2, 8.5340453229235E-2, 8.5478236354929E-2, 8.5616140102098E-2, 8.5754164558916E-2, 8.5892309813584E-2, 8.6030575954329E-2, 8.6168963069402E-2, 8.6307471247083E-2, 8.6446100575673E-2, 8.6584851143501E-2, 8.6723723038920E-2, 8.6862716350310E-2, 8.7001831166075E-2, 8.7141067574642E-2, 8.7280425664466E-2, 8.7419905524026E-2, 8.7559507241824E-2, 8.7699230906388E-2, 8.7839076606270E-2, 8.7979044430048E-2, 8.8119134466323E-2, 8.8259346803718E-2, 8.8399681530885E-2, 8.8540138736496E-2, 8.8680718509248E-2, 8.8821420937864E-2, 8.8962246111087E-2, 8.9103194117687E-2, 8.9244265046455E-2, 8.9385458986208E-2, 8.9526776025784E-2, 8.9668216254046E-2, 8.9809779759879E-2, 8.9951466632192E-2, 9.0093276959916E-2, 9.0235210832005E-2, 9.0377268337438E-2, 9.0519449565213E-2, 9.0661754604353E-2, 9.0804183543904E-2, 9.0946736472932E-2, 9.1089413480528E-2, 9.1232214655802E-2, 9.1375140087890E-2, 9.1518189865947E-2, 9.1661364079150E-2, 9.1804662816699E-2, 9.1948086167817E-2, 9.2091634221744E-2, 9.2235307067747E-2, 9.2379104795110E-2, 9.2523027493141E-2, 9.2667075251168E-2, 9.2811248158540E-2, 9.2955546304627E-2, 9.3099969778820E-2, 9.3244518670532E-2, 9.3389193069194E-2, 9.3533993064261E-2, 9.3678918745204E-2, 9.3823970201519E-2, 9.3969147522719E-2, 9.4114450798339E-2, 9.4259880117932E-2, 9.4405435571074E-2, 9.4551117247357E-2, 9.4696925236396E-2, 9.4842859627823E-2, 9.4988920511293E-2, 9.5135107976475E-2, 9.5281422113063E-2, 9.5427863010767E-2, 9.5574430759316E-2, 9.5721125448459E-2, 9.5867947167964E-2, 9.6014896007615E-2, 9.6161972057219E-2, 9.6309175406599E-2, 9.6456506145595E-2, 9.6603964364068E-2, 9.6751550151897E-2, 9.6899263598977E-2, 9.7047104795222E-2, 9.7195073830565E-2, 9.7343170794954E-2, 9.7491395778358E-2, 9.7639748870761E-2, 9.7788230162165E-2, 9.7936839742589E-2, 9.8085577702071E-2, 9.8234444130663E-2, 9.8383439118437E-2, 9.8532562755480E-2, 9.8681815131895E-2, 9.8831196337803E-2, 9.8980706463342E-2, 9.9130345598664E-2, 9.9280113833940E-2, 9.9430011259355E-2, 9.9580037965112E-2, 9.9730194041426E-2, 9.9880479578533E-2, 1.0003089466668E-1, 1.0018143939613E-1, 1.0033211385717E-1, 1.0048291814009E-1, 1.0063385233520E-1, 1.0078491653283E-1, 1.0093611082331E-1, 1.0108743529701E-1, 1.0123889004428E-1, 1.0139047515553E-1, 1.0154219072113E-1, 1.0169403683152E-1, 1.0184601357711E-1, 1.0199812104835E-1, 1.0215035933569E-1, 1.0230272852960E-1, 1.0245522872057E-1, 1.0260785999908E-1, 1.0276062245566E-1, 1.0291351618082E-1, 1.0306654126510E-1, 1.0321969779905E-1, 1.0337298587323E-1, 1.0352640557822E-1, 1.0367995700460E-1, 1.0383364024298E-1, 1.0398745538397E-1, 1.0414140251819E-1, 1.0429548173628E-1, 1.0444969312889E-1, 1.0460403678669E-1, 1.0475851280033E-1, 1.0491312126052E-1, 1.0506786225795E-1, 1.0522273588332E-1, 1.0537774222736E-1, 1.0553288138078E-1, 1.0568815343435E-1, 1.0584355847880E-1, 1.0599909660490E-1, 1.0615476790342E-1, 1.0631057246515E-1, 1.0646651038089E-1, 1.0662258174143E-1, 1.0677878663759E-1, 1.0693512516020E-1, 1.0709159740009E-1, 1.0724820344811E-1, 1.0740494339510E-1, 1.0756181733194E-1, 1.0771882534949E-1, 1.0787596753864E-1, 1.0803324399027E-1, 1.0819065479529E-1, 1.0834820004461E-1, 1.0850587982914E-1, 1.0866369423980E-1, 1.0882164336753E-1, 1.0897972730328E-1, 1.0913794613799E-1, 1.0929629996262E-1, 1.0945478886814E-1, 1.0961341294551E-1, 1.0977217228572E-1, 1.0993106697977E-1, 1.1009009711863E-1, 1.1024926279332E-1, 1.1040856409485E-1, 1.1056800111422E-1, 1.1072757394247E-1, 1.1088728267063E-1, 1.1104712738972E-1, 1.1120710819079E-1, 1.1136722516489E-1, 1.1152747840307E-1, 1.1168786799639E-1, 1.1184839403592E-1, 1.1200905661273E-1, 1.1216985581789E-1, 1.1233079174248E-1, 1.1249186447760E-1, 1.1265307411433E-1, 1.1281442074376E-1, 1.1297590445701E-1, 1.1313752534517E-1, 1.1329928349935E-1, 1.1346117901067E-1, 1.1362321197025E-1, 1.1378538246920E-1, 1.1394769059865E-1, 1.1411013644974E-1, 1.1427272011358E-1, 1.1443544168133E-1, 1.1459830124411E-1, 1.1476129889306E-1, 1.1492443471934E-1, 1.1508770881409E-1, 1.1525112126846E-1, 1.1541467217360E-1, 1.1557836162067E-1, 1.1574218970082E-1, 1.1590615650520E-1, 1.1607026212499E-1, 1.1623450665134E-1, 1.1639889017541E-1, 1.1656341278837E-1, 1.1672807458138E-1, 1.1689287564561E-1, 1.1705781607223E-1, 1.1722289595240E-1, 1.1738811537729E-1, 1.1755347443808E-1, 1.1771897322592E-1, 1.1788461183200E-1, 1.1805039034747E-1, 1.1821630886350E-1, 1.1838236747127E-1, 1.1854856626194E-1, 1.1871490532668E-1, 1.1888138475665E-1, 1.1904800464301E-1, 1.1921476507694E-1, 1.1938166614959E-1, 1.1954870795212E-1, 1.1971589057569E-1, 1.1988321411146E-1, 1.2005067865058E-1, 1.2021828428420E-1, 1.2038603110348E-1, 1.2055391919956E-1, 1.2072194866358E-1, 1.2089011958669E-1, 1.2105843206003E-1, 1.2122688617472E-1, 1.2139548202191E-1, 1.2156421969272E-1, 1.2173309927828E-1, 1.2190212086970E-1, 1.2207128455810E-1, 1.2224059043460E-1, 1.2241003859030E-1, 1.2257962911631E-1, 1.2274936210373E-1, 1.2291923764364E-1, 1.2308925582714E-1, 1.2325941674531E-1, 1.2342972048923E-1, 1.2360016714998E-1, 1.2377075681861E-1, 1.2394148958619E-1, 1.2411236554377E-1, 1.2428338478240E-1, 1.2445454739313E-1, 1.2462585346698E-1, 1.2479730309499E-1, 1.2496889636818E-1, 1.2514063337756E-1, 1.2531251421414E-1, 1.2548453896891E-1, 1.2565670773288E-1, 1.2582902059702E-1, 1.2600147765230E-1, 1.2617407898971E-1, 1.2634682470019E-1, 1.2651971487469E-1, 1.2669274960416E-1, 1.2686592897953E-1, 1.2703925309172E-1, 1.2721272203165E-1, 1.2738633589022E-1, 1.2756009475833E-1, 1.2773399872686E-1, 1.2790804788669E-1, 1.2808224232868E-1, 1.2825658214369E-1, 1.2843106742256E-1, 1.2860569825612E-1, 1.2878047473520E-1, 1.2895539695061E-1, 1.2913046499314E-1, 1.2930567895359E-1, 1.2948103892273E-1, 1.2965654499133E-1, 1.2983219725014E-1, 1.3000799578989E-1, 1.3018394070133E-1, 1.3036003207515E-1, 1.3053627000207E-1, 1.3071265457278E-1, 1.3088918587795E-1, 1.3106586400824E-1, 1.3124268905430E-1, 1.3141966110678E-1, 1.3159678025628E-1, 1.3177404659342E-1, 1.3195146020879E-1, 1.3212902119297E-1, 1.3230672963653E-1, 1.3248458563000E-1, 1.3266258926393E-1, 1.3284074062884E-1, 1.3301903981522E-1, 1.3319748691356E-1, 1.3337608201434E-1, 1.3355482520802E-1, 1.3373371658502E-1, 1.3391275623577E-1, 1.3409194425068E-1, 1.3427128072014E-1, 1.3445076573452E-1, 1.3463039938417E-1, 1.3481018175943E-1, 1.3499011295062E-1, 1.3517019304804E-1, 1.3535042214198E-1, 1.3553080032269E-1, 1.3571132768044E-1, 1.3589200430543E-1, 1.3607283028790E-1, 1.3625380571801E-1, 1.3643493068595E-1, 1.3661620528187E-1, 1.3679762959590E-1, 1.3697920371814E-1, 1.3716092773870E-1, 1.3734280174763E-1, 1.3752482583501E-1, 1.3770700009084E-1, 1.3788932460515E-1, 1.3807179946792E-1, 1.3825442476911E-1, 1.3843720059868E-1, 1.3862012704655E-1, 1.3880320420261E-1, 1.3898643215675E-1, 1.3916981099882E-1, 1.3935334081867E-1, 1.3953702170609E-1, 1.3972085375088E-1, 1.3990483704280E-1, 1.4008897167160E-1, 1.4027325772699E-1, 1.4045769529867E-1, 1.4064228447631E-1, 1.4082702534956E-1, 1.4101191800803E-1, 1.4119696254132E-1, 1.4138215903901E-1, 1.4156750759064E-1, 1.4175300828573E-1, 1.4193866121378E-1, 1.4212446646426E-1, 1.4231042412662E-1, 1.4249653429026E-1, 1.4268279704459E-1, 1.4286921247896E-1, 1.4305578068272E-1, 1.4324250174517E-1, 1.4342937575560E-1, 1.4361640280327E-1, 1.4380358297740E-1, 1.4399091636719E-1, 1.4417840306182E-1, 1.4436604315043E-1, 1.4455383672213E-1, 1.4474178386601E-1, 1.4492988467112E-1, 1.4511813922650E-1, 1.4530654762115E-1, 1.4549510994402E-1, 1.4568382628406E-1, 1.4587269673018E-1, 1.4606172137125E-1, 1.4625090029612E-1, 1.4644023359361E-1, 1.4662972135250E-1, 1.4681936366155E-1, 1.4700916060947E-1, 1.4719911228497E-1, 1.4738921877669E-1, 1.4757948017326E-1, 1.4776989656328E-1, 1.4796046803530E-1, 1.4815119467786E-1, 1.4834207657944E-1, 1.4853311382852E-1, 1.4872430651351E-1, 1.4891565472281E-1, 1.4910715854478E-1, 1.4929881806774E-1, 1.4949063337999E-1, 1.4968260456978E-1, 1.4987473172534E-1, 1.5006701493483E-1, 1.5025945428643E-1, 1.5045204986823E-1, 1.5064480176832E-1, 1.5083771007474E-1, 1.5103077487550E-1, 1.5122399625856E-1, 1.5141737431185E-1, 1.5161090912327E-1, 1.5180460078068E-1, 1.5199844937189E-1, 1.5219245498468E-1, 1.5238661770681E-1, 1.5258093762597E-1, 1.5277541482982E-1, 1.5297004940601E-1, 1.5316484144210E-1, 1.5335979102566E-1, 1.5355489824419E-1, 1.5375016318517E-1, 1.5394558593601E-1, 1.5414116658410E-1, 1.5433690521681E-1, 1.5453280192142E-1, 1.5472885678521E-1, 1.5492506989541E-1, 1.5512144133919E-1, 1.5531797120370E-1, 1.5551465957603E-1, 1.5571150654325E-1, 1.5590851219236E-1, 1.5610567661034E-1, 1.5630299988411E-1, 1.5650048210056E-1, 1.5669812334654E-1, 1.5689592370883E-1, 1.5709388327419E-1, 1.5729200212934E-1, 1.5749028036092E-1, 1.5768871805557E-1, 1.5788731529986E-1, 1.5808607218031E-1, 1.5828498878341E-1, 1.5848406519559E-1, 1.5868330150325E-1, 1.5888269779273E-1, 1.5908225415033E-1, 1.5928197066230E-1, 1.5948184741484E-1, 1.5968188449411E-1, 1.5988208198621E-1, 1.6008243997722E-1, 1.6028295855313E-1, 1.6048363779992E-1, 1.6068447780350E-1, 1.6088547864973E-1, 1.6108664042443E-1, 1.6128796321337E-1, 1.6148944710226E-1, 1.6169109217678E-1, 1.6189289852254E-1, 1.6209486622510E-1, 1.6229699536998E-1, 1.6249928604265E-1, 1.6270173832852E-1, 1.6290435231294E-1, 1.6310712808123E-1, 1.6331006571865E-1, 1.6351316531040E-1, 1.6371642694162E-1, 1.6391985069743E-1, 1.6412343666286E-1, 1.6432718492290E-1, 1.6453109556250E-1, 1.6473516866654E-1, 1.6493940431985E-1, 1.6514380260719E-1, 1.6534836361330E-1, 1.6555308742284E-1, 1.6575797412041E-1, 1.6596302379056E-1, 1.6616823651781E-1, 1.6637361238658E-1, 1.6657915148126E-1, 1.6678485388618E-1, 1.6699071968561E-1, 1.6719674896376E-1, 1.6740294180479E-1, 1.6760929829279E-1, 1.6781581851181E-1, 1.6802250254582E-1, 1.6822935047875E-1, 1.6843636239445E-1, 1.6864353837673E-1, 1.6885087850934E-1, 1.6905838287596E-1, 1.6926605156021E-1, 1.6947388464565E-1, 1.6968188221579E-1, 1.6989004435407E-1, 1.7009837114386E-1, 1.7030686266849E-1, 1.7051551901120E-1, 1.7072434025521E-1, 1.7093332648362E-1, 1.7114247777952E-1, 1.7135179422591E-1, 1.7156127590573E-1, 1.7177092290186E-1, 1.7198073529711E-1, 1.7219071317423E-1, 1.7240085661592E-1, 1.7261116570478E-1, 1.7282164052337E-1, 1.7303228115420E-1, 1.7324308767967E-1, 1.7345406018214E-1, 1.7366519874392E-1, 1.7387650344722E-1, 1.7408797437421E-1, 1.7429961160696E-1, 1.7451141522752E-1, 1.7472338531784E-1, 1.7493552195979E-1, 1.7514782523521E-1, 1.7536029522584E-1, 1.7557293201337E-1, 1.7578573567940E-1, 1.7599870630548E-1, 1.7621184397309E-1, 1.7642514876363E-1, 1.7663862075843E-1, 1.7685226003875E-1, 1.7706606668578E-1, 1.7728004078065E-1, 1.7749418240439E-1, 1.7770849163799E-1, 1.7792296856235E-1, 1.7813761325830E-1, 1.7835242580660E-1, 1.7856740628793E-1, 1.7878255478291E-1, 1.7899787137206E-1, 1.7921335613586E-1, 1.7942900915470E-1, 1.7964483050888E-1, 1.7986082027865E-1, 1.8007697854417E-1, 1.8029330538552E-1, 1.8050980088273E-1, 1.8072646511572E-1, 1.8094329816436E-1, 1.8116030010843E-1, 1.8137747102762E-1, 1.8159481100158E-1, 1.8181232010985E-1, 1.8202999843190E-1, 1.8224784604712E-1, 1.8246586303482E-1, 1.8268404947425E-1, 1.8290240544456E-1, 1.8312093102483E-1, 1.8333962629404E-1, 1.8355849133111E-1, 1.8377752621489E-1, 1.8399673102412E-1, 1.8421610583747E-1, 1.8443565073354E-1, 1.8465536579083E-1, 1.8487525108778E-1, 1.8509530670271E-1, 1.8531553271391E-1, 1.8553592919953E-1, 1.8575649623768E-1, 1.8597723390637E-1, 1.8619814228351E-1, 1.8641922144696E-1, 1.8664047147447E-1, 1.8686189244371E-1, 1.8708348443226E-1, 1.8730524751762E-1, 1.8752718177722E-1, 1.8774928728836E-1, 1.8797156412831E-1, 1.8819401237419E-1, 1.8841663210310E-1, 1.8863942339199E-1, 1.8886238631775E-1, 1.8908552095720E-1, 1.8930882738704E-1, 1.8953230568389E-1, 1.8975595592429E-1, 1.8997977818468E-1, 1.9020377254141E-1, 1.9042793907075E-1, 1.9065227784887E-1, 1.9087678895184E-1, 1.9110147245566E-1, 1.9132632843622E-1, 1.9155135696934E-1, 1.9177655813071E-1, 1.9200193199597E-1, 1.9222747864063E-1, 1.9245319814014E-1, 1.9267909056982E-1, 1.9290515600493E-1, 1.9313139452061E-1, 1.9335780619192E-1, 1.9358439109382E-1, 1.9381114930118E-1, 1.9403808088876E-1, 1.9426518593123E-1, 1.9449246450318E-1, 1.9471991667907E-1, 1.9494754253330E-1, 1.9517534214013E-1, 1.9540331557377E-1, 1.9563146290830E-1, 1.9585978421770E-1, 1.9608827957587E-1, 1.9631694905659E-1, 1.9654579273356E-1, 1.9677481068037E-1, 1.9700400297050E-1, 1.9723336967735E-1, 1.9746291087420E-1, 1.9769262663425E-1, 1.9792251703056E-1, 1.9815258213614E-1, 1.9838282202385E-1, 1.9861323676648E-1, 1.9884382643670E-1, 1.9907459110708E-1, 1.9930553085008E-1, 1.9953664573807E-1, 1.9976793584330E-1, 1.9999940123793E-1, 2.0023104199400E-1, 2.0046285818346E-1, 2.0069484987813E-1, 2.0092701714976E-1, 2.0115936006995E-1, 2.0139187871023E-1, 2.0162457314199E-1, 2.0185744343655E-1, 2.0209048966509E-1, 2.0232371189870E-1, 2.0255711020833E-1, 2.0279068466487E-1, 2.0302443533907E-1, 2.0325836230156E-1, 2.0349246562288E-1, 2.0372674537346E-1, 2.0396120162361E-1, 2.0419583444352E-1, 2.0443064390328E-1, 2.0466563007288E-1, 2.0490079302217E-1, 2.0513613282090E-1, 2.0537164953872E-1, 2.0560734324514E-1, 2.0584321400957E-1, 2.0607926190131E-1, 2.0631548698953E-1, 2.0655188934331E-1, 2.0678846903159E-1, 2.0702522612320E-1, 2.0726216068686E-1, 2.0749927279117E-1, 2.0773656250461E-1, 2.0797402989555E-1, 2.0821167503224E-1, 2.0844949798279E-1, 2.0868749881524E-1, 2.0892567759745E-1, 2.0916403439722E-1, 2.0940256928219E-1, 2.0964128231988E-1, 2.0988017357773E-1, 2.1011924312301E-1, 2.1035849102289E-1, 2.1059791734443E-1, 2.1083752215455E-1, 2.1107730552005E-1, 2.1131726750761E-1, 2.1155740818380E-1, 2.1179772761505E-1, 2.1203822586766E-1, 2.1227890300782E-1, 2.1251975910160E-1, 2.1276079421493E-1, 2.1300200841362E-1, 2.1324340176336E-1, 2.1348497432970E-1, 2.1372672617808E-1, 2.1396865737380E-1, 2.1421076798204E-1, 2.1445305806785E-1, 2.1469552769616E-1, 2.1493817693174E-1, 2.1518100583928E-1, 2.1542401448331E-1, 2.1566720292822E-1, 2.1591057123829E-1, 2.1615411947768E-1, 2.1639784771039E-1, 2.1664175600030E-1, 2.1688584441117E-1, 2.1713011300661E-1, 2.1737456185011E-1, 2.1761919100503E-1, 2.1786400053458E-1, 2.1810899050184E-1, 2.1835416096978E-1, 2.1859951200121E-1, 2.1884504365881E-1, 2.1909075600513E-1, 2.1933664910258E-1, 2.1958272301344E-1, 2.1982897779984E-1, 2.2007541352379E-1, 2.2032203024716E-1, 2.2056882803166E-1, 2.2081580693890E-1, 2.2106296703032E-1, 2.2131030836723E-1, 2.2155783101080E-1, 2.2180553502208E-1, 2.2205342046195E-1, 2.2230148739116E-1, 2.2254973587033E-1, 2.2279816595993E-1, 2.2304677772028E-1, 2.2329557121157E-1, 2.2354454649385E-1, 2.2379370362701E-1, 2.2404304267082E-1, 2.2429256368488E-1, 2.2454226672868E-1, 2.2479215186152E-1, 2.2504221914260E-1, 2.2529246863094E-1, 2.2554290038544E-1, 2.2579351446484E-1, 2.2604431092773E-1, 2.2629528983256E-1, 2.2654645123764E-1, 2.2679779520112E-1, 2.2704932178100E-1, 2.2730103103515E-1, 2.2755292302126E-1, 2.2780499779689E-1, 2.2805725541946E-1, 2.2830969594622E-1, 2.2856231943428E-1, 2.2881512594059E-1, 2.2906811552196E-1, 2.2932128823503E-1, 2.2957464413632E-1, 2.2982818328216E-1, 2.3008190572875E-1, 2.3033581153212E-1, 2.3058990074817E-1, 2.3084417343262E-1, 2.3109862964105E-1, 2.3135326942888E-1, 2.3160809285137E-1, 2.3186309996364E-1, 2.3211829082062E-1, 2.3237366547713E-1, 2.3262922398779E-1, 2.3288496640708E-1, 2.3314089278932E-1, 2.3339700318868E-1, 2.3365329765915E-1, 2.3390977625458E-1, 2.3416643902866E-1, 2.3442328603490E-1, 2.3468031732666E-1, 2.3493753295714E-1, 2.3519493297939E-1, 2.3545251744627E-1, 2.3571028641050E-1, 2.3596823992463E-1, 2.3622637804104E-1, 2.3648470081196E-1, 2.3674320828945E-1, 2.3700190052539E-1, 2.3726077757151E-1, 2.3751983947938E-1, 2.3777908630039E-1, 2.3803851808577E-1, 2.3829813488658E-1, 2.3855793675371E-1, 2.3881792373790E-1, 2.3907809588969E-1, 2.3933845325948E-1, 2.3959899589749E-1, 2.3985972385377E-1, 2.4012063717820E-1, 2.4038173592048E-1, 2.4064302013016E-1, 2.4090448985661E-1, 2.4116614514901E-1, 2.4142798605639E-1, 2.4169001262760E-1, 2.4195222491133E-1, 2.4221462295606E-1, 2.4247720681013E-1, 2.4273997652170E-1, 2.4300293213874E-1, 2.4326607370906E-1, 2.4352940128029E-1, 2.4379291489987E-1, 2.4405661461509E-1, 2.4432050047303E-1, 2.4458457252063E-1, 2.4484883080462E-1, 2.4511327537157E-1, 2.4537790626786E-1, 2.4564272353969E-1, 2.4590772723309E-1, 2.4617291739391E-1, 2.4643829406781E-1, 2.4670385730027E-1, 2.4696960713659E-1, 2.4723554362190E-1, 2.4750166680112E-1, 2.4776797671900E-1, 2.4803447342013E-1, 2.4830115694888E-1, 2.4856802734946E-1, 2.4883508466588E-1, 2.4910232894197E-1, 2.4936976022138E-1, 2.4963737854756E-1, 2.4990518396378E-1, 2.5017317651314E-1, 2.5044135623853E-1, 2.5070972318265E-1, 2.5097827738803E-1, 2.5124701889699E-1, 2.5151594775169E-1, 2.5178506399407E-1, 2.5205436766589E-1, 2.5232385880872E-1, 2.5259353746394E-1, 2.5286340367275E-1, 2.5313345747612E-1, 2.5340369891488E-1, 2.5367412802962E-1, 2.5394474486076E-1, 2.5421554944852E-1, 2.5448654183294E-1, 2.5475772205383E-1, 2.5502909015084E-1, 2.5530064616341E-1, 2.5557239013078E-1, 2.5584432209199E-1, 2.5611644208591E-1, 2.5638875015117E-1, 2.5666124632624E-1, 2.5693393064936E-1, 2.5720680315859E-1, 2.5747986389180E-1, 2.5775311288662E-1, 2.5802655018053E-1, 2.5830017581076E-1, 2.5857398981438E-1, 2.5884799222823E-1, 2.5912218308896E-1, 2.5939656243302E-1, 2.5967113029664E-1, 2.5994588671587E-1, 2.6022083172653E-1, 2.6049596536425E-1, 2.6077128766445E-1, 2.6104679866236E-1, 2.6132249839298E-1, 2.6159838689112E-1, 2.6187446419136E-1, 2.6215073032810E-1, 2.6242718533552E-1, 2.6270382924758E-1, 2.6298066209806E-1, 2.6325768392050E-1, 2.6353489474824E-1, 2.6381229461442E-1, 2.6408988355196E-1, 2.6436766159356E-1, 2.6464562877173E-1, 2.6492378511874E-1, 2.6520213066666E-1, 2.6548066544737E-1, 2.6575938949248E-1, 2.6603830283345E-1, 2.6631740550148E-1, 2.6659669752756E-1, 2.6687617894249E-1, 2.6715584977683E-1, 2.6743571006092E-1, 2.6771575982491E-1, 2.6799599909870E-1, 2.6827642791199E-1, 2.6855704629425E-1, 2.6883785427475E-1, 2.6911885188252E-1, 2.6940003914638E-1, 2.6968141609493E-1, 2.6996298275654E-1, 2.7024473915937E-1, 2.7052668533134E-1, 2.7080882130017E-1, 2.7109114709334E-1, 2.7137366273811E-1, 2.7165636826152E-1, 2.7193926369039E-1, 2.7222234905129E-1, 2.7250562437060E-1, 2.7278908967445E-1, 2.7307274498875E-1, 2.7335659033917E-1, 2.7364062575119E-1, 2.7392485125001E-1, 2.7420926686064E-1, 2.7449387260785E-1, 2.7477866851617E-1, 2.7506365460992E-1, 2.7534883091317E-1, 2.7563419744977E-1, 2.7591975424333E-1, 2.7620550131725E-1, 2.7649143869466E-1, 2.7677756639850E-1, 2.7706388445143E-1, 2.7735039287592E-1, 2.7763709169417E-1, 2.7792398092817E-1, 2.7821106059966E-1, 2.7849833073016E-1, 2.7878579134093E-1, 2.7907344245301E-1, 2.7936128408719E-1, 2.7964931626404E-1, 2.7993753900388E-1, 2.8022595232679E-1, 2.8051455625261E-1, 2.8080335080095E-1, 2.8109233599116E-1, 2.8138151184237E-1, 2.8167087837346E-1, 2.8196043560306E-1, 2.8225018354956E-1, 2.8254012223113E-1, 2.8283025166567E-1, 2.8312057187083E-1, 2.8341108286405E-1, 2.8370178466250E-1, 2.8399267728309E-1, 2.8428376074253E-1, 2.8457503505723E-1, 2.8486650024340E-1, 2.8515815631697E-1, 2.8545000329364E-1, 2.8574204118884E-1, 2.8603427001779E-1, 2.8632668979541E-1, 2.8661930053641E-1, 2.8691210225524E-1, 2.8720509496608E-1, 2.8749827868288E-1, 2.8779165341933E-1, 2.8808521918887E-1, 2.8837897600467E-1, 2.8867292387968E-1, 2.8896706282656E-1, 2.8926139285775E-1, 2.8955591398540E-1, 2.8985062622142E-1, 2.9014552957748E-1, 2.9044062406497E-1, 2.9073590969502E-1, 2.9103138647853E-1, 2.9132705442612E-1, 2.9162291354814E-1, 2.9191896385472E-1, 2.9221520535569E-1, 2.9251163806064E-1, 2.9280826197890E-1, 2.9310507711953E-1, 2.9340208349133E-1, 2.9369928110285E-1, 2.9399666996235E-1, 2.9429425007786E-1, 2.9459202145713E-1, 2.9488998410763E-1, 2.9518813803659E-1, 2.9548648325097E-1, 2.9578501975744E-1, 2.9608374756245E-1, 2.9638266667213E-1, 2.9668177709238E-1, 2.9698107882882E-1, 2.9728057188680E-1, 2.9758025627140E-1, 2.9788013198743E-1, 2.9818019903945E-1, 2.9848045743171E-1, 2.9878090716822E-1, 2.9908154825271E-1, 2.9938238068863E-1, 2.9968340447918E-1, 2.9998461962726E-1, 3.0028602613551E-1, 3.0058762400629E-1, 3.0088941324169E-1, 3.0119139384352E-1, 3.0149356581333E-1, 3.0179592915236E-1, 3.0209848386162E-1, 3.0240122994180E-1, 3.0270416739333E-1, 3.0300729621636E-1, 3.0331061641077E-1, 3.0361412797615E-1, 3.0391783091180E-1, 3.0422172521677E-1, 3.0452581088980E-1, 3.0483008792937E-1, 3.0513455633365E-1, 3.0543921610056E-1, 3.0574406722771E-1, 3.0604910971245E-1, 3.0635434355183E-1, 3.0665976874262E-1, 3.0696538528129E-1, 3.0727119316406E-1, 3.0757719238684E-1, 3.0788338294524E-1, 3.0818976483461E-1, 3.0849633805000E-1, 3.0880310258617E-1, 3.0911005843759E-1, 3.0941720559845E-1, 3.0972454406265E-1, 3.1003207382378E-1, 3.1033979487517E-1, 3.1064770720982E-1, 3.1095581082048E-1, 3.1126410569957E-1, 3.1157259183925E-1, 3.1188126923137E-1, 3.1219013786747E-1, 3.1249919773883E-1, 3.1280844883641E-1, 3.1311789115088E-1, 3.1342752467261E-1, 3.1373734939169E-1, 3.1404736529790E-1, 3.1435757238071E-1, 3.1466797062933E-1, 3.1497856003262E-1, 3.1528934057919E-1, 3.1560031225731E-1, 3.1591147505497E-1, 3.1622282895987E-1, 3.1653437395938E-1, 3.1684611004059E-1, 3.1715803719028E-1, 3.1747015539493E-1, 3.1778246464071E-1, 3.1809496491349E-1, 3.1840765619883E-1, 3.1872053848200E-1, 3.1903361174795E-1, 3.1934687598133E-1, 3.1966033116649E-1, 3.1997397728745E-1, 3.2028781432794E-1, 3.2060184227139E-1, 3.2091606110090E-1, 3.2123047079928E-1, 3.2154507134901E-1, 3.2185986273227E-1, 3.2217484493094E-1, 3.2249001792657E-1, 3.2280538170041E-1, 3.2312093623340E-1, 3.2343668150615E-1, 3.2375261749898E-1, 3.2406874419186E-1, 3.2438506156450E-1, 3.2470156959624E-1, 3.2501826826614E-1, 3.2533515755293E-1, 3.2565223743502E-1, 3.2596950789051E-1, 3.2628696889719E-1, 3.2660462043251E-1, 3.2692246247362E-1, 3.2724049499734E-1, 3.2755871798018E-1, 3.2787713139832E-1, 3.2819573522763E-1, 3.2851452944364E-1, 3.2883351402157E-1, 3.2915268893633E-1, 3.2947205416248E-1, 3.2979160967428E-1, 3.3011135544565E-1, 3.3043129145020E-1, 3.3075141766120E-1, 3.3107173405161E-1, 3.3139224059404E-1, 3.3171293726081E-1, 3.3203382402387E-1, 3.3235490085487E-1, 3.3267616772514E-1, 3.3299762460564E-1, 3.3331927146705E-1, 3.3364110827969E-1, 3.3396313501355E-1, 3.3428535163831E-1, 3.3460775812329E-1, 3.3493035443750E-1, 3.3525314054960E-1, 3.3557611642795E-1, 3.3589928204053E-1, 3.3622263735503E-1, 3.3654618233877E-1, 3.3686991695875E-1, 3.3719384118164E-1, 3.3751795497377E-1, 3.3784225830113E-1, 3.3816675112936E-1, 3.3849143342380E-1, 3.3881630514942E-1, 3.3914136627085E-1, 3.3946661675239E-1, 3.3979205655802E-1, 3.4011768565133E-1, 3.4044350399563E-1, 3.4076951155384E-1, 3.4109570828855E-1, 3.4142209416203E-1, 3.4174866913618E-1, 3.4207543317257E-1, 3.4240238623242E-1, 3.4272952827661E-1, 3.4305685926567E-1, 3.4338437915978E-1, 3.4371208791880E-1, 3.4403998550222E-1, 3.4436807186918E-1, 3.4469634697848E-1, 3.4502481078857E-1, 3.4535346325756E-1, 3.4568230434320E-1, 3.4601133400289E-1, 3.4634055219369E-1, 3.4666995887230E-1, 3.4699955399507E-1, 3.4732933751799E-1, 3.4765930939673E-1, 3.4798946958656E-1, 3.4831981804244E-1, 3.4865035471894E-1, 3.4898107957030E-1, 3.4931199255039E-1, 3.4964309361275E-1, 3.4997438271052E-1, 3.5030585979653E-1, 3.5063752482322E-1, 3.5096937774268E-1, 3.5130141850666E-1, 3.5163364706653E-1, 3.5196606337331E-1, 3.5229866737766E-1, 3.5263145902986E-1, 3.5296443827988E-1, 3.5329760507727E-1, 3.5363095937125E-1, 3.5396450111068E-1, 3.5429823024404E-1, 3.5463214671947E-1, 3.5496625048471E-1, 3.5530054148718E-1, 3.5563501967390E-1, 3.5596968499155E-1, 3.5630453738641E-1, 3.5663957680444E-1, 3.5697480319119E-1, 3.5731021649187E-1, 3.5764581665130E-1, 3.5798160361397E-1, 3.5831757732395E-1, 3.5865373772498E-1, 3.5899008476041E-1, 3.5932661837323E-1, 3.5966333850606E-1, 3.6000024510112E-1, 3.6033733810030E-1, 3.6067461744510E-1, 3.6101208307663E-1, 3.6134973493566E-1, 3.6168757296255E-1, 3.6202559709731E-1, 3.6236380727957E-1, 3.6270220344858E-1, 3.6304078554321E-1, 3.6337955350197E-1, 3.6371850726297E-1, 3.6405764676397E-1, 3.6439697194232E-1, 3.6473648273501E-1, 3.6507617907865E-1, 3.6541606090948E-1, 3.6575612816333E-1, 3.6609638077567E-1, 3.6643681868160E-1, 3.6677744181581E-1, 3.6711825011263E-1, 3.6745924350599E-1, 3.6780042192946E-1, 3.6814178531620E-1, 3.6848333359900E-1, 3.6882506671027E-1, 3.6916698458203E-1, 3.6950908714589E-1, 3.6985137433312E-1, 3.7019384607457E-1, 3.7053650230072E-1, 3.7087934294164E-1, 3.7122236792702E-1, 3.7156557718619E-1, 3.7190897064806E-1, 3.7225254824114E-1, 3.7259630989359E-1, 3.7294025553314E-1, 3.7328438508716E-1, 3.7362869848260E-1, 3.7397319564604E-1, 3.7431787650366E-1, 3.7466274098123E-1, 3.7500778900416E-1, 3.7535302049744E-1, 3.7569843538566E-1, 3.7604403359305E-1, 3.7638981504340E-1, 3.7673577966014E-1, 3.7708192736627E-1, 3.7742825808443E-1, 3.7777477173684E-1, 3.7812146824532E-1, 3.7846834753129E-1, 3.7881540951579E-1, 3.7916265411944E-1, 3.7951008126246E-1, 3.7985769086470E-1, 3.8020548284556E-1, 3.8055345712407E-1, 3.8090161361886E-1, 3.8124995224814E-1, 3.8159847292972E-1, 3.8194717558103E-1, 3.8229606011907E-1, 3.8264512646044E-1, 3.8299437452133E-1, 3.8334380421755E-1, 3.8369341546448E-1, 3.8404320817710E-1, 3.8439318226997E-1, 3.8474333765728E-1, 3.8509367425277E-1, 3.8544419196979E-1, 3.8579489072128E-1, 3.8614577041978E-1, 3.8649683097741E-1, 3.8684807230587E-1, 3.8719949431647E-1, 3.8755109692008E-1, 3.8790288002720E-1, 3.8825484354788E-1, 3.8860698739178E-1, 3.8895931146813E-1, 3.8931181568576E-1, 3.8966449995308E-1, 3.9001736417808E-1, 3.9037040826834E-1, 3.9072363213103E-1, 3.9107703567290E-1, 3.9143061880028E-1, 3.9178438141909E-1, 3.9213832343481E-1, 3.9249244475254E-1, 3.9284674527694E-1, 3.9320122491223E-1, 3.9355588356226E-1, 3.9391072113042E-1, 3.9426573751970E-1, 3.9462093263265E-1, 3.9497630637142E-1, 3.9533185863773E-1, 3.9568758933287E-1, 3.9604349835773E-1, 3.9639958561274E-1, 3.9675585099794E-1, 3.9711229441294E-1, 3.9746891575690E-1, 3.9782571492859E-1, 3.9818269182634E-1, 3.9853984634805E-1, 3.9889717839119E-1, 3.9925468785282E-1, 3.9961237462956E-1, 3.9997023861760E-1, 4.0032827971272E-1, 4.0068649781024E-1, 4.0104489280509E-1, 4.0140346459173E-1, 4.0176221306423E-1, 4.0212113811620E-1, 4.0248023964083E-1, 4.0283951753088E-1, 4.0319897167867E-1, 4.0355860197610E-1, 4.0391840831464E-1, 4.0427839058530E-1, 4.0463854867868E-1, 4.0499888248495E-1, 4.0535939189383E-1, 4.0572007679461E-1, 4.0608093707615E-1, 4.0644197262688E-1, 4.0680318333476E-1, 4.0716456908736E-1, 4.0752612977179E-1, 4.0788786527471E-1, 4.0824977548237E-1, 4.0861186028055E-1, 4.0897411955463E-1, 4.0933655318951E-1, 4.0969916106969E-1, 4.1006194307919E-1, 4.1042489910162E-1, 4.1078802902013E-1, 4.1115133271745E-1, 4.1151481007584E-1, 4.1187846097715E-1, 4.1224228530276E-1, 4.1260628293361E-1, 4.1297045375022E-1, 4.1333479763264E-1, 4.1369931446048E-1, 4.1406400411293E-1, 4.1442886646869E-1, 4.1479390140606E-1, 4.1515910880287E-1, 4.1552448853650E-1, 4.1589004048390E-1, 4.1625576452155E-1, 4.1662166052551E-1, 4.1698772837137E-1, 4.1735396793428E-1, 4.1772037908893E-1, 4.1808696170959E-1, 4.1845371567005E-1, 4.1882064084367E-1, 4.1918773710333E-1, 4.1955500432150E-1, 4.1992244237016E-1, 4.2029005112087E-1, 4.2065783044472E-1, 4.2102578021235E-1, 4.2139390029394E-1, 4.2176219055924E-1, 4.2213065087752E-1, 4.2249928111760E-1, 4.2286808114787E-1, 4.2323705083624E-1, 4.2360619005016E-1, 4.2397549865665E-1, 4.2434497652226E-1, 4.2471462351307E-1, 4.2508443949472E-1, 4.2545442433240E-1, 4.2582457789081E-1, 4.2619490003423E-1, 4.2656539062646E-1, 4.2693604953084E-1, 4.2730687661026E-1, 4.2767787172714E-1, 4.2804903474345E-1, 4.2842036552069E-1, 4.2879186391991E-1, 4.2916352980170E-1, 4.2953536302616E-1, 4.2990736345297E-1, 4.3027953094132E-1, 4.3065186534994E-1, 4.3102436653710E-1, 4.3139703436061E-1, 4.3176986867782E-1, 4.3214286934560E-1, 4.3251603622037E-1, 4.3288936915808E-1, 4.3326286801420E-1, 4.3363653264377E-1, 4.3401036290133E-1, 4.3438435864096E-1, 4.3475851971630E-1, 4.3513284598047E-1, 4.3550733728619E-1, 4.3588199348564E-1, 4.3625681443060E-1, 4.3663179997232E-1, 4.3700694996163E-1, 4.3738226424887E-1, 4.3775774268390E-1, 4.3813338511612E-1, 4.3850919139447E-1, 4.3888516136741E-1, 4.3926129488292E-1, 4.3963759178852E-1, 4.4001405193125E-1, 4.4039067515770E-1, 4.4076746131395E-1, 4.4114441024563E-1, 4.4152152179791E-1, 4.4189879581545E-1, 4.4227623214247E-1, 4.4265383062269E-1, 4.4303159109938E-1, 4.4340951341532E-1, 4.4378759741281E-1, 4.4416584293369E-1, 4.4454424981931E-1, 4.4492281791056E-1, 4.4530154704783E-1, 4.4568043707104E-1, 4.4605948781966E-1, 4.4643869913265E-1, 4.4681807084850E-1, 4.4719760280523E-1, 4.4757729484037E-1, 4.4795714679098E-1, 4.4833715849364E-1, 4.4871732978446E-1, 4.4909766049903E-1, 4.4947815047252E-1, 4.4985879953956E-1, 4.5023960753435E-1, 4.5062057429057E-1, 4.5100169964145E-1, 4.5138298341971E-1, 4.5176442545760E-1, 4.5214602558690E-1, 4.5252778363889E-1, 4.5290969944437E-1, 4.5329177283367E-1, 4.5367400363661E-1, 4.5405639168255E-1, 4.5443893680036E-1, 4.5482163881843E-1, 4.5520449756464E-1, 4.5558751286642E-1, 4.5597068455070E-1, 4.5635401244391E-1, 4.5673749637201E-1, 4.5712113616047E-1, 4.5750493163429E-1, 4.5788888261795E-1, 4.5827298893546E-1, 4.5865725041035E-1, 4.5904166686566E-1, 4.5942623812392E-1, 4.5981096400721E-1, 4.6019584433708E-1, 4.6058087893463E-1, 4.6096606762044E-1, 4.6135141021461E-1, 4.6173690653677E-1, 4.6212255640604E-1, 4.6250835964105E-1, 4.6289431605993E-1, 4.6328042548036E-1, 4.6366668771948E-1, 4.6405310259397E-1, 4.6443966992001E-1, 4.6482638951329E-1, 4.6521326118899E-1, 4.6560028476183E-1, 4.6598746004602E-1, 4.6637478685527E-1, 4.6676226500280E-1, 4.6714989430136E-1, 4.6753767456318E-1, 4.6792560560000E-1, 4.6831368722308E-1, 4.6870191924317E-1, 4.6909030147053E-1, 4.6947883371493E-1, 4.6986751578565E-1, 4.7025634749146E-1, 4.7064532864064E-1, 4.7103445904098E-1, 4.7142373849977E-1, 4.7181316682380E-1, 4.7220274381937E-1, 4.7259246929229E-1, 4.7298234304786E-1, 4.7337236489088E-1, 4.7376253462566E-1, 4.7415285205602E-1, 4.7454331698528E-1, 4.7493392921624E-1, 4.7532468855124E-1, 4.7571559479208E-1, 4.7610664774010E-1, 4.7649784719611E-1, 4.7688919296045E-1, 4.7728068483292E-1, 4.7767232261287E-1, 4.7806410609912E-1, 4.7845603508999E-1, 4.7884810938331E-1, 4.7924032877641E-1, 4.7963269306611E-1, 4.8002520204874E-1, 4.8041785552012E-1, 4.8081065327557E-1, 4.8120359510993E-1, 4.8159668081750E-1, 4.8198991019211E-1, 4.8238328302708E-1, 4.8277679911521E-1, 4.8317045824884E-1, 4.8356426021976E-1, 4.8395820481928E-1, 4.8435229183822E-1, 4.8474652106687E-1, 4.8514089229504E-1, 4.8553540531202E-1, 4.8593005990660E-1, 4.8632485586709E-1, 4.8671979298125E-1, 4.8711487103638E-1, 4.8751008981926E-1, 4.8790544911616E-1, 4.8830094871284E-1, 4.8869658839459E-1, 4.8909236794614E-1, 4.8948828715178E-1, 4.8988434579524E-1, 4.9028054365976E-1, 4.9067688052811E-1, 4.9107335618250E-1, 4.9146997040466E-1, 4.9186672297583E-1, 4.9226361367673E-1, 4.9266064228755E-1, 4.9305780858802E-1, 4.9345511235733E-1, 4.9385255337417E-1, 4.9425013141674E-1, 4.9464784626271E-1, 4.9504569768925E-1, 4.9544368547305E-1, 4.9584180939024E-1, 4.9624006921650E-1, 4.9663846472696E-1, 4.9703699569626E-1, 4.9743566189853E-1, 4.9783446310741E-1, 4.9823339909599E-1, 4.9863246963689E-1, 4.9903167450222E-1, 4.9943101346355E-1, 4.9983048629198E-1, 5.0020461899626E-1, 5.0056010333412E-1, 5.0091570610510E-1, 5.0127142710383E-1, 5.0162726612446E-1, 5.0198322296073E-1, 5.0233929740587E-1, 5.0269548925272E-1, 5.0305179829361E-1, 5.0340822432046E-1, 5.0376476712472E-1, 5.0412142649738E-1, 5.0447820232898E-1, 5.0483509410963E-1, 5.0519210192895E-1, 5.0554922547614E-1, 5.0590646453992E-1, 5.0626381890858E-1, 5.0662128836993E-1, 5.0697887271136E-1, 5.0733657171978E-1, 5.0769438518166E-1, 5.0805231288301E-1, 5.0841035460938E-1, 5.0876851014588E-1, 5.0912677927716E-1, 5.0948516178742E-1, 5.0984365746041E-1, 5.1020236607940E-1, 5.1056098742724E-1, 5.1091982128630E-1, 5.1127876743852E-1, 5.1163782566537E-1, 5.1199699574786E-1, 5.1235627746657E-1, 5.1271567060160E-1, 5.1307517493261E-1, 5.1343479023881E-1, 5.1379451629894E-1, 5.1415435289130E-1, 5.1451429979372E-1, 5.1487435678360E-1, 5.1523452363786E-1, 5.1559480013299E-1, 5.1595518604501E-1, 5.1631568114948E-1, 5.1667628522152E-1, 5.1703699803579E-1, 5.1739781936651E-1, 5.1775874898741E-1, 5.1811978667180E-1, 5.1848093219252E-1, 5.1884218532196E-1, 5.1920354583206E-1, 5.1956501349429E-1, 5.1992658807969E-1, 5.2028826935881E-1, 5.2065005710179E-1, 5.2101195107829E-1, 5.2137395105750E-1, 5.2173605680820E-1, 5.2209826809868E-1, 5.2246058469678E-1, 5.2282300636990E-1, 5.2318553288498E-1, 5.2354816400851E-1, 5.2391089950650E-1, 5.2427373914455E-1, 5.2463668268776E-1, 5.2499972990082E-1, 5.2536288054793E-1, 5.2572613439285E-1, 5.2608949119890E-1, 5.2645295072892E-1, 5.2681651274532E-1, 5.2718017701004E-1, 5.2754394328457E-1, 5.2790781132994E-1, 5.2827178090676E-1, 5.2863585177514E-1, 5.2900002369477E-1, 5.2936429642486E-1, 5.2972866972420E-1, 5.3009314335109E-1, 5.3045771706342E-1, 5.3082239061857E-1, 5.3118716377353E-1, 5.3155203628478E-1, 5.3191700790839E-1, 5.3228207839995E-1, 5.3264724751462E-1, 5.3301251500709E-1, 5.3337788063159E-1, 5.3374334414193E-1, 5.3410890529143E-1, 5.3447456383299E-1, 5.3484031951904E-1, 5.3520617210155E-1, 5.3557212133207E-1, 5.3593816696165E-1, 5.3630430874094E-1, 5.3667054642010E-1, 5.3703687974886E-1, 5.3740330847648E-1, 5.3776983235180E-1, 5.3813645112316E-1, 5.3850316453850E-1, 5.3886997234528E-1, 5.3923687429050E-1, 5.3960387012075E-1, 5.3997095958212E-1, 5.4033814242029E-1, 5.4070541838047E-1, 5.4107278720741E-1, 5.4144024864543E-1, 5.4180780243840E-1, 5.4217544832972E-1, 5.4254318606236E-1, 5.4291101537883E-1, 5.4327893602119E-1, 5.4364694773105E-1, 5.4401505024959E-1, 5.4438324331752E-1, 5.4475152667510E-1, 5.4511990006215E-1, 5.4548836321805E-1, 5.4585691588171E-1, 5.4622555779160E-1, 5.4659428868576E-1, 5.4696310830175E-1, 5.4733201637671E-1, 5.4770101264731E-1, 5.4807009684980E-1, 5.4843926871996E-1, 5.4880852799312E-1, 5.4917787440418E-1, 5.4954730768758E-1, 5.4991682757734E-1, 5.5028643380698E-1, 5.5065612610964E-1, 5.5102590421795E-1, 5.5139576786415E-1, 5.5176571678000E-1, 5.5213575069681E-1, 5.5250586934548E-1, 5.5287607245643E-1, 5.5324635975966E-1, 5.5361673098470E-1, 5.5398718586065E-1, 5.5435772411618E-1, 5.5472834547949E-1, 5.5509904967835E-1, 5.5546983644008E-1, 5.5584070549156E-1, 5.5621165655924E-1, 5.5658268936910E-1, 5.5695380364670E-1, 5.5732499911714E-1, 5.5769627550510E-1, 5.5806763253479E-1, 5.5843906993001E-1, 5.5881058741409E-1, 5.5918218470993E-1, 5.5955386153999E-1, 5.5992561762628E-1, 5.6029745269040E-1, 5.6066936645347E-1, 5.6104135863619E-1, 5.6141342895882E-1, 5.6178557714118E-1, 5.6215780290263E-1, 5.6253010596214E-1, 5.6290248603818E-1, 5.6327494284883E-1, 5.6364747611172E-1, 5.6402008554401E-1, 5.6439277086247E-1, 5.6476553178340E-1, 5.6513836802267E-1, 5.6551127929573E-1, 5.6588426531756E-1, 5.6625732580274E-1, 5.6663046046539E-1, 5.6700366901920E-1, 5.6737695117743E-1, 5.6775030665289E-1, 5.6812373515798E-1, 5.6849723640464E-1, 5.6887081010439E-1, 5.6924445596831E-1, 5.6961817370705E-1, 5.6999196303083E-1, 5.7036582364942E-1, 5.7073975527218E-1, 5.7111375760802E-1, 5.7148783036543E-1, 5.7186197325246E-1, 5.7223618597672E-1, 5.7261046824542E-1, 5.7298481976531E-1, 5.7335924024271E-1, 5.7373372938353E-1, 5.7410828689324E-1, 5.7448291247686E-1, 5.7485760583901E-1, 5.7523236668388E-1, 5.7560719471520E-1, 5.7598208963631E-1, 5.7635705115010E-1, 5.7673207895904E-1, 5.7710717276517E-1, 5.7748233227010E-1, 5.7785755717502E-1, 5.7823284718070E-1, 5.7860820198745E-1, 5.7898362129521E-1, 5.7935910480345E-1, 5.7973465221122E-1, 5.8011026321718E-1, 5.8048593751952E-1, 5.8086167481605E-1, 5.8123747480411E-1, 5.8161333718066E-1, 5.8198926164221E-1, 5.8236524788487E-1, 5.8274129560431E-1, 5.8311740449578E-1, 5.8349357425412E-1, 5.8386980457374E-1, 5.8424609514863E-1, 5.8462244567238E-1, 5.8499885583812E-1, 5.8537532533861E-1, 5.8575185386615E-1, 5.8612844111265E-1, 5.8650508676958E-1, 5.8688179052801E-1, 5.8725855207859E-1, 5.8763537111155E-1, 5.8801224731670E-1, 5.8838918038345E-1, 5.8876617000077E-1, 5.8914321585723E-1, 5.8952031764100E-1, 5.8989747503981E-1, 5.9027468774098E-1, 5.9065195543145E-1, 5.9102927779769E-1, 5.9140665452582E-1, 5.9178408530150E-1, 5.9216156981001E-1, 5.9253910773619E-1, 5.9291669876450E-1, 5.9329434257897E-1, 5.9367203886323E-1, 5.9404978730050E-1, 5.9442758757358E-1, 5.9480543936488E-1, 5.9518334235640E-1, 5.9556129622971E-1, 5.9593930066600E-1, 5.9631735534605E-1, 5.9669545995021E-1, 5.9707361415847E-1, 5.9745181765036E-1, 5.9783007010506E-1, 5.9820837120131E-1, 5.9858672061745E-1, 5.9896511803143E-1, 5.9934356312080E-1, 5.9972205556270E-1, 6.0010059503386E-1, 6.0047918121063E-1, 6.0085781376894E-1, 6.0123649238433E-1, 6.0161521673194E-1, 6.0199398648652E-1, 6.0237280132240E-1, 6.0275166091354E-1, 6.0313056493347E-1, 6.0350951305535E-1, 6.0388850495194E-1, 6.0426754029560E-1, 6.0464661875829E-1, 6.0502574001158E-1, 6.0540490372664E-1, 6.0578410957427E-1, 6.0616335722485E-1, 6.0654264634837E-1, 6.0692197661445E-1, 6.0730134769230E-1, 6.0768075925074E-1, 6.0806021095821E-1, 6.0843970248274E-1, 6.0881923349200E-1, 6.0919880365326E-1, 6.0957841263338E-1, 6.0995806009887E-1, 6.1033774571582E-1, 6.1071746914995E-1, 6.1109723006660E-1, 6.1147702813072E-1, 6.1185686300687E-1, 6.1223673435922E-1, 6.1261664185157E-1, 6.1299658514734E-1, 6.1337656390956E-1, 6.1375657780087E-1, 6.1413662648355E-1, 6.1451670961948E-1, 6.1489682687017E-1, 6.1527697789675E-1, 6.1565716235997E-1, 6.1603737992020E-1, 6.1641763023744E-1, 6.1679791297130E-1, 6.1717822778104E-1, 6.1755857432551E-1, 6.1793895226320E-1, 6.1831936125224E-1, 6.1869980095037E-1, 6.1908027101496E-1, 6.1946077110301E-1, 6.1984130087113E-1, 6.2023185997560E-1, 6.2060244807229E-1, 6.2098306481673E-1, 6.2136370986404E-1, 6.2174438286902E-1, 6.2212508348607E-1, 6.2250581136924E-1, 6.2288656617219E-1, 6.2326734754825E-1, 6.2364815515034E-1, 6.2402898863106E-1, 6.2440984764261E-1, 6.2479073183686E-1, 6.2517164086528E-1, 6.2555257437901E-1, 6.2593353202881E-1, 6.2631451346509E-1, 6.2669551833789E-1, 6.2707654629689E-1, 6.2745759699144E-1, 6.2783867007049E-1, 6.2821976518265E-1, 6.2860088197619E-1, 6.2898202009900E-1, 6.2936317919862E-1, 6.2974435892225E-1, 6.3012555891673E-1, 6.3050677882853E-1, 6.3088801830378E-1, 6.3126927698827E-1, 6.3165055452742E-1, 6.3203185056632E-1, 6.3241316474968E-1, 6.3279449672188E-1, 6.3317584612697E-1, 6.3355721260862E-1, 6.3393859581016E-1, 6.3431999537460E-1, 6.3470141094457E-1, 6.3508284216238E-1, 6.3546428866999E-1, 6.3584575010900E-1, 6.3622722612070E-1, 6.3660871634600E-1, 6.3699022042551E-1, 6.3737173799947E-1, 6.3775326870779E-1, 6.3813481219005E-1, 6.3851636808548E-1, 6.3889793603296E-1, 6.3927951567108E-1, 6.3966110663805E-1, 6.4004270857175E-1, 6.4042432110976E-1, 6.4080594388929E-1, 6.4118757654723E-1, 6.4156921872014E-1, 6.4195087004424E-1, 6.4233253015545E-1, 6.4271419868932E-1, 6.4309587528110E-1, 6.4347755956569E-1, 6.4385925117769E-1, 6.4424094975135E-1, 6.4462265492060E-1, 6.4500436631906E-1, 6.4538608358001E-1, 6.4576780633642E-1, 6.4614953422091E-1, 6.4653126686582E-1, 6.4691300390313E-1, 6.4729474496453E-1, 6.4767648968137E-1, 6.4805823768470E-1, 6.4843998860524E-1, 6.4882174207340E-1, 6.4920349771927E-1, 6.4958525517262E-1, 6.4996701406292E-1, 6.5034877401931E-1, 6.5073053467064E-1, 6.5111229564542E-1, 6.5149405657188E-1, 6.5187581707791E-1, 6.5225757679112E-1, 6.5263933533879E-1, 6.5302109234789E-1, 6.5340284744511E-1, 6.5378460025681E-1, 6.5416635040905E-1, 6.5454809752760E-1, 6.5492984123790E-1, 6.5531158116512E-1, 6.5569331693410E-1, 6.5607504816939E-1, 6.5645677449526E-1, 6.5683849553564E-1, 6.5722021091421E-1, 6.5760192025431E-1, 6.5798362317900E-1, 6.5836531931107E-1, 6.5874700827297E-1, 6.5912868968688E-1, 6.5951036317471E-1, 6.5989202835803E-1, 6.6027368485815E-1, 6.6065533229609E-1, 6.6103697029257E-1, 6.6141859846803E-1, 6.6180021644263E-1, 6.6218182383621E-1, 6.6256342026836E-1, 6.6294500535838E-1, 6.6332657872527E-1, 6.6370813998777E-1, 6.6408968876431E-1, 6.6447122467306E-1, 6.6485274733191E-1, 6.6523425635846E-1, 6.6561575137004E-1, 6.6599723198370E-1, 6.6637869781621E-1, 6.6676014848408E-1, 6.6714158360353E-1, 6.6752300279050E-1, 6.6790440566068E-1, 6.6828579182948E-1, 6.6866716091203E-1, 6.6904851252319E-1, 6.6942984627758E-1, 6.6981116178951E-1, 6.7019245867305E-1, 6.7057373654200E-1, 6.7095499500989E-1, 6.7133623368999E-1, 6.7171745219530E-1, 6.7209865013858E-1, 6.7247982713230E-1, 6.7286098278869E-1, 6.7324211671970E-1, 6.7362322853705E-1, 6.7400431785219E-1, 6.7438538427630E-1, 6.7476642742032E-1, 6.7514744689494E-1, 6.7552844231059E-1, 6.7590941327744E-1, 6.7629035940542E-1, 6.7667128030421E-1, 6.7705217558323E-1, 6.7743304485166E-1, 6.7781388771843E-1, 6.7819470379223E-1, 6.7857549268149E-1, 6.7895625399442E-1, 6.7933698733896E-1, 6.7971769232283E-1, 6.8009836855349E-1, 6.8047901563817E-1, 6.8085963318386E-1, 6.8124022079731E-1, 6.8162077808504E-1, 6.8200130465332E-1, 6.8238180010820E-1, 6.8276226405548E-1, 6.8314269610074E-1, 6.8352309584932E-1, 6.8390346290634E-1, 6.8428379687668E-1, 6.8466409736498E-1, 6.8504436397569E-1, 6.8542459631299E-1, 6.8580479398086E-1, 6.8618495658305E-1, 6.8656508372307E-1, 6.8694517500425E-1, 6.8732523002964E-1, 6.8770524840212E-1, 6.8808522972432E-1, 6.8846517359867E-1, 6.8884507962737E-1, 6.8922494741240E-1, 6.8960477655555E-1, 6.8998456665837E-1, 6.9036431732220E-1, 6.9074402814818E-1, 6.9112369873723E-1, 6.9150332869006E-1, 6.9188291760718E-1, 6.9226246508889E-1, 6.9264197073527E-1, 6.9302143414620E-1, 6.9340085492138E-1, 6.9378023266026E-1, 6.9415956696213E-1, 6.9453885742607E-1, 6.9491810365093E-1, 6.9529730523539E-1, 6.9567646177794E-1, 6.9605557287685E-1, 6.9643463813019E-1, 6.9681365713587E-1, 6.9719262949157E-1, 6.9757155479480E-1, 6.9795043264287E-1, 6.9832926263290E-1, 6.9870804436181E-1, 6.9908677742637E-1, 6.9946546142311E-1, 6.9984409594842E-1, 7.0022268059848E-1, 7.0060121496930E-1, 7.0097969865668E-1, 7.0135813125629E-1, 7.0173651236356E-1, 7.0211484157379E-1, 7.0249311848208E-1, 7.0287134268336E-1, 7.0324951377237E-1, 7.0362763134369E-1, 7.0400569499172E-1, 7.0438370431070E-1, 7.0476165889469E-1, 7.0513955833757E-1, 7.0551740223307E-1, 7.0589519017473E-1, 7.0627292175596E-1, 7.0665059656997E-1, 7.0702821420982E-1, 7.0740577426840E-1, 7.0778327633845E-1, 7.0816072001254E-1, 7.0853810488308E-1, 7.0891543054234E-1, 7.0929269658240E-1, 7.0966990259522E-1, 7.1004704817257E-1, 7.1042413290610E-1, 7.1080115638728E-1, 7.1117811820745E-1, 7.1155501795778E-1, 7.1193185522931E-1, 7.1230862961292E-1, 7.1268534069935E-1, 7.1306198807919E-1, 7.1343857134289E-1, 7.1381509008075E-1, 7.1419154388294E-1, 7.1456793233948E-1, 7.1494425504025E-1, 7.1532051157500E-1, 7.1569670153334E-1, 7.1607282450474E-1, 7.1644888007853E-1, 7.1682486784393E-1, 7.1720078739000E-1, 7.1757663830569E-1, 7.1795242017981E-1, 7.1832813260104E-1, 7.1870377515793E-1, 7.1907934743892E-1, 7.1945484903232E-1, 7.1983027952630E-1, 7.2020563850892E-1, 7.2058092556812E-1, 7.2095614029172E-1, 7.2133128226742E-1, 7.2170635108279E-1, 7.2208134632531E-1, 7.2245626758232E-1, 7.2283111444106E-1, 7.2320588648865E-1, 7.2358058331211E-1, 7.2395520449833E-1, 7.2432974963411E-1, 7.2470421830614E-1, 7.2507861010099E-1, 7.2545292460513E-1, 7.2582716140494E-1, 7.2620132008669E-1, 7.2657540023653E-1, 7.2694940144053E-1, 7.2732332328466E-1, 7.2769716535479E-1, 7.2807092723668E-1, 7.2844460851603E-1, 7.2881820877839E-1, 7.2919172760928E-1, 7.2956516459408E-1, 7.2993851931811E-1, 7.3031179136658E-1, 7.3068498032462E-1, 7.3105808577728E-1, 7.3143110730953E-1, 7.3180404450622E-1, 7.3217689695217E-1, 7.3254966423207E-1, 7.3292234593057E-1, 7.3329494163222E-1, 7.3366745092148E-1, 7.3403987338276E-1, 7.3441220860039E-1, 7.3478445615862E-1, 7.3515661564162E-1, 7.3552868663349E-1, 7.3590066871829E-1, 7.3627256147997E-1, 7.3664436450244E-1, 7.3701607736953E-1, 7.3738769966501E-1, 7.3775923097259E-1, 7.3813067087591E-1, 7.3850201895857E-1, 7.3887327480408E-1, 7.3924443799590E-1, 7.3961550811745E-1, 7.3998648475209E-1, 7.4035736748310E-1, 7.4072815589374E-1, 7.4109884956721E-1, 7.4146944808663E-1, 7.4183995103512E-1, 7.4221035799571E-1, 7.4258066855141E-1, 7.4295088228516E-1, 7.4332099877989E-1, 7.4369101761846E-1, 7.4406093838369E-1, 7.4443076065838E-1, 7.4480048402527E-1, 7.4517010806707E-1, 7.4553963236646E-1, 7.4590905650607E-1, 7.4627838006852E-1, 7.4664760263637E-1, 7.4701672379217E-1, 7.4738574311844E-1, 7.4775466019766E-1, 7.4812347461229E-1, 7.4849218594476E-1, 7.4886079377748E-1, 7.4922929769284E-1, 7.4959769727321E-1, 7.4996599210092E-1, 7.5033418175830E-1, 7.5070226582766E-1, 7.5107024389130E-1, 7.5143811553149E-1, 7.5180588033049E-1, 7.5217353787055E-1, 7.5254108773392E-1, 7.5290852950283E-1, 7.5327586275949E-1, 7.5364308708612E-1, 7.5401020206494E-1, 7.5437720727815E-1, 7.5474410230795E-1, 7.5511088673655E-1, 7.5547756014614E-1, 7.5584412211893E-1, 7.5621057223712E-1, 7.5657691008292E-1, 7.5694313523855E-1, 7.5730924728623E-1, 7.5767524580818E-1, 7.5804113038664E-1, 7.5840690060387E-1, 7.5877255604211E-1, 7.5913809628365E-1, 7.5950352091078E-1, 7.5986882950579E-1, 7.6023402165102E-1, 7.6059909692879E-1, 7.6096405492148E-1, 7.6132889521146E-1, 7.6169361738113E-1, 7.6205822101294E-1, 7.6242270568932E-1, 7.6278707099277E-1, 7.6315131650580E-1, 7.6351544181093E-1, 7.6387944649075E-1, 7.6424333012785E-1, 7.6460709230487E-1, 7.6497073260449E-1, 7.6533425060941E-1, 7.6569764590237E-1, 7.6606091806616E-1, 7.6642406668362E-1, 7.6678709133759E-1, 7.6714999161100E-1, 7.6751276708680E-1, 7.6787541734799E-1, 7.6823794197762E-1, 7.6860034055879E-1, 7.6896261267464E-1, 7.6932475790838E-1, 7.6968677584325E-1, 7.7004866606256E-1, 7.7041042814968E-1, 7.7077206168801E-1, 7.7113356626105E-1, 7.7149494145233E-1, 7.7185618684543E-1, 7.7221730202404E-1, 7.7257828657186E-1, 7.7293914007270E-1, 7.7329986211040E-1, 7.7366045226889E-1, 7.7402091013216E-1, 7.7438123528429E-1, 7.7474142730940E-1, 7.7510148579171E-1, 7.7546141031550E-1, 7.7582120046514E-1, 7.7618085582506E-1, 7.7654037597978E-1, 7.7689976051391E-1, 7.7725900901212E-1, 7.7761812105917E-1, 7.7797709623992E-1, 7.7833593413931E-1, 7.7869463434234E-1, 7.7905319643415E-1, 7.7941161999991E-1, 7.7976990462494E-1, 7.8012804989461E-1, 7.8048605539441E-1, 7.8084392070991E-1, 7.8120164542678E-1, 7.8155922913081E-1, 7.8191667140785E-1, 7.8227397184388E-1, 7.8263113002498E-1, 7.8298814553732E-1, 7.8334501796720E-1, 7.8370174690100E-1, 7.8405833192523E-1, 7.8441477262649E-1, 7.8477106859151E-1, 7.8512721940712E-1, 7.8548322466026E-1, 7.8583908393801E-1, 7.8619479682754E-1, 7.8655036291614E-1, 7.8690578179124E-1, 7.8726105304036E-1, 7.8761617625118E-1, 7.8797115101147E-1, 7.8832597690915E-1, 7.8868065353224E-1, 7.8903518046891E-1, 7.8938955730746E-1, 7.8974378363630E-1, 7.9009785904398E-1, 7.9045178311921E-1, 7.9080555545079E-1, 7.9115917562769E-1, 7.9151264323900E-1, 7.9186595787396E-1, 7.9221911912194E-1, 7.9257212657246E-1, 7.9292497981519E-1, 7.9327767843992E-1, 7.9363022203660E-1, 7.9398261019534E-1, 7.9433484250638E-1, 7.9468691856012E-1, 7.9503883794710E-1, 7.9539060025803E-1, 7.9574220508377E-1, 7.9609365201532E-1, 7.9644494064385E-1, 7.9679607056069E-1, 7.9714704135732E-1, 7.9749785262540E-1, 7.9784850395673E-1, 7.9819899494329E-1, 7.9854932517722E-1, 7.9889949425083E-1, 7.9924950175659E-1, 7.9959934728714E-1, 7.9994903043530E-1, 8.0029855079407E-1, 8.0064790795659E-1, 8.0099710151622E-1, 8.0134613106646E-1, 8.0169499620100E-1, 8.0204369651372E-1, 8.0239223159867E-1, 8.0274060105009E-1, 8.0308880446238E-1, 8.0343684143016E-1, 8.0378471154820E-1, 8.0413241441150E-1, 8.0447994961522E-1, 8.0482731675471E-1, 8.0517451542551E-1, 8.0552154522338E-1, 8.0586840574425E-1, 8.0621509658426E-1, 8.0656161733972E-1, 8.0690796760717E-1, 8.0725414698335E-1, 8.0760015506517E-1, 8.0794599144978E-1, 8.0829165573451E-1, 8.0863714751691E-1, 8.0898246639473E-1, 8.0932761196592E-1, 8.0967258382866E-1, 8.1001738158133E-1, 8.1036200482253E-1, 8.1070645315105E-1, 8.1105072616593E-1, 8.1139482346641E-1, 8.1173874465193E-1, 8.1208248932219E-1, 8.1242605707708E-1, 8.1276944751673E-1, 8.1311266024147E-1, 8.1345569485188E-1, 8.1379855094876E-1, 8.1414122813312E-1, 8.1448372600624E-1, 8.1482604416958E-1, 8.1516818222488E-1, 8.1551013977407E-1, 8.1585191641935E-1, 8.1619351176313E-1, 8.1653492540808E-1, 8.1687615695710E-1, 8.1721720601331E-1, 8.1755807218011E-1, 8.1789875506112E-1, 8.1823925426019E-1, 8.1857956938146E-1, 8.1891970002928E-1, 8.1925964580825E-1, 8.1959940632324E-1, 8.1993898117935E-1, 8.2027836998196E-1, 8.2061757233667E-1, 8.2095658784936E-1, 8.2129541612616E-1, 8.2163405677346E-1, 8.2197250939790E-1, 8.2231077360640E-1, 8.2264884900611E-1, 8.2298673520448E-1, 8.2332443180920E-1, 8.2366193842824E-1, 8.2399925466983E-1, 8.2433638014246E-1, 8.2467331445493E-1, 8.2501005721626E-1, 8.2534660803577E-1, 8.2568296652305E-1, 8.2601913228798E-1, 8.2635510494068E-1, 8.2669088409160E-1, 8.2702646935142E-1, 8.2736186033114E-1, 8.2769705664201E-1, 8.2803205789559E-1, 8.2836686370371E-1, 8.2870147367850E-1, 8.2903588743236E-1, 8.2937010457799E-1, 8.2970412472838E-1, 8.3003794749681E-1, 8.3037157249686E-1, 8.3070499934240E-1, 8.3103822764759E-1, 8.3137125702689E-1, 8.3170408709506E-1, 8.3203671746717E-1, 8.3236914775858E-1, 8.3270137758495E-1, 8.3303340656226E-1, 8.3336523430676E-1, 8.3369686043506E-1, 8.3402828456403E-1, 8.3435950631088E-1, 8.3469052529311E-1, 8.3502134112854E-1, 8.3535195343531E-1, 8.3568236183186E-1, 8.3601256593697E-1, 8.3634256536971E-1, 8.3667235974948E-1, 8.3700194869600E-1, 8.3733133182932E-1, 8.3766050876980E-1, 8.3798947913813E-1, 8.3831824255531E-1, 8.3864679864269E-1, 8.3897514702194E-1, 8.3930328731505E-1, 8.3963121914435E-1, 8.3995894213249E-1, 8.4028645590247E-1, 8.4061376007762E-1, 8.4094085428159E-1, 8.4126773813838E-1, 8.4159441127234E-1, 8.4192087330813E-1, 8.4224712387077E-1, 8.4257316258562E-1, 8.4289898907838E-1, 8.4322460297510E-1, 8.4355000390218E-1, 8.4387519148634E-1, 8.4420016535469E-1, 8.4452492513466E-1, 8.4484947045403E-1, 8.4517380094096E-1, 8.4549791622393E-1, 8.4582181593181E-1, 8.4614549969378E-1, 8.4646896713943E-1, 8.4679221789867E-1, 8.4711525160178E-1, 8.4743806787942E-1, 8.4776066636258E-1, 8.4808304668265E-1, 8.4840520847135E-1, 8.4872715136079E-1, 8.4904887498345E-1, 8.4937037897215E-1, 8.4969166296012E-1, 8.5001272658092E-1, 8.5033356946853E-1, 8.5065419125726E-1, 8.5097459158182E-1, 8.5129477007730E-1, 8.5161472637914E-1, 8.5193446012318E-1, 8.5225397094565E-1, 8.5257325848315E-1, 8.5289232237264E-1, 8.5321116225151E-1, 8.5352977775750E-1, 8.5384816852875E-1, 8.5416633420379E-1, 8.5448427442152E-1, 8.5480198882127E-1, 8.5511947704271E-1, 8.5543673872595E-1, 8.5575377351146E-1, 8.5607058104012E-1, 8.5638716095322E-1, 8.5670351289241E-1, 8.5701963649978E-1, 8.5733553141779E-1, 8.5765119728931E-1, 8.5796663375763E-1, 8.5828184046643E-1, 8.5859681705977E-1, 8.5891156318217E-1, 8.5922607847851E-1, 8.5954036259410E-1, 8.5985441517465E-1, 8.6016823586630E-1, 8.6048182431559E-1, 8.6079518016946E-1, 8.6110830307529E-1, 8.6142119268086E-1, 8.6173384863437E-1, 8.6204627058443E-1, 8.6235845818010E-1, 8.6267041107082E-1, 8.6298212890647E-1, 8.6329361133737E-1, 8.6360485801424E-1, 8.6391586858823E-1, 8.6422664271092E-1, 8.6453718003432E-1, 8.6484748021087E-1, 8.6515754289344E-1, 8.6546736773531E-1, 8.6577695439023E-1, 8.6608630251236E-1, 8.6639541175629E-1, 8.6670428177706E-1, 8.6701291223015E-1, 8.6732130277146E-1, 8.6762945305734E-1, 8.6793736274459E-1, 8.6824503149043E-1, 8.6855245895255E-1, 8.6885964478905E-1, 8.6916658865851E-1, 8.6947329021994E-1, 8.6977974913279E-1, 8.7008596505697E-1, 8.7039193765284E-1, 8.7069766658121E-1, 8.7100315150333E-1, 8.7130839208092E-1, 8.7161338797615E-1, 8.7191813885163E-1, 8.7222264437045E-1, 8.7252690419615E-1, 8.7283091799272E-1, 8.7313468542462E-1, 8.7343820615676E-1, 8.7374147985452E-1, 8.7404450618375E-1, 8.7434728481076E-1, 8.7464981540231E-1, 8.7495209762564E-1, 8.7525413114847E-1, 8.7555591563897E-1, 8.7585745076578E-1, 8.7615873619802E-1, 8.7645977160528E-1, 8.7676055665762E-1, 8.7706109102558E-1, 8.7736137438018E-1, 8.7766140639289E-1, 8.7796118673569E-1, 8.7826071508102E-1, 8.7855999110181E-1, 8.7885901447146E-1, 8.7915778486386E-1, 8.7945630195339E-1, 8.7975456541488E-1, 8.8005257492369E-1, 8.8035033015564E-1, 8.8064783078705E-1, 8.8094507649471E-1, 8.8124206695593E-1, 8.8153880184846E-1, 8.8183528085061E-1, 8.8213150364112E-1, 8.8242746989925E-1, 8.8272317930477E-1, 8.8301863153792E-1, 8.8331382627945E-1, 8.8360876321059E-1, 8.8390344201311E-1, 8.8419786236923E-1, 8.8449202396170E-1, 8.8478592647377E-1, 8.8507956958918E-1, 8.8537295299220E-1, 8.8566607636757E-1, 8.8595893940056E-1, 8.8625154177694E-1, 8.8654388318299E-1, 8.8683596330550E-1, 8.8712778183177E-1, 8.8741933844960E-1, 8.8771063284731E-1, 8.8800166471375E-1, 8.8829243373826E-1, 8.8858293961070E-1, 8.8887318202145E-1, 8.8916316066141E-1, 8.8945287522199E-1, 8.8974232539513E-1, 8.9003151087328E-1, 8.9032043134942E-1, 8.9060908651704E-1, 8.9089747607017E-1, 8.9118559970334E-1, 8.9147345711162E-1, 8.9176104799061E-1, 8.9204837203644E-1, 8.9233542894575E-1, 8.9262221841571E-1, 8.9290874014404E-1, 8.9319499382897E-1, 8.9348097916928E-1, 8.9376669586427E-1, 8.9405214361377E-1, 8.9433732211816E-1, 8.9462223107833E-1, 8.9490687019574E-1, 8.9519123917237E-1, 8.9547533771072E-1, 8.9575916551386E-1, 8.9604272228539E-1, 8.9632600772944E-1, 8.9660902155069E-1, 8.9689176345437E-1, 8.9717423314625E-1, 8.9745643033263E-1, 8.9773835472037E-1, 8.9802000601688E-1, 8.9830138393011E-1, 8.9858248816856E-1, 8.9886331844127E-1, 8.9914387445784E-1, 8.9942415592843E-1, 8.9970416256374E-1, 8.9998389407501E-1, 9.0026335017407E-1, 9.0054253057326E-1, 9.0082143498551E-1, 9.0110006312430E-1, 9.0137841470366E-1, 9.0165648943816E-1, 9.0193428704297E-1, 9.0221180723380E-1, 9.0248904972690E-1, 9.0276601423912E-1, 9.0304270048784E-1, 9.0331910819102E-1, 9.0359523706718E-1, 9.0387108683541E-1, 9.0414665721536E-1, 9.0442194792724E-1, 9.0469695869184E-1, 9.0497168923051E-1, 9.0524613926518E-1, 9.0552030851834E-1, 9.0579419671305E-1, 9.0606780357294E-1, 9.0634112882223E-1, 9.0661417218570E-1, 9.0688693338869E-1, 9.0715941215714E-1, 9.0743160821755E-1, 9.0770352129701E-1, 9.0797515112318E-1, 9.0824649742428E-1, 9.0851755992914E-1, 9.0878833836716E-1, 9.0905883246830E-1, 9.0932904196314E-1, 9.0959896658279E-1, 9.0986860605900E-1, 9.1013796012406E-1, 9.1040702851087E-1, 9.1067581095290E-1, 9.1094430718421E-1, 9.1121251693945E-1, 9.1148043995386E-1, 9.1174807596326E-1, 9.1201542470407E-1, 9.1228248591328E-1, 9.1254925932849E-1, 9.1281574468789E-1, 9.1308194173025E-1, 9.1334785019494E-1, 9.1361346982192E-1, 9.1387880035176E-1, 9.1414384152560E-1, 9.1440859308519E-1, 9.1467305477288E-1, 9.1493722633161E-1, 9.1520110750491E-1, 9.1546469803693E-1, 9.1572799767240E-1, 9.1599100615666E-1, 9.1625372323564E-1, 9.1651614865590E-1, 9.1677828216456E-1, 9.1704012350938E-1, 9.1730167243870E-1, 9.1756292870147E-1, 9.1782389204725E-1, 9.1808456222621E-1, 9.1834493898911E-1, 9.1860502208733E-1, 9.1886481127285E-1, 9.1912430629827E-1, 9.1938350691679E-1, 9.1964241288221E-1, 9.1990102394896E-1, 9.2015933987208E-1, 9.2041736040720E-1, 9.2067508531058E-1, 9.2093251433909E-1, 9.2118964725021E-1, 9.2144648380205E-1, 9.2170302375331E-1, 9.2195926686332E-1, 9.2221521289202E-1, 9.2247086159998E-1, 9.2272621274837E-1, 9.2298126609899E-1, 9.2323602141426E-1, 9.2349047845720E-1, 9.2374463699148E-1, 9.2399849678137E-1, 9.2425205759176E-1, 9.2450531918817E-1, 9.2475828133674E-1, 9.2501094380424E-1, 9.2526330635805E-1, 9.2551536876619E-1, 9.2576713079728E-1, 9.2601859222060E-1, 9.2626975280602E-1, 9.2652061232406E-1, 9.2677117054586E-1, 9.2702142724320E-1, 9.2727138218846E-1, 9.2752103515467E-1, 9.2777038591549E-1, 9.2801943424521E-1, 9.2826817991873E-1, 9.2851662271160E-1, 9.2876476240001E-1, 9.2901259876077E-1, 9.2926013157130E-1, 9.2950736060971E-1, 9.2975428565468E-1, 9.3000090648557E-1, 9.3024722288236E-1, 9.3049323462566E-1, 9.3073894149673E-1, 9.3098434327744E-1, 9.3122943975033E-1, 9.3147423069855E-1, 9.3171871590591E-1, 9.3196289515685E-1, 9.3220676823643E-1, 9.3245033493039E-1, 9.3269359502507E-1, 9.3293654830747E-1, 9.3317919456524E-1, 9.3342153358665E-1, 9.3366356516062E-1, 9.3390528907672E-1, 9.3414670512515E-1, 9.3438781309677E-1, 9.3462861278307E-1, 9.3486910397620E-1, 9.3510928646893E-1, 9.3534916005469E-1, 9.3558872452756E-1, 9.3582797968226E-1, 9.3606692531417E-1, 9.3630556121928E-1, 9.3654388719428E-1, 9.3678190303646E-1, 9.3701960854380E-1, 9.3725700351488E-1, 9.3749408774899E-1, 9.3773086104601E-1, 9.3796732320651E-1, 9.3820347403171E-1, 9.3843931332344E-1, 9.3867484088424E-1, 9.3891005651726E-1, 9.3914496002631E-1, 9.3937955121587E-1, 9.3961382989105E-1, 9.3984779585763E-1, 9.4008144892204E-1, 9.4031478889136E-1, 9.4054781557332E-1, 9.4078052877633E-1, 9.4101292830942E-1, 9.4124501398230E-1, 9.4147678560533E-1, 9.4170824298953E-1, 9.4193938594657E-1, 9.4217021428878E-1, 9.4240072782916E-1, 9.4263092638133E-1, 9.4286080975962E-1, 9.4309037777899E-1, 9.4331963025505E-1, 9.4354856700409E-1, 9.4377718784305E-1, 9.4400549258954E-1, 9.4423348106182E-1, 9.4446115307880E-1, 9.4468850846008E-1, 9.4491554702590E-1, 9.4514226859717E-1, 9.4536867299546E-1, 9.4559476004300E-1, 9.4582052956269E-1, 9.4604598137808E-1, 9.4627111531340E-1, 9.4649593119353E-1, 9.4672042884402E-1, 9.4694460809108E-1, 9.4716846876160E-1, 9.4739201068311E-1, 9.4761523368383E-1, 9.4783813759262E-1, 9.4806072223903E-1, 9.4828298745326E-1, 9.4850493306618E-1, 9.4872655890933E-1, 9.4894786481492E-1, 9.4916885061581E-1, 9.4938951614555E-1, 9.4960986123834E-1, 9.4982988572906E-1, 9.5004958945324E-1, 9.5026897224711E-1, 9.5048803394753E-1, 9.5070677439206E-1, 9.5092519341891E-1, 9.5114329086697E-1, 9.5136106657580E-1, 9.5157852038562E-1, 9.5179565213732E-1, 9.5201246167248E-1, 9.5222894883332E-1, 9.5244511346276E-1, 9.5266095540437E-1, 9.5287647450239E-1, 9.5309167060176E-1, 9.5330654354806E-1, 9.5352109318755E-1, 9.5373531936717E-1, 9.5394922193451E-1, 9.5416280073787E-1, 9.5437605562620E-1, 9.5458898644910E-1, 9.5480159305689E-1, 9.5501387530053E-1, 9.5522583303166E-1, 9.5543746610259E-1, 9.5564877436632E-1, 9.5585975767650E-1, 9.5607041588748E-1, 9.5628074885426E-1, 9.5649075643252E-1, 9.5670043847863E-1, 9.5690979484961E-1, 9.5711882540316E-1, 9.5732752999768E-1, 9.5753590849222E-1, 9.5774396074650E-1, 9.5795168662093E-1, 9.5815908597659E-1, 9.5836615867524E-1, 9.5857290457931E-1, 9.5877932355189E-1, 9.5898541545679E-1, 9.5919118015844E-1, 9.5939661752198E-1, 9.5960172741323E-1, 9.5980650969867E-1, 9.6001096424545E-1, 9.6021509092142E-1, 9.6041888959508E-1, 9.6062236013563E-1, 9.6082550241293E-1, 9.6102831629752E-1, 9.6123080166062E-1, 9.6143295837412E-1, 9.6163478631060E-1, 9.6183628534331E-1, 9.6203745534616E-1, 9.6223829619377E-1, 9.6243880776140E-1, 9.6263898992502E-1, 9.6283884256125E-1, 9.6303836554741E-1, 9.6323755876148E-1, 9.6343642208212E-1, 9.6363495538868E-1, 9.6383315856118E-1, 9.6403103148029E-1, 9.6422857402741E-1, 9.6442578608458E-1, 9.6462266753452E-1, 9.6481921826063E-1, 9.6501543814701E-1, 9.6521132707839E-1, 9.6540688494023E-1, 9.6560211161864E-1, 9.6579700700039E-1, 9.6599157097297E-1, 9.6618580342450E-1, 9.6637970424382E-1, 9.6657327332043E-1, 9.6676651054449E-1, 9.6695941580687E-1, 9.6715198899908E-1, 9.6734423001334E-1, 9.6753613874254E-1, 9.6772771508022E-1, 9.6791895892064E-1, 9.6810987015870E-1, 9.6830044869001E-1, 9.6849069441081E-1, 9.6868060721807E-1, 9.6887018700941E-1, 9.6905943368311E-1, 9.6924834713817E-1, 9.6943692727422E-1, 9.6962517399161E-1, 9.6981308719133E-1, 9.7000066677507E-1, 9.7018791264518E-1, 9.7037482470469E-1, 9.7056140285733E-1, 9.7074764700747E-1, 9.7093355706017E-1, 9.7111913292118E-1, 9.7130437449691E-1, 9.7148928169444E-1, 9.7167385442155E-1, 9.7185809258666E-1, 9.7204199609890E-1, 9.7222556486806E-1, 9.7240879880461E-1, 9.7259169781968E-1, 9.7277426182508E-1, 9.7295649073332E-1, 9.7313838445756E-1, 9.7331994291163E-1, 9.7350116601005E-1, 9.7368205366801E-1, 9.7386260580137E-1, 9.7404282232666E-1, 9.7422270316110E-1, 9.7440224822258E-1, 9.7458145742963E-1, 9.7476033070151E-1, 9.7493886795810E-1, 9.7511706912000E-1, 9.7529493410843E-1, 9.7547246284534E-1, 9.7564965525331E-1, 9.7582651125562E-1, 9.7600303077619E-1, 9.7617921373964E-1, 9.7635506007126E-1, 9.7653056969699E-1, 9.7670574254347E-1, 9.7688057853799E-1, 9.7705507760852E-1, 9.7722923968370E-1, 9.7740306469283E-1, 9.7757655256590E-1, 9.7774970323356E-1, 9.7792251662713E-1, 9.7809499267860E-1, 9.7826713132063E-1, 9.7843893248654E-1, 9.7861039611034E-1, 9.7878152212669E-1, 9.7895231047092E-1, 9.7912276107905E-1, 9.7929287388775E-1, 9.7946264883434E-1, 9.7963208585686E-1, 9.7980118489396E-1, 9.7996994588499E-1, 9.8013836876996E-1, 9.8030645348955E-1, 9.8047419998510E-1, 9.8064160819862E-1, 9.8080867807278E-1, 9.8097540955094E-1, 9.8114180257708E-1, 9.8130785709589E-1, 9.8147357305270E-1, 9.8163895039351E-1, 9.8180398906498E-1, 9.8196868901446E-1, 9.8213305018992E-1, 9.8229707254003E-1, 9.8246075601410E-1, 9.8262410056213E-1, 9.8278710613475E-1, 9.8294977268327E-1, 9.8311210015967E-1, 9.8327408851656E-1, 9.8343573770726E-1, 9.8359704768570E-1, 9.8375801840651E-1, 9.8391864982496E-1, 9.8407894189699E-1, 9.8423889457918E-1, 9.8439850782881E-1, 9.8455778160376E-1, 9.8471671586263E-1, 9.8487531056465E-1, 9.8503356566969E-1, 9.8519148113832E-1, 9.8534905693172E-1, 9.8550629301177E-1, 9.8566318934099E-1, 9.8581974588254E-1, 9.8597596260026E-1, 9.8613183945863E-1, 9.8628737642281E-1, 9.8644257345857E-1, 9.8659743053239E-1, 9.8675194761135E-1, 9.8690612466323E-1, 9.8705996165643E-1, 9.8721345856002E-1, 9.8736661534372E-1, 9.8751943197791E-1, 9.8767190843360E-1, 9.8782404468248E-1, 9.8797584069686E-1, 9.8812729644972E-1, 9.8827841191470E-1, 9.8842918706607E-1, 9.8857962187876E-1, 9.8872971632835E-1, 9.8887947039105E-1, 9.8902888404375E-1, 9.8917795726397E-1, 9.8932669002987E-1, 9.8947508232028E-1, 9.8962313411466E-1, 9.8977084539311E-1, 9.8991821613639E-1, 9.9006524632591E-1, 9.9021193594372E-1, 9.9035828497249E-1, 9.9050429339557E-1, 9.9064996119694E-1, 9.9079528836122E-1, 9.9094027487367E-1, 9.9108492072021E-1, 9.9122922588738E-1, 9.9137319036237E-1, 9.9151681413302E-1, 9.9166009718780E-1, 9.9180303951582E-1, 9.9194564110684E-1, 9.9208790195125E-1, 9.9222982204007E-1, 9.9237140136499E-1, 9.9251263991830E-1, 9.9265353769295E-1, 9.9279409468253E-1, 9.9293431088124E-1, 9.9307418628395E-1, 9.9321372088614E-1, 9.9335291468394E-1, 9.9349176767411E-1, 9.9363027985404E-1, 9.9376845122175E-1, 9.9390628177591E-1, 9.9404377151581E-1, 9.9418092044137E-1, 9.9431772855314E-1, 9.9445419585232E-1, 9.9459032234072E-1, 9.9472610802079E-1, 9.9486155289560E-1, 9.9499665696885E-1, 9.9513142024489E-1, 9.9526584272868E-1, 9.9539992442580E-1, 9.9553366534246E-1, 9.9566706548552E-1, 9.9580012486244E-1, 9.9593284348131E-1, 9.9606522135085E-1, 9.9619725848040E-1, 9.9632895487993E-1, 9.9646031056004E-1, 9.9659132553192E-1, 9.9672199980741E-1, 9.9685233339897E-1, 9.9698232631968E-1, 9.9711197858323E-1, 9.9724129020393E-1, 9.9737026119673E-1, 9.9749889157718E-1, 9.9762718136145E-1, 9.9775513056632E-1, 9.9788273920922E-1, 9.9801000730815E-1, 9.9813693488176E-1, 9.9826352194931E-1, 9.9838976853066E-1, 9.9851567464629E-1, 9.9864124031731E-1, 9.9876646556543E-1, 9.9889135041296E-1, 9.9901589488284E-1, 9.9914009899861E-1, 9.9926396278444E-1, 9.9938748626508E-1, 9.9951066946592E-1, 9.9963351241293E-1, 9.9975601513272E-1, 9.9987817765247E-1, 1.0000000000000E+0};
 constexpr std::array<float, lut_size> low_contrast {0.0000000000000E+0, 3.8071194186105E-5, 7.6191797945641E-5, 1.1436187302051E-4, 1.5258148122314E-4, 1.9085068443662E-4, 2.2916954461466E-4, 2.6753812378176E-4, 3.0595648403317E-4, 3.4442468753504E-4, 3.8294279652444E-4, 4.2151087330939E-4, 4.6012898026901E-4, 4.9879717985350E-4, 5.3751553458421E-4, 5.7628410705378E-4, 6.1510295992610E-4, 6.5397215593645E-4, 6.9289175789149E-4, 7.3186182866941E-4, 7.7088243121990E-4, 8.0995362856429E-4, 8.4907548379557E-4, 8.8824806007843E-4, 9.2747142064941E-4, 9.6674562881684E-4, 1.0060707479610E-3, 1.0454468415342E-3, 1.0848739730607E-3, 1.1243522061369E-3, 1.1638816044313E-3, 1.2034622316848E-3, 1.2430941517104E-3, 1.2827774283936E-3, 1.3225121256921E-3, 1.3622983076364E-3, 1.4021360383292E-3, 1.4420253819461E-3, 1.4819664027351E-3, 1.5219591650170E-3, 1.5620037331854E-3, 1.6021001717069E-3, 1.6422485451208E-3, 1.6824489180394E-3, 1.7227013551481E-3, 1.7630059212053E-3, 1.8033626810427E-3, 1.8437716995651E-3, 1.8842330417507E-3, 1.9247467726507E-3, 1.9653129573902E-3, 2.0059316611675E-3, 2.0466029492543E-3, 2.0873268869961E-3, 2.1281035398121E-3, 2.1689329731949E-3, 2.2098152527112E-3, 2.2507504440013E-3, 2.2917386127796E-3, 2.3327798248343E-3, 2.3738741460277E-3, 2.4150216422962E-3, 2.4562223796502E-3, 2.4974764241744E-3, 2.5387838420279E-3, 2.5801446994439E-3, 2.6215590627301E-3, 2.6630269982687E-3, 2.7045485725162E-3, 2.7461238520041E-3, 2.7877529033380E-3, 2.8294357931986E-3, 2.8711725883413E-3, 2.9129633555960E-3, 2.9548081618680E-3, 2.9967070741370E-3, 3.0386601594582E-3, 3.0806674849616E-3, 3.1227291178523E-3, 3.1648451254106E-3, 3.2070155749923E-3, 3.2492405340282E-3, 3.2915200700246E-3, 3.3338542505633E-3, 3.3762431433015E-3, 3.4186868159719E-3, 3.4611853363830E-3, 3.5037387724189E-3, 3.5463471920393E-3, 3.5890106632800E-3, 3.6317292542524E-3, 3.6745030331439E-3, 3.7173320682179E-3, 3.7602164278139E-3, 3.8031561803475E-3, 3.8461513943103E-3, 3.8892021382704E-3, 3.9323084808720E-3, 3.9754704908356E-3, 4.0186882369584E-3, 4.0619617881138E-3, 4.1052912132518E-3, 4.1486765813990E-3, 4.1921179616588E-3, 4.2356154232112E-3, 4.2791690353128E-3, 4.3227788672974E-3, 4.3664449885755E-3, 4.4101674686345E-3, 4.4539463770390E-3, 4.4977817834305E-3, 4.5416737575278E-3, 4.5856223691268E-3, 4.6296276881007E-3, 4.6736897844000E-3, 4.7178087280528E-3, 4.7619845891642E-3, 4.8062174379172E-3, 4.8505073445722E-3, 4.8948543794673E-3, 4.9392586130182E-3, 4.9837201157185E-3, 5.0282389581394E-3, 5.0728152109302E-3, 5.1174489448179E-3, 5.1621402306076E-3, 5.2068891391826E-3, 5.2516957415041E-3, 5.2965601086114E-3, 5.3414823116224E-3, 5.3864624217328E-3, 5.4315005102172E-3, 5.4765966484281E-3, 5.5217509077968E-3, 5.5669633598329E-3, 5.6122340761250E-3, 5.6575631283398E-3, 5.7029505882231E-3, 5.7483965275993E-3, 5.7939010183717E-3, 5.8394641325226E-3, 5.8850859421130E-3, 5.9307665192830E-3, 5.9765059362520E-3, 6.0223042653182E-3, 6.0681615788591E-3, 6.1140779493316E-3, 6.1600534492717E-3, 6.2060881512948E-3, 6.2521821280960E-3, 6.2983354524495E-3, 6.3445481972093E-3, 6.3908204353088E-3, 6.4371522397614E-3, 6.4835436836598E-3, 6.5299948401768E-3, 6.5765057825650E-3, 6.6230765841568E-3, 6.6697073183645E-3, 6.7163980586807E-3, 6.7631488786778E-3, 6.8099598520085E-3, 6.8568310524056E-3, 6.9037625536822E-3, 6.9507544297318E-3, 6.9978067545280E-3, 7.0449196021252E-3, 7.0920930466580E-3, 7.1393271623418E-3, 7.1866220234723E-3, 7.2339777044262E-3, 7.2813942796606E-3, 7.3288718237136E-3, 7.3764104112042E-3, 7.4240101168321E-3, 7.4716710153781E-3, 7.5193931817039E-3, 7.5671766907523E-3, 7.6150216175475E-3, 7.6629280371945E-3, 7.7108960248797E-3, 7.7589256558709E-3, 7.8070170055172E-3, 7.8551701492492E-3, 7.9033851625787E-3, 7.9516621210994E-3, 8.0000011004865E-3, 8.0484021764966E-3, 8.0968654249684E-3, 8.1453909218220E-3, 8.1939787430598E-3, 8.2426289647655E-3, 8.2913416631052E-3, 8.3401169143268E-3, 8.3889547947604E-3, 8.4378553808180E-3, 8.4868187489940E-3, 8.5358449758648E-3, 8.5849341380893E-3, 8.6340863124087E-3, 8.6833015756465E-3, 8.7325800047087E-3, 8.7819216765838E-3, 8.8313266683431E-3, 8.8807950571401E-3, 8.9303269202114E-3, 8.9799223348761E-3, 9.0295813785362E-3, 9.0793041286765E-3, 9.1290906628647E-3, 9.1789410587516E-3, 9.2288553940708E-3, 9.2788337466393E-3, 9.3288761943568E-3, 9.3789828152067E-3, 9.4291536872553E-3, 9.4793888886523E-3, 9.5296884976308E-3, 9.5800525925072E-3, 9.6304812516815E-3, 9.6809745536373E-3, 9.7315325769416E-3, 9.7821554002450E-3, 9.8328431022822E-3, 9.8835957618711E-3, 9.9344134579139E-3, 9.9852962693963E-3, 1.0036244275388E-2, 1.0087257555043E-2, 1.0138336187599E-2, 1.0189480252378E-2, 1.0240689828785E-2, 1.0291964996312E-2, 1.0343305834532E-2, 1.0394712423104E-2, 1.0446184841771E-2, 1.0497723170361E-2, 1.0549327488786E-2, 1.0600997877043E-2, 1.0652734415211E-2, 1.0704537183458E-2, 1.0756406262034E-2, 1.0808341731273E-2, 1.0860343671596E-2, 1.0912412163508E-2, 1.0964547287598E-2, 1.1016749124540E-2, 1.1069017755096E-2, 1.1121353260108E-2, 1.1173755720508E-2, 1.1226225217311E-2, 1.1278761831615E-2, 1.1331365644608E-2, 1.1384036737560E-2, 1.1436775191827E-2, 1.1489581088852E-2, 1.1542454510160E-2, 1.1595395537365E-2, 1.1648404252166E-2, 1.1701480736347E-2, 1.1754625071776E-2, 1.1807837340410E-2, 1.1861117624290E-2, 1.1914466005543E-2, 1.1967882566382E-2, 1.2021367389106E-2, 1.2074920556100E-2, 1.2128542149836E-2, 1.2182232252871E-2, 1.2235990947848E-2, 1.2289818317497E-2, 1.2343714444633E-2, 1.2397679412160E-2, 1.2451713303065E-2, 1.2505816200425E-2, 1.2559988187400E-2, 1.2614229347239E-2, 1.2668539763277E-2, 1.2722919518934E-2, 1.2777368697719E-2, 1.2831887383228E-2, 1.2886475659141E-2, 1.2941133609227E-2, 1.2995861317341E-2, 1.3050658867427E-2, 1.3105526343512E-2, 1.3160463829714E-2, 1.3215471410236E-2, 1.3270549169369E-2, 1.3325697191491E-2, 1.3380915561066E-2, 1.3436204362648E-2, 1.3491563680875E-2, 1.3546993600476E-2, 1.3602494206265E-2, 1.3658065583143E-2, 1.3713707816102E-2, 1.3769420990217E-2, 1.3825205190654E-2, 1.3881060502666E-2, 1.3936987011593E-2, 1.3992984802863E-2, 1.4049053961992E-2, 1.4105194574585E-2, 1.4161406726333E-2, 1.4217690503016E-2, 1.4274045990502E-2, 1.4330473274747E-2, 1.4386972441795E-2, 1.4443543577779E-2, 1.4500186768920E-2, 1.4556902101526E-2, 1.4613689661994E-2, 1.4670549536810E-2, 1.4727481812549E-2, 1.4784486575872E-2, 1.4841563913531E-2, 1.4898713912365E-2, 1.4955936659303E-2, 1.5013232241362E-2, 1.5070600745646E-2, 1.5128042259352E-2, 1.5185556869761E-2, 1.5243144664246E-2, 1.5300805730269E-2, 1.5358540155377E-2, 1.5416348027212E-2, 1.5474229433501E-2, 1.5532184462060E-2, 1.5590213200796E-2, 1.5648315737704E-2, 1.5706492160870E-2, 1.5764742558466E-2, 1.5823067018756E-2, 1.5881465630093E-2, 1.5939938480918E-2, 1.5998485659763E-2, 1.6057107255249E-2, 1.6115803356086E-2, 1.6174574051074E-2, 1.6233419429104E-2, 1.6292339579154E-2, 1.6351334590293E-2, 1.6410404551680E-2, 1.6469549552565E-2, 1.6528769682285E-2, 1.6588065030269E-2, 1.6647435686035E-2, 1.6706881739191E-2, 1.6766403279437E-2, 1.6826000396560E-2, 1.6885673180440E-2, 1.6945421721044E-2, 1.7005246108432E-2, 1.7065146432752E-2, 1.7125122784246E-2, 1.7185175253241E-2, 1.7245303930160E-2, 1.7305508905511E-2, 1.7365790269896E-2, 1.7426148114007E-2, 1.7486582528627E-2, 1.7547093604627E-2, 1.7607681432970E-2, 1.7668346104712E-2, 1.7729087710997E-2, 1.7789906343060E-2, 1.7850802092228E-2, 1.7911775049917E-2, 1.7972825307636E-2, 1.8033952956984E-2, 1.8095158089650E-2, 1.8156440797416E-2, 1.8217801172153E-2, 1.8279239305825E-2, 1.8340755290485E-2, 1.8402349218279E-2, 1.8464021181443E-2, 1.8525771272306E-2, 1.8587599583285E-2, 1.8649506206892E-2, 1.8711491235728E-2, 1.8773554762486E-2, 1.8835696879951E-2, 1.8897917680999E-2, 1.8960217258597E-2, 1.9022595705805E-2, 1.9085053115773E-2, 1.9147589581743E-2, 1.9210205197050E-2, 1.9272900055118E-2, 1.9335674249467E-2, 1.9398527873704E-2, 1.9461461021530E-2, 1.9524473786740E-2, 1.9587566263217E-2, 1.9650738544938E-2, 1.9713990725971E-2, 1.9777322900479E-2, 1.9840735162713E-2, 1.9904227607017E-2, 1.9967800327830E-2, 2.0031453419680E-2, 2.0095186977188E-2, 2.0159001095069E-2, 2.0222895868126E-2, 2.0286871391260E-2, 2.0350927759459E-2, 2.0415065067807E-2, 2.0479283411479E-2, 2.0543582885742E-2, 2.0607963585957E-2, 2.0672425607576E-2, 2.0736969046144E-2, 2.0801593997298E-2, 2.0866300556770E-2, 2.0931088820381E-2, 2.0995958884048E-2, 2.1060910843778E-2, 2.1125944795673E-2, 2.1191060835926E-2, 2.1256259060824E-2, 2.1321539566747E-2, 2.1386902450166E-2, 2.1452347807648E-2, 2.1517875735849E-2, 2.1583486331521E-2, 2.1649179691509E-2, 2.1714955912748E-2, 2.1780815092271E-2, 2.1846757327199E-2, 2.1912782714749E-2, 2.1978891352231E-2, 2.2045083337047E-2, 2.2111358766694E-2, 2.2177717738760E-2, 2.2244160350928E-2, 2.2310686700975E-2, 2.2377296886768E-2, 2.2443991006271E-2, 2.2510769157539E-2, 2.2577631438722E-2, 2.2644577948063E-2, 2.2711608783897E-2, 2.2778724044655E-2, 2.2845923828860E-2, 2.2913208235128E-2, 2.2980577362171E-2, 2.3048031308792E-2, 2.3115570173889E-2, 2.3183194056454E-2, 2.3250903055571E-2, 2.3318697270420E-2, 2.3386576800274E-2, 2.3454541744498E-2, 2.3522592202553E-2, 2.3590728273993E-2, 2.3658950058466E-2, 2.3727257655714E-2, 2.3795651165572E-2, 2.3864130687971E-2, 2.3932696322935E-2, 2.4001348170580E-2, 2.4070086331118E-2, 2.4138910904856E-2, 2.4207821992194E-2, 2.4276819693624E-2, 2.4345904109736E-2, 2.4415075341211E-2, 2.4484333488826E-2, 2.4553678653451E-2, 2.4623110936052E-2, 2.4692630437687E-2, 2.4762237259509E-2, 2.4831931502766E-2, 2.4901713268801E-2, 2.4971582659048E-2, 2.5041539775040E-2, 2.5111584718400E-2, 2.5181717590848E-2, 2.5251938494197E-2, 2.5322247530357E-2, 2.5392644801330E-2, 2.5463130409212E-2, 2.5533704456195E-2, 2.5604367044566E-2, 2.5675118276705E-2, 2.5745958255088E-2, 2.5816887082283E-2, 2.5887904860957E-2, 2.5959011693867E-2, 2.6030207683868E-2, 2.6101492933907E-2, 2.6172867547028E-2, 2.6244331626369E-2, 2.6315885275161E-2, 2.6387528596733E-2, 2.6459261694506E-2, 2.6531084671996E-2, 2.6602997632815E-2, 2.6675000680670E-2, 2.6747093919361E-2, 2.6819277452784E-2, 2.6891551384930E-2, 2.6963915819885E-2, 2.7036370861830E-2, 2.7108916615038E-2, 2.7181553183882E-2, 2.7254280672825E-2, 2.7327099186429E-2, 2.7400008829348E-2, 2.7473009706333E-2, 2.7546101922228E-2, 2.7619285581974E-2, 2.7692560790605E-2, 2.7765927653252E-2, 2.7839386275141E-2, 2.7912936761590E-2, 2.7986579218016E-2, 2.8060313749928E-2, 2.8134140462933E-2, 2.8208059462730E-2, 2.8282070855116E-2, 2.8356174745981E-2, 2.8430371241311E-2, 2.8504660447188E-2, 2.8579042469786E-2, 2.8653517415379E-2, 2.8728085390331E-2, 2.8802746501106E-2, 2.8877500854260E-2, 2.8952348556444E-2, 2.9027289714407E-2, 2.9102324434991E-2, 2.9177452825134E-2, 2.9252674991869E-2, 2.9327991042324E-2, 2.9403401083723E-2, 2.9478905223385E-2, 2.9554503568723E-2, 2.9630196227247E-2, 2.9705983306562E-2, 2.9781864914368E-2, 2.9857841158459E-2, 2.9933912146727E-2, 3.0010077987157E-2, 3.0086338787831E-2, 3.0162694656925E-2, 3.0239145702711E-2, 3.0315692033555E-2, 3.0392333757921E-2, 3.0469070984367E-2, 3.0545903821545E-2, 3.0622832378203E-2, 3.0699856763187E-2, 3.0776977085435E-2, 3.0854193453981E-2, 3.0931505977956E-2, 3.1008914766584E-2, 3.1086419929187E-2, 3.1164021575180E-2, 3.1241719814075E-2, 3.1319514755479E-2, 3.1397406509092E-2, 3.1475395184714E-2, 3.1553480892237E-2, 3.1631663741649E-2, 3.1709943843033E-2, 3.1788321306569E-2, 3.1866796242530E-2, 3.1945368761287E-2, 3.2024038973303E-2, 3.2102806989141E-2, 3.2181672919455E-2, 3.2260636874996E-2, 3.2339698966610E-2, 3.2418859305241E-2, 3.2498118001923E-2, 3.2577475167791E-2, 3.2656930914071E-2, 3.2736485352087E-2, 3.2816138593258E-2, 3.2895890749096E-2, 3.2975741931211E-2, 3.3055692251307E-2, 3.3135741821184E-2, 3.3215890752737E-2, 3.3296139157956E-2, 3.3376487148926E-2, 3.3456934837829E-2, 3.3537482336940E-2, 3.3618129758631E-2, 3.3698877215368E-2, 3.3779724819714E-2, 3.3860672684324E-2, 3.3941720921952E-2, 3.4022869645445E-2, 3.4104118967745E-2, 3.4185469001891E-2, 3.4266919861015E-2, 3.4348471658346E-2, 3.4430124507208E-2, 3.4511878521018E-2, 3.4593733813291E-2, 3.4675690497635E-2, 3.4757748687754E-2, 3.4839908497448E-2, 3.4922170040610E-2, 3.5004533431230E-2, 3.5086998783392E-2, 3.5169566211275E-2, 3.5252235829154E-2, 3.5335007751399E-2, 3.5417882092472E-2, 3.5500858966935E-2, 3.5583938489441E-2, 3.5667120774740E-2, 3.5750405937676E-2, 3.5833794093188E-2, 3.5917285356310E-2, 3.6000879842172E-2, 3.6084577665996E-2, 3.6168378943103E-2, 3.6252283788905E-2, 3.6336292318911E-2, 3.6420404648724E-2, 3.6504620894042E-2, 3.6588941170657E-2, 3.6673365594458E-2, 3.6757894281427E-2, 3.6842527347639E-2, 3.6927264909267E-2, 3.7012107082578E-2, 3.7097053983931E-2, 3.7182105729783E-2, 3.7267262436683E-2, 3.7352524221277E-2, 3.7437891200302E-2, 3.7523363490594E-2, 3.7608941209080E-2, 3.7694624472782E-2, 3.7780413398818E-2, 3.7866308104400E-2, 3.7952308706832E-2, 3.8038415323517E-2, 3.8124628071947E-2, 3.8210947069713E-2, 3.8297372434496E-2, 3.8383904284076E-2, 3.8470542736323E-2, 3.8557287909204E-2, 3.8644139920778E-2, 3.8731098889199E-2, 3.8818164932717E-2, 3.8905338169674E-2, 3.8992618718505E-2, 3.9080006697742E-2, 3.9167502226009E-2, 3.9255105422025E-2, 3.9342816404602E-2, 3.9430635292646E-2, 3.9518562205157E-2, 3.9606597261231E-2, 3.9694740580053E-2, 3.9782992280907E-2, 3.9871352483167E-2, 3.9959821306303E-2, 4.0048398869876E-2, 4.0137085293544E-2, 4.0225880697057E-2, 4.0314785200257E-2, 4.0403798923082E-2, 4.0492921985563E-2, 4.0582154507823E-2, 4.0671496610080E-2, 4.0760948412644E-2, 4.0850510035920E-2, 4.0940181600405E-2, 4.1029963226689E-2, 4.1119855035457E-2, 4.1209857147485E-2, 4.1299969683643E-2, 4.1390192764896E-2, 4.1480526512298E-2, 4.1570971047000E-2, 4.1661526490244E-2, 4.1752192963365E-2, 4.1842970587791E-2, 4.1933859485043E-2, 4.2024859776734E-2, 4.2115971584572E-2, 4.2207195030356E-2, 4.2298530235976E-2, 4.2389977323419E-2, 4.2481536414761E-2, 4.2573207632171E-2, 4.2664991097912E-2, 4.2756886934338E-2, 4.2848895263896E-2, 4.2941016209125E-2, 4.3033249892657E-2, 4.3125596437215E-2, 4.3218055965616E-2, 4.3310628600768E-2, 4.3403314465670E-2, 4.3496113683416E-2, 4.3589026377188E-2, 4.3682052670264E-2, 4.3775192686012E-2, 4.3868446547890E-2, 4.3961814379452E-2, 4.4055296304339E-2, 4.4148892446288E-2, 4.4242602929125E-2, 4.4336427876769E-2, 4.4430367413228E-2, 4.4524421662604E-2, 4.4618590749090E-2, 4.4712874796970E-2, 4.4807273930618E-2, 4.4901788274502E-2, 4.4996417953179E-2, 4.5091163091297E-2, 4.5186023813597E-2, 4.5281000244909E-2, 4.5376092510154E-2, 4.5471300734346E-2, 4.5566625042588E-2, 4.5662065560073E-2, 4.5757622412088E-2, 4.5853295724006E-2, 4.5949085621294E-2, 4.6044992229509E-2, 4.6141015674298E-2, 4.6237156081397E-2, 4.6333413576634E-2, 4.6429788285928E-2, 4.6526280335287E-2, 4.6622889850807E-2, 4.6719616958679E-2, 4.6816461785179E-2, 4.6913424456676E-2, 4.7010505099629E-2, 4.7107703840583E-2, 4.7205020806178E-2, 4.7302456123140E-2, 4.7400009918285E-2, 4.7497682318520E-2, 4.7595473450840E-2, 4.7693383442331E-2, 4.7791412420166E-2, 4.7889560511609E-2, 4.7987827844012E-2, 4.8086214544817E-2, 4.8184720741554E-2, 4.8283346561843E-2, 4.8382092133393E-2, 4.8480957584000E-2, 4.8579943041550E-2, 4.8679048634019E-2, 4.8778274489467E-2, 4.8877620736048E-2, 4.8977087502000E-2, 4.9076674915653E-2, 4.9176383105422E-2, 4.9276212199811E-2, 4.9376162327414E-2, 4.9476233616910E-2, 4.9576426197069E-2, 4.9676740196747E-2, 4.9777175744887E-2, 4.9877732970521E-2, 4.9978412002768E-2, 5.0079212970836E-2, 5.0180136004018E-2, 5.0281181231695E-2, 5.0382348783337E-2, 5.0483638788500E-2, 5.0585051376825E-2, 5.0686586678044E-2, 5.0788244821973E-2, 5.0890025938515E-2, 5.0991930157661E-2, 5.1093957609487E-2, 5.1196108424158E-2, 5.1298382731923E-2, 5.1400780663119E-2, 5.1503302348167E-2, 5.1605947917578E-2, 5.1708717501945E-2, 5.1811611231949E-2, 5.1914629238357E-2, 5.2017771652023E-2, 5.2121038603882E-2, 5.2224430224960E-2, 5.2327946646366E-2, 5.2431587999295E-2, 5.2535354415027E-2, 5.2639246024927E-2, 5.2743262960445E-2, 5.2847405353117E-2, 5.2951673334564E-2, 5.3056067036491E-2, 5.3160586590687E-2, 5.3265232129028E-2, 5.3370003783472E-2, 5.3474901686064E-2, 5.3579925968930E-2, 5.3685076764283E-2, 5.3790354204420E-2, 5.3895758421720E-2, 5.4001289548649E-2, 5.4106947717753E-2, 5.4212733061665E-2, 5.4318645713099E-2, 5.4424685804855E-2, 5.4530853469815E-2, 5.4637148840945E-2, 5.4743572051292E-2, 5.4850123233989E-2, 5.4956802522250E-2, 5.5063610049372E-2, 5.5170545948737E-2, 5.5277610353806E-2, 5.5384803398125E-2, 5.5492125215321E-2, 5.5599575939105E-2, 5.5707155703268E-2, 5.5814864641686E-2, 5.5922702888313E-2, 5.6030670577188E-2, 5.6138767842430E-2, 5.6246994818241E-2, 5.6355351638903E-2, 5.6463838438780E-2, 5.6572455352318E-2, 5.6681202514043E-2, 5.6790080058561E-2, 5.6899088120562E-2, 5.7008226834814E-2, 5.7117496336167E-2, 5.7226896759550E-2, 5.7336428239975E-2, 5.7446090912531E-2, 5.7555884912391E-2, 5.7665810374803E-2, 5.7775867435100E-2, 5.7886056228692E-2, 5.7996376891068E-2, 5.8106829557798E-2, 5.8217414364532E-2, 5.8328131446997E-2, 5.8438980941001E-2, 5.8549962982429E-2, 5.8661077707248E-2, 5.8772325251500E-2, 5.8883705751309E-2, 5.8995219342875E-2, 5.9106866162477E-2, 5.9218646346472E-2, 5.9330560031297E-2, 5.9442607353465E-2, 5.9554788449565E-2, 5.9667103456268E-2, 5.9779552510320E-2, 5.9892135748544E-2, 6.0004853307841E-2, 6.0117705325189E-2, 6.0230691937643E-2, 6.0343813282334E-2, 6.0457069496472E-2, 6.0570460717341E-2, 6.0683987082301E-2, 6.0797648728792E-2, 6.0911445794325E-2, 6.1025378416492E-2, 6.1139446732957E-2, 6.1253650881462E-2, 6.1367990999822E-2, 6.1482467225930E-2, 6.1597079697753E-2, 6.1711828553334E-2, 6.1826713930789E-2, 6.1941735968309E-2, 6.2056894804163E-2, 6.2172190576691E-2, 6.2287623424307E-2, 6.2403193485502E-2, 6.2518900898839E-2, 6.2634745802956E-2, 6.2750728336563E-2, 6.2866848638444E-2, 6.2983106847459E-2, 6.3099503102538E-2, 6.3216037542685E-2, 6.3332710306978E-2, 6.3449521534567E-2, 6.3566471364673E-2, 6.3683559936593E-2, 6.3800787389693E-2, 6.3918153863413E-2, 6.4035659497264E-2, 6.4153304430829E-2, 6.4271088803764E-2, 6.4389012755793E-2, 6.4507076426715E-2, 6.4625279956398E-2, 6.4743623484782E-2, 6.4862107151878E-2, 6.4980731097765E-2, 6.5099495462597E-2, 6.5218400386594E-2, 6.5337446010048E-2, 6.5456632473321E-2, 6.5575959916845E-2, 6.5695428481121E-2, 6.5815038306719E-2, 6.5934789534279E-2, 6.6054682304511E-2, 6.6174716758192E-2, 6.6294893036169E-2, 6.6415211279356E-2, 6.6535671628738E-2, 6.6656274225366E-2, 6.6777019210359E-2, 6.6897906724905E-2, 6.7018936910260E-2, 6.7140109907746E-2, 6.7261425858752E-2, 6.7382884904737E-2, 6.7504487187223E-2, 6.7626232847802E-2, 6.7748122028131E-2, 6.7870154869933E-2, 6.7992331514998E-2, 6.8114652105182E-2, 6.8237116782407E-2, 6.8359725688659E-2, 6.8482478965992E-2, 6.8605376756523E-2, 6.8728419202435E-2, 6.8851606445975E-2, 6.8974938629457E-2, 6.9098415895257E-2, 6.9222038385816E-2, 6.9345806243639E-2, 6.9469719611295E-2, 6.9593778631418E-2, 6.9717983446703E-2, 6.9842334199910E-2, 6.9966831033861E-2, 7.0091474091442E-2, 7.0216263515600E-2, 7.0341199449348E-2, 7.0466282035757E-2, 7.0591511417962E-2, 7.0716887739161E-2, 7.0842411142612E-2, 7.0968081771635E-2, 7.1093899769610E-2, 7.1219865279981E-2, 7.1345978446251E-2, 7.1472239411982E-2, 7.1598648320800E-2, 7.1725205316389E-2, 7.1851910542493E-2, 7.1978764142916E-2, 7.2105766261522E-2, 7.2232917042234E-2, 7.2360216629034E-2, 7.2487665165964E-2, 7.2615262797124E-2, 7.2743009666671E-2, 7.2870905918822E-2, 7.2998951697852E-2, 7.3127147148095E-2, 7.3255492413939E-2, 7.3383987639832E-2, 7.3512632970279E-2, 7.3641428549843E-2, 7.3770374523141E-2, 7.3899471034847E-2, 7.4028718229695E-2, 7.4158116252470E-2, 7.4287665248016E-2, 7.4417365361232E-2, 7.4547216737071E-2, 7.4677219520543E-2, 7.4807373856712E-2, 7.4937679890697E-2, 7.5068137767671E-2, 7.5198747632862E-2, 7.5329509631551E-2, 7.5460423909073E-2, 7.5591490610817E-2, 7.5722709882225E-2, 7.5854081868792E-2, 7.5985606716066E-2, 7.6117284569648E-2, 7.6249115575189E-2, 7.6381099878395E-2, 7.6513237625023E-2, 7.6645528960881E-2, 7.6777974031828E-2, 7.6910572983775E-2, 7.7043325962684E-2, 7.7176233114566E-2, 7.7309294585485E-2, 7.7442510521554E-2, 7.7575881068934E-2, 7.7709406373838E-2, 7.7843086582527E-2, 7.7976921841313E-2, 7.8110912296555E-2, 7.8245058094661E-2, 7.8379359382087E-2, 7.8513816305339E-2, 7.8648429010969E-2, 7.8783197645576E-2, 7.8918122355810E-2, 7.9053203288364E-2, 7.9188440589979E-2, 7.9323834407444E-2, 7.9459384887592E-2, 7.9595092177305E-2, 7.9730956423508E-2, 7.9866977773174E-2, 8.0003156373318E-2, 8.0139492371003E-2, 8.0275985913335E-2, 8.0412637147466E-2, 8.0549446220590E-2, 8.0686413279947E-2, 8.0823538472820E-2, 8.0960821946534E-2, 8.1098263848460E-2, 8.1235864326009E-2, 8.1373623526636E-2, 8.1511541597838E-2, 8.1649618687154E-2, 8.1787854942164E-2, 8.1926250510492E-2, 8.2064805539799E-2, 8.2203520177791E-2, 8.2342394572211E-2, 8.2481428870847E-2, 8.2620623221522E-2, 8.2759977772101E-2, 8.2899492670490E-2, 8.3039168064632E-2, 8.3179004102509E-2, 8.3319000932143E-2, 8.3459158701594E-2, 8.3599477558958E-2, 8.3739957652372E-2, 8.3880599130008E-2, 8.4021402140077E-2, 8.4162366830825E-2, 8.4303493350536E-2, 8.4444781847530E-2, 8.4586232470162E-2, 8.4727845366825E-2, 8.4869620685944E-2, 8.5011558575984E-2, 8.5153659185439E-2, 8.5295922662842E-2, 8.5438349156758E-2, 8.5580938815788E-2, 8.5723691788563E-2, 8.5866608223751E-2, 8.6009688270050E-2, 8.6152932076194E-2, 8.6296339790947E-2, 8.6439911563105E-2, 8.6583647541497E-2, 8.6727547874983E-2, 8.6871612712453E-2, 8.7015842202829E-2, 8.7160236495065E-2, 8.7304795738142E-2, 8.7449520081073E-2, 8.7594409672900E-2, 8.7739464662695E-2, 8.7884685199557E-2, 8.8030071432615E-2, 8.8175623511028E-2, 8.8321341583979E-2, 8.8467225800683E-2, 8.8613276310378E-2, 8.8759493262333E-2, 8.8905876805841E-2, 8.9052427090223E-2, 8.9199144264824E-2, 8.9346028479018E-2, 8.9493079882200E-2, 8.9640298623795E-2, 8.9787684853248E-2, 8.9935238720033E-2, 9.0082960373643E-2, 9.0230849963600E-2, 9.0378907639444E-2, 9.0527133550743E-2, 9.0675527847086E-2, 9.0824090678081E-2, 9.0972822193364E-2, 9.1121722542588E-2, 9.1270791875430E-2, 9.1420030341586E-2, 9.1569438090775E-2, 9.1719015272734E-2, 9.1868762037221E-2, 9.2018678534014E-2, 9.2168764912911E-2, 9.2319021323726E-2, 9.2469447916295E-2, 9.2620044840471E-2, 9.2770812246123E-2, 9.2921750283140E-2, 9.3072859101428E-2, 9.3224138850909E-2, 9.3375589681521E-2, 9.3527211743219E-2, 9.3679005185974E-2, 9.3830970159772E-2, 9.3983106814614E-2, 9.4135415300515E-2, 9.4287895767506E-2, 9.4440548365631E-2, 9.4593373244946E-2, 9.4746370555523E-2, 9.4899540447446E-2, 9.5052883070811E-2, 9.5206398575726E-2, 9.5360087112311E-2, 9.5513948830698E-2, 9.5667983881029E-2, 9.5822192413456E-2, 9.5976574578145E-2, 9.6131130525267E-2, 9.6285860405006E-2, 9.6440764367553E-2, 9.6595842563109E-2, 9.6751095141884E-2, 9.6906522254095E-2, 9.7062124049965E-2, 9.7217900679728E-2, 9.7373852293621E-2, 9.7529979041891E-2, 9.7686281074788E-2, 9.7842758542570E-2, 9.7999411595499E-2, 9.8156240383843E-2, 9.8313245057872E-2, 9.8470425767865E-2, 9.8627782664099E-2, 9.8785315896858E-2, 9.8943025616429E-2, 9.9100911973100E-2, 9.9258975117161E-2, 9.9417215198907E-2, 9.9575632368629E-2, 9.9734226776624E-2, 9.9892998573187E-2, 1.0005194790861E-1, 1.0021107493320E-1, 1.0037037979724E-1, 1.0052986265103E-1, 1.0068952364486E-1, 1.0084936292902E-1, 1.0100938065379E-1, 1.0116957696948E-1, 1.0132995202635E-1, 1.0149050597468E-1, 1.0165123896476E-1, 1.0181215114685E-1, 1.0197324267122E-1, 1.0213451368813E-1, 1.0229596434783E-1, 1.0245759480058E-1, 1.0261940519661E-1, 1.0278139568617E-1, 1.0294356641948E-1, 1.0310591754676E-1, 1.0326844921823E-1, 1.0343116158409E-1, 1.0359405479454E-1, 1.0375712899976E-1, 1.0392038434993E-1, 1.0408382099521E-1, 1.0424743908577E-1, 1.0441123877174E-1, 1.0457522020326E-1, 1.0473938353044E-1, 1.0490372890341E-1, 1.0506825647225E-1, 1.0523296638705E-1, 1.0539785879787E-1, 1.0556293385477E-1, 1.0572819170779E-1, 1.0589363250696E-1, 1.0605925640228E-1, 1.0622506354374E-1, 1.0639105408133E-1, 1.0655722816500E-1, 1.0672358594471E-1, 1.0689012757036E-1, 1.0705685319188E-1, 1.0722376295914E-1, 1.0739085702202E-1, 1.0755813553037E-1, 1.0772559863401E-1, 1.0789324648276E-1, 1.0806107922641E-1, 1.0822909701472E-1, 1.0839729999744E-1, 1.0856568832429E-1, 1.0873426214497E-1, 1.0890302160916E-1, 1.0907196686651E-1, 1.0924109806665E-1, 1.0941041535919E-1, 1.0957991889370E-1, 1.0974960881974E-1, 1.0991948528684E-1, 1.1008954844450E-1, 1.1025979844219E-1, 1.1043023542937E-1, 1.1060085955544E-1, 1.1077167096980E-1, 1.1094266982182E-1, 1.1111385626082E-1, 1.1128523043610E-1, 1.1145679249695E-1, 1.1162854259260E-1, 1.1180048087227E-1, 1.1197260748512E-1, 1.1214492258032E-1, 1.1231742630696E-1, 1.1249011881413E-1, 1.1266300025089E-1, 1.1283607076623E-1, 1.1300933050915E-1, 1.1318277962857E-1, 1.1335641827342E-1, 1.1353024659255E-1, 1.1370426473481E-1, 1.1387847284899E-1, 1.1405287108385E-1, 1.1422745958810E-1, 1.1440223851045E-1, 1.1457720799952E-1, 1.1475236820391E-1, 1.1492771927221E-1, 1.1510326135292E-1, 1.1527899459452E-1, 1.1545491914547E-1, 1.1563103515414E-1, 1.1580734276891E-1, 1.1598384213808E-1, 1.1616053340992E-1, 1.1633741673266E-1, 1.1651449225446E-1, 1.1669176012347E-1, 1.1686922048778E-1, 1.1704687349541E-1, 1.1722471929438E-1, 1.1740275803262E-1, 1.1758098985803E-1, 1.1775941491847E-1, 1.1793803336174E-1, 1.1811684533559E-1, 1.1829585098772E-1, 1.1847505046578E-1, 1.1865444391737E-1, 1.1883403149005E-1, 1.1901381333131E-1, 1.1919378958859E-1, 1.1937396040928E-1, 1.1955432594073E-1, 1.1973488633021E-1, 1.1991564172495E-1, 1.2009659227213E-1, 1.2027773811886E-1, 1.2045907941220E-1, 1.2064061629916E-1, 1.2082234892667E-1, 1.2100427744164E-1, 1.2118640199088E-1, 1.2136872272117E-1, 1.2155123977922E-1, 1.2173395331168E-1, 1.2191686346513E-1, 1.2209997038610E-1, 1.2228327422107E-1, 1.2246677511642E-1, 1.2265047321851E-1, 1.2283436867360E-1, 1.2301846162792E-1, 1.2320275222760E-1, 1.2338724061873E-1, 1.2357192694733E-1, 1.2375681135934E-1, 1.2394189400065E-1, 1.2412717501707E-1, 1.2431265455435E-1, 1.2449833275817E-1, 1.2468420977414E-1, 1.2487028574779E-1, 1.2505656082460E-1, 1.2524303514996E-1, 1.2542970886920E-1, 1.2561658212757E-1, 1.2580365507025E-1, 1.2599092784235E-1, 1.2617840058890E-1, 1.2636607345487E-1, 1.2655394658513E-1, 1.2674202012450E-1, 1.2693029421771E-1, 1.2711876900941E-1, 1.2730744464418E-1, 1.2749632126653E-1, 1.2768539902086E-1, 1.2787467805153E-1, 1.2806415850280E-1, 1.2825384051884E-1, 1.2844372424377E-1, 1.2863380982159E-1, 1.2882409739625E-1, 1.2901458711160E-1, 1.2920527911140E-1, 1.2939617353936E-1, 1.2958727053906E-1, 1.2977857025404E-1, 1.2997007282771E-1, 1.3016177840342E-1, 1.3035368712443E-1, 1.3054579913391E-1, 1.3073811457495E-1, 1.3093063359052E-1, 1.3112335632355E-1, 1.3131628291684E-1, 1.3150941351311E-1, 1.3170274825500E-1, 1.3189628728505E-1, 1.3209003074569E-1, 1.3228397877929E-1, 1.3247813152810E-1, 1.3267248913430E-1, 1.3286705173994E-1, 1.3306181948701E-1, 1.3325679251738E-1, 1.3345197097283E-1, 1.3364735499505E-1, 1.3384294472562E-1, 1.3403874030603E-1, 1.3423474187766E-1, 1.3443094958181E-1, 1.3462736355965E-1, 1.3482398395228E-1, 1.3502081090067E-1, 1.3521784454571E-1, 1.3541508502817E-1, 1.3561253248872E-1, 1.3581018706794E-1, 1.3600804890627E-1, 1.3620611814409E-1, 1.3640439492164E-1, 1.3660287937907E-1, 1.3680157165640E-1, 1.3700047189357E-1, 1.3719958023039E-1, 1.3739889680657E-1, 1.3759842176171E-1, 1.3779815523529E-1, 1.3799809736669E-1, 1.3819824829516E-1, 1.3839860815987E-1, 1.3859917709983E-1, 1.3879995525398E-1, 1.3900094276111E-1, 1.3920213975992E-1, 1.3940354638898E-1, 1.3960516278674E-1, 1.3980698909155E-1, 1.4000902544162E-1, 1.4021127197505E-1, 1.4041372882982E-1, 1.4061639614380E-1, 1.4081927405471E-1, 1.4102236270019E-1, 1.4122566221772E-1, 1.4142917274467E-1, 1.4163289441830E-1, 1.4183682737572E-1, 1.4204097175393E-1, 1.4224532768980E-1, 1.4244989532009E-1, 1.4265467478139E-1, 1.4285966621022E-1, 1.4306486974292E-1, 1.4327028551573E-1, 1.4347591366475E-1, 1.4368175432595E-1, 1.4388780763517E-1, 1.4409407372812E-1, 1.4430055274037E-1, 1.4450724480736E-1, 1.4471415006439E-1, 1.4492126864665E-1, 1.4512860068916E-1, 1.4533614632683E-1, 1.4554390569441E-1, 1.4575187892654E-1, 1.4596006615769E-1, 1.4616846752221E-1, 1.4637708315432E-1, 1.4658591318807E-1, 1.4679495775740E-1, 1.4700421699608E-1, 1.4721369103775E-1, 1.4742338001592E-1, 1.4763328406393E-1, 1.4784340331499E-1, 1.4805373790216E-1, 1.4826428795836E-1, 1.4847505361636E-1, 1.4868603500878E-1, 1.4889723226808E-1, 1.4910864552660E-1, 1.4932027491650E-1, 1.4953212056981E-1, 1.4974418261839E-1, 1.4995646119397E-1, 1.5016895642810E-1, 1.5038166845221E-1, 1.5059459739755E-1, 1.5080774339522E-1, 1.5102110657617E-1, 1.5123468707119E-1, 1.5144848501090E-1, 1.5166250052579E-1, 1.5187673374616E-1, 1.5209118480219E-1, 1.5230585382385E-1, 1.5252074094098E-1, 1.5273584628327E-1, 1.5295116998021E-1, 1.5316671216115E-1, 1.5338247295528E-1, 1.5359845249161E-1, 1.5381465089900E-1, 1.5403106830613E-1, 1.5424770484152E-1, 1.5446456063353E-1, 1.5468163581032E-1, 1.5489893049993E-1, 1.5511644483018E-1, 1.5533417892875E-1, 1.5555213292314E-1, 1.5577030694069E-1, 1.5598870110853E-1, 1.5620731555366E-1, 1.5642615040288E-1, 1.5664520578282E-1, 1.5686448181993E-1, 1.5708397864049E-1, 1.5730369637061E-1, 1.5752363513619E-1, 1.5774379506298E-1, 1.5796417627655E-1, 1.5818477890227E-1, 1.5840560306535E-1, 1.5862664889079E-1, 1.5884791650343E-1, 1.5906940602791E-1, 1.5929111758871E-1, 1.5951305131010E-1, 1.5973520731618E-1, 1.5995758573083E-1, 1.6018018667780E-1, 1.6040301028059E-1, 1.6062605666255E-1, 1.6084932594682E-1, 1.6107281825637E-1, 1.6129653371396E-1, 1.6152047244216E-1, 1.6174463456334E-1, 1.6196902019970E-1, 1.6219362947321E-1, 1.6241846250568E-1, 1.6264351941870E-1, 1.6286880033367E-1, 1.6309430537179E-1, 1.6332003465405E-1, 1.6354598830127E-1, 1.6377216643404E-1, 1.6399856917275E-1, 1.6422519663761E-1, 1.6445204894861E-1, 1.6467912622554E-1, 1.6490642858797E-1, 1.6513395615530E-1, 1.6536170904669E-1, 1.6558968738111E-1, 1.6581789127731E-1, 1.6604632085384E-1, 1.6627497622903E-1, 1.6650385752103E-1, 1.6673296484773E-1, 1.6696229832686E-1, 1.6719185807588E-1, 1.6742164421209E-1, 1.6765165685255E-1, 1.6788189611409E-1, 1.6811236211336E-1, 1.6834305496676E-1, 1.6857397479049E-1, 1.6880512170053E-1, 1.6903649581262E-1, 1.6926809724232E-1, 1.6949992610492E-1, 1.6973198251553E-1, 1.6996426658901E-1, 1.7019677844001E-1, 1.7042951818295E-1, 1.7066248593202E-1, 1.7089568180119E-1, 1.7112910590421E-1, 1.7136275835458E-1, 1.7159663926559E-1, 1.7183074875029E-1, 1.7206508692152E-1, 1.7229965389185E-1, 1.7253444977366E-1, 1.7276947467906E-1, 1.7300472871995E-1, 1.7324021200798E-1, 1.7347592465459E-1, 1.7371186677095E-1, 1.7394803846801E-1, 1.7418443985648E-1, 1.7442107104683E-1, 1.7465793214929E-1, 1.7489502327385E-1, 1.7513234453026E-1, 1.7536989602802E-1, 1.7560767787640E-1, 1.7584569018440E-1, 1.7608393306080E-1, 1.7632240661413E-1, 1.7656111095267E-1, 1.7680004618444E-1, 1.7703921241723E-1, 1.7727860975856E-1, 1.7751823831573E-1, 1.7775809819576E-1, 1.7799818950542E-1, 1.7823851235125E-1, 1.7847906683951E-1, 1.7871985307623E-1, 1.7896087116715E-1, 1.7920212121779E-1, 1.7944360333338E-1, 1.7968531761893E-1, 1.7992726417915E-1, 1.8016944311851E-1, 1.8041185454122E-1, 1.8065449855123E-1, 1.8089737525222E-1, 1.8114048474761E-1, 1.8138382714055E-1, 1.8162740253392E-1, 1.8187121103036E-1, 1.8211525273221E-1, 1.8235952774157E-1, 1.8260403616024E-1, 1.8284877808978E-1, 1.8309375363147E-1, 1.8333896288630E-1, 1.8358440595502E-1, 1.8383008293807E-1, 1.8407599393565E-1, 1.8432213904766E-1, 1.8456851837374E-1, 1.8481513201323E-1, 1.8506198006522E-1, 1.8530906262851E-1, 1.8555637980161E-1, 1.8580393168276E-1, 1.8605171836991E-1, 1.8629973996074E-1, 1.8654799655265E-1, 1.8679648824272E-1, 1.8704521512779E-1, 1.8729417730439E-1, 1.8754337486876E-1, 1.8779280791685E-1, 1.8804247654435E-1, 1.8829238084663E-1, 1.8854252091877E-1, 1.8879289685558E-1, 1.8904350875156E-1, 1.8929435670091E-1, 1.8954544079755E-1, 1.8979676113511E-1, 1.9004831780690E-1, 1.9030011090596E-1, 1.9055214052500E-1, 1.9080440675647E-1, 1.9105690969248E-1, 1.9130964942488E-1, 1.9156262604517E-1, 1.9181583964459E-1, 1.9206929031405E-1, 1.9232297814418E-1, 1.9257690322527E-1, 1.9283106564733E-1, 1.9308546550005E-1, 1.9334010287282E-1, 1.9359497785473E-1, 1.9385009053452E-1, 1.9410544100067E-1, 1.9436102934130E-1, 1.9461685564426E-1, 1.9487291999705E-1, 1.9512922248688E-1, 1.9538576320063E-1, 1.9564254222488E-1, 1.9589955964586E-1, 1.9615681554951E-1, 1.9641431002144E-1, 1.9667204314694E-1, 1.9693001501099E-1, 1.9718822569822E-1, 1.9744667529296E-1, 1.9770536387921E-1, 1.9796429154063E-1, 1.9822345836059E-1, 1.9848286442209E-1, 1.9874250980782E-1, 1.9900239460016E-1, 1.9926251888112E-1, 1.9952288273241E-1, 1.9978348623540E-1, 2.0004432947112E-1, 2.0030541252028E-1, 2.0056673546323E-1, 2.0082829838001E-1, 2.0109010135032E-1, 2.0135214445350E-1, 2.0161442776857E-1, 2.0187695137422E-1, 2.0213971534877E-1, 2.0240271977022E-1, 2.0266596471623E-1, 2.0292945026409E-1, 2.0319317649078E-1, 2.0345714347291E-1, 2.0372135128675E-1, 2.0398580000823E-1, 2.0425048971292E-1, 2.0451542047605E-1, 2.0478059237249E-1, 2.0504600547677E-1, 2.0531165986306E-1, 2.0557755560518E-1, 2.0584369277659E-1, 2.0611007145041E-1, 2.0637669169938E-1, 2.0664355359590E-1, 2.0691065721201E-1, 2.0717800261939E-1, 2.0744558988936E-1, 2.0771341909286E-1, 2.0798149030051E-1, 2.0824980358253E-1, 2.0851835900879E-1, 2.0878715664879E-1, 2.0905619657168E-1, 2.0932547884622E-1, 2.0959500354081E-1, 2.0986477072348E-1, 2.1013478046191E-1, 2.1040503282339E-1, 2.1067552787483E-1, 2.1094626568279E-1, 2.1121724631344E-1, 2.1148846983258E-1, 2.1175993630563E-1, 2.1203164579764E-1, 2.1230359837329E-1, 2.1257579409686E-1, 2.1284823303226E-1, 2.1312091524303E-1, 2.1339384079231E-1, 2.1366700974287E-1, 2.1394042215709E-1, 2.1421407809698E-1, 2.1448797762414E-1, 2.1476212079980E-1, 2.1503650768480E-1, 2.1531113833958E-1, 2.1558601282422E-1, 2.1586113119838E-1, 2.1613649352133E-1, 2.1641209985196E-1, 2.1668795024877E-1, 2.1696404476985E-1, 2.1724038347291E-1, 2.1751696641525E-1, 2.1779379365378E-1, 2.1807086524500E-1, 2.1834818124504E-1, 2.1862574170959E-1, 2.1890354669397E-1, 2.1918159625308E-1, 2.1945989044143E-1, 2.1973842931311E-1, 2.2001721292182E-1, 2.2029624132084E-1, 2.2057551456305E-1, 2.2085503270093E-1, 2.2113479578652E-1, 2.2141480387149E-1, 2.2169505700707E-1, 2.2197555524408E-1, 2.2225629863295E-1, 2.2253728722367E-1, 2.2281852106582E-1, 2.2310000020857E-1, 2.2338172470067E-1, 2.2366369459046E-1, 2.2394590992583E-1, 2.2422837075429E-1, 2.2451107712290E-1, 2.2479402907831E-1, 2.2507722666675E-1, 2.2536066993402E-1, 2.2564435892548E-1, 2.2592829368608E-1, 2.2621247426036E-1, 2.2649690069239E-1, 2.2678157302585E-1, 2.2706649130395E-1, 2.2735165556952E-1, 2.2763706586490E-1, 2.2792272223204E-1, 2.2820862471244E-1, 2.2849477334715E-1, 2.2878116817682E-1, 2.2906780924163E-1, 2.2935469658134E-1, 2.2964183023525E-1, 2.2992921024224E-1, 2.3021683664074E-1, 2.3050470946874E-1, 2.3079282876378E-1, 2.3108119456297E-1, 2.3136980690296E-1, 2.3165866581995E-1, 2.3194777134972E-1, 2.3223712352757E-1, 2.3252672238836E-1, 2.3281656796651E-1, 2.3310666029599E-1, 2.3339699941029E-1, 2.3368758534247E-1, 2.3397841812514E-1, 2.3426949779043E-1, 2.3456082437004E-1, 2.3485239789521E-1, 2.3514421839669E-1, 2.3543628590480E-1, 2.3572860044941E-1, 2.3602116205988E-1, 2.3631397076517E-1, 2.3660702659372E-1, 2.3690032957354E-1, 2.3719387973216E-1, 2.3748767709666E-1, 2.3778172169363E-1, 2.3807601354920E-1, 2.3837055268904E-1, 2.3866533913833E-1, 2.3896037292180E-1, 2.3925565406369E-1, 2.3955118258778E-1, 2.3984695851737E-1, 2.4014298187528E-1, 2.4043925268385E-1, 2.4073577096495E-1, 2.4103253673999E-1, 2.4132955002985E-1, 2.4162681085499E-1, 2.4192431923534E-1, 2.4222207519037E-1, 2.4252007873906E-1, 2.4281832989991E-1, 2.4311682869093E-1, 2.4341557512965E-1, 2.4371456923310E-1, 2.4401381101784E-1, 2.4431330049991E-1, 2.4461303769490E-1, 2.4491302261787E-1, 2.4521325528342E-1, 2.4551373570563E-1, 2.4581446389809E-1, 2.4611543987391E-1, 2.4641666364569E-1, 2.4671813522554E-1, 2.4701985462506E-1, 2.4732182185536E-1, 2.4762403692705E-1, 2.4792649985023E-1, 2.4822921063450E-1, 2.4853216928897E-1, 2.4883537582222E-1, 2.4913883024235E-1, 2.4944253255693E-1, 2.4974648277305E-1, 2.5005068089726E-1, 2.5035512693563E-1, 2.5065982089369E-1, 2.5096476277648E-1, 2.5126995258852E-1, 2.5157539033382E-1, 2.5188107601588E-1, 2.5218700963766E-1, 2.5249319120163E-1, 2.5279962070973E-1, 2.5310629816338E-1, 2.5341322356350E-1, 2.5372039691046E-1, 2.5402781820412E-1, 2.5433548744383E-1, 2.5464340462841E-1, 2.5495156975614E-1, 2.5525998282479E-1, 2.5556864383160E-1, 2.5587755277329E-1, 2.5618670964603E-1, 2.5649611444549E-1, 2.5680576716678E-1, 2.5711566780450E-1, 2.5742581635271E-1, 2.5773621280493E-1, 2.5804685715416E-1, 2.5835774939286E-1, 2.5866888951294E-1, 2.5898027750580E-1, 2.5929191336226E-1, 2.5960379707265E-1, 2.5991592862673E-1, 2.6022830801371E-1, 2.6054093522229E-1, 2.6085381024060E-1, 2.6116693305623E-1, 2.6148030365624E-1, 2.6179392202713E-1, 2.6210778815486E-1, 2.6242190202482E-1, 2.6273626362190E-1, 2.6305087293038E-1, 2.6336572993404E-1, 2.6368083461608E-1, 2.6399618695914E-1, 2.6431178694534E-1, 2.6462763455621E-1, 2.6494372977274E-1, 2.6526007257537E-1, 2.6557666294398E-1, 2.6589350085786E-1, 2.6621058629579E-1, 2.6652791923596E-1, 2.6684549965600E-1, 2.6716332753298E-1, 2.6748140284341E-1, 2.6779972556323E-1, 2.6811829566782E-1, 2.6843711313200E-1, 2.6875617793000E-1, 2.6907549003550E-1, 2.6939504942160E-1, 2.6971485606085E-1, 2.7003490992521E-1, 2.7035521098607E-1, 2.7067575921424E-1, 2.7099655457999E-1, 2.7131759705296E-1, 2.7163888660227E-1, 2.7196042319643E-1, 2.7228220680338E-1, 2.7260423739047E-1, 2.7292651492449E-1, 2.7324903937165E-1, 2.7357181069756E-1, 2.7389482886725E-1, 2.7421809384518E-1, 2.7454160559522E-1, 2.7486536408066E-1, 2.7518936926418E-1, 2.7551362110790E-1, 2.7583811957334E-1, 2.7616286462143E-1, 2.7648785621252E-1, 2.7681309430636E-1, 2.7713857886210E-1, 2.7746430983831E-1, 2.7779028719297E-1, 2.7811651088346E-1, 2.7844298086655E-1, 2.7876969709843E-1, 2.7909665953469E-1, 2.7942386813033E-1, 2.7975132283973E-1, 2.8007902361668E-1, 2.8040697041438E-1, 2.8073516318541E-1, 2.8106360188175E-1, 2.8139228645479E-1, 2.8172121685531E-1, 2.8205039303346E-1, 2.8237981493882E-1, 2.8270948252035E-1, 2.8303939572639E-1, 2.8336955450467E-1, 2.8369995880234E-1, 2.8403060856589E-1, 2.8436150374125E-1, 2.8469264427370E-1, 2.8502403010791E-1, 2.8535566118797E-1, 2.8568753745730E-1, 2.8601965885874E-1, 2.8635202533451E-1, 2.8668463682620E-1, 2.8701749327479E-1, 2.8735059462064E-1, 2.8768394080348E-1, 2.8801753176241E-1, 2.8835136743595E-1, 2.8868544776194E-1, 2.8901977267764E-1, 2.8935434211966E-1, 2.8968915602399E-1, 2.9002421432599E-1, 2.9035951696041E-1, 2.9069506386135E-1, 2.9103085496228E-1, 2.9136689019605E-1, 2.9170316949487E-1, 2.9203969279034E-1, 2.9237646001340E-1, 2.9271347109435E-1, 2.9305072596290E-1, 2.9338822454807E-1, 2.9372596677827E-1, 2.9406395258128E-1, 2.9440218188423E-1, 2.9474065461361E-1, 2.9507937069527E-1, 2.9541833005442E-1, 2.9575753261564E-1, 2.9609697830285E-1, 2.9643666703933E-1, 2.9677659874773E-1, 2.9711677335003E-1, 2.9745719076758E-1, 2.9779785092110E-1, 2.9813875373062E-1, 2.9847989911555E-1, 2.9882128699466E-1, 2.9916291728604E-1, 2.9950478990715E-1, 2.9984690477479E-1, 3.0018926180511E-1, 3.0053186091361E-1, 3.0087470201513E-1, 3.0121778502385E-1, 3.0156110985331E-1, 3.0190467641639E-1, 3.0224848462529E-1, 3.0259253439157E-1, 3.0293682562614E-1, 3.0328135823924E-1, 3.0362613214043E-1, 3.0397114723865E-1, 3.0431640344213E-1, 3.0466190065848E-1, 3.0500763879462E-1, 3.0535361775681E-1, 3.0569983745064E-1, 3.0604629778106E-1, 3.0639299865231E-1, 3.0673993996800E-1, 3.0708712163105E-1, 3.0743454354372E-1, 3.0778220560760E-1, 3.0813010772359E-1, 3.0847824979194E-1, 3.0882663171223E-1, 3.0917525338335E-1, 3.0952411470351E-1, 3.0987321557028E-1, 3.1022255588052E-1, 3.1057213553043E-1, 3.1092195441553E-1, 3.1127201243065E-1, 3.1162230946997E-1, 3.1197284542695E-1, 3.1232362019440E-1, 3.1267463366445E-1, 3.1302588572853E-1, 3.1337737627740E-1, 3.1372910520113E-1, 3.1408107238912E-1, 3.1443327773005E-1, 3.1478572111197E-1, 3.1513840242219E-1, 3.1549132154736E-1, 3.1584447837345E-1, 3.1619787278571E-1, 3.1655150466874E-1, 3.1690537390642E-1, 3.1725948038195E-1, 3.1761382397784E-1, 3.1796840457592E-1, 3.1832322205729E-1, 3.1867827630240E-1, 3.1903356719098E-1, 3.1938909460206E-1, 3.1974485841401E-1, 3.2010085850447E-1, 3.2045709475038E-1, 3.2081356702801E-1, 3.2117027521292E-1, 3.2152721917995E-1, 3.2188439880328E-1, 3.2224181395635E-1, 3.2259946451193E-1, 3.2295735034207E-1, 3.2331547131812E-1, 3.2367382731073E-1, 3.2403241818985E-1, 3.2439124382472E-1, 3.2475030408388E-1, 3.2510959883515E-1, 3.2546912794566E-1, 3.2582889128184E-1, 3.2618888870937E-1, 3.2654912009328E-1, 3.2690958529785E-1, 3.2727028418665E-1, 3.2763121662258E-1, 3.2799238246777E-1, 3.2835378158369E-1, 3.2871541383107E-1, 3.2907727906994E-1, 3.2943937715960E-1, 3.2980170795866E-1, 3.3016427132498E-1, 3.3052706711575E-1, 3.3089009518741E-1, 3.3125335539569E-1, 3.3161684759561E-1, 3.3198057164147E-1, 3.3234452738685E-1, 3.3270871468461E-1, 3.3307313338689E-1, 3.3343778334512E-1, 3.3380266440998E-1, 3.3416777643147E-1, 3.3453311925883E-1, 3.3489869274061E-1, 3.3526449672460E-1, 3.3563053105791E-1, 3.3599679558689E-1, 3.3636329015718E-1, 3.3673001461369E-1, 3.3709696880061E-1, 3.3746415256140E-1, 3.3783156573878E-1, 3.3819920817477E-1, 3.3856707971064E-1, 3.3893518018694E-1, 3.3930350944348E-1, 3.3967206731935E-1, 3.4004085365291E-1, 3.4040986828179E-1, 3.4077911104288E-1, 3.4114858177234E-1, 3.4151828030560E-1, 3.4188820647736E-1, 3.4225836012158E-1, 3.4262874107148E-1, 3.4299934915957E-1, 3.4337018421760E-1, 3.4374124607660E-1, 3.4411253456684E-1, 3.4448404951788E-1, 3.4485579075853E-1, 3.4522775811686E-1, 3.4559995142021E-1, 3.4597237049518E-1, 3.4634501516762E-1, 3.4671788526266E-1, 3.4709098060466E-1, 3.4746430101727E-1, 3.4783784632339E-1, 3.4821161634515E-1, 3.4858561090398E-1, 3.4895982982055E-1, 3.4933427291478E-1, 3.4970894000586E-1, 3.5008383091221E-1, 3.5045894545154E-1, 3.5083428344080E-1, 3.5120984469618E-1, 3.5158562903315E-1, 3.5196163626641E-1, 3.5233786620993E-1, 3.5271431867694E-1, 3.5309099347989E-1, 3.5346789043051E-1, 3.5384500933977E-1, 3.5422235001790E-1, 3.5459991227438E-1, 3.5497769591792E-1, 3.5535570075651E-1, 3.5573392659737E-1, 3.5611237324698E-1, 3.5649104051105E-1, 3.5686992819456E-1, 3.5724903610173E-1, 3.5762836403602E-1, 3.5800791180016E-1, 3.5838767919609E-1, 3.5876766602504E-1, 3.5914787208744E-1, 3.5952829718301E-1, 3.5990894111068E-1, 3.6028980366865E-1, 3.6067088465435E-1, 3.6105218386445E-1, 3.6143370109489E-1, 3.6181543614082E-1, 3.6219738879665E-1, 3.6257955885604E-1, 3.6296194611189E-1, 3.6334455035632E-1, 3.6372737138072E-1, 3.6411040897571E-1, 3.6449366293114E-1, 3.6487713303613E-1, 3.6526081907901E-1, 3.6564472084737E-1, 3.6602883812803E-1, 3.6641317070706E-1, 3.6679771836976E-1, 3.6718248090066E-1, 3.6756745808355E-1, 3.6795264970146E-1, 3.6833805553663E-1, 3.6872367537056E-1, 3.6910950898399E-1, 3.6949555615689E-1, 3.6988181666846E-1, 3.7026829029715E-1, 3.7065497682064E-1, 3.7104187601586E-1, 3.7142898765894E-1, 3.7181631152529E-1, 3.7220384738953E-1, 3.7259159502552E-1, 3.7297955420636E-1, 3.7336772470438E-1, 3.7375610629114E-1, 3.7414469873745E-1, 3.7453350181335E-1, 3.7492251528810E-1, 3.7531173893020E-1, 3.7570117250740E-1, 3.7609081578666E-1, 3.7648066853419E-1, 3.7687073051542E-1, 3.7726100149503E-1, 3.7765148123692E-1, 3.7804216950423E-1, 3.7843306605931E-1, 3.7882417066378E-1, 3.7921548307847E-1, 3.7960700306343E-1, 3.7999873037797E-1, 3.8039066478061E-1, 3.8078280602912E-1, 3.8117515388048E-1, 3.8156770809092E-1, 3.8196046841588E-1, 3.8235343461006E-1, 3.8274660642736E-1, 3.8313998362094E-1, 3.8353356594316E-1, 3.8392735314564E-1, 3.8432134497920E-1, 3.8471554119393E-1, 3.8510994153911E-1, 3.8550454576327E-1, 3.8589935361416E-1, 3.8629436483879E-1, 3.8668957918335E-1, 3.8708499639330E-1, 3.8748061621332E-1, 3.8787643838730E-1, 3.8827246265839E-1, 3.8866868876894E-1, 3.8906511646055E-1, 3.8946174547405E-1, 3.8985857554949E-1, 3.9025560642614E-1, 3.9065283784252E-1, 3.9105026953637E-1, 3.9144790124465E-1, 3.9184573270356E-1, 3.9224376364854E-1, 3.9264199381423E-1, 3.9304042293453E-1, 3.9343905074254E-1, 3.9383787697060E-1, 3.9423690135030E-1, 3.9463612361243E-1, 3.9503554348702E-1, 3.9543516070333E-1, 3.9583497498984E-1, 3.9623498607428E-1, 3.9663519368359E-1, 3.9703559754395E-1, 3.9743619738076E-1, 3.9783699291865E-1, 3.9823798388149E-1, 3.9863916999238E-1, 3.9904055097362E-1, 3.9944212654678E-1, 3.9984389643263E-1, 4.0024586035118E-1, 4.0064801802168E-1, 4.0105036916259E-1, 4.0145291349162E-1, 4.0185565072568E-1, 4.0225858058095E-1, 4.0266170277282E-1, 4.0306501701589E-1, 4.0346852302402E-1, 4.0387222051030E-1, 4.0427610918702E-1, 4.0468018876575E-1, 4.0508445895723E-1, 4.0548891947149E-1, 4.0589357001776E-1, 4.0629841030449E-1, 4.0670344003939E-1, 4.0710865892938E-1, 4.0751406668063E-1, 4.0791966299853E-1, 4.0832544758769E-1, 4.0873142015199E-1, 4.0913758039450E-1, 4.0954392801754E-1, 4.0995046272268E-1, 4.1035718421069E-1, 4.1076409218159E-1, 4.1117118633465E-1, 4.1157846636834E-1, 4.1198593198038E-1, 4.1239358286773E-1, 4.1280141872658E-1, 4.1320943925234E-1, 4.1361764413968E-1, 4.1402603308248E-1, 4.1443460577388E-1, 4.1484336190623E-1, 4.1525230117114E-1, 4.1566142325943E-1, 4.1607072786118E-1, 4.1648021466568E-1, 4.1688988336149E-1, 4.1729973363638E-1, 4.1770976517737E-1, 4.1811997767071E-1, 4.1853037080189E-1, 4.1894094425564E-1, 4.1935169771594E-1, 4.1976263086598E-1, 4.2017374338821E-1, 4.2058503496431E-1, 4.2099650527521E-1, 4.2140815400107E-1, 4.2181998082130E-1, 4.2223198541454E-1, 4.2264416745868E-1, 4.2305652663084E-1, 4.2346906260739E-1, 4.2388177506393E-1, 4.2429466367533E-1, 4.2470772811568E-1, 4.2512096805831E-1, 4.2553438317580E-1, 4.2594797313999E-1, 4.2636173762193E-1, 4.2677567629195E-1, 4.2718978881960E-1, 4.2760407487368E-1, 4.2801853412225E-1, 4.2843316623260E-1, 4.2884797087127E-1, 4.2926294770405E-1, 4.2967809639598E-1, 4.3009341661135E-1, 4.3050890801368E-1, 4.3092457026575E-1, 4.3134040302960E-1, 4.3175640596651E-1, 4.3217257873700E-1, 4.3258892100087E-1, 4.3300543241713E-1, 4.3342211264407E-1, 4.3383896133923E-1, 4.3425597815940E-1, 4.3467316276061E-1, 4.3509051479816E-1, 4.3550803392660E-1, 4.3592571979973E-1, 4.3634357207060E-1, 4.3676159039152E-1, 4.3717977441408E-1, 4.3759812378909E-1, 4.3801663816662E-1, 4.3843531719603E-1, 4.3885416052591E-1, 4.3927316780412E-1, 4.3969233867776E-1, 4.4011167279322E-1, 4.4053116979614E-1, 4.4095082933139E-1, 4.4137065104315E-1, 4.4179063457484E-1, 4.4221077956912E-1, 4.4263108566796E-1, 4.4305155251256E-1, 4.4347217974339E-1, 4.4389296700019E-1, 4.4431391392196E-1, 4.4473502014698E-1, 4.4515628531278E-1, 4.4557770905616E-1, 4.4599929101320E-1, 4.4642103081924E-1, 4.4684292810888E-1, 4.4726498251602E-1, 4.4768719367379E-1, 4.4810956121463E-1, 4.4853208477022E-1, 4.4895476397153E-1, 4.4937759844880E-1, 4.4980058783155E-1, 4.5022373174856E-1, 4.5064702982790E-1, 4.5107048169691E-1, 4.5149408698221E-1, 4.5191784530968E-1, 4.5234175630450E-1, 4.5276581959113E-1, 4.5319003479328E-1, 4.5361440153398E-1, 4.5403891943552E-1, 4.5446358811946E-1, 4.5488840720667E-1, 4.5531337631728E-1, 4.5573849507072E-1, 4.5616376308570E-1, 4.5658917998021E-1, 4.5701474537152E-1, 4.5744045887622E-1, 4.5786632011014E-1, 4.5829232868844E-1, 4.5871848422555E-1, 4.5914478633519E-1, 4.5957123463038E-1, 4.5999782872342E-1, 4.6042456822591E-1, 4.6085145274874E-1, 4.6127848190210E-1, 4.6170565529547E-1, 4.6213297253763E-1, 4.6256043323666E-1, 4.6298803699992E-1, 4.6341578343408E-1, 4.6384367214512E-1, 4.6427170273830E-1, 4.6469987481820E-1, 4.6512818798868E-1, 4.6555664185293E-1, 4.6598523601342E-1, 4.6641397007194E-1, 4.6684284362958E-1, 4.6727185628673E-1, 4.6770100764309E-1, 4.6813029729768E-1, 4.6855972484882E-1, 4.6898928989413E-1, 4.6941899203056E-1, 4.6984883085436E-1, 4.7027880596109E-1, 4.7070891694565E-1, 4.7113916340221E-1, 4.7156954492429E-1, 4.7200006110472E-1, 4.7243071153564E-1, 4.7286149580851E-1, 4.7329241351411E-1, 4.7372346424256E-1, 4.7415464758326E-1, 4.7458596312497E-1, 4.7501741045575E-1, 4.7544898916301E-1, 4.7588069883346E-1, 4.7631253905314E-1, 4.7674450940744E-1, 4.7717660948104E-1, 4.7760883885799E-1, 4.7804119712164E-1, 4.7847368385470E-1, 4.7890629863918E-1, 4.7933904105644E-1, 4.7977191068718E-1, 4.8020490711144E-1, 4.8063802990857E-1, 4.8107127865729E-1, 4.8150465293563E-1, 4.8193815232098E-1, 4.8237177639007E-1, 4.8280552471897E-1, 4.8323939688308E-1, 4.8367339245716E-1, 4.8410751101531E-1, 4.8454175213099E-1, 4.8497611537698E-1, 4.8541060032543E-1, 4.8584520654783E-1, 4.8627993361504E-1, 4.8671478109724E-1, 4.8714974856399E-1, 4.8758483558420E-1, 4.8802004172612E-1, 4.8845536655738E-1, 4.8889080964496E-1, 4.8932637055518E-1, 4.8976204885375E-1, 4.9019784410572E-1, 4.9063375587552E-1, 4.9106978372692E-1, 4.9150592722309E-1, 4.9194218592653E-1, 4.9237855939913E-1, 4.9281504720215E-1, 4.9325164889620E-1, 4.9368836404129E-1, 4.9412519219677E-1, 4.9456213292138E-1, 4.9499918577325E-1, 4.9543635030987E-1, 4.9587362608810E-1, 4.9631101266419E-1, 4.9674850959377E-1, 4.9718611643185E-1, 4.9762383273282E-1, 4.9806165805046E-1, 4.9849959193792E-1, 4.9893763394775E-1, 4.9937578363190E-1, 4.9981404054167E-1, 5.0023864315706E-1, 5.0065320779805E-1, 5.0106787254264E-1, 5.0148263696430E-1, 5.0189750063596E-1, 5.0231246312997E-1, 5.0272752401808E-1, 5.0314268287153E-1, 5.0355793926094E-1, 5.0397329275639E-1, 5.0438874292739E-1, 5.0480428934290E-1, 5.0521993157130E-1, 5.0563566918043E-1, 5.0605150173754E-1, 5.0646742880936E-1, 5.0688344996204E-1, 5.0729956476118E-1, 5.0771577277183E-1, 5.0813207355848E-1, 5.0854846668508E-1, 5.0896495171503E-1, 5.0938152821116E-1, 5.0979819573579E-1, 5.1021495385066E-1, 5.1063180211699E-1, 5.1104874009544E-1, 5.1146576734615E-1, 5.1188288342869E-1, 5.1230008790211E-1, 5.1271738032493E-1, 5.1313476025512E-1, 5.1355222725012E-1, 5.1396978086684E-1, 5.1438742066164E-1, 5.1480514619039E-1, 5.1522295700838E-1, 5.1564085267041E-1, 5.1605883273075E-1, 5.1647689674312E-1, 5.1689504426075E-1, 5.1731327483632E-1, 5.1773158802201E-1, 5.1814998336947E-1, 5.1856846042984E-1, 5.1898701875373E-1, 5.1940565789126E-1, 5.1982437739200E-1, 5.2024317680504E-1, 5.2066205567896E-1, 5.2108101356180E-1, 5.2150005000113E-1, 5.2191916454400E-1, 5.2233835673694E-1, 5.2275762612599E-1, 5.2317697225670E-1, 5.2359639467410E-1, 5.2401589292274E-1, 5.2443546654666E-1, 5.2485511508941E-1, 5.2527483809404E-1, 5.2569463510312E-1, 5.2611450565871E-1, 5.2653444930240E-1, 5.2695446557529E-1, 5.2737455401798E-1, 5.2779471417060E-1, 5.2821494557278E-1, 5.2863524776370E-1, 5.2905562028202E-1, 5.2947606266594E-1, 5.2989657445321E-1, 5.3031715518105E-1, 5.3073780438625E-1, 5.3115852160510E-1, 5.3157930637345E-1, 5.3200015822666E-1, 5.3242107669962E-1, 5.3284206132676E-1, 5.3326311164204E-1, 5.3368422717898E-1, 5.3410540747062E-1, 5.3452665204953E-1, 5.3494796044785E-1, 5.3536933219724E-1, 5.3579076682892E-1, 5.3621226387365E-1, 5.3663382286174E-1, 5.3705544332305E-1, 5.3747712478701E-1, 5.3789886678256E-1, 5.3832066883825E-1, 5.3874253048214E-1, 5.3916445124187E-1, 5.3958643064465E-1, 5.4000846821724E-1, 5.4043056348595E-1, 5.4085271597668E-1, 5.4127492521489E-1, 5.4169719072560E-1, 5.4211951203340E-1, 5.4254188866247E-1, 5.4296432013655E-1, 5.4338680597896E-1, 5.4380934571258E-1, 5.4423193885990E-1, 5.4465458494297E-1, 5.4507728348342E-1, 5.4550003400247E-1, 5.4592283602094E-1, 5.4634568905921E-1, 5.4676859263728E-1, 5.4719154627470E-1, 5.4761454949066E-1, 5.4803760180392E-1, 5.4846070273282E-1, 5.4888385179533E-1, 5.4930704850900E-1, 5.4973029239100E-1, 5.5015358295808E-1, 5.5057691972660E-1, 5.5100030221254E-1, 5.5142372993149E-1, 5.5184720239862E-1, 5.5227071912875E-1, 5.5269427963630E-1, 5.5311788343529E-1, 5.5354153003939E-1, 5.5396521896185E-1, 5.5438894971557E-1, 5.5481272181307E-1, 5.5523653476649E-1, 5.5566038808758E-1, 5.5608428128775E-1, 5.5650821387803E-1, 5.5693218536906E-1, 5.5735619527114E-1, 5.5778024309419E-1, 5.5820432834779E-1, 5.5862845054112E-1, 5.5905260918305E-1, 5.5947680378205E-1, 5.5990103384625E-1, 5.6032529888345E-1, 5.6074959840107E-1, 5.6117393190618E-1, 5.6159829890551E-1, 5.6202369890547E-1, 5.6244713141207E-1, 5.6287159593104E-1, 5.6329609196771E-1, 5.6372061902713E-1, 5.6414517661397E-1, 5.6456976423258E-1, 5.6499438138698E-1, 5.6541902758086E-1, 5.6584370231759E-1, 5.6626840510018E-1, 5.6669313543136E-1, 5.6711789281350E-1, 5.6754267674866E-1, 5.6796748673860E-1, 5.6839232228474E-1, 5.6881718288819E-1, 5.6924206804975E-1, 5.6966697726990E-1, 5.7009191004883E-1, 5.7051686588641E-1, 5.7094184428219E-1, 5.7136684473544E-1, 5.7179186674512E-1, 5.7221690980989E-1, 5.7264197342810E-1, 5.7306705709783E-1, 5.7349216031685E-1, 5.7391728258263E-1, 5.7434242339237E-1, 5.7476758224297E-1, 5.7519275863104E-1, 5.7561795205291E-1, 5.7604316200464E-1, 5.7646838798199E-1, 5.7689362948046E-1, 5.7731888599526E-1, 5.7774415702134E-1, 5.7816944205335E-1, 5.7859474058571E-1, 5.7902005211253E-1, 5.7944537612770E-1, 5.7987071212480E-1, 5.8029605959718E-1, 5.8072141803791E-1, 5.8114678693981E-1, 5.8157216579546E-1, 5.8199755409716E-1, 5.8242295133696E-1, 5.8284835700668E-1, 5.8327377059788E-1, 5.8369919160187E-1, 5.8412461950973E-1, 5.8455005381228E-1, 5.8497549400011E-1, 5.8540093956357E-1, 5.8582638999278E-1, 5.8625184477762E-1, 5.8667730340774E-1, 5.8710276537256E-1, 5.8752823016128E-1, 5.8795369726286E-1, 5.8837916616605E-1, 5.8880463635938E-1, 5.8923010733114E-1, 5.8965557856942E-1, 5.9008104956209E-1, 5.9050651979682E-1, 5.9093198876105E-1, 5.9135745594202E-1, 5.9178292082677E-1, 5.9220838290211E-1, 5.9263384165468E-1, 5.9305929657091E-1, 5.9348474713700E-1, 5.9391019283901E-1, 5.9433563316275E-1, 5.9476106759389E-1, 5.9518649561786E-1, 5.9561191671994E-1, 5.9603733038520E-1, 5.9646273609854E-1, 5.9688813334467E-1, 5.9731352160814E-1, 5.9773890037329E-1, 5.9816426912432E-1, 5.9858962734522E-1, 5.9901497451984E-1, 5.9944031013185E-1, 5.9986563366475E-1, 6.0029094460188E-1, 6.0071624242641E-1, 6.0114152662136E-1, 6.0156679666959E-1, 6.0199205205379E-1, 6.0241729225652E-1, 6.0284251676017E-1, 6.0326772504698E-1, 6.0369291659905E-1, 6.0411809089834E-1, 6.0454324742666E-1, 6.0496838566567E-1, 6.0539350509690E-1, 6.0581860520175E-1, 6.0624368546147E-1, 6.0666874535719E-1, 6.0709378436991E-1, 6.0751880198048E-1, 6.0794379766967E-1, 6.0836877091807E-1, 6.0879372120619E-1, 6.0921864801441E-1, 6.0964355082297E-1, 6.1006842911204E-1, 6.1049328236163E-1, 6.1091811005168E-1, 6.1134291166198E-1, 6.1176768667225E-1, 6.1219243456208E-1, 6.1261715481099E-1, 6.1304184689836E-1, 6.1346651030349E-1, 6.1389114450560E-1, 6.1431574898380E-1, 6.1474032321710E-1, 6.1516486668445E-1, 6.1558937886468E-1, 6.1601385923656E-1, 6.1643830727878E-1, 6.1686272246991E-1, 6.1728710428850E-1, 6.1771145221298E-1, 6.1813576572173E-1, 6.1856004429304E-1, 6.1898428740516E-1, 6.1940849453623E-1, 6.1983266516437E-1, 6.2025679876761E-1, 6.2068089482393E-1, 6.2110495281124E-1, 6.2152897220742E-1, 6.2195295249026E-1, 6.2237689313753E-1, 6.2280079362693E-1, 6.2322465343614E-1, 6.2364847204276E-1, 6.2407224892436E-1, 6.2449598355850E-1, 6.2491967542265E-1, 6.2534332399428E-1, 6.2576692875081E-1, 6.2619048916965E-1, 6.2661400472815E-1, 6.2703747490366E-1, 6.2746089917348E-1, 6.2788427701492E-1, 6.2830760790523E-1, 6.2873089132168E-1, 6.2915412674150E-1, 6.2957731364191E-1, 6.3000045150012E-1, 6.3042353979334E-1, 6.3084657799877E-1, 6.3126956559359E-1, 6.3169250205499E-1, 6.3211538686016E-1, 6.3253821948629E-1, 6.3296099941058E-1, 6.3338372611022E-1, 6.3380639906243E-1, 6.3422901774442E-1, 6.3465158163343E-1, 6.3507409020670E-1, 6.3549654294152E-1, 6.3591893931515E-1, 6.3634127880491E-1, 6.3676356088813E-1, 6.3718578504218E-1, 6.3760795074443E-1, 6.3803005747231E-1, 6.3845210470328E-1, 6.3887409191481E-1, 6.3929601858444E-1, 6.3971788418974E-1, 6.4013968820830E-1, 6.4056143011779E-1, 6.4098310939591E-1, 6.4140472552039E-1, 6.4182627796905E-1, 6.4224776621974E-1, 6.4266918975036E-1, 6.4309054803889E-1, 6.4351184056335E-1, 6.4393306680183E-1, 6.4435422623249E-1, 6.4477531833354E-1, 6.4519634258329E-1, 6.4561729846009E-1, 6.4603818544237E-1, 6.4645900300866E-1, 6.4687975063755E-1, 6.4730042780769E-1, 6.4772103399786E-1, 6.4814156868688E-1, 6.4856203135368E-1, 6.4898242147728E-1, 6.4940273853679E-1, 6.4982298201140E-1, 6.5024315138042E-1, 6.5066324612323E-1, 6.5108326571935E-1, 6.5150320964836E-1, 6.5192307738997E-1, 6.5234286842399E-1, 6.5276258223035E-1, 6.5318221828908E-1, 6.5360177608032E-1, 6.5402125508434E-1, 6.5444065478152E-1, 6.5485997465238E-1, 6.5527921417752E-1, 6.5569837283771E-1, 6.5611745011383E-1, 6.5653644548688E-1, 6.5695535843801E-1, 6.5737418844849E-1, 6.5779293499974E-1, 6.5821159757330E-1, 6.5863017565088E-1, 6.5904866871430E-1, 6.5946707624554E-1, 6.5988539772674E-1, 6.6030363264018E-1, 6.6072178046828E-1, 6.6113984069363E-1, 6.6155781279898E-1, 6.6197569626722E-1, 6.6239349058142E-1, 6.6281119522480E-1, 6.6322880968075E-1, 6.6364633343284E-1, 6.6406376596479E-1, 6.6448110676050E-1, 6.6489835530406E-1, 6.6531551107970E-1, 6.6573257357187E-1, 6.6614954226518E-1, 6.6656641664442E-1, 6.6698319619458E-1, 6.6739988040082E-1, 6.6781646874851E-1, 6.6823296072320E-1, 6.6864935581063E-1, 6.6906565349675E-1, 6.6948185326769E-1, 6.6989795460981E-1, 6.7031395700965E-1, 6.7072985995397E-1, 6.7114566292971E-1, 6.7156136542406E-1, 6.7197696692440E-1, 6.7239246691832E-1, 6.7280786489363E-1, 6.7322316033837E-1, 6.7363835274079E-1, 6.7405344158937E-1, 6.7446842637281E-1, 6.7488330658004E-1, 6.7529808170021E-1, 6.7571275122273E-1, 6.7612731463721E-1, 6.7654177143352E-1, 6.7695612110176E-1, 6.7737036313227E-1, 6.7778449701563E-1, 6.7819852224267E-1, 6.7861243830448E-1, 6.7902624469237E-1, 6.7943994089793E-1, 6.7985352641298E-1, 6.8026700072962E-1, 6.8068036334019E-1, 6.8109361373730E-1, 6.8150675141381E-1, 6.8191977586287E-1, 6.8233268657787E-1, 6.8274548305248E-1, 6.8315816478064E-1, 6.8357073125658E-1, 6.8398318197477E-1, 6.8439551642999E-1, 6.8480773411729E-1, 6.8521983453200E-1, 6.8563181716972E-1, 6.8604368152637E-1, 6.8645542709813E-1, 6.8686705338148E-1, 6.8727855987320E-1, 6.8768994607035E-1, 6.8810121147029E-1, 6.8851235557070E-1, 6.8892337786954E-1, 6.8933427786508E-1, 6.8974505505589E-1, 6.9015570894085E-1, 6.9056623901916E-1, 6.9097664479033E-1, 6.9138692575417E-1, 6.9179708141082E-1, 6.9220711126073E-1, 6.9261701480468E-1, 6.9302679154377E-1, 6.9343644097941E-1, 6.9384596261336E-1, 6.9425535594769E-1, 6.9466462048481E-1, 6.9507375572748E-1, 6.9548276117875E-1, 6.9589163634206E-1, 6.9630038072115E-1, 6.9670899382012E-1, 6.9711747514342E-1, 6.9752582419582E-1, 6.9793404048247E-1, 6.9834212350884E-1, 6.9875007278078E-1, 6.9915788780447E-1, 6.9956556808646E-1, 6.9997311313366E-1, 7.0038052245333E-1, 7.0078779555310E-1, 7.0119493194097E-1, 7.0160193112528E-1, 7.0200879261478E-1, 7.0241551591856E-1, 7.0282210054609E-1, 7.0322854600722E-1, 7.0363485181217E-1, 7.0404101747154E-1, 7.0444704249633E-1, 7.0485292639789E-1, 7.0525866868798E-1, 7.0566426887873E-1, 7.0606972648268E-1, 7.0647504101275E-1, 7.0688021198224E-1, 7.0728523890487E-1, 7.0769012129474E-1, 7.0809485866635E-1, 7.0849945053462E-1, 7.0890389641485E-1, 7.0930819582276E-1, 7.0971234827447E-1, 7.1011635328651E-1, 7.1052021037582E-1, 7.1092391905977E-1, 7.1132747885612E-1, 7.1173088928307E-1, 7.1213414985922E-1, 7.1253726010360E-1, 7.1294021953567E-1, 7.1334302767531E-1, 7.1374568404282E-1, 7.1414818815894E-1, 7.1455053954483E-1, 7.1495273772211E-1, 7.1535478221280E-1, 7.1575667253937E-1, 7.1615840822474E-1, 7.1655998879227E-1, 7.1696141376574E-1, 7.1736268266941E-1, 7.1776379502795E-1, 7.1816475036651E-1, 7.1856554821068E-1, 7.1896618808648E-1, 7.1936666952044E-1, 7.1976699203948E-1, 7.2016715517103E-1, 7.2056715844296E-1, 7.2096700138360E-1, 7.2136668352175E-1, 7.2176620438667E-1, 7.2216556350810E-1, 7.2256476041624E-1, 7.2296379464177E-1, 7.2336266571583E-1, 7.2376137317005E-1, 7.2415991653653E-1, 7.2455829534786E-1, 7.2495650913709E-1, 7.2535455743778E-1, 7.2575243978396E-1, 7.2615015571014E-1, 7.2654770475133E-1, 7.2694508644304E-1, 7.2734230032125E-1, 7.2773934592245E-1, 7.2813622278362E-1, 7.2853293044225E-1, 7.2892946843631E-1, 7.2932583630429E-1, 7.2972203358518E-1, 7.3011805981846E-1, 7.3051391454414E-1, 7.3090959730272E-1, 7.3130510763523E-1, 7.3170044508320E-1, 7.3209560918868E-1, 7.3249059949422E-1, 7.3288541554292E-1, 7.3328005687838E-1, 7.3367452304472E-1, 7.3406881358659E-1, 7.3446292804917E-1, 7.3485686597815E-1, 7.3525062691977E-1, 7.3564421042079E-1, 7.3603761602851E-1, 7.3643084329074E-1, 7.3682389175587E-1, 7.3721676097278E-1, 7.3760945049093E-1, 7.3800195986030E-1, 7.3839428863142E-1, 7.3878643635535E-1, 7.3917840258373E-1, 7.3957018686871E-1, 7.3996178876301E-1, 7.4035320781992E-1, 7.4074444359324E-1, 7.4113549563736E-1, 7.4152636350721E-1, 7.4191704675830E-1, 7.4230754494668E-1, 7.4269785762896E-1, 7.4308798436233E-1, 7.4347792470453E-1, 7.4386767821389E-1, 7.4425724444928E-1, 7.4464662297017E-1, 7.4503581333657E-1, 7.4542481510909E-1, 7.4581362784892E-1, 7.4620235111779E-1, 7.4659068447805E-1, 7.4697892749262E-1, 7.4736697972498E-1, 7.4775484073923E-1, 7.4814251010002E-1, 7.4852998737262E-1, 7.4891727212286E-1, 7.4930436391718E-1, 7.4969126232261E-1, 7.5007796690676E-1, 7.5046447723785E-1, 7.5085079288470E-1, 7.5123691341672E-1, 7.5162283840391E-1, 7.5200856741689E-1, 7.5239410002689E-1, 7.5277943580571E-1, 7.5316457432580E-1, 7.5354951516018E-1, 7.5393425788250E-1, 7.5431880206703E-1, 7.5470314728863E-1, 7.5508729312280E-1, 7.5547123914562E-1, 7.5585498493383E-1, 7.5623853006476E-1, 7.5662187411637E-1, 7.5700501666724E-1, 7.5738795729658E-1, 7.5777069558423E-1, 7.5815323111063E-1, 7.5853556345687E-1, 7.5891769220468E-1, 7.5929961693640E-1, 7.5968133723500E-1, 7.6006285268411E-1, 7.6044416286798E-1, 7.6082526737149E-1, 7.6120616578017E-1, 7.6158685768019E-1, 7.6196734265836E-1, 7.6234762030213E-1, 7.6272769019961E-1, 7.6310755193952E-1, 7.6348720511127E-1, 7.6386664930490E-1, 7.6424588411110E-1, 7.6462490912121E-1, 7.6500372392722E-1, 7.6538232812180E-1, 7.6576072129825E-1, 7.6613890305053E-1, 7.6651687297327E-1, 7.6689463066175E-1, 7.6727217571193E-1, 7.6764950772042E-1, 7.6802662628448E-1, 7.6840353100207E-1, 7.6878022147180E-1, 7.6915669729293E-1, 7.6953295806542E-1, 7.6990900338990E-1, 7.7028483286766E-1, 7.7066044610065E-1, 7.7103584269154E-1, 7.7141102224364E-1, 7.7178598436094E-1, 7.7216072864814E-1, 7.7253525471058E-1, 7.7290956215432E-1, 7.7328365058608E-1, 7.7365751961327E-1, 7.7403116884399E-1, 7.7440459788704E-1, 7.7477780635187E-1, 7.7515079384867E-1, 7.7552355998828E-1, 7.7589610438226E-1, 7.7626842664285E-1, 7.7664052638300E-1, 7.7701240321634E-1, 7.7738405675720E-1, 7.7775548662062E-1, 7.7812669242234E-1, 7.7849767377879E-1, 7.7886843030712E-1, 7.7923896162516E-1, 7.7960926735146E-1, 7.7997934710529E-1, 7.8034920050661E-1, 7.8071882717609E-1, 7.8108822673512E-1, 7.8145739880579E-1, 7.8182634301092E-1, 7.8219505897401E-1, 7.8256354631933E-1, 7.8293180467180E-1, 7.8329983365713E-1, 7.8366763290168E-1, 7.8403520203257E-1, 7.8440254067764E-1, 7.8476964846544E-1, 7.8513652502525E-1, 7.8550316998707E-1, 7.8586958298163E-1, 7.8623576364039E-1, 7.8660171159552E-1, 7.8696742647995E-1, 7.8733290792731E-1, 7.8769815557198E-1, 7.8806316904906E-1, 7.8842794799440E-1, 7.8879249204458E-1, 7.8915680083689E-1, 7.8952087400940E-1, 7.8988471120088E-1, 7.9024831205087E-1, 7.9061167619962E-1, 7.9097480328815E-1, 7.9133769295820E-1, 7.9170034485226E-1, 7.9206275861358E-1, 7.9242493388613E-1, 7.9278687031465E-1, 7.9314856754460E-1, 7.9351002522221E-1, 7.9387124299447E-1, 7.9423222050909E-1, 7.9459295741454E-1, 7.9495345336007E-1, 7.9531370799565E-1, 7.9567372097201E-1, 7.9603349194066E-1, 7.9639302055385E-1, 7.9675230646457E-1, 7.9711134932659E-1, 7.9747014879445E-1, 7.9782870452342E-1, 7.9818701616956E-1, 7.9854508338968E-1, 7.9890290584134E-1, 7.9926048318289E-1, 7.9961781507342E-1, 7.9997490117281E-1, 8.0033174114170E-1, 8.0068833464148E-1, 8.0104468133434E-1, 8.0140078088321E-1, 8.0175663295180E-1, 8.0211223720461E-1, 8.0246759330689E-1, 8.0282270092467E-1, 8.0317755972477E-1, 8.0353216937475E-1, 8.0388652954297E-1, 8.0424063989858E-1, 8.0459450011147E-1, 8.0494810985235E-1, 8.0530146879268E-1, 8.0565457660471E-1, 8.0600743296148E-1, 8.0636003753679E-1, 8.0671239000524E-1, 8.0706449004222E-1, 8.0741633732388E-1, 8.0776793152718E-1, 8.0811927232985E-1, 8.0847035941041E-1, 8.0882119244818E-1, 8.0917177112325E-1, 8.0952209511650E-1, 8.0987216410963E-1, 8.1022197778509E-1, 8.1057153582614E-1, 8.1092083791684E-1, 8.1126988374204E-1, 8.1161867298737E-1, 8.1196720533926E-1, 8.1231548048494E-1, 8.1266349811245E-1, 8.1301125791059E-1, 8.1335875956900E-1, 8.1370600277808E-1, 8.1405298722905E-1, 8.1439971261393E-1, 8.1474617862553E-1, 8.1509238495747E-1, 8.1543833130416E-1, 8.1578401736083E-1, 8.1612944282351E-1, 8.1647460738901E-1, 8.1681951075497E-1, 8.1716415261983E-1, 8.1750853268282E-1, 8.1785265064399E-1, 8.1819650620421E-1, 8.1854009906513E-1, 8.1888342892922E-1, 8.1922649549976E-1, 8.1956929848085E-1, 8.1991183757737E-1, 8.2025411249504E-1, 8.2059612294037E-1, 8.2093786862071E-1, 8.2127934924420E-1, 8.2162056451978E-1, 8.2196151415724E-1, 8.2230219786716E-1, 8.2264261536094E-1, 8.2298276635079E-1, 8.2332265054975E-1, 8.2366226767165E-1, 8.2400161743117E-1, 8.2434069954379E-1, 8.2467951372581E-1, 8.2501805969433E-1, 8.2535633716731E-1, 8.2569434586349E-1, 8.2603208550246E-1, 8.2636955580460E-1, 8.2670675649115E-1, 8.2704368728412E-1, 8.2738034790640E-1, 8.2771673808166E-1, 8.2805285753440E-1, 8.2838870598997E-1, 8.2872428317450E-1, 8.2905958881498E-1, 8.2939462263922E-1, 8.2972938437584E-1, 8.3006387375429E-1, 8.3039809050486E-1, 8.3073203435864E-1, 8.3106570504759E-1, 8.3139910230445E-1, 8.3173222586281E-1, 8.3206507545710E-1, 8.3239765082255E-1, 8.3272995169524E-1, 8.3306197781208E-1, 8.3339372891080E-1, 8.3372520472996E-1, 8.3405640500896E-1, 8.3438732948802E-1, 8.3471797790820E-1, 8.3504835001139E-1, 8.3537844554031E-1, 8.3570826423850E-1, 8.3603780585036E-1, 8.3636707012111E-1, 8.3669605679679E-1, 8.3702476562428E-1, 8.3735319635132E-1, 8.3768134872645E-1, 8.3800922249907E-1, 8.3833681741938E-1, 8.3866413323846E-1, 8.3899116970819E-1, 8.3931792658131E-1, 8.3964440361138E-1, 8.3997060055279E-1, 8.4029651716081E-1, 8.4062215319148E-1, 8.4094750840174E-1, 8.4127258254932E-1, 8.4159737539282E-1, 8.4192188669166E-1, 8.4224611620610E-1, 8.4257006369725E-1, 8.4289372892704E-1, 8.4321711165826E-1, 8.4354021165453E-1, 8.4386302868029E-1, 8.4418556250085E-1, 8.4450781288235E-1, 8.4482977959175E-1, 8.4515146239689E-1, 8.4547286106640E-1, 8.4579397536979E-1, 8.4611480507740E-1, 8.4643534996040E-1, 8.4675560979082E-1, 8.4707558434151E-1, 8.4739527338617E-1, 8.4771467669935E-1, 8.4803379405642E-1, 8.4835262523363E-1, 8.4867117000802E-1, 8.4898942815751E-1, 8.4930739946086E-1, 8.4962508369764E-1, 8.4994248064831E-1, 8.5025959009413E-1, 8.5057641181723E-1, 8.5089294560057E-1, 8.5120919122795E-1, 8.5152514848401E-1, 8.5184081715426E-1, 8.5215619702502E-1, 8.5247128788347E-1, 8.5278608951762E-1, 8.5310060171634E-1, 8.5341482426933E-1, 8.5372875696715E-1, 8.5404239960117E-1, 8.5435575196363E-1, 8.5466881384762E-1, 8.5498158504704E-1, 8.5529406535667E-1, 8.5560625457211E-1, 8.5591815248981E-1, 8.5622975890705E-1, 8.5654107362199E-1, 8.5685209643360E-1, 8.5716282714169E-1, 8.5747326554694E-1, 8.5778341145085E-1, 8.5809326465578E-1, 8.5840282496491E-1, 8.5871209218230E-1, 8.5902106611281E-1, 8.5932974656218E-1, 8.5963813333697E-1, 8.5994622624458E-1, 8.6025402509328E-1, 8.6056152969215E-1, 8.6086873985114E-1, 8.6117565538102E-1, 8.6148227609342E-1, 8.6178860180080E-1, 8.6209463231647E-1, 8.6240036745458E-1, 8.6270580703011E-1, 8.6301095085892E-1, 8.6331579875766E-1, 8.6362035054385E-1, 8.6392460603586E-1, 8.6422856505289E-1, 8.6453222741497E-1, 8.6483559294299E-1, 8.6513866145867E-1, 8.6544143278458E-1, 8.6574390674413E-1, 8.6604608316155E-1, 8.6634796186193E-1, 8.6664954267121E-1, 8.6695082541615E-1, 8.6725180992434E-1, 8.6755249602425E-1, 8.6785288354516E-1, 8.6815297231719E-1, 8.6845276217130E-1, 8.6875225293930E-1, 8.6905144445384E-1, 8.6935033654838E-1, 8.6964892905726E-1, 8.6994722181562E-1, 8.7024521465946E-1, 8.7054290742561E-1, 8.7084029995175E-1, 8.7113739207637E-1, 8.7143418363883E-1, 8.7173067447930E-1, 8.7202686443880E-1, 8.7232275335918E-1, 8.7261834108313E-1, 8.7291362745417E-1, 8.7320861231667E-1, 8.7350329551581E-1, 8.7379767689763E-1, 8.7409175630899E-1, 8.7438553359758E-1, 8.7467900861195E-1, 8.7497218120144E-1, 8.7526505121626E-1, 8.7555761850745E-1, 8.7584988292686E-1, 8.7614184432719E-1, 8.7643350256197E-1, 8.7672485748556E-1, 8.7701590895314E-1, 8.7730665682075E-1, 8.7759710094522E-1, 8.7788724118425E-1, 8.7817707739635E-1, 8.7846660944085E-1, 8.7875583717794E-1, 8.7904476046860E-1, 8.7933337917466E-1, 8.7962169315879E-1, 8.7990970228447E-1, 8.8019740641600E-1, 8.8048480541853E-1, 8.8077189915801E-1, 8.8105868750125E-1, 8.8134517031585E-1, 8.8163134747025E-1, 8.8191721883373E-1, 8.8220278427638E-1, 8.8248804366910E-1, 8.8277299688364E-1, 8.8305764379255E-1, 8.8334198426923E-1, 8.8362601818787E-1, 8.8390974542352E-1, 8.8419316585200E-1, 8.8447627935001E-1, 8.8475908579502E-1, 8.8504158506535E-1, 8.8532377704012E-1, 8.8560566159930E-1, 8.8588723862364E-1, 8.8616850799474E-1, 8.8644946959499E-1, 8.8673012330762E-1, 8.8701046901667E-1, 8.8729050660698E-1, 8.8757023596424E-1, 8.8784965697492E-1, 8.8812876952632E-1, 8.8840757350657E-1, 8.8868606880457E-1, 8.8896425531008E-1, 8.8924213291365E-1, 8.8951970150665E-1, 8.8979696098124E-1, 8.9007391123042E-1, 8.9035055214798E-1, 8.9062688362854E-1, 8.9090290556751E-1, 8.9117861786112E-1, 8.9145402040639E-1, 8.9172911310118E-1, 8.9200389584413E-1, 8.9227836853470E-1, 8.9255253107315E-1, 8.9282638336054E-1, 8.9309992529875E-1, 8.9337315679045E-1, 8.9364607773913E-1, 8.9391868804907E-1, 8.9419098762534E-1, 8.9446297637385E-1, 8.9473465420127E-1, 8.9500602101509E-1, 8.9527707672362E-1, 8.9554782123592E-1, 8.9581825446189E-1, 8.9608837631222E-1, 8.9635818669839E-1, 8.9662768553268E-1, 8.9689687272816E-1, 8.9716574819871E-1, 8.9743431185898E-1, 8.9770256362446E-1, 8.9797050341138E-1, 8.9823813113679E-1, 8.9850544671854E-1, 8.9877245007526E-1, 8.9903914112637E-1, 8.9930551979208E-1, 8.9957158599339E-1, 8.9983733965211E-1, 9.0010278069080E-1, 9.0036790903284E-1, 9.0063272460238E-1, 9.0089722732436E-1, 9.0116141712451E-1, 9.0142529392934E-1, 9.0168885766615E-1, 9.0195210826301E-1, 9.0221504564879E-1, 9.0247766975313E-1, 9.0273998050645E-1, 9.0300197783997E-1, 9.0326366168567E-1, 9.0352503197631E-1, 9.0378608864544E-1, 9.0404683162738E-1, 9.0430726085722E-1, 9.0456737627085E-1, 9.0482717780491E-1, 9.0508666539682E-1, 9.0534583898478E-1, 9.0560469850777E-1, 9.0586324390554E-1, 9.0612147511858E-1, 9.0637939208821E-1, 9.0663699475646E-1, 9.0689428306616E-1, 9.0715125696092E-1, 9.0740791638510E-1, 9.0766426128381E-1, 9.0792029160297E-1, 9.0817600728924E-1, 9.0843140829003E-1, 9.0868649455354E-1, 9.0894126602872E-1, 9.0919572266529E-1, 9.0944986441373E-1, 9.0970369122527E-1, 9.0995720305191E-1, 9.1021039984641E-1, 9.1046328156228E-1, 9.1071584815380E-1, 9.1096809957600E-1, 9.1122003578465E-1, 9.1147165673631E-1, 9.1172296238826E-1, 9.1197395269855E-1, 9.1222462762598E-1, 9.1247498713010E-1, 9.1272503117122E-1, 9.1297475971038E-1, 9.1322417270939E-1, 9.1347327013080E-1, 9.1372205193790E-1, 9.1397051809473E-1, 9.1421866856609E-1, 9.1446650331751E-1, 9.1471402231526E-1, 9.1496122552636E-1, 9.1520811291859E-1, 9.1545468446043E-1, 9.1570094012114E-1, 9.1594687987070E-1, 9.1619250367982E-1, 9.1643781151998E-1, 9.1668280336336E-1, 9.1692747918291E-1, 9.1717183895227E-1, 9.1741588264587E-1, 9.1765961023883E-1, 9.1790302170702E-1, 9.1814611702704E-1, 9.1838889617621E-1, 9.1863135913260E-1, 9.1887350587499E-1, 9.1911533638291E-1, 9.1935685063658E-1, 9.1959804861698E-1, 9.1983893030580E-1, 9.2007949568545E-1, 9.2031974473908E-1, 9.2055967745055E-1, 9.2079929380444E-1, 9.2103859378606E-1, 9.2127757738142E-1, 9.2151624457728E-1, 9.2175459536107E-1, 9.2199262972099E-1, 9.2223034764593E-1, 9.2246774912548E-1, 9.2270483414996E-1, 9.2294160271041E-1, 9.2317805479858E-1, 9.2341419040690E-1, 9.2365000952856E-1, 9.2388551215741E-1, 9.2412069828804E-1, 9.2435556791574E-1, 9.2459012103649E-1, 9.2482435764700E-1, 9.2505827774467E-1, 9.2529188132760E-1, 9.2552516839460E-1, 9.2575813894517E-1, 9.2599079297952E-1, 9.2622313049856E-1, 9.2645515150389E-1, 9.2668685599782E-1, 9.2691824398333E-1, 9.2714931546411E-1, 9.2738007044457E-1, 9.2761050892976E-1, 9.2784063092547E-1, 9.2807043643815E-1, 9.2829992547496E-1, 9.2852909804373E-1, 9.2875795415299E-1, 9.2898649381195E-1, 9.2921471703052E-1, 9.2944262381928E-1, 9.2967021418950E-1, 9.2989748815313E-1, 9.3012444572279E-1, 9.3035108691181E-1, 9.3057741173418E-1, 9.3080342020456E-1, 9.3102911233831E-1, 9.3125448815146E-1, 9.3147954766069E-1, 9.3170429088339E-1, 9.3192871783760E-1, 9.3215282854205E-1, 9.3237662301612E-1, 9.3260010127988E-1, 9.3282326335406E-1, 9.3304610926005E-1, 9.3326863901992E-1, 9.3349085265641E-1, 9.3371275019290E-1, 9.3393433165346E-1, 9.3415559706281E-1, 9.3437654644634E-1, 9.3459717983008E-1, 9.3481749724075E-1, 9.3503749870570E-1, 9.3525718425295E-1, 9.3547655391118E-1, 9.3569560770972E-1, 9.3591434567856E-1, 9.3613276784833E-1, 9.3635087425032E-1, 9.3656866491647E-1, 9.3678613987938E-1, 9.3700329917227E-1, 9.3722014282905E-1, 9.3743667088422E-1, 9.3765288337299E-1, 9.3786878033116E-1, 9.3808436179521E-1, 9.3829962780223E-1, 9.3851457838998E-1, 9.3872921359684E-1, 9.3894353346185E-1, 9.3915753802465E-1, 9.3937122732556E-1, 9.3958460140551E-1, 9.3979766030606E-1, 9.4001040406943E-1, 9.4022283273843E-1, 9.4043494635655E-1, 9.4064674496787E-1, 9.4085822861712E-1, 9.4106939734964E-1, 9.4128025121142E-1, 9.4149079024906E-1, 9.4170101450978E-1, 9.4191092404144E-1, 9.4212051889250E-1, 9.4232979911205E-1, 9.4253876474982E-1, 9.4274741585612E-1, 9.4295575248191E-1, 9.4316377467874E-1, 9.4337148249880E-1, 9.4357887599488E-1, 9.4378595522038E-1, 9.4399272023931E-1, 9.4419917107632E-1, 9.4440530781662E-1, 9.4461113050607E-1, 9.4481663920111E-1, 9.4502183395881E-1, 9.4522671483682E-1, 9.4543128189341E-1, 9.4563553518745E-1, 9.4583947477840E-1, 9.4604310072633E-1, 9.4624641309192E-1, 9.4644941193641E-1, 9.4665209732169E-1, 9.4685446931020E-1, 9.4705652796499E-1, 9.4725827334971E-1, 9.4745970552859E-1, 9.4766082456647E-1, 9.4786163052876E-1, 9.4806212348145E-1, 9.4826230349116E-1, 9.4846217062504E-1, 9.4866172495087E-1, 9.4886096653699E-1, 9.4905989545234E-1, 9.4925851176641E-1, 9.4945681554931E-1, 9.4965480687170E-1, 9.4985248580482E-1, 9.5004985242051E-1, 9.5024690679117E-1, 9.5044364898976E-1, 9.5064007908983E-1, 9.5083619716550E-1, 9.5103200329147E-1, 9.5122749754299E-1, 9.5142267999588E-1, 9.5161755072655E-1, 9.5181210981195E-1, 9.5200635732961E-1, 9.5220029335761E-1, 9.5239391797462E-1, 9.5258723125983E-1, 9.5278023329303E-1, 9.5297292415454E-1, 9.5316530392526E-1, 9.5335737268662E-1, 9.5354913052064E-1, 9.5374057750986E-1, 9.5393171373739E-1, 9.5412253928690E-1, 9.5431305424258E-1, 9.5450325868921E-1, 9.5469315271208E-1, 9.5488273639705E-1, 9.5507200983053E-1, 9.5526097309945E-1, 9.5544962629130E-1, 9.5563796949411E-1, 9.5582600279645E-1, 9.5601372628744E-1, 9.5620114005671E-1, 9.5638824419446E-1, 9.5657503879140E-1, 9.5676152393880E-1, 9.5694769972843E-1, 9.5713356625264E-1, 9.5731912360426E-1, 9.5750437187668E-1, 9.5768931116381E-1, 9.5787394156010E-1, 9.5805826316051E-1, 9.5824227606052E-1, 9.5842598035617E-1, 9.5860937614397E-1, 9.5879246352100E-1, 9.5897524258483E-1, 9.5915771343357E-1, 9.5933987616582E-1, 9.5952173088072E-1, 9.5970327767792E-1, 9.5988451665759E-1, 9.6006544792039E-1, 9.6024607156752E-1, 9.6042638770067E-1, 9.6060639642205E-1, 9.6078609783439E-1, 9.6096549204089E-1, 9.6114457914529E-1, 9.6132335925182E-1, 9.6150183246522E-1, 9.6167999889073E-1, 9.6185785863407E-1, 9.6203541180150E-1, 9.6221265849975E-1, 9.6238959883606E-1, 9.6256623291814E-1, 9.6274256085424E-1, 9.6291858275306E-1, 9.6309429872381E-1, 9.6326970887621E-1, 9.6344481332043E-1, 9.6361961216716E-1, 9.6379410552757E-1, 9.6396829351331E-1, 9.6414217623651E-1, 9.6431575380981E-1, 9.6448902634630E-1, 9.6466199395956E-1, 9.6483465676368E-1, 9.6500701487319E-1, 9.6517906840311E-1, 9.6535081746894E-1, 9.6552226218665E-1, 9.6569340267270E-1, 9.6586423904400E-1, 9.6603477141795E-1, 9.6620499991241E-1, 9.6637492464571E-1, 9.6654454573664E-1, 9.6671386330447E-1, 9.6688287746895E-1, 9.6705158835025E-1, 9.6721999606904E-1, 9.6738810074643E-1, 9.6755590250401E-1, 9.6772340146382E-1, 9.6789059774836E-1, 9.6805749148057E-1, 9.6822408278387E-1, 9.6839037178212E-1, 9.6855635859964E-1, 9.6872204336120E-1, 9.6888742619202E-1, 9.6905250721776E-1, 9.6921728656455E-1, 9.6938176435895E-1, 9.6954594072797E-1, 9.6970981579906E-1, 9.6987338970013E-1, 9.7003666255951E-1, 9.7019963450598E-1, 9.7036230566877E-1, 9.7052467617752E-1, 9.7068674616235E-1, 9.7084851575379E-1, 9.7100998508279E-1, 9.7117115428076E-1, 9.7133202347954E-1, 9.7149259281138E-1, 9.7165286240898E-1, 9.7181283240547E-1, 9.7197250293439E-1, 9.7213187412973E-1, 9.7229094612588E-1, 9.7244971905766E-1, 9.7260819306033E-1, 9.7276636826955E-1, 9.7292424482142E-1, 9.7308182285244E-1, 9.7323910249954E-1, 9.7339608390005E-1, 9.7355276719175E-1, 9.7370915251279E-1, 9.7386524000177E-1, 9.7402102979768E-1, 9.7417652203992E-1, 9.7433171686832E-1, 9.7448661442309E-1, 9.7464121484487E-1, 9.7479551827469E-1, 9.7494952485399E-1, 9.7510323472462E-1, 9.7525664802882E-1, 9.7540976490924E-1, 9.7556258550891E-1, 9.7571510997130E-1, 9.7586733844023E-1, 9.7601927105994E-1, 9.7617090797506E-1, 9.7632224933063E-1, 9.7647329527205E-1, 9.7662404594513E-1, 9.7677450149608E-1, 9.7692466207147E-1, 9.7707452781828E-1, 9.7722409888387E-1, 9.7737337541599E-1, 9.7752235756276E-1, 9.7767104547269E-1, 9.7781943929468E-1, 9.7796753917800E-1, 9.7811534527230E-1, 9.7826285772761E-1, 9.7841007669433E-1, 9.7855700232325E-1, 9.7870363476552E-1, 9.7884997417267E-1, 9.7899602069660E-1, 9.7914177448958E-1, 9.7928723570424E-1, 9.7943240449361E-1, 9.7957728101104E-1, 9.7972186541029E-1, 9.7986615784545E-1, 9.8001015847100E-1, 9.8015386744176E-1, 9.8029728491293E-1, 9.8044041104006E-1, 9.8058324597906E-1, 9.8072578988619E-1, 9.8086804291809E-1, 9.8101000523171E-1, 9.8115167698441E-1, 9.8129305833387E-1, 9.8143414943811E-1, 9.8157495045553E-1, 9.8171546154486E-1, 9.8185568286519E-1, 9.8199561457595E-1, 9.8213525683691E-1, 9.8227460980819E-1, 9.8241367365025E-1, 9.8255244852391E-1, 9.8269093459030E-1, 9.8282913201091E-1, 9.8296704094757E-1, 9.8310466156243E-1, 9.8324199401800E-1, 9.8337903847710E-1, 9.8351579510291E-1, 9.8365226405892E-1, 9.8378844550895E-1, 9.8392433961718E-1, 9.8405994654808E-1, 9.8419526646648E-1, 9.8433029953752E-1, 9.8446504592666E-1, 9.8459950579970E-1, 9.8473367932277E-1, 9.8486756666229E-1, 9.8500116798502E-1, 9.8513448345804E-1, 9.8526751324876E-1, 9.8540025752488E-1, 9.8553271645444E-1, 9.8566489020578E-1, 9.8579677894757E-1, 9.8592838284877E-1, 9.8605970207866E-1, 9.8619073680685E-1, 9.8632148720324E-1, 9.8645195343803E-1, 9.8658213568175E-1, 9.8671203410523E-1, 9.8684164887958E-1, 9.8697098017624E-1, 9.8710002816695E-1, 9.8722879302375E-1, 9.8735727491896E-1, 9.8748547402522E-1, 9.8761339051547E-1, 9.8774102456294E-1, 9.8786837634114E-1, 9.8799544602390E-1, 9.8812223378533E-1, 9.8824873979983E-1, 9.8837496424210E-1, 9.8850090728711E-1, 9.8862656911016E-1, 9.8875194988678E-1, 9.8887704979284E-1, 9.8900186900445E-1, 9.8912640769805E-1, 9.8925066605032E-1, 9.8937464423825E-1, 9.8949834243910E-1, 9.8962176083040E-1, 9.8974489958998E-1, 9.8986775889593E-1, 9.8999033892663E-1, 9.9011263986072E-1, 9.9023466187712E-1, 9.9035640515503E-1, 9.9047786987391E-1, 9.9059905621350E-1, 9.9071996435380E-1, 9.9084059447509E-1, 9.9096094675790E-1, 9.9108102138305E-1, 9.9120081853160E-1, 9.9132033838490E-1, 9.9143958112453E-1, 9.9155854693236E-1, 9.9167723599051E-1, 9.9179564848136E-1, 9.9191378458755E-1, 9.9203164449196E-1, 9.9214922837776E-1, 9.9226653642834E-1, 9.9238356882737E-1, 9.9250032575876E-1, 9.9261680740667E-1, 9.9273301395552E-1, 9.9284894558998E-1, 9.9296460249494E-1, 9.9307998485558E-1, 9.9319509285730E-1, 9.9330992668575E-1, 9.9342448652683E-1, 9.9353877256666E-1, 9.9365278499164E-1, 9.9376652398839E-1, 9.9387998974375E-1, 9.9399318244483E-1, 9.9410610227897E-1, 9.9421874943374E-1, 9.9433112409694E-1, 9.9444322645662E-1, 9.9455505670105E-1, 9.9466661501873E-1, 9.9477790159842E-1, 9.9488891662906E-1, 9.9499966029987E-1, 9.9511013280025E-1, 9.9522033431988E-1, 9.9533026504861E-1, 9.9543992517656E-1, 9.9554931489404E-1, 9.9565843439161E-1, 9.9576728386002E-1, 9.9587586349028E-1, 9.9598417347358E-1, 9.9609221400136E-1, 9.9619998526525E-1, 9.9630748745712E-1, 9.9641472076904E-1, 9.9652168539329E-1, 9.9662838152239E-1, 9.9673480934903E-1, 9.9684096906615E-1, 9.9694686086688E-1, 9.9705248494455E-1, 9.9715784149273E-1, 9.9726293070516E-1, 9.9736775277581E-1, 9.9747230789884E-1, 9.9757659626862E-1, 9.9768061807973E-1, 9.9778437352693E-1, 9.9788786280521E-1, 9.9799108610974E-1, 9.9809404363588E-1, 9.9819673557921E-1, 9.9829916213549E-1, 9.9840132350068E-1, 9.9850321987094E-1, 9.9860485144261E-1, 9.9870621841223E-1, 9.9880732097654E-1, 9.9890815933245E-1, 9.9900873367707E-1, 9.9910904420771E-1, 9.9920909112185E-1, 9.9930887461716E-1, 9.9940839489149E-1, 9.9950765214288E-1, 9.9960664656957E-1, 9.9970537836995E-1, 9.9980384774261E-1, 9.9990205488631E-1, 1.0000000000000E+0};
 constexpr std::array<float, lut_size> medium_low_contrast{0.0000000000000E+0, 2.2547506131860E-5, 4.5132073901206E-5, 6.7753762938042E-5, 9.0412632963947E-5, 1.1310874379219E-4, 1.3584215532786E-4, 1.5861292756800E-4, 1.8142112060171E-4, 2.0426679461029E-4, 2.2715000986738E-4, 2.5007082673907E-4, 2.7302930568399E-4, 2.9602550725352E-4, 3.1905949209184E-4, 3.4213132093611E-4, 3.6524105461655E-4, 3.8838875405662E-4, 4.1157448027309E-4, 4.3479829437621E-4, 4.5806025756983E-4, 4.8136043115151E-4, 5.0469887651266E-4, 5.2807565513868E-4, 5.5149082860905E-4, 5.7494445859749E-4, 5.9843660687211E-4, 6.2196733529546E-4, 6.4553670582475E-4, 6.6914478051192E-4, 6.9279162150377E-4, 7.1647729104213E-4, 7.4020185146394E-4, 7.6396536520142E-4, 7.8776789478217E-4, 8.1160950282930E-4, 8.3549025206159E-4, 8.5941020529359E-4, 8.8336942543575E-4, 9.0736797549456E-4, 9.3140591857269E-4, 9.5548331786910E-4, 9.7960023667917E-4, 1.0037567383949E-3, 1.0279528865048E-3, 1.0521887445944E-3, 1.0764643763461E-3, 1.1007798455393E-3, 1.1251352160509E-3, 1.1495305518547E-3, 1.1739659170223E-3, 1.1984413757228E-3, 1.2229569922231E-3, 1.2475128308878E-3, 1.2721089561796E-3, 1.2967454326595E-3, 1.3214223249864E-3, 1.3461396979179E-3, 1.3708976163099E-3, 1.3956961451172E-3, 1.4205353493932E-3, 1.4454152942902E-3, 1.4703360450598E-3, 1.4952976670524E-3, 1.5203002257181E-3, 1.5453437866062E-3, 1.5704284153657E-3, 1.5955541777452E-3, 1.6207211395934E-3, 1.6459293668586E-3, 1.6711789255896E-3, 1.6964698819352E-3, 1.7218023021447E-3, 1.7471762525678E-3, 1.7725917996550E-3, 1.7980490099575E-3, 1.8235479501274E-3, 1.8490886869179E-3, 1.8746712871834E-3, 1.9002958178795E-3, 1.9259623460634E-3, 1.9516709388939E-3, 1.9774216636313E-3, 2.0032145876379E-3, 2.0290497783782E-3, 2.0549273034185E-3, 2.0808472304275E-3, 2.1068096271763E-3, 2.1328145615386E-3, 2.1588621014906E-3, 2.1849523151114E-3, 2.2110852705831E-3, 2.2372610361908E-3, 2.2634796803229E-3, 2.2897412714709E-3, 2.3160458782300E-3, 2.3423935692991E-3, 2.3687844134807E-3, 2.3952184796811E-3, 2.4216958369109E-3, 2.4482165542847E-3, 2.4747807010214E-3, 2.5013883464442E-3, 2.5280395599813E-3, 2.5547344111652E-3, 2.5814729696334E-3, 2.6082553051284E-3, 2.6350814874979E-3, 2.6619515866946E-3, 2.6888656727768E-3, 2.7158238159084E-3, 2.7428260863589E-3, 2.7698725545034E-3, 2.7969632908233E-3, 2.8240983659059E-3, 2.8512778504447E-3, 2.8785018152397E-3, 2.9057703311972E-3, 2.9330834693304E-3, 2.9604413007591E-3, 2.9878438967100E-3, 3.0152913285169E-3, 3.0427836676209E-3, 3.0703209855704E-3, 3.0979033540210E-3, 3.1255308447364E-3, 3.1532035295876E-3, 3.1809214805537E-3, 3.2086847697219E-3, 3.2364934692873E-3, 3.2643476515538E-3, 3.2922473889331E-3, 3.3201927539461E-3, 3.3481838192220E-3, 3.3762206574991E-3, 3.4043033416246E-3, 3.4324319445550E-3, 3.4606065393558E-3, 3.4888271992023E-3, 3.5170939973790E-3, 3.5454070072805E-3, 3.5737663024110E-3, 3.6021719563846E-3, 3.6306240429258E-3, 3.6591226358693E-3, 3.6876678091601E-3, 3.7162596368539E-3, 3.7448981931169E-3, 3.7735835522265E-3, 3.8023157885707E-3, 3.8310949766487E-3, 3.8599211910713E-3, 3.8887945065603E-3, 3.9177149979492E-3, 3.9466827401833E-3, 3.9756978083195E-3, 4.0047602775270E-3, 4.0338702230867E-3, 4.0630277203922E-3, 4.0922328449492E-3, 4.1214856723760E-3, 4.1507862784037E-3, 4.1801347388762E-3, 4.2095311297502E-3, 4.2389755270957E-3, 4.2684680070960E-3, 4.2980086460477E-3, 4.3275975203609E-3, 4.3572347065595E-3, 4.3869202812811E-3, 4.4166543212775E-3, 4.4464369034145E-3, 4.4762681046719E-3, 4.5061480021445E-3, 4.5360766730410E-3, 4.5660541946853E-3, 4.5960806445159E-3, 4.6261561000863E-3, 4.6562806390652E-3, 4.6864543392364E-3, 4.7166772784994E-3, 4.7469495348691E-3, 4.7772711864760E-3, 4.8076423115666E-3, 4.8380629885034E-3, 4.8685332957650E-3, 4.8990533119462E-3, 4.9296231157583E-3, 4.9602427860294E-3, 4.9909124017038E-3, 5.0216320418432E-3, 5.0524017856259E-3, 5.0832217123477E-3, 5.1140919014214E-3, 5.1450124323775E-3, 5.1759833848639E-3, 5.2070048386463E-3, 5.2380768736083E-3, 5.2691995697515E-3, 5.3003730071958E-3, 5.3315972661793E-3, 5.3628724270584E-3, 5.3941985703085E-3, 5.4255757765235E-3, 5.4570041264163E-3, 5.4884837008187E-3, 5.5200145806820E-3, 5.5515968470765E-3, 5.5832305811922E-3, 5.6149158643388E-3, 5.6466527779455E-3, 5.6784414035617E-3, 5.7102818228568E-3, 5.7421741176205E-3, 5.7741183697626E-3, 5.8061146613137E-3, 5.8381630744251E-3, 5.8702636913686E-3, 5.9024165945373E-3, 5.9346218664452E-3, 5.9668795897276E-3, 5.9991898471413E-3, 6.0315527215645E-3, 6.0639682959973E-3, 6.0964366535614E-3, 6.1289578775007E-3, 6.1615320511812E-3, 6.1941592580912E-3, 6.2268395818412E-3, 6.2595731061647E-3, 6.2923599149177E-3, 6.3252000920790E-3, 6.3580937217506E-3, 6.3910408881577E-3, 6.4240416756486E-3, 6.4570961686955E-3, 6.4902044518937E-3, 6.5233666099626E-3, 6.5565827277456E-3, 6.5898528902099E-3, 6.6231771824472E-3, 6.6565556896733E-3, 6.6899884972286E-3, 6.7234756905784E-3, 6.7570173553125E-3, 6.7906135771459E-3, 6.8242644419186E-3, 6.8579700355958E-3, 6.8917304442684E-3, 6.9255457541524E-3, 6.9594160515900E-3, 6.9933414230490E-3, 7.0273219551232E-3, 7.0613577345326E-3, 7.0954488481237E-3, 7.1295953828691E-3, 7.1637974258684E-3, 7.1980550643476E-3, 7.2323683856599E-3, 7.2667374772854E-3, 7.3011624268315E-3, 7.3356433220328E-3, 7.3701802507517E-3, 7.4047733009779E-3, 7.4394225608293E-3, 7.4741281185515E-3, 7.5088900625182E-3, 7.5437084812315E-3, 7.5785834633219E-3, 7.6135150975485E-3, 7.6485034727988E-3, 7.6835486780896E-3, 7.7186508025664E-3, 7.7538099355041E-3, 7.7890261663067E-3, 7.8242995845079E-3, 7.8596302797707E-3, 7.8950183418883E-3, 7.9304638607833E-3, 7.9659669265089E-3, 8.0015276292482E-3, 8.0371460593147E-3, 8.0728223071525E-3, 8.1085564633364E-3, 8.1443486185719E-3, 8.1801988636955E-3, 8.2161072896751E-3, 8.2520739876095E-3, 8.2880990487291E-3, 8.3241825643959E-3, 8.3603246261036E-3, 8.3965253254778E-3, 8.4327847542762E-3, 8.4691030043886E-3, 8.5054801678372E-3, 8.5419163367765E-3, 8.5784116034939E-3, 8.6149660604096E-3, 8.6515798000764E-3, 8.6882529151807E-3, 8.7249854985417E-3, 8.7617776431123E-3, 8.7986294419788E-3, 8.8355409883613E-3, 8.8725123756136E-3, 8.9095436972238E-3, 8.9466350468137E-3, 8.9837865181400E-3, 9.0209982050934E-3, 9.0582702016993E-3, 9.0956026021181E-3, 9.1329955006449E-3, 9.1704489917099E-3, 9.2079631698785E-3, 9.2455381298517E-3, 9.2831739664658E-3, 9.3208707746928E-3, 9.3586286496406E-3, 9.3964476865530E-3, 9.4343279808102E-3, 9.4722696279283E-3, 9.5102727235600E-3, 9.5483373634949E-3, 9.5864636436588E-3, 9.6246516601147E-3, 9.6629015090628E-3, 9.7012132868401E-3, 9.7395870899214E-3, 9.7780230149186E-3, 9.8165211585815E-3, 9.8550816177978E-3, 9.8937044895928E-3, 9.9323898711303E-3, 9.9711378597122E-3, 1.0009948552779E-2, 1.0048822047909E-2, 1.0087758442820E-2, 1.0126757835370E-2, 1.0165820323552E-2, 1.0204946005503E-2, 1.0244134979495E-2, 1.0283387343944E-2, 1.0322703197401E-2, 1.0362082638560E-2, 1.0401525766253E-2, 1.0441032679455E-2, 1.0480603477277E-2, 1.0520238258975E-2, 1.0559937123941E-2, 1.0599700171711E-2, 1.0639527501961E-2, 1.0679419214508E-2, 1.0719375409309E-2, 1.0759396186464E-2, 1.0799481646214E-2, 1.0839631888940E-2, 1.0879847015168E-2, 1.0920127125564E-2, 1.0960472320934E-2, 1.1000882702231E-2, 1.1041358370546E-2, 1.1081899427116E-2, 1.1122505973317E-2, 1.1163178110672E-2, 1.1203915940843E-2, 1.1244719565637E-2, 1.1285589087006E-2, 1.1326524607043E-2, 1.1367526227985E-2, 1.1408594052213E-2, 1.1449728182252E-2, 1.1490928720772E-2, 1.1532195770585E-2, 1.1573529434649E-2, 1.1614929816067E-2, 1.1656397018085E-2, 1.1697931144095E-2, 1.1739532297634E-2, 1.1781200582382E-2, 1.1822936102168E-2, 1.1864738960964E-2, 1.1906609262887E-2, 1.1948547112202E-2, 1.1990552613317E-2, 1.2032625870790E-2, 1.2074766989321E-2, 1.2116976073759E-2, 1.2159253229099E-2, 1.2201598560481E-2, 1.2244012173194E-2, 1.2286494172673E-2, 1.2329044664500E-2, 1.2371663754405E-2, 1.2414351548265E-2, 1.2457108152103E-2, 1.2499933672091E-2, 1.2542828214551E-2, 1.2585791885949E-2, 1.2628824792902E-2, 1.2671927042174E-2, 1.2715098740677E-2, 1.2758339995475E-2, 1.2801650913775E-2, 1.2845031602939E-2, 1.2888482170473E-2, 1.2932002724036E-2, 1.2975593371434E-2, 1.3019254220623E-2, 1.3062985379709E-2, 1.3106786956949E-2, 1.3150659060747E-2, 1.3194601799661E-2, 1.3238615282394E-2, 1.3282699617806E-2, 1.3326854914902E-2, 1.3371081282840E-2, 1.3415378830929E-2, 1.3459747668629E-2, 1.3504187905550E-2, 1.3548699651456E-2, 1.3593283016259E-2, 1.3637938110024E-2, 1.3682665042970E-2, 1.3727463925465E-2, 1.3772334868030E-2, 1.3817277981339E-2, 1.3862293376216E-2, 1.3907381163641E-2, 1.3952541454744E-2, 1.3997774360808E-2, 1.4043079993271E-2, 1.4088458463723E-2, 1.4133909883906E-2, 1.4179434365716E-2, 1.4225032021204E-2, 1.4270702962574E-2, 1.4316447302183E-2, 1.4362265152543E-2, 1.4408156626319E-2, 1.4454121836332E-2, 1.4500160895556E-2, 1.4546273917120E-2, 1.4592461014308E-2, 1.4638722300560E-2, 1.4685057889468E-2, 1.4731467894783E-2, 1.4777952430408E-2, 1.4824511610403E-2, 1.4871145548984E-2, 1.4917854360522E-2, 1.4964638159545E-2, 1.5011497060735E-2, 1.5058431178933E-2, 1.5105440629134E-2, 1.5152525526492E-2, 1.5199685986314E-2, 1.5246922124068E-2, 1.5294234055376E-2, 1.5341621896018E-2, 1.5389085761931E-2, 1.5436625769212E-2, 1.5484242034110E-2, 1.5531934673038E-2, 1.5579703802562E-2, 1.5627549539409E-2, 1.5675472000463E-2, 1.5723471302765E-2, 1.5771547563517E-2, 1.5819700900078E-2, 1.5867931429966E-2, 1.5916239270858E-2, 1.5964624540589E-2, 1.6013087357156E-2, 1.6061627838712E-2, 1.6110246103571E-2, 1.6158942270207E-2, 1.6207716457253E-2, 1.6256568783502E-2, 1.6305499367906E-2, 1.6354508329580E-2, 1.6403595787797E-2, 1.6452761861991E-2, 1.6502006671756E-2, 1.6551330336849E-2, 1.6600732977184E-2, 1.6650214712841E-2, 1.6699775664056E-2, 1.6749415951231E-2, 1.6799135694926E-2, 1.6848935015864E-2, 1.6898814034931E-2, 1.6948772873171E-2, 1.6998811651795E-2, 1.7048930492173E-2, 1.7099129515838E-2, 1.7149408844485E-2, 1.7199768599973E-2, 1.7250208904323E-2, 1.7300729879718E-2, 1.7351331648506E-2, 1.7402014333196E-2, 1.7452778056461E-2, 1.7503622941139E-2, 1.7554549110230E-2, 1.7605556686898E-2, 1.7656645794471E-2, 1.7707816556441E-2, 1.7759069096463E-2, 1.7810403538360E-2, 1.7861820006115E-2, 1.7913318623877E-2, 1.7964899515962E-2, 1.8016562806848E-2, 1.8068308621179E-2, 1.8120137083764E-2, 1.8172048319578E-2, 1.8224042453761E-2, 1.8276119611617E-2, 1.8328279918618E-2, 1.8380523500402E-2, 1.8432850482770E-2, 1.8485260991691E-2, 1.8537755153302E-2, 1.8590333093903E-2, 1.8642994939963E-2, 1.8695740818115E-2, 1.8748570855163E-2, 1.8801485178073E-2, 1.8854483913982E-2, 1.8907567190193E-2, 1.8960735134174E-2, 1.9013987873565E-2, 1.9067325536169E-2, 1.9120748249960E-2, 1.9174256143078E-2, 1.9227849343832E-2, 1.9281527980698E-2, 1.9335292182322E-2, 1.9389142077518E-2, 1.9443077795267E-2, 1.9497099464720E-2, 1.9551207215196E-2, 1.9605401176184E-2, 1.9659681477342E-2, 1.9714048248496E-2, 1.9768501619642E-2, 1.9823041720945E-2, 1.9877668682742E-2, 1.9932382635537E-2, 1.9987183710004E-2, 2.0042072036988E-2, 2.0097047747505E-2, 2.0152110972738E-2, 2.0207261844045E-2, 2.0262500492950E-2, 2.0317827051151E-2, 2.0373241650516E-2, 2.0428744423081E-2, 2.0484335501057E-2, 2.0540015016825E-2, 2.0595783102937E-2, 2.0651639892115E-2, 2.0707585517255E-2, 2.0763620111423E-2, 2.0819743807857E-2, 2.0875956739969E-2, 2.0932259041340E-2, 2.0988650845724E-2, 2.1045132287050E-2, 2.1101703499416E-2, 2.1158364617094E-2, 2.1215115774529E-2, 2.1271957106339E-2, 2.1328888747313E-2, 2.1385910832415E-2, 2.1443023496782E-2, 2.1500226875725E-2, 2.1557521104726E-2, 2.1614906319442E-2, 2.1672382655705E-2, 2.1729950249519E-2, 2.1787609237062E-2, 2.1845359754687E-2, 2.1903201938922E-2, 2.1961135926466E-2, 2.2019161854196E-2, 2.2077279859162E-2, 2.2135490078588E-2, 2.2193792649874E-2, 2.2252187710595E-2, 2.2310675398501E-2, 2.2369255851515E-2, 2.2427929207738E-2, 2.2486695605446E-2, 2.2545555183089E-2, 2.2604508079295E-2, 2.2663554432864E-2, 2.2722694382776E-2, 2.2781928068186E-2, 2.2841255628422E-2, 2.2900677202992E-2, 2.2960192931579E-2, 2.3019802954042E-2, 2.3079507410417E-2, 2.3139306440918E-2, 2.3199200185932E-2, 2.3259188786028E-2, 2.3319272381947E-2, 2.3379451114612E-2, 2.3439725125120E-2, 2.3500094554746E-2, 2.3560559544943E-2, 2.3621120237342E-2, 2.3681776773750E-2, 2.3742529296154E-2, 2.3803377946719E-2, 2.3864322867784E-2, 2.3925364201872E-2, 2.3986502091681E-2, 2.4047736680087E-2, 2.4109068110146E-2, 2.4170496525092E-2, 2.4232023068338E-2, 2.4293644883476E-2, 2.4355365114276E-2, 2.4417182904688E-2, 2.4479098398840E-2, 2.4541111741041E-2, 2.4603223075779E-2, 2.4665432547719E-2, 2.4727740301710E-2, 2.4790146482777E-2, 2.4852651236126E-2, 2.4915254707144E-2, 2.4977957041396E-2, 2.5040758384629E-2, 2.5103658882769E-2, 2.5166658681923E-2, 2.5229757928378E-2, 2.5292956768602E-2, 2.5356255349244E-2, 2.5419653817131E-2, 2.5483152319276E-2, 2.5546751002867E-2, 2.5610450015279E-2, 2.5674249504063E-2, 2.5738149616954E-2, 2.5802150501868E-2, 2.5866252306902E-2, 2.5930455180336E-2, 2.5994759270629E-2, 2.6059164726424E-2, 2.6123671696544E-2, 2.6188280329997E-2, 2.6252990775970E-2, 2.6317803183833E-2, 2.6382717703139E-2, 2.6447734483622E-2, 2.6512853675201E-2, 2.6578075427973E-2, 2.6643399892223E-2, 2.6708827218416E-2, 2.6774357557198E-2, 2.6839991059401E-2, 2.6905727876039E-2, 2.6971568158308E-2, 2.7037512057590E-2, 2.7103559725446E-2, 2.7169711313624E-2, 2.7235966974055E-2, 2.7302326858851E-2, 2.7368791120310E-2, 2.7435359910913E-2, 2.7502033383326E-2, 2.7568811690396E-2, 2.7635694985157E-2, 2.7702683420825E-2, 2.7769777150802E-2, 2.7836976328673E-2, 2.7904281108207E-2, 2.7971691643358E-2, 2.8039208088265E-2, 2.8106830597250E-2, 2.8174559324823E-2, 2.8242394425674E-2, 2.8310336054681E-2, 2.8378384366908E-2, 2.8446539517600E-2, 2.8514801662190E-2, 2.8583170956296E-2, 2.8651647555720E-2, 2.8720231616450E-2, 2.8788923294661E-2, 2.8857722746709E-2, 2.8926630129141E-2, 2.8995645598687E-2, 2.9064769312261E-2, 2.9134001426965E-2, 2.9203342100088E-2, 2.9272791489102E-2, 2.9342349751667E-2, 2.9412017045628E-2, 2.9481793529016E-2, 2.9551679360050E-2, 2.9621674697134E-2, 2.9691779698859E-2, 2.9761994524000E-2, 2.9832319331522E-2, 2.9902754280575E-2, 2.9973299530496E-2, 3.0043955240807E-2, 3.0114721571220E-2, 3.0185598681631E-2, 3.0256586732124E-2, 3.0327685882971E-2, 3.0398896294629E-2, 3.0470218127744E-2, 3.0541651543148E-2, 3.0613196701861E-2, 3.0684853765089E-2, 3.0756622894228E-2, 3.0828504250859E-2, 3.0900497996751E-2, 3.0972604293861E-2, 3.1044823304334E-2, 3.1117155190502E-2, 3.1189600114885E-2, 3.1262158240190E-2, 3.1334829729314E-2, 3.1407614745340E-2, 3.1480513451540E-2, 3.1553526011373E-2, 3.1626652588486E-2, 3.1699893346717E-2, 3.1773248450088E-2, 3.1846718062812E-2, 3.1920302349291E-2, 3.1994001474111E-2, 3.2067815602053E-2, 3.2141744898080E-2, 3.2215789527347E-2, 3.2289949655198E-2, 3.2364225447165E-2, 3.2438617068966E-2, 3.2513124686512E-2, 3.2587748465900E-2, 3.2662488573417E-2, 3.2737345175537E-2, 3.2812318438926E-2, 3.2887408530437E-2, 3.2962615617111E-2, 3.3037939866181E-2, 3.3113381445066E-2, 3.3188940521377E-2, 3.3264617262911E-2, 3.3340411837657E-2, 3.3416324413791E-2, 3.3492355159680E-2, 3.3568504243880E-2, 3.3644771835136E-2, 3.3721158102382E-2, 3.3797663214743E-2, 3.3874287341530E-2, 3.3951030652248E-2, 3.4027893316589E-2, 3.4104875504434E-2, 3.4181977385855E-2, 3.4259199131114E-2, 3.4336540910661E-2, 3.4414002895136E-2, 3.4491585255371E-2, 3.4569288162384E-2, 3.4647111787387E-2, 3.4725056301778E-2, 3.4803121877146E-2, 3.4881308685272E-2, 3.4959616898124E-2, 3.5038046687862E-2, 3.5116598226835E-2, 3.5195271687581E-2, 3.5274067242829E-2, 3.5352985065499E-2, 3.5432025328700E-2, 3.5511188205730E-2, 3.5590473870079E-2, 3.5669882495427E-2, 3.5749414255641E-2, 3.5829069324782E-2, 3.5908847877100E-2, 3.5988750087034E-2, 3.6068776129213E-2, 3.6148926178459E-2, 3.6229200409780E-2, 3.6309598998379E-2, 3.6390122119644E-2, 3.6470769949158E-2, 3.6551542662691E-2, 3.6632440436205E-2, 3.6713463445850E-2, 3.6794611867970E-2, 3.6875885879096E-2, 3.6957285655950E-2, 3.7038811375445E-2, 3.7120463214685E-2, 3.7202341350962E-2, 3.7284145961759E-2, 3.7366177224751E-2, 3.7448335317801E-2, 3.7530620418964E-2, 3.7613032706484E-2, 3.7695572358797E-2, 3.7778239554527E-2, 3.7861034472489E-2, 3.7943957291690E-2, 3.8027008191326E-2, 3.8110187350782E-2, 3.8193494949634E-2, 3.8276931167651E-2, 3.8360496184788E-2, 3.8444190181192E-2, 3.8528013337201E-2, 3.8611965833343E-2, 3.8696047850334E-2, 3.8780259569084E-2, 3.8864601170689E-2, 3.8949072836438E-2, 3.9033674747809E-2, 3.9118407086470E-2, 3.9203270034281E-2, 3.9288263773288E-2, 3.9373388485732E-2, 3.9458644354039E-2, 3.9544031560830E-2, 3.9629550288912E-2, 3.9715200721284E-2, 3.9800983041134E-2, 3.9886897431840E-2, 3.9972944076971E-2, 4.0059123160284E-2, 4.0145434865728E-2, 4.0231879377439E-2, 4.0318456879746E-2, 4.0405167557165E-2, 4.0492011594403E-2, 4.0578989176356E-2, 4.0666100488111E-2, 4.0753345714942E-2, 4.0840725042316E-2, 4.0928238655886E-2, 4.1015886741497E-2, 4.1103669485182E-2, 4.1191587073165E-2, 4.1279639691857E-2, 4.1367827527860E-2, 4.1456150767965E-2, 4.1544609599152E-2, 4.1633204208590E-2, 4.1721934783638E-2, 4.1810801511842E-2, 4.1899804580940E-2, 4.1988944178856E-2, 4.2078220493705E-2, 4.2167633713790E-2, 4.2257184027603E-2, 4.2346871623825E-2, 4.2436696691326E-2, 4.2526659419162E-2, 4.2616759996582E-2, 4.2706998613020E-2, 4.2797375458100E-2, 4.2887890721634E-2, 4.2978544593623E-2, 4.3069337264254E-2, 4.3160268923906E-2, 4.3251339763143E-2, 4.3342549972719E-2, 4.3433899743574E-2, 4.3525389266839E-2, 4.3617018733829E-2, 4.3708788336049E-2, 4.3800698265194E-2, 4.3892748713141E-2, 4.3984939871961E-2, 4.4077271933907E-2, 4.4169745091422E-2, 4.4262359537138E-2, 4.4355115463871E-2, 4.4448013064626E-2, 4.4541052532594E-2, 4.4634234061155E-2, 4.4727557843874E-2, 4.4821024074505E-2, 4.4914632946986E-2, 4.5008384655443E-2, 4.5102279394189E-2, 4.5196317357725E-2, 4.5290498740734E-2, 4.5384823738089E-2, 4.5479292544849E-2, 4.5573905356259E-2, 4.5668662367747E-2, 4.5763563774931E-2, 4.5858609773614E-2, 4.5953800559783E-2, 4.6049136329611E-2, 4.6144617279459E-2, 4.6240243605871E-2, 4.6336015505577E-2, 4.6431933175493E-2, 4.6527996812718E-2, 4.6624206614539E-2, 4.6720562778426E-2, 4.6817065502033E-2, 4.6913714983202E-2, 4.7010511419957E-2, 4.7107455010506E-2, 4.7204545953244E-2, 4.7301784446747E-2, 4.7399170689777E-2, 4.7496704881281E-2, 4.7594387220388E-2, 4.7692217906411E-2, 4.7790197138848E-2, 4.7888325117379E-2, 4.7986602041867E-2, 4.8085028112361E-2, 4.8183603529091E-2, 4.8282328492470E-2, 4.8381203203094E-2, 4.8480227861742E-2, 4.8579402669377E-2, 4.8678727827142E-2, 4.8778203536363E-2, 4.8877829998550E-2, 4.8977607415392E-2, 4.9077535988764E-2, 4.9177615920718E-2, 4.9277847413492E-2, 4.9378230669502E-2, 4.9478765891348E-2, 4.9579453281810E-2, 4.9680293043849E-2, 4.9781285380608E-2, 4.9882430495408E-2, 4.9983728591753E-2, 5.0085179873328E-2, 5.0186784543997E-2, 5.0288542807803E-2, 5.0390454868971E-2, 5.0492520931906E-2, 5.0594741201191E-2, 5.0697115881589E-2, 5.0799645178043E-2, 5.0902329295675E-2, 5.1005168439786E-2, 5.1108162815855E-2, 5.1211312629540E-2, 5.1314618086678E-2, 5.1418079393284E-2, 5.1521696755552E-2, 5.1625470379853E-2, 5.1729400472736E-2, 5.1833487240926E-2, 5.1937730891329E-2, 5.2042131631026E-2, 5.2146689667274E-2, 5.2251405207510E-2, 5.2356278459345E-2, 5.2461309630567E-2, 5.2566498929142E-2, 5.2671846563210E-2, 5.2777352741088E-2, 5.2883017671269E-2, 5.2988841562421E-2, 5.3094824623387E-2, 5.3200967063187E-2, 5.3307269091013E-2, 5.3413730916234E-2, 5.3520352748393E-2, 5.3627134797208E-2, 5.3734077272569E-2, 5.3841180384543E-2, 5.3948444343368E-2, 5.4055869359456E-2, 5.4163455643395E-2, 5.4271203405943E-2, 5.4379112858032E-2, 5.4487184210766E-2, 5.4595417675422E-2, 5.4703813463451E-2, 5.4812371786472E-2, 5.4921092856280E-2, 5.5029976884838E-2, 5.5139024084283E-2, 5.5248234666921E-2, 5.5357608845231E-2, 5.5467146831861E-2, 5.5576848839631E-2, 5.5686715081528E-2, 5.5796745770713E-2, 5.5906941120514E-2, 5.6017301344430E-2, 5.6127826656127E-2, 5.6238517269442E-2, 5.6349373398381E-2, 5.6460395257117E-2, 5.6571583059993E-2, 5.6682937021517E-2, 5.6794457356367E-2, 5.6906144279390E-2, 5.7017998005596E-2, 5.7130018750166E-2, 5.7242206728445E-2, 5.7354562155946E-2, 5.7467085248348E-2, 5.7579776221496E-2, 5.7692635291399E-2, 5.7805662674233E-2, 5.7918858586340E-2, 5.8032223244225E-2, 5.8145756864558E-2, 5.8259459664175E-2, 5.8373331860073E-2, 5.8487373669415E-2, 5.8601585309528E-2, 5.8715966997900E-2, 5.8830518952183E-2, 5.8945241390193E-2, 5.9060134529906E-2, 5.9175198589461E-2, 5.9290433787160E-2, 5.9405840341465E-2, 5.9521418470999E-2, 5.9637168394548E-2, 5.9753090331056E-2, 5.9869184499629E-2, 5.9985451119532E-2, 6.0101890410191E-2, 6.0218502591189E-2, 6.0335287882272E-2, 6.0452246503340E-2, 6.0569378674456E-2, 6.0686684615838E-2, 6.0804164547864E-2, 6.0921818691067E-2, 6.1039647266141E-2, 6.1157650493932E-2, 6.1275828595447E-2, 6.1394181791847E-2, 6.1512710304449E-2, 6.1631414354727E-2, 6.1750294164309E-2, 6.1869349954978E-2, 6.1988581948672E-2, 6.2107990367483E-2, 6.2227575433658E-2, 6.2347337369597E-2, 6.2467276397851E-2, 6.2587392741128E-2, 6.2707686622285E-2, 6.2828158264335E-2, 6.2948807890438E-2, 6.3069635723911E-2, 6.3190641988217E-2, 6.3311826906974E-2, 6.3433190703949E-2, 6.3554733603057E-2, 6.3676455828367E-2, 6.3798357604093E-2, 6.3920439154602E-2, 6.4042700704406E-2, 6.4165142478169E-2, 6.4287764700700E-2, 6.4410567596957E-2, 6.4533551392045E-2, 6.4656716311215E-2, 6.4780062579866E-2, 6.4903590423543E-2, 6.5027300067934E-2, 6.5151191738875E-2, 6.5275265662347E-2, 6.5399522064473E-2, 6.5523961171523E-2, 6.5648583209910E-2, 6.5773388406189E-2, 6.5898376987060E-2, 6.6023549179363E-2, 6.6148905210082E-2, 6.6274445306344E-2, 6.6400169695414E-2, 6.6526078604700E-2, 6.6652172261751E-2, 6.6778450894255E-2, 6.6904914730039E-2, 6.7031563997073E-2, 6.7158398923461E-2, 6.7285419737449E-2, 6.7412626667420E-2, 6.7540019941893E-2, 6.7667599789527E-2, 6.7795366439117E-2, 6.7923320119592E-2, 6.8051461060021E-2, 6.8179789489604E-2, 6.8308305637680E-2, 6.8437009733719E-2, 6.8565902007329E-2, 6.8694982688249E-2, 6.8824252006352E-2, 6.8953710191643E-2, 6.9083357474262E-2, 6.9213194084479E-2, 6.9343220252694E-2, 6.9473436209441E-2, 6.9603842185383E-2, 6.9734438411314E-2, 6.9865225118156E-2, 6.9996202536962E-2, 7.0127370898913E-2, 7.0258730435317E-2, 7.0390281377612E-2, 7.0522023957362E-2, 7.0653958406259E-2, 7.0786084956119E-2, 7.0918403838885E-2, 7.1050915286627E-2, 7.1183619531538E-2, 7.1316516805936E-2, 7.1449607342263E-2, 7.1582891373084E-2, 7.1716369131088E-2, 7.1850040849084E-2, 7.1983906760007E-2, 7.2117967096909E-2, 7.2252222092966E-2, 7.2386671981474E-2, 7.2521316995847E-2, 7.2656157369621E-2, 7.2791193336449E-2, 7.2926425130103E-2, 7.3061852984473E-2, 7.3197477133566E-2, 7.3333297811507E-2, 7.3469315252536E-2, 7.3605529691009E-2, 7.3741941361397E-2, 7.3878550498287E-2, 7.4015357336378E-2, 7.4152362110486E-2, 7.4289565055536E-2, 7.4426966406569E-2, 7.4564566398735E-2, 7.4702365267299E-2, 7.4840363247634E-2, 7.4978560575225E-2, 7.5116957485665E-2, 7.5255554214659E-2, 7.5394350998017E-2, 7.5533348071662E-2, 7.5672545671620E-2, 7.5811944034027E-2, 7.5951543395123E-2, 7.6091343991257E-2, 7.6231346058880E-2, 7.6371549834550E-2, 7.6511955554929E-2, 7.6652563456780E-2, 7.6793373776973E-2, 7.6934386752478E-2, 7.7075602620366E-2, 7.7217021617811E-2, 7.7358643982088E-2, 7.7500469950570E-2, 7.7642499760731E-2, 7.7784733650143E-2, 7.7927171856477E-2, 7.8069814617501E-2, 7.8212662171079E-2, 7.8355714755175E-2, 7.8498972607845E-2, 7.8642435967241E-2, 7.8786105071612E-2, 7.8929980159297E-2, 7.9074061468732E-2, 7.9218349238443E-2, 7.9362843707050E-2, 7.9507545113264E-2, 7.9652453695885E-2, 7.9797569693805E-2, 7.9942893346005E-2, 8.0088424891556E-2, 8.0234164569615E-2, 8.0380112619428E-2, 8.0526269280327E-2, 8.0672634791733E-2, 8.0819209393149E-2, 8.0965993324165E-2, 8.1112986824455E-2, 8.1260190133776E-2, 8.1407603491969E-2, 8.1555227138956E-2, 8.1703061314743E-2, 8.1851106259415E-2, 8.1999362213136E-2, 8.2147829416154E-2, 8.2296508108792E-2, 8.2445398531452E-2, 8.2594500924615E-2, 8.2743815528838E-2, 8.2893342584753E-2, 8.3043082333070E-2, 8.3193035014572E-2, 8.3343200870116E-2, 8.3493580140633E-2, 8.3644173067128E-2, 8.3794979890674E-2, 8.3946000852421E-2, 8.4097236193583E-2, 8.4248686155449E-2, 8.4400350979376E-2, 8.4552230906787E-2, 8.4704326179175E-2, 8.4856637038100E-2, 8.5009163725186E-2, 8.5161906482125E-2, 8.5314865550672E-2, 8.5468041172647E-2, 8.5621433589934E-2, 8.5775043044476E-2, 8.5928869778282E-2, 8.6082914033419E-2, 8.6237176052017E-2, 8.6391656076262E-2, 8.6546354348402E-2, 8.6701271110742E-2, 8.6856406605642E-2, 8.7011761075521E-2, 8.7167334762854E-2, 8.7323127910169E-2, 8.7479140760050E-2, 8.7635373555131E-2, 8.7791826538104E-2, 8.7948499951707E-2, 8.8105394038733E-2, 8.8262509042024E-2, 8.8419845204470E-2, 8.8577402769013E-2, 8.8735181978639E-2, 8.8893183076383E-2, 8.9051406305327E-2, 8.9209851908596E-2, 8.9368520129362E-2, 8.9527411210839E-2, 8.9686525396285E-2, 8.9845862928999E-2, 9.0005424052324E-2, 9.0165209009640E-2, 9.0325218044369E-2, 9.0485451399971E-2, 9.0645909319944E-2, 9.0806592047823E-2, 9.0967499827181E-2, 9.1128632901623E-2, 9.1289991514793E-2, 9.1451575910365E-2, 9.1613386332047E-2, 9.1775423023582E-2, 9.1937686228739E-2, 9.2100176191322E-2, 9.2262893155162E-2, 9.2425837364119E-2, 9.2589009062082E-2, 9.2752408492965E-2, 9.2916035900709E-2, 9.3079891529280E-2, 9.3243975622669E-2, 9.3408288424890E-2, 9.3572830179977E-2, 9.3737601131991E-2, 9.3902601525007E-2, 9.4067831603127E-2, 9.4233291610465E-2, 9.4398981791157E-2, 9.4564902389357E-2, 9.4731053649231E-2, 9.4897435814964E-2, 9.5064049130755E-2, 9.5230893840813E-2, 9.5397970189365E-2, 9.5565278420644E-2, 9.5732818778898E-2, 9.5900591508382E-2, 9.6068596853362E-2, 9.6236835058109E-2, 9.6405306366904E-2, 9.6574011024032E-2, 9.6742949273784E-2, 9.6912121360455E-2, 9.7081527528342E-2, 9.7251168021745E-2, 9.7421043084966E-2, 9.7591152962306E-2, 9.7761497898066E-2, 9.7932078136546E-2, 9.8102893922041E-2, 9.8273945498844E-2, 9.8445233111244E-2, 9.8616757003524E-2, 9.8788517419959E-2, 9.8960514604818E-2, 9.9132748802361E-2, 9.9305220256840E-2, 9.9477929212492E-2, 9.9650875913549E-2, 9.9824060604224E-2, 9.9997483528721E-2, 1.0017114493123E-1, 1.0034504505592E-1, 1.0051918414694E-1, 1.0069356244844E-1, 1.0086818020454E-1, 1.0104303765933E-1, 1.0121813505689E-1, 1.0139347264129E-1, 1.0156905065656E-1, 1.0174486934670E-1, 1.0192092895570E-1, 1.0209722972753E-1, 1.0227377190612E-1, 1.0245055573538E-1, 1.0262758145917E-1, 1.0280484932135E-1, 1.0298235956573E-1, 1.0316011243609E-1, 1.0333810817619E-1, 1.0351634702974E-1, 1.0369482924042E-1, 1.0387355505188E-1, 1.0405252470772E-1, 1.0423173845150E-1, 1.0441119652677E-1, 1.0459089917699E-1, 1.0477084664563E-1, 1.0495103917607E-1, 1.0513147701168E-1, 1.0531216039578E-1, 1.0549308957162E-1, 1.0567426478243E-1, 1.0585568627138E-1, 1.0603735428158E-1, 1.0621926905612E-1, 1.0640143083800E-1, 1.0658383987020E-1, 1.0676649639562E-1, 1.0694940065711E-1, 1.0713255289749E-1, 1.0731595335949E-1, 1.0749960228579E-1, 1.0768349991902E-1, 1.0786764650175E-1, 1.0805204227646E-1, 1.0823668748560E-1, 1.0842158237154E-1, 1.0860672717658E-1, 1.0879212214298E-1, 1.0897776751289E-1, 1.0916366352842E-1, 1.0934981043161E-1, 1.0953620846442E-1, 1.0972285786874E-1, 1.0990975888637E-1, 1.1009691175906E-1, 1.1028431672848E-1, 1.1047197403621E-1, 1.1065988392376E-1, 1.1084804663255E-1, 1.1103646240393E-1, 1.1122513147917E-1, 1.1141405409945E-1, 1.1160323050586E-1, 1.1179266093942E-1, 1.1198234564105E-1, 1.1217228485158E-1, 1.1236247881176E-1, 1.1255292776224E-1, 1.1274363194359E-1, 1.1293459159627E-1, 1.1312580696067E-1, 1.1331727827705E-1, 1.1350900578561E-1, 1.1370098972643E-1, 1.1389323033949E-1, 1.1408572786467E-1, 1.1427848254176E-1, 1.1447149461043E-1, 1.1466476431026E-1, 1.1485829188072E-1, 1.1505207756116E-1, 1.1524612159085E-1, 1.1544042420892E-1, 1.1563498565440E-1, 1.1582980616622E-1, 1.1602488598318E-1, 1.1622023534396E-1, 1.1641582448716E-1, 1.1661168365122E-1, 1.1680780307448E-1, 1.1700418299516E-1, 1.1720082365136E-1, 1.1739772528106E-1, 1.1759488812209E-1, 1.1779231241220E-1, 1.1798999838898E-1, 1.1818794628989E-1, 1.1838615635228E-1, 1.1858462881337E-1, 1.1878336391022E-1, 1.1898236187978E-1, 1.1918162295887E-1, 1.1938114738416E-1, 1.1958093539218E-1, 1.1978098721934E-1, 1.1998130310189E-1, 1.2018188327595E-1, 1.2038272797749E-1, 1.2058383744234E-1, 1.2078521190619E-1, 1.2098685160457E-1, 1.2118875677287E-1, 1.2139092764633E-1, 1.2159336446003E-1, 1.2179606744892E-1, 1.2199903684777E-1, 1.2220237289121E-1, 1.2240577581370E-1, 1.2260954584956E-1, 1.2281358323294E-1, 1.2301788819784E-1, 1.2322246097806E-1, 1.2342730180729E-1, 1.2363241091902E-1, 1.2383778854658E-1, 1.2404343492313E-1, 1.2424935028168E-1, 1.2445553485504E-1, 1.2466198887586E-1, 1.2486871257662E-1, 1.2507570618963E-1, 1.2528296994701E-1, 1.2549050408070E-1, 1.2569830882247E-1, 1.2590638440392E-1, 1.2611473105643E-1, 1.2632334901124E-1, 1.2653223849937E-1, 1.2674139975168E-1, 1.2695083299881E-1, 1.2716053847125E-1, 1.2737051639926E-1, 1.2758076701293E-1, 1.2779129054215E-1, 1.2800208721662E-1, 1.2821315726582E-1, 1.2842450091906E-1, 1.2863611840544E-1, 1.2884800995384E-1, 1.2906017579297E-1, 1.2927261615130E-1, 1.2948533125711E-1, 1.2969832133849E-1, 1.2991158662329E-1, 1.3012512733916E-1, 1.3033894371354E-1, 1.3055303597365E-1, 1.3076740434651E-1, 1.3098204905890E-1, 1.3119697033741E-1, 1.3141216840837E-1, 1.3162764349793E-1, 1.3184339583198E-1, 1.3205942563622E-1, 1.3227573313609E-1, 1.3249231855683E-1, 1.3270918212343E-1, 1.3292632406065E-1, 1.3314374459304E-1, 1.3336144394489E-1, 1.3357942234027E-1, 1.3379768000299E-1, 1.3401621715665E-1, 1.3423503402459E-1, 1.3445413082992E-1, 1.3467350779549E-1, 1.3489316514391E-1, 1.3511310309757E-1, 1.3533332187856E-1, 1.3555382170876E-1, 1.3577460280978E-1, 1.3599566540299E-1, 1.3621700970949E-1, 1.3643863595014E-1, 1.3666054434551E-1, 1.3688273511594E-1, 1.3710520848150E-1, 1.3732796466200E-1, 1.3755100387697E-1, 1.3777432634569E-1, 1.3799793228716E-1, 1.3822182192012E-1, 1.3844599546303E-1, 1.3867045313408E-1, 1.3889519515118E-1, 1.3912023173197E-1, 1.3934553309382E-1, 1.3957112945380E-1, 1.3979701102871E-1, 1.4002317803506E-1, 1.4024963068908E-1, 1.4047636920671E-1, 1.4070339380361E-1, 1.4093070469515E-1, 1.4115830209638E-1, 1.4138618622210E-1, 1.4161435728678E-1, 1.4184281550461E-1, 1.4207156108947E-1, 1.4230059425496E-1, 1.4252991521436E-1, 1.4275952418064E-1, 1.4298942136649E-1, 1.4321960698427E-1, 1.4345008124603E-1, 1.4368084436354E-1, 1.4391189654821E-1, 1.4414323801118E-1, 1.4437486896325E-1, 1.4460678961491E-1, 1.4483900017632E-1, 1.4507150085732E-1, 1.4530429186746E-1, 1.4553737341591E-1, 1.4577074571156E-1, 1.4600440896295E-1, 1.4623836337829E-1, 1.4647260916546E-1, 1.4670714653202E-1, 1.4694197568518E-1, 1.4717709683180E-1, 1.4741251017844E-1, 1.4764821593128E-1, 1.4788421429618E-1, 1.4812050547864E-1, 1.4835708968384E-1, 1.4859396711658E-1, 1.4883113798134E-1, 1.4906860248221E-1, 1.4930636082298E-1, 1.4954441320704E-1, 1.4978275983743E-1, 1.5002140091686E-1, 1.5026033664764E-1, 1.5049956723175E-1, 1.5073909287079E-1, 1.5097891376598E-1, 1.5121903011821E-1, 1.5145944212797E-1, 1.5170014999539E-1, 1.5194115392021E-1, 1.5218245410182E-1, 1.5242405073922E-1, 1.5266594403103E-1, 1.5290813417549E-1, 1.5315062137046E-1, 1.5339340581341E-1, 1.5363648770143E-1, 1.5387986723122E-1, 1.5412354459909E-1, 1.5436752000095E-1, 1.5461179363232E-1, 1.5485636568834E-1, 1.5510123636373E-1, 1.5534640585281E-1, 1.5559187434953E-1, 1.5583764204740E-1, 1.5608370913954E-1, 1.5633007581867E-1, 1.5657674227708E-1, 1.5682370870667E-1, 1.5707097529892E-1, 1.5731854224489E-1, 1.5756640973523E-1, 1.5781457796017E-1, 1.5806304710952E-1, 1.5831181737265E-1, 1.5856088893855E-1, 1.5881026199573E-1, 1.5905993673230E-1, 1.5930991333596E-1, 1.5956019199392E-1, 1.5981077289302E-1, 1.6006165621962E-1, 1.6031284215966E-1, 1.6056433089863E-1, 1.6081612262160E-1, 1.6106821751317E-1, 1.6132061575751E-1, 1.6157331753833E-1, 1.6182632303890E-1, 1.6207963244205E-1, 1.6233324593013E-1, 1.6258716368505E-1, 1.6284138588826E-1, 1.6309591272075E-1, 1.6335074436305E-1, 1.6360588099523E-1, 1.6386132279688E-1, 1.6411706994714E-1, 1.6437312262466E-1, 1.6462948100766E-1, 1.6488614527383E-1, 1.6514311560043E-1, 1.6540039216421E-1, 1.6565797514148E-1, 1.6591586470802E-1, 1.6617406103917E-1, 1.6643256430975E-1, 1.6669137469413E-1, 1.6695049236615E-1, 1.6720991749918E-1, 1.6746965026611E-1, 1.6772969083930E-1, 1.6799003939064E-1, 1.6825069609152E-1, 1.6851166111281E-1, 1.6877293462489E-1, 1.6903451679763E-1, 1.6929640780039E-1, 1.6955860780204E-1, 1.6982111697090E-1, 1.7008393547482E-1, 1.7034706348109E-1, 1.7061050115653E-1, 1.7087424866740E-1, 1.7113830617945E-1, 1.7140267385792E-1, 1.7166735186751E-1, 1.7193234037240E-1, 1.7219763953622E-1, 1.7246324952209E-1, 1.7272917049259E-1, 1.7299540260976E-1, 1.7326194603511E-1, 1.7352880092959E-1, 1.7379596745363E-1, 1.7406344576711E-1, 1.7433123602935E-1, 1.7459933839913E-1, 1.7486775303468E-1, 1.7513648009369E-1, 1.7540551973326E-1, 1.7567487210997E-1, 1.7594453737981E-1, 1.7621451569824E-1, 1.7648480722013E-1, 1.7675541209980E-1, 1.7702633049099E-1, 1.7729756254689E-1, 1.7756910842009E-1, 1.7784096826262E-1, 1.7811314222596E-1, 1.7838563046096E-1, 1.7865843311792E-1, 1.7893155034657E-1, 1.7920498229603E-1, 1.7947872911485E-1, 1.7975279095097E-1, 1.8002716795177E-1, 1.8030186026401E-1, 1.8057686803387E-1, 1.8085219140693E-1, 1.8112783052817E-1, 1.8140378554195E-1, 1.8168005659207E-1, 1.8195664382168E-1, 1.8223354737335E-1, 1.8251076738902E-1, 1.8278830401004E-1, 1.8306615737713E-1, 1.8334432763039E-1, 1.8362281490931E-1, 1.8390161935276E-1, 1.8418074109899E-1, 1.8446018028562E-1, 1.8473993704963E-1, 1.8502001152739E-1, 1.8530040385464E-1, 1.8558111416646E-1, 1.8586214259733E-1, 1.8614348928106E-1, 1.8642515435085E-1, 1.8670713793923E-1, 1.8698944017809E-1, 1.8727206119870E-1, 1.8755500113165E-1, 1.8783826010689E-1, 1.8812183825372E-1, 1.8840573570078E-1, 1.8868995257606E-1, 1.8897448900688E-1, 1.8925934511990E-1, 1.8954452104113E-1, 1.8983001689590E-1, 1.9011583280886E-1, 1.9040196890402E-1, 1.9068842530470E-1, 1.9097520213354E-1, 1.9126229951251E-1, 1.9154971756291E-1, 1.9183745640533E-1, 1.9212551615971E-1, 1.9241389694528E-1, 1.9270259888059E-1, 1.9299162208351E-1, 1.9328096667120E-1, 1.9357063276013E-1, 1.9386062046609E-1, 1.9415092990415E-1, 1.9444156118868E-1, 1.9473251443336E-1, 1.9502378975115E-1, 1.9531538725432E-1, 1.9560730705442E-1, 1.9589954926227E-1, 1.9619211398801E-1, 1.9648500134104E-1, 1.9677821143004E-1, 1.9707174436299E-1, 1.9736560024712E-1, 1.9765977918895E-1, 1.9795428129428E-1, 1.9824910666815E-1, 1.9854425541490E-1, 1.9883972763813E-1, 1.9913552344068E-1, 1.9943164292468E-1, 1.9972808619151E-1, 2.0002485334179E-1, 2.0032194447542E-1, 2.0061935969153E-1, 2.0091709908852E-1, 2.0121516276402E-1, 2.0151355081493E-1, 2.0181226333736E-1, 2.0211130042670E-1, 2.0241066217754E-1, 2.0271034868373E-1, 2.0301036003835E-1, 2.0331069633372E-1, 2.0361135766138E-1, 2.0391234411210E-1, 2.0421365577587E-1, 2.0451529274191E-1, 2.0481725509867E-1, 2.0511954293381E-1, 2.0542215633420E-1, 2.0572509538594E-1, 2.0602836017433E-1, 2.0633195078388E-1, 2.0663586729831E-1, 2.0694010980057E-1, 2.0724467837277E-1, 2.0754957309625E-1, 2.0785479405154E-1, 2.0816034131838E-1, 2.0846621497568E-1, 2.0877241510156E-1, 2.0907894177333E-1, 2.0938579506748E-1, 2.0969297505970E-1, 2.1000048182483E-1, 2.1030831543694E-1, 2.1061647596924E-1, 2.1092496349414E-1, 2.1123377808320E-1, 2.1154291980718E-1, 2.1185238873600E-1, 2.1216218493873E-1, 2.1247230848364E-1, 2.1278275943813E-1, 2.1309353786879E-1, 2.1340464384134E-1, 2.1371607742069E-1, 2.1402783867087E-1, 2.1433992765508E-1, 2.1465234443568E-1, 2.1496508907416E-1, 2.1527816163116E-1, 2.1559156216647E-1, 2.1590529073902E-1, 2.1621934740687E-1, 2.1653373222723E-1, 2.1684844525643E-1, 2.1716348654995E-1, 2.1747885616238E-1, 2.1779455414746E-1, 2.1811058055803E-1, 2.1842693544608E-1, 2.1874361886270E-1, 2.1906063085811E-1, 2.1937797148165E-1, 2.1969564078177E-1, 2.2001363880602E-1, 2.2033196560109E-1, 2.2065062121274E-1, 2.2096960568588E-1, 2.2128891906447E-1, 2.2160856139163E-1, 2.2192853270953E-1, 2.2224883305947E-1, 2.2256946248182E-1, 2.2289042101607E-1, 2.2321170870077E-1, 2.2353332557359E-1, 2.2385527167125E-1, 2.2417754702958E-1, 2.2450015168349E-1, 2.2482308566696E-1, 2.2514634901306E-1, 2.2546994175391E-1, 2.2579386392072E-1, 2.2611811554379E-1, 2.2644269665244E-1, 2.2676760727511E-1, 2.2709284743926E-1, 2.2741841717144E-1, 2.2774431649725E-1, 2.2807054544134E-1, 2.2839710402743E-1, 2.2872399227828E-1, 2.2905121021571E-1, 2.2937875786058E-1, 2.2970663523282E-1, 2.3003484235136E-1, 2.3036337923422E-1, 2.3069224589843E-1, 2.3102144236006E-1, 2.3135096863424E-1, 2.3168082473511E-1, 2.3201101067583E-1, 2.3234152646864E-1, 2.3267237212474E-1, 2.3300354765441E-1, 2.3333505306693E-1, 2.3366688837059E-1, 2.3399905357272E-1, 2.3433154867966E-1, 2.3466437369676E-1, 2.3499752862838E-1, 2.3533101347789E-1, 2.3566482824768E-1, 2.3599897293913E-1, 2.3633344755263E-1, 2.3666825208757E-1, 2.3700338654235E-1, 2.3733885091436E-1, 2.3767464519996E-1, 2.3801076939455E-1, 2.3834722349249E-1, 2.3868400748712E-1, 2.3902112137080E-1, 2.3935856513485E-1, 2.3969633876958E-1, 2.4003444226427E-1, 2.4037287560719E-1, 2.4071163878559E-1, 2.4105073178567E-1, 2.4139015459263E-1, 2.4172990719063E-1, 2.4206998956278E-1, 2.4241040169118E-1, 2.4275114355688E-1, 2.4309221513990E-1, 2.4343361641921E-1, 2.4377534737274E-1, 2.4411740797737E-1, 2.4445979820896E-1, 2.4480251804227E-1, 2.4514556745107E-1, 2.4548894640802E-1, 2.4583265488476E-1, 2.4617669285186E-1, 2.4652106027883E-1, 2.4686575713413E-1, 2.4721078338515E-1, 2.4755613899820E-1, 2.4790182393854E-1, 2.4824783817035E-1, 2.4859418165676E-1, 2.4894085435979E-1, 2.4928785624041E-1, 2.4963518725851E-1, 2.4998284737289E-1, 2.5033083654128E-1, 2.5067915472031E-1, 2.5102780186554E-1, 2.5137677793145E-1, 2.5172608287139E-1, 2.5207571663766E-1, 2.5242567918145E-1, 2.5277597045285E-1, 2.5312659040086E-1, 2.5347753897337E-1, 2.5382881611718E-1, 2.5418042177798E-1, 2.5453235590036E-1, 2.5488461842779E-1, 2.5523720930264E-1, 2.5559012846616E-1, 2.5594337585850E-1, 2.5629695141868E-1, 2.5665085508461E-1, 2.5700508679309E-1, 2.5735964647976E-1, 2.5771453407919E-1, 2.5806974952479E-1, 2.5842529274884E-1, 2.5878116368252E-1, 2.5913736225584E-1, 2.5949388839772E-1, 2.5985074203590E-1, 2.6020792309703E-1, 2.6056543150657E-1, 2.6092326718888E-1, 2.6128143006716E-1, 2.6163992006347E-1, 2.6199873709872E-1, 2.6235788109268E-1, 2.6271735196395E-1, 2.6307714963000E-1, 2.6343727400714E-1, 2.6379772501051E-1, 2.6415850255411E-1, 2.6451960655078E-1, 2.6488103691219E-1, 2.6524279354884E-1, 2.6560487637008E-1, 2.6596728528410E-1, 2.6633002019788E-1, 2.6669308101729E-1, 2.6705646764697E-1, 2.6742017999042E-1, 2.6778421794996E-1, 2.6814858142673E-1, 2.6851327032067E-1, 2.6887828453057E-1, 2.6924362395403E-1, 2.6960928848744E-1, 2.6997527802603E-1, 2.7034159246383E-1, 2.7070823169368E-1, 2.7107519560724E-1, 2.7144248409496E-1, 2.7181009704610E-1, 2.7217803434872E-1, 2.7254629588968E-1, 2.7291488155466E-1, 2.7328379122810E-1, 2.7365302479327E-1, 2.7402258213221E-1, 2.7439246312577E-1, 2.7476266765357E-1, 2.7513319559405E-1, 2.7550404682440E-1, 2.7587522122063E-1, 2.7624671865750E-1, 2.7661853900859E-1, 2.7699068214622E-1, 2.7736314794151E-1, 2.7773593626437E-1, 2.7810904698346E-1, 2.7848247996623E-1, 2.7885623507889E-1, 2.7923031218643E-1, 2.7960471115261E-1, 2.7997943183994E-1, 2.8035447410972E-1, 2.8072983782200E-1, 2.8110552283560E-1, 2.8148152900808E-1, 2.8185785619578E-1, 2.8223450425380E-1, 2.8261147303598E-1, 2.8298876239493E-1, 2.8336637218200E-1, 2.8374430224729E-1, 2.8412255243967E-1, 2.8450112260673E-1, 2.8488001259483E-1, 2.8525922224906E-1, 2.8563875141326E-1, 2.8601859993001E-1, 2.8639876764063E-1, 2.8677925438519E-1, 2.8716006000248E-1, 2.8754118433004E-1, 2.8792262720413E-1, 2.8830438845975E-1, 2.8868646793064E-1, 2.8906886544927E-1, 2.8945158084681E-1, 2.8983461395320E-1, 2.9021796459707E-1, 2.9060163260579E-1, 2.9098561780546E-1, 2.9136992002088E-1, 2.9175453907560E-1, 2.9213947479185E-1, 2.9252472699061E-1, 2.9291029549157E-1, 2.9329618011311E-1, 2.9368238067236E-1, 2.9406889698513E-1, 2.9445572886596E-1, 2.9484287612809E-1, 2.9523033858347E-1, 2.9561811604275E-1, 2.9600620831530E-1, 2.9639461520917E-1, 2.9678333653114E-1, 2.9717237208668E-1, 2.9756172167994E-1, 2.9795138511379E-1, 2.9834136218980E-1, 2.9873165270822E-1, 2.9912225646801E-1, 2.9951317326680E-1, 2.9990440290094E-1, 3.0029594516546E-1, 3.0068779985406E-1, 3.0107996675916E-1, 3.0147244567185E-1, 3.0186523638191E-1, 3.0225833867779E-1, 3.0265175234664E-1, 3.0304547717430E-1, 3.0343951294527E-1, 3.0383385944273E-1, 3.0422851644856E-1, 3.0462348374330E-1, 3.0501876110616E-1, 3.0541434831506E-1, 3.0581024514654E-1, 3.0620645137587E-1, 3.0660296677695E-1, 3.0699979112237E-1, 3.0739692418337E-1, 3.0779436572990E-1, 3.0819211553053E-1, 3.0859017335252E-1, 3.0898853896179E-1, 3.0938721212294E-1, 3.0978619259920E-1, 3.1018548015249E-1, 3.1058507454339E-1, 3.1098497553112E-1, 3.1138518287358E-1, 3.1178569632731E-1, 3.1218651564752E-1, 3.1258764058808E-1, 3.1298907090150E-1, 3.1339080633896E-1, 3.1379284665027E-1, 3.1419519158392E-1, 3.1459784088703E-1, 3.1500079430538E-1, 3.1540405158340E-1, 3.1580761246416E-1, 3.1621147668940E-1, 3.1661564399947E-1, 3.1702011413340E-1, 3.1742488682885E-1, 3.1782996182212E-1, 3.1823533884816E-1, 3.1864101764056E-1, 3.1904699793156E-1, 3.1945327945203E-1, 3.1985986193147E-1, 3.2026674509805E-1, 3.2067392867856E-1, 3.2108141239841E-1, 3.2148919598168E-1, 3.2189727915106E-1, 3.2230566162789E-1, 3.2271434313215E-1, 3.2312332338243E-1, 3.2353260209598E-1, 3.2394217898865E-1, 3.2435205377496E-1, 3.2476222616803E-1, 3.2517269587962E-1, 3.2558346262013E-1, 3.2599452609857E-1, 3.2640588602260E-1, 3.2681754209849E-1, 3.2722949403114E-1, 3.2764174152407E-1, 3.2805428427945E-1, 3.2846712199806E-1, 3.2888025437929E-1, 3.2929368112118E-1, 3.2970740192037E-1, 3.3012141647213E-1, 3.3053572447038E-1, 3.3095032560761E-1, 3.3136521957497E-1, 3.3178040606222E-1, 3.3219588475774E-1, 3.3261165534852E-1, 3.3302771752018E-1, 3.3344407095696E-1, 3.3386071534171E-1, 3.3427765035590E-1, 3.3469487567962E-1, 3.3511239099159E-1, 3.3553019596911E-1, 3.3594829028812E-1, 3.3636667362318E-1, 3.3678534564746E-1, 3.3720430603274E-1, 3.3762355444942E-1, 3.3804309056650E-1, 3.3846291405162E-1, 3.3888302457101E-1, 3.3930342178951E-1, 3.3972410537060E-1, 3.4014507497635E-1, 3.4056633026745E-1, 3.4098787090320E-1, 3.4140969654150E-1, 3.4183180683889E-1, 3.4225420145049E-1, 3.4267688003004E-1, 3.4309984222991E-1, 3.4352308770106E-1, 3.4394661609305E-1, 3.4437042705408E-1, 3.4479452023094E-1, 3.4521889526904E-1, 3.4564355181238E-1, 3.4606848950359E-1, 3.4649370798389E-1, 3.4691920689314E-1, 3.4734498586978E-1, 3.4777104455086E-1, 3.4819738257206E-1, 3.4862399956765E-1, 3.4905089517051E-1, 3.4947806901213E-1, 3.4990552072262E-1, 3.5033324993068E-1, 3.5076125626363E-1, 3.5118953934739E-1, 3.5161809880651E-1, 3.5204693426411E-1, 3.5247604534196E-1, 3.5290543166040E-1, 3.5333509283842E-1, 3.5376502849357E-1, 3.5419523824206E-1, 3.5462572169866E-1, 3.5505647847679E-1, 3.5548750818845E-1, 3.5591881044426E-1, 3.5635038485346E-1, 3.5678223102388E-1, 3.5721434856196E-1, 3.5764673707277E-1, 3.5807939615998E-1, 3.5851232542585E-1, 3.5894552447128E-1, 3.5937899289577E-1, 3.5981273029742E-1, 3.6024673627295E-1, 3.6068101041770E-1, 3.6111555232560E-1, 3.6155036158922E-1, 3.6198543779971E-1, 3.6242078054685E-1, 3.6285638941904E-1, 3.6329226400329E-1, 3.6372840388519E-1, 3.6416480864900E-1, 3.6460147787754E-1, 3.6503841115229E-1, 3.6547560805331E-1, 3.6591306815930E-1, 3.6635079104756E-1, 3.6678877629402E-1, 3.6722702347320E-1, 3.6766553215826E-1, 3.6810430192099E-1, 3.6854333233176E-1, 3.6898262295958E-1, 3.6942217337209E-1, 3.6986198313553E-1, 3.7030205181476E-1, 3.7074237897328E-1, 3.7118296417319E-1, 3.7162380697523E-1, 3.7206490693874E-1, 3.7250626362171E-1, 3.7294787658072E-1, 3.7338974537101E-1, 3.7383186954642E-1, 3.7427424865943E-1, 3.7471688226112E-1, 3.7515976990124E-1, 3.7560291112814E-1, 3.7604630548878E-1, 3.7648995252879E-1, 3.7693385179241E-1, 3.7737800282250E-1, 3.7782240516057E-1, 3.7826705834674E-1, 3.7871196191980E-1, 3.7915711541712E-1, 3.7960251837475E-1, 3.8004817032736E-1, 3.8049407080824E-1, 3.8094021934934E-1, 3.8138661548125E-1, 3.8183325873316E-1, 3.8228014863295E-1, 3.8272728470710E-1, 3.8317466648075E-1, 3.8362229347769E-1, 3.8407016522033E-1, 3.8451828122974E-1, 3.8496664102563E-1, 3.8541524412636E-1, 3.8586409004894E-1, 3.8631317830900E-1, 3.8676250842086E-1, 3.8721207989746E-1, 3.8766189225041E-1, 3.8811194498996E-1, 3.8856223762501E-1, 3.8901276966313E-1, 3.8946354061052E-1, 3.8991454997207E-1, 3.9036579725130E-1, 3.9081728195040E-1, 3.9126900357022E-1, 3.9172096161026E-1, 3.9217315556870E-1, 3.9262558494238E-1, 3.9307824922678E-1, 3.9353114791608E-1, 3.9398428050310E-1, 3.9443764647935E-1, 3.9489124533500E-1, 3.9534507655887E-1, 3.9579913963850E-1, 3.9625343406005E-1, 3.9670795930840E-1, 3.9716271486707E-1, 3.9761770021828E-1, 3.9807291484293E-1, 3.9852835822057E-1, 3.9898402982947E-1, 3.9943992914656E-1, 3.9989605564747E-1, 4.0035240880649E-1, 4.0080898809661E-1, 4.0126579298953E-1, 4.0172282295561E-1, 4.0218007746392E-1, 4.0263755598220E-1, 4.0309525797691E-1, 4.0355318291320E-1, 4.0401133025491E-1, 4.0446969946457E-1, 4.0492829000344E-1, 4.0538710133146E-1, 4.0584613290728E-1, 4.0630538418824E-1, 4.0676485463042E-1, 4.0722454368858E-1, 4.0768445081620E-1, 4.0814457546547E-1, 4.0860491708730E-1, 4.0906547513130E-1, 4.0952624904582E-1, 4.0998723827792E-1, 4.1044844227336E-1, 4.1090986047664E-1, 4.1137149233099E-1, 4.1183333727835E-1, 4.1229539475940E-1, 4.1275766421355E-1, 4.1322014507892E-1, 4.1368283679239E-1, 4.1414573878955E-1, 4.1460885050475E-1, 4.1507217137107E-1, 4.1553570082031E-1, 4.1599943828304E-1, 4.1646338318856E-1, 4.1692753496492E-1, 4.1739189303892E-1, 4.1785645683610E-1, 4.1832122578076E-1, 4.1878619929595E-1, 4.1925137680349E-1, 4.1971675772392E-1, 4.2018234147659E-1, 4.2064812747956E-1, 4.2111411514970E-1, 4.2158030390262E-1, 4.2204669315271E-1, 4.2251328231310E-1, 4.2298007079574E-1, 4.2344705801131E-1, 4.2391424336930E-1, 4.2438162627795E-1, 4.2484920614430E-1, 4.2531698237417E-1, 4.2578495437215E-1, 4.2625312154164E-1, 4.2672148328482E-1, 4.2719003900264E-1, 4.2765878809487E-1, 4.2812772996008E-1, 4.2859686399560E-1, 4.2906618959762E-1, 4.2953570616107E-1, 4.3000541307972E-1, 4.3047530974615E-1, 4.3094539555173E-1, 4.3141566988667E-1, 4.3188613213995E-1, 4.3235678169941E-1, 4.3282761795169E-1, 4.3329864028224E-1, 4.3376984807537E-1, 4.3424124071417E-1, 4.3471281758060E-1, 4.3518457805542E-1, 4.3565652151824E-1, 4.3612864734750E-1, 4.3660095492049E-1, 4.3707344361331E-1, 4.3754611280094E-1, 4.3801896185719E-1, 4.3849199015472E-1, 4.3896519706503E-1, 4.3943858195849E-1, 4.3991214420431E-1, 4.4038588317058E-1, 4.4085979822424E-1, 4.4133388873108E-1, 4.4180815405579E-1, 4.4228259356189E-1, 4.4275720661179E-1, 4.4323199256679E-1, 4.4370695078704E-1, 4.4418208063159E-1, 4.4465738145836E-1, 4.4513285262417E-1, 4.4560849348470E-1, 4.4608430339455E-1, 4.4656028170720E-1, 4.4703642777504E-1, 4.4751274094932E-1, 4.4798922058025E-1, 4.4846586601689E-1, 4.4894267660725E-1, 4.4941965169822E-1, 4.4989679063562E-1, 4.5037409276419E-1, 4.5085155742756E-1, 4.5132918396831E-1, 4.5180697172794E-1, 4.5228492004688E-1, 4.5276302826447E-1, 4.5324129571900E-1, 4.5371972174771E-1, 4.5419830568675E-1, 4.5467704687123E-1, 4.5515594463520E-1, 4.5563499831166E-1, 4.5611420723256E-1, 4.5659357072881E-1, 4.5707308813027E-1, 4.5755275876576E-1, 4.5803258196308E-1, 4.5851255704897E-1, 4.5899268334915E-1, 4.5947296018833E-1, 4.5995338689017E-1, 4.6043396277733E-1, 4.6091468717144E-1, 4.6139555939311E-1, 4.6187657876196E-1, 4.6235774459658E-1, 4.6283905621457E-1, 4.6332051293251E-1, 4.6380211406600E-1, 4.6428385892964E-1, 4.6476574683703E-1, 4.6524777710079E-1, 4.6572994903254E-1, 4.6621226194294E-1, 4.6669471514165E-1, 4.6717730793737E-1, 4.6766003963781E-1, 4.6814290954972E-1, 4.6862591697889E-1, 4.6910906123015E-1, 4.6959234160734E-1, 4.7007575741339E-1, 4.7055930795024E-1, 4.7104299251889E-1, 4.7152681041942E-1, 4.7201076095093E-1, 4.7249484341160E-1, 4.7297905709868E-1, 4.7346340130848E-1, 4.7394787533637E-1, 4.7443247847682E-1, 4.7491721002336E-1, 4.7540206926860E-1, 4.7588705550426E-1, 4.7637216802112E-1, 4.7685740610907E-1, 4.7734276905708E-1, 4.7782825615324E-1, 4.7831386668474E-1, 4.7879959993785E-1, 4.7928545519798E-1, 4.7977143174965E-1, 4.8025752887648E-1, 4.8074374586123E-1, 4.8123008198578E-1, 4.8171653653113E-1, 4.8220310877743E-1, 4.8268979800393E-1, 4.8317660348907E-1, 4.8366352451039E-1, 4.8415056034459E-1, 4.8463771026754E-1, 4.8512497355424E-1, 4.8561234947885E-1, 4.8609983731471E-1, 4.8658743633430E-1, 4.8707514580930E-1, 4.8756296501053E-1, 4.8805089320800E-1, 4.8853892967091E-1, 4.8902707366765E-1, 4.8951532446576E-1, 4.9000368133202E-1, 4.9049214353237E-1, 4.9098071033197E-1, 4.9146938099517E-1, 4.9195815478555E-1, 4.9244703096586E-1, 4.9293600879812E-1, 4.9342508754352E-1, 4.9391426646250E-1, 4.9440354481472E-1, 4.9489292185907E-1, 4.9538239685368E-1, 4.9587196905591E-1, 4.9636163772237E-1, 4.9685140210892E-1, 4.9734126147065E-1, 4.9783121506193E-1, 4.9832126213638E-1, 4.9881140194688E-1, 4.9930163374557E-1, 4.9979195678388E-1, 5.0027490487865E-1, 5.0075244000058E-1, 5.0123006175931E-1, 5.0170776942323E-1, 5.0218556226008E-1, 5.0266343953688E-1, 5.0314140051998E-1, 5.0361944447506E-1, 5.0409757066712E-1, 5.0457577836048E-1, 5.0505406681881E-1, 5.0553243530510E-1, 5.0601088308170E-1, 5.0648940941030E-1, 5.0696801355193E-1, 5.0744669476698E-1, 5.0792545231521E-1, 5.0840428545573E-1, 5.0888319344702E-1, 5.0936217554692E-1, 5.0984123101266E-1, 5.1032035910085E-1, 5.1079955906746E-1, 5.1127883016787E-1, 5.1175817165684E-1, 5.1223758278853E-1, 5.1271706281649E-1, 5.1319661099370E-1, 5.1367622657251E-1, 5.1415590880472E-1, 5.1463565694150E-1, 5.1511547023349E-1, 5.1559534793073E-1, 5.1607528928268E-1, 5.1655529353825E-1, 5.1703535994577E-1, 5.1751548775304E-1, 5.1799567620728E-1, 5.1847592455516E-1, 5.1895623204282E-1, 5.1943659791585E-1, 5.1991702141930E-1, 5.2039750179770E-1, 5.2087803829502E-1, 5.2135863015475E-1, 5.2183927661983E-1, 5.2231997693268E-1, 5.2280073033524E-1, 5.2328153606890E-1, 5.2376239337459E-1, 5.2424330149272E-1, 5.2472425966319E-1, 5.2520526712544E-1, 5.2568632311842E-1, 5.2616742688058E-1, 5.2664857764991E-1, 5.2712977466392E-1, 5.2761101715966E-1, 5.2809230437370E-1, 5.2857363554218E-1, 5.2905500990075E-1, 5.2953642668465E-1, 5.3001788512863E-1, 5.3049938446703E-1, 5.3098092393375E-1, 5.3146250276224E-1, 5.3194412018555E-1, 5.3242577543627E-1, 5.3290746774660E-1, 5.3338919634832E-1, 5.3387096047280E-1, 5.3435275935098E-1, 5.3483459221344E-1, 5.3531645829034E-1, 5.3579835681144E-1, 5.3628028700614E-1, 5.3676224810342E-1, 5.3724423933191E-1, 5.3772625991986E-1, 5.3820830909515E-1, 5.3869038608529E-1, 5.3917249011742E-1, 5.3965462041836E-1, 5.4013677621453E-1, 5.4061895673204E-1, 5.4110116119664E-1, 5.4158338883376E-1, 5.4206563886847E-1, 5.4254791052553E-1, 5.4303020302938E-1, 5.4351251560412E-1, 5.4399484747355E-1, 5.4447719786116E-1, 5.4495956599014E-1, 5.4544195108335E-1, 5.4592435236339E-1, 5.4640676905255E-1, 5.4688920037284E-1, 5.4737164554596E-1, 5.4785410379338E-1, 5.4833657433625E-1, 5.4881905639549E-1, 5.4930154919172E-1, 5.4978405194534E-1, 5.5026656387645E-1, 5.5074908420494E-1, 5.5123161215044E-1, 5.5171414693232E-1, 5.5219668776975E-1, 5.5267923388164E-1, 5.5316178448668E-1, 5.5364433880335E-1, 5.5412689604989E-1, 5.5460945544435E-1, 5.5509201620456E-1, 5.5557457754815E-1, 5.5605713869254E-1, 5.5653969885498E-1, 5.5702225725250E-1, 5.5750481310198E-1, 5.5798736562009E-1, 5.5846991402334E-1, 5.5895245752806E-1, 5.5943499535043E-1, 5.5991752670645E-1, 5.6040005081197E-1, 5.6088256688270E-1, 5.6136507413419E-1, 5.6184757178186E-1, 5.6233005904096E-1, 5.6281253512666E-1, 5.6329499925395E-1, 5.6377745063774E-1, 5.6425988849278E-1, 5.6474231203374E-1, 5.6522472047517E-1, 5.6570711303151E-1, 5.6618948891710E-1, 5.6667184734620E-1, 5.6715418753296E-1, 5.6763650869146E-1, 5.6811881003569E-1, 5.6860109077956E-1, 5.6908335013694E-1, 5.6956558732159E-1, 5.7004780154723E-1, 5.7052999202753E-1, 5.7101215797609E-1, 5.7149429860649E-1, 5.7197641313223E-1, 5.7245850076680E-1, 5.7294056072366E-1, 5.7342259221621E-1, 5.7390459445787E-1, 5.7438656666201E-1, 5.7486850804199E-1, 5.7535041781117E-1, 5.7583229518291E-1, 5.7631413937055E-1, 5.7679594958746E-1, 5.7727772504700E-1, 5.7775946496255E-1, 5.7824116854752E-1, 5.7872283501534E-1, 5.7920446357945E-1, 5.7968605345335E-1, 5.8016760385058E-1, 5.8064911398469E-1, 5.8113058306931E-1, 5.8161201031812E-1, 5.8209339494484E-1, 5.8257473616327E-1, 5.8305603318727E-1, 5.8353728523078E-1, 5.8401849150780E-1, 5.8449965123243E-1, 5.8498076361885E-1, 5.8546182788133E-1, 5.8594284323423E-1, 5.8642380889202E-1, 5.8690472406928E-1, 5.8738558798068E-1, 5.8786639984103E-1, 5.8834715886525E-1, 5.8882786426838E-1, 5.8930851526559E-1, 5.8978911107219E-1, 5.9026965090363E-1, 5.9075013397550E-1, 5.9123055950354E-1, 5.9171092670364E-1, 5.9219123479186E-1, 5.9267148298440E-1, 5.9315167049765E-1, 5.9363179654816E-1, 5.9411186035267E-1, 5.9459186112809E-1, 5.9507179809152E-1, 5.9555167046025E-1, 5.9603147745178E-1, 5.9651121828379E-1, 5.9699089217418E-1, 5.9747049834105E-1, 5.9795003600273E-1, 5.9842950437776E-1, 5.9890890268490E-1, 5.9938823014316E-1, 5.9986748597176E-1, 6.0034666939017E-1, 6.0082577961811E-1, 6.0130481587555E-1, 6.0178377738269E-1, 6.0226266336001E-1, 6.0274147302824E-1, 6.0322020560841E-1, 6.0369886032176E-1, 6.0417743638988E-1, 6.0465593303458E-1, 6.0513434947798E-1, 6.0561268494252E-1, 6.0609093865088E-1, 6.0656910982608E-1, 6.0704719769144E-1, 6.0752520147058E-1, 6.0800312038744E-1, 6.0848095366628E-1, 6.0895870053168E-1, 6.0943636020854E-1, 6.0991393192213E-1, 6.1039141489802E-1, 6.1086880836213E-1, 6.1134611154073E-1, 6.1182332366047E-1, 6.1230044394831E-1, 6.1277747163159E-1, 6.1325440593804E-1, 6.1373124609572E-1, 6.1420799133310E-1, 6.1468464087902E-1, 6.1516119396268E-1, 6.1563764981370E-1, 6.1611400766209E-1, 6.1659026673825E-1, 6.1706642627298E-1, 6.1754248549750E-1, 6.1801844364343E-1, 6.1849429994282E-1, 6.1897005362814E-1, 6.1944570393226E-1, 6.1992125008852E-1, 6.2039669133068E-1, 6.2087202689292E-1, 6.2134725600990E-1, 6.2182237791671E-1, 6.2229739184888E-1, 6.2277229704244E-1, 6.2324709273383E-1, 6.2372177816000E-1, 6.2419635255835E-1, 6.2467081516677E-1, 6.2514516522362E-1, 6.2561940196775E-1, 6.2609352463850E-1, 6.2656753247570E-1, 6.2704142471970E-1, 6.2751520061133E-1, 6.2798885939193E-1, 6.2846240030337E-1, 6.2893582258802E-1, 6.2940912548878E-1, 6.2988230824907E-1, 6.3035537011286E-1, 6.3082831032463E-1, 6.3130112812941E-1, 6.3177382277277E-1, 6.3224639350085E-1, 6.3271883956032E-1, 6.3319116019841E-1, 6.3366335466291E-1, 6.3413542220230E-1, 6.3460736206520E-1, 6.3507917350142E-1, 6.3555085576096E-1, 6.3602240809448E-1, 6.3649382975324E-1, 6.3696511998910E-1, 6.3743627805451E-1, 6.3790730320253E-1, 6.3837819468681E-1, 6.3884895176162E-1, 6.3931957368184E-1, 6.3979005970298E-1, 6.4026040908116E-1, 6.4073062107315E-1, 6.4120069493632E-1, 6.4167062992869E-1, 6.4214042530894E-1, 6.4261008033637E-1, 6.4307959427094E-1, 6.4354896637325E-1, 6.4401819590459E-1, 6.4448728212687E-1, 6.4495622430271E-1, 6.4542502169536E-1, 6.4589367356878E-1, 6.4636217918757E-1, 6.4683053781707E-1, 6.4729874872324E-1, 6.4776681117279E-1, 6.4823472443310E-1, 6.4870248777224E-1, 6.4917010045901E-1, 6.4963756176289E-1, 6.5010487095411E-1, 6.5057202730359E-1, 6.5103903008297E-1, 6.5150587856462E-1, 6.5197257202165E-1, 6.5243910972790E-1, 6.5290549095794E-1, 6.5337171498709E-1, 6.5383778109140E-1, 6.5430368854769E-1, 6.5476943663353E-1, 6.5523502462724E-1, 6.5570045180790E-1, 6.5616571745539E-1, 6.5663082085030E-1, 6.5709576127406E-1, 6.5756053800883E-1, 6.5802515033757E-1, 6.5848959754404E-1, 6.5895387891277E-1, 6.5941799372910E-1, 6.5988194127915E-1, 6.6034572084986E-1, 6.6080933172898E-1, 6.6127277320505E-1, 6.6173604456744E-1, 6.6219914510634E-1, 6.6266207411276E-1, 6.6312483087852E-1, 6.6358741469631E-1, 6.6404982485960E-1, 6.6451206066276E-1, 6.6497412140094E-1, 6.6543600637018E-1, 6.6589771486737E-1, 6.6635924619021E-1, 6.6682059963731E-1, 6.6728177450811E-1, 6.6774277010293E-1, 6.6820358572295E-1, 6.6866422067023E-1, 6.6912467424769E-1, 6.6958494575917E-1, 6.7004503450934E-1, 6.7050493980381E-1, 6.7096466094904E-1, 6.7142419725242E-1, 6.7188354802221E-1, 6.7234271256760E-1, 6.7280169019866E-1, 6.7326048022639E-1, 6.7371908196270E-1, 6.7417749472043E-1, 6.7463571781330E-1, 6.7509375055600E-1, 6.7555159226414E-1, 6.7600924225424E-1, 6.7646669984378E-1, 6.7692396435117E-1, 6.7738103509577E-1, 6.7783791139787E-1, 6.7829459257874E-1, 6.7875107796057E-1, 6.7920736686654E-1, 6.7966345862077E-1, 6.8011935254835E-1, 6.8057504797534E-1, 6.8103054422878E-1, 6.8148584063668E-1, 6.8194093652802E-1, 6.8239583123277E-1, 6.8285052408188E-1, 6.8330501440732E-1, 6.8375930154200E-1, 6.8421338481987E-1, 6.8466726357587E-1, 6.8512093714593E-1, 6.8557440486700E-1, 6.8602766607703E-1, 6.8648072011500E-1, 6.8693356632088E-1, 6.8738620403569E-1, 6.8783863260146E-1, 6.8829085136125E-1, 6.8874285965913E-1, 6.8919465684024E-1, 6.8964624225073E-1, 6.9009761523781E-1, 6.9054877514971E-1, 6.9099972133572E-1, 6.9145045314619E-1, 6.9190096993251E-1, 6.9235127104712E-1, 6.9280135584354E-1, 6.9325122367634E-1, 6.9370087390116E-1, 6.9415030587471E-1, 6.9459951895477E-1, 6.9504851250020E-1, 6.9549728587092E-1, 6.9594583842797E-1, 6.9639416953345E-1, 6.9684227855055E-1, 6.9729016484354E-1, 6.9773782777782E-1, 6.9818526671986E-1, 6.9863248103723E-1, 6.9907947009861E-1, 6.9952623327380E-1, 6.9997276993368E-1, 7.0041907945028E-1, 7.0086516119671E-1, 7.0131101454723E-1, 7.0175663887720E-1, 7.0220203356311E-1, 7.0264719798259E-1, 7.0309213151437E-1, 7.0353683353836E-1, 7.0398130343557E-1, 7.0442554058816E-1, 7.0486954437944E-1, 7.0531331419384E-1, 7.0575684941699E-1, 7.0620014943561E-1, 7.0664321363761E-1, 7.0708604141205E-1, 7.0752863214915E-1, 7.0797098524029E-1, 7.0841310007802E-1, 7.0885497605605E-1, 7.0929661256927E-1, 7.0973800901372E-1, 7.1017916478666E-1, 7.1062007928648E-1, 7.1106075191279E-1, 7.1150118206637E-1, 7.1194136914918E-1, 7.1238131256438E-1, 7.1282101171631E-1, 7.1326046601053E-1, 7.1369967485376E-1, 7.1413863765396E-1, 7.1457735382027E-1, 7.1501582276304E-1, 7.1545404389382E-1, 7.1589201662539E-1, 7.1632974037172E-1, 7.1676721454802E-1, 7.1720443857070E-1, 7.1764141185740E-1, 7.1807813382697E-1, 7.1851460389951E-1, 7.1895082149633E-1, 7.1938678603997E-1, 7.1982249695421E-1, 7.2025795366406E-1, 7.2069315559579E-1, 7.2112810217687E-1, 7.2156279283604E-1, 7.2199722700329E-1, 7.2243140410984E-1, 7.2286532358817E-1, 7.2329898487201E-1, 7.2373238739635E-1, 7.2416553059742E-1, 7.2459841391273E-1, 7.2503103678105E-1, 7.2546339864239E-1, 7.2589549893805E-1, 7.2632733711059E-1, 7.2675891260384E-1, 7.2719022486290E-1, 7.2762127333416E-1, 7.2805205746527E-1, 7.2848257670517E-1, 7.2891283050407E-1, 7.2934281831348E-1, 7.2977253958618E-1, 7.3020199377624E-1, 7.3063118033903E-1, 7.3106009873120E-1, 7.3148874841072E-1, 7.3191712883681E-1, 7.3234523947004E-1, 7.3277307977224E-1, 7.3320064920657E-1, 7.3362794723747E-1, 7.3405497333070E-1, 7.3448172695334E-1, 7.3490820757375E-1, 7.3533441466164E-1, 7.3576034768800E-1, 7.3618600612515E-1, 7.3661138944674E-1, 7.3703649712772E-1, 7.3746132864437E-1, 7.3788588347429E-1, 7.3831016109643E-1, 7.3873416099102E-1, 7.3915788263967E-1, 7.3958132552529E-1, 7.4000448913212E-1, 7.4042737294576E-1, 7.4084997645313E-1, 7.4127229914249E-1, 7.4169434050343E-1, 7.4211610002690E-1, 7.4253757720519E-1, 7.4295877153193E-1, 7.4337968250209E-1, 7.4380030961200E-1, 7.4422065235933E-1, 7.4464071024313E-1, 7.4506048276376E-1, 7.4547996942296E-1, 7.4589916972383E-1, 7.4631808317083E-1, 7.4673670926975E-1, 7.4715504752778E-1, 7.4757309745346E-1, 7.4799085855668E-1, 7.4840833034871E-1, 7.4882551234218E-1, 7.4924240405111E-1, 7.4965900499087E-1, 7.5007531467819E-1, 7.5049133263121E-1, 7.5090705836942E-1, 7.5132249141369E-1, 7.5173763128626E-1, 7.5215247751078E-1, 7.5256702961225E-1, 7.5298128711705E-1, 7.5339524955297E-1, 7.5380891644916E-1, 7.5422228733618E-1, 7.5463536174595E-1, 7.5504813921179E-1, 7.5546061926841E-1, 7.5587280145193E-1, 7.5628468529983E-1, 7.5669627035101E-1, 7.5710755614574E-1, 7.5751854222571E-1, 7.5792922813399E-1, 7.5833961341507E-1, 7.5874969761481E-1, 7.5915948028049E-1, 7.5956896096080E-1, 7.5997813920581E-1, 7.6038701456702E-1, 7.6079558659730E-1, 7.6120385485097E-1, 7.6161181888372E-1, 7.6201947825268E-1, 7.6242683251636E-1, 7.6283388123471E-1, 7.6324062396906E-1, 7.6364706028218E-1, 7.6405318973825E-1, 7.6445901190284E-1, 7.6486452634297E-1, 7.6526973262706E-1, 7.6567463032494E-1, 7.6607921900787E-1, 7.6648349824853E-1, 7.6688746762101E-1, 7.6729112670084E-1, 7.6769447506496E-1, 7.6809751229172E-1, 7.6850023796092E-1, 7.6890265165377E-1, 7.6930475295291E-1, 7.6970654144239E-1, 7.7010801670772E-1, 7.7050917833581E-1, 7.7091002591502E-1, 7.7131055903510E-1, 7.7171077728729E-1, 7.7211068026421E-1, 7.7251026755993E-1, 7.7290953876996E-1, 7.7330849349123E-1, 7.7370713132211E-1, 7.7410545186241E-1, 7.7450345471336E-1, 7.7490113947764E-1, 7.7529850575935E-1, 7.7569555316406E-1, 7.7609228129873E-1, 7.7648868977179E-1, 7.7688477819311E-1, 7.7728054617399E-1, 7.7767599332716E-1, 7.7807111926680E-1, 7.7846592360854E-1, 7.7886040596944E-1, 7.7925456596800E-1, 7.7964840322416E-1, 7.8004191735932E-1, 7.8043510799631E-1, 7.8082797475940E-1, 7.8122051727431E-1, 7.8161273516820E-1, 7.8200462806969E-1, 7.8239619560882E-1, 7.8278743741709E-1, 7.8317835312745E-1, 7.8356894237428E-1, 7.8395920479343E-1, 7.8434914002217E-1, 7.8473874769924E-1, 7.8512802746482E-1, 7.8551697896052E-1, 7.8590560182942E-1, 7.8629389571605E-1, 7.8668186026638E-1, 7.8706949512781E-1, 7.8745679994922E-1, 7.8784377438093E-1, 7.8823041807469E-1, 7.8861673068373E-1, 7.8900271186270E-1, 7.8938836126773E-1, 7.8977367855637E-1, 7.9015866338763E-1, 7.9054331542198E-1, 7.9092763432134E-1, 7.9131161974906E-1, 7.9169527136996E-1, 7.9207858885030E-1, 7.9246157185780E-1, 7.9284422006162E-1, 7.9322653313237E-1, 7.9360851074212E-1, 7.9399015256439E-1, 7.9437145827414E-1, 7.9475242754778E-1, 7.9513306006319E-1, 7.9551335549968E-1, 7.9589331353801E-1, 7.9627293386041E-1, 7.9665221615053E-1, 7.9703116009350E-1, 7.9740976537588E-1, 7.9778803168568E-1, 7.9816595871238E-1, 7.9854354614688E-1, 7.9892079368155E-1, 7.9929770101020E-1, 7.9967426782810E-1, 8.0005049383194E-1, 8.0042637871989E-1, 8.0080192219156E-1, 8.0117712394800E-1, 8.0155198369170E-1, 8.0192650112663E-1, 8.0230067595817E-1, 8.0267450789316E-1, 8.0304799663990E-1, 8.0342114190812E-1, 8.0379394340900E-1, 8.0416640085516E-1, 8.0453851396068E-1, 8.0491028244108E-1, 8.0528170601331E-1, 8.0565278439578E-1, 8.0602351730833E-1, 8.0639390447226E-1, 8.0676394561030E-1, 8.0713364044663E-1, 8.0750298870686E-1, 8.0787199011806E-1, 8.0824064440872E-1, 8.0860895130878E-1, 8.0897691054963E-1, 8.0934452186408E-1, 8.0971178498640E-1, 8.1007869965229E-1, 8.1044526559887E-1, 8.1081148256472E-1, 8.1117735028985E-1, 8.1154286851571E-1, 8.1190803698518E-1, 8.1227285544257E-1, 8.1263732363363E-1, 8.1300144130556E-1, 8.1336520820696E-1, 8.1372862408789E-1, 8.1409168869984E-1, 8.1445440179571E-1, 8.1481676312984E-1, 8.1517877245802E-1, 8.1554042953745E-1, 8.1590173412676E-1, 8.1626268598600E-1, 8.1662328487667E-1, 8.1698353056168E-1, 8.1734342280536E-1, 8.1770296137348E-1, 8.1806214603323E-1, 8.1842097655322E-1, 8.1877945270348E-1, 8.1913757425547E-1, 8.1949534098205E-1, 8.1985275265754E-1, 8.2020980905764E-1, 8.2056650995948E-1, 8.2092285514162E-1, 8.2127884438402E-1, 8.2163447746807E-1, 8.2198975417657E-1, 8.2234467429372E-1, 8.2269923760516E-1, 8.2305344389791E-1, 8.2340729296043E-1, 8.2376078458258E-1, 8.2411391855562E-1, 8.2446669467223E-1, 8.2481911272650E-1, 8.2517117251391E-1, 8.2552287383137E-1, 8.2587421647716E-1, 8.2622520025100E-1, 8.2657582495399E-1, 8.2692609038864E-1, 8.2727599635885E-1, 8.2762554266994E-1, 8.2797472912860E-1, 8.2832355554294E-1, 8.2867202172246E-1, 8.2902012747806E-1, 8.2936787262201E-1, 8.2971525696800E-1, 8.3006228033111E-1, 8.3040894252778E-1, 8.3075524337589E-1, 8.3110118269466E-1, 8.3144676030472E-1, 8.3179197602809E-1, 8.3213682968816E-1, 8.3248132110972E-1, 8.3282545011892E-1, 8.3316921654333E-1, 8.3351262021185E-1, 8.3385566095479E-1, 8.3419833860384E-1, 8.3454065299205E-1, 8.3488260395385E-1, 8.3522419132506E-1, 8.3556541494285E-1, 8.3590627464576E-1, 8.3624677027373E-1, 8.3658690166803E-1, 8.3692666867134E-1, 8.3726607112765E-1, 8.3760510888237E-1, 8.3794378178225E-1, 8.3828208967539E-1, 8.3862003241127E-1, 8.3895760984073E-1, 8.3929482181594E-1, 8.3963166819046E-1, 8.3996814881920E-1, 8.4030426355840E-1, 8.4064001226567E-1, 8.4097539479998E-1, 8.4131041102163E-1, 8.4164506079228E-1, 8.4197934397494E-1, 8.4231326043394E-1, 8.4264681003500E-1, 8.4297999264513E-1, 8.4331280813272E-1, 8.4364525636748E-1, 8.4397733722047E-1, 8.4430905056408E-1, 8.4464039627202E-1, 8.4497137421937E-1, 8.4530198428250E-1, 8.4563222633914E-1, 8.4596210026835E-1, 8.4629160595049E-1, 8.4662074326727E-1, 8.4694951210172E-1, 8.4727791233818E-1, 8.4760594386233E-1, 8.4793360656116E-1, 8.4826090032297E-1, 8.4858782503739E-1, 8.4891438059536E-1, 8.4924056688913E-1, 8.4956638381227E-1, 8.4989183125964E-1, 8.5021690912743E-1, 8.5054161731313E-1, 8.5086595571554E-1, 8.5118992423474E-1, 8.5151352277213E-1, 8.5183675123042E-1, 8.5215960951360E-1, 8.5248209752697E-1, 8.5280421517710E-1, 8.5312596237189E-1, 8.5344733902051E-1, 8.5376834503341E-1, 8.5408898032234E-1, 8.5440924480036E-1, 8.5472913838176E-1, 8.5504866098217E-1, 8.5536781251846E-1, 8.5568659290880E-1, 8.5600500207263E-1, 8.5632303993067E-1, 8.5664070640491E-1, 8.5695800141862E-1, 8.5727492489632E-1, 8.5759147676383E-1, 8.5790765694821E-1, 8.5822346537779E-1, 8.5853890198218E-1, 8.5885396669223E-1, 8.5916865944007E-1, 8.5948298015907E-1, 8.5979692878386E-1, 8.6011050525032E-1, 8.6042370949561E-1, 8.6073654145811E-1, 8.6104900107745E-1, 8.6136108829452E-1, 8.6167280305145E-1, 8.6198414529161E-1, 8.6229511495961E-1, 8.6260571200130E-1, 8.6291593636378E-1, 8.6322578799536E-1, 8.6353526684560E-1, 8.6384437286530E-1, 8.6415310600646E-1, 8.6446146622234E-1, 8.6476945346741E-1, 8.6507706769735E-1, 8.6538430886909E-1, 8.6569117694076E-1, 8.6599767187171E-1, 8.6630379362252E-1, 8.6660954215496E-1, 8.6691491743203E-1, 8.6721991941794E-1, 8.6752454807809E-1, 8.6782880337911E-1, 8.6813268528882E-1, 8.6843619377623E-1, 8.6873932881158E-1, 8.6904209036629E-1, 8.6934447841296E-1, 8.6964649292542E-1, 8.6994813387866E-1, 8.7024940124887E-1, 8.7055029501344E-1, 8.7085081515093E-1, 8.7115096164109E-1, 8.7145073446484E-1, 8.7175013360430E-1, 8.7204915904276E-1, 8.7234781076466E-1, 8.7264608875566E-1, 8.7294399300255E-1, 8.7324152349330E-1, 8.7353868021707E-1, 8.7383546316416E-1, 8.7413187232602E-1, 8.7442790769531E-1, 8.7472356926579E-1, 8.7501885703242E-1, 8.7531377099129E-1, 8.7560831113966E-1, 8.7590247747592E-1, 8.7619626999962E-1, 8.7648968871145E-1, 8.7678273361326E-1, 8.7707540470801E-1, 8.7736770199983E-1, 8.7765962549398E-1, 8.7795117519683E-1, 8.7824235111592E-1, 8.7853315325989E-1, 8.7882358163852E-1, 8.7911363626273E-1, 8.7940331714454E-1, 8.7969262429711E-1, 8.7998155773470E-1, 8.8027011747272E-1, 8.8055830352765E-1, 8.8084611591712E-1, 8.8113355465986E-1, 8.8142061977571E-1, 8.8170731128560E-1, 8.8199362921160E-1, 8.8227957357683E-1, 8.8256514440557E-1, 8.8285034172314E-1, 8.8313516555600E-1, 8.8341961593167E-1, 8.8370369287879E-1, 8.8398739642707E-1, 8.8427072660730E-1, 8.8455368345138E-1, 8.8483626699226E-1, 8.8511847726400E-1, 8.8540031430171E-1, 8.8568177814160E-1, 8.8596286882093E-1, 8.8624358637805E-1, 8.8652393085236E-1, 8.8680390228434E-1, 8.8708350071553E-1, 8.8736272618852E-1, 8.8764157874697E-1, 8.8792005843561E-1, 8.8819816530020E-1, 8.8847589938755E-1, 8.8875326074556E-1, 8.8903024942312E-1, 8.8930686547021E-1, 8.8958310893783E-1, 8.8985897987804E-1, 8.9013447834391E-1, 8.9040960438958E-1, 8.9068435807018E-1, 8.9095873944193E-1, 8.9123274856202E-1, 8.9150638548870E-1, 8.9177965028124E-1, 8.9205254299993E-1, 8.9232506370608E-1, 8.9259721246200E-1, 8.9286898933106E-1, 8.9314039437758E-1, 8.9341142766695E-1, 8.9368208926554E-1, 8.9395237924071E-1, 8.9422229766086E-1, 8.9449184459536E-1, 8.9476102011459E-1, 8.9502982428994E-1, 8.9529825719376E-1, 8.9556631889943E-1, 8.9583400948129E-1, 8.9610132901468E-1, 8.9636827757592E-1, 8.9663485524232E-1, 8.9690106209216E-1, 8.9716689820470E-1, 8.9743236366018E-1, 8.9769745853981E-1, 8.9796218292575E-1, 8.9822653690117E-1, 8.9849052055017E-1, 8.9875413395782E-1, 8.9901737721016E-1, 8.9928025039418E-1, 8.9954275359784E-1, 8.9980488691003E-1, 9.0006665042061E-1, 9.0032804422038E-1, 9.0058906840108E-1, 9.0084972305541E-1, 9.0111000827701E-1, 9.0136992416044E-1, 9.0162947080121E-1, 9.0188864829577E-1, 9.0214745674149E-1, 9.0240589623668E-1, 9.0266396688056E-1, 9.0292166877329E-1, 9.0317900201596E-1, 9.0343596671055E-1, 9.0369256295999E-1, 9.0394879086810E-1, 9.0420465053962E-1, 9.0446014208022E-1, 9.0471526559644E-1, 9.0497002119575E-1, 9.0522440898653E-1, 9.0547842907803E-1, 9.0573208158044E-1, 9.0598536660480E-1, 9.0623828426307E-1, 9.0649083466811E-1, 9.0674301793364E-1, 9.0699483417428E-1, 9.0724628350555E-1, 9.0749736604381E-1, 9.0774808190634E-1, 9.0799843121128E-1, 9.0824841407763E-1, 9.0849803062529E-1, 9.0874728097500E-1, 9.0899616524838E-1, 9.0924468356793E-1, 9.0949283605698E-1, 9.0974062283973E-1, 9.0998804404125E-1, 9.1023509978746E-1, 9.1048179020512E-1, 9.1072811542184E-1, 9.1097407556610E-1, 9.1121967076719E-1, 9.1146490115527E-1, 9.1170976686132E-1, 9.1195426801718E-1, 9.1219840475551E-1, 9.1244217720979E-1, 9.1268558551436E-1, 9.1292862980436E-1, 9.1317131021577E-1, 9.1341362688539E-1, 9.1365557995083E-1, 9.1389716955054E-1, 9.1413839582377E-1, 9.1437925891057E-1, 9.1461975895183E-1, 9.1485989608923E-1, 9.1509967046526E-1, 9.1533908222320E-1, 9.1557813150716E-1, 9.1581681846201E-1, 9.1605514323345E-1, 9.1629310596796E-1, 9.1653070681281E-1, 9.1676794591605E-1, 9.1700482342653E-1, 9.1724133949389E-1, 9.1747749426852E-1, 9.1771328790161E-1, 9.1794872054514E-1, 9.1818379235184E-1, 9.1841850347522E-1, 9.1865285406956E-1, 9.1888684428990E-1, 9.1912047429205E-1, 9.1935374423259E-1, 9.1958665426884E-1, 9.1981920455890E-1, 9.2005139526160E-1, 9.2028322653654E-1, 9.2051469854406E-1, 9.2074581144525E-1, 9.2097656540194E-1, 9.2120696057672E-1, 9.2143699713289E-1, 9.2166667523452E-1, 9.2189599504640E-1, 9.2212495673404E-1, 9.2235356046369E-1, 9.2258180640235E-1, 9.2280969471770E-1, 9.2303722557819E-1, 9.2326439915295E-1, 9.2349121561186E-1, 9.2371767512550E-1, 9.2394377786515E-1, 9.2416952400284E-1, 9.2439491371126E-1, 9.2461994716385E-1, 9.2484462453473E-1, 9.2506894599871E-1, 9.2529291173133E-1, 9.2551652190881E-1, 9.2573977670805E-1, 9.2596267630667E-1, 9.2618522088295E-1, 9.2640741061589E-1, 9.2662924568514E-1, 9.2685072627105E-1, 9.2707185255465E-1, 9.2729262471764E-1, 9.2751304294241E-1, 9.2773310741200E-1, 9.2795281831013E-1, 9.2817217582120E-1, 9.2839118013025E-1, 9.2860983142300E-1, 9.2882812988583E-1, 9.2904607570577E-1, 9.2926366907052E-1, 9.2948091016841E-1, 9.2969779918844E-1, 9.2991433632025E-1, 9.3013052175413E-1, 9.3034635568102E-1, 9.3056183829248E-1, 9.3077696978074E-1, 9.3099175033863E-1, 9.3120618015964E-1, 9.3142025943789E-1, 9.3163398836811E-1, 9.3184736714569E-1, 9.3206039596662E-1, 9.3227307502751E-1, 9.3248540452561E-1, 9.3269738465876E-1, 9.3290901562545E-1, 9.3312029762476E-1, 9.3333123085637E-1, 9.3354181552060E-1, 9.3375205181835E-1, 9.3396193995114E-1, 9.3417148012107E-1, 9.3438067253087E-1, 9.3458951738383E-1, 9.3479801488387E-1, 9.3500616523547E-1, 9.3521396864373E-1, 9.3542142531430E-1, 9.3562853545346E-1, 9.3583529926803E-1, 9.3604171696543E-1, 9.3624778875367E-1, 9.3645351484132E-1, 9.3665889543751E-1, 9.3686393075197E-1, 9.3706862099497E-1, 9.3727296637738E-1, 9.3747696711061E-1, 9.3768062340662E-1, 9.3788393547796E-1, 9.3808690353773E-1, 9.3828952779956E-1, 9.3849180847765E-1, 9.3869374578677E-1, 9.3889533994219E-1, 9.3909659115978E-1, 9.3929749965590E-1, 9.3949806564750E-1, 9.3969828935203E-1, 9.3989817098750E-1, 9.4009771077245E-1, 9.4029690892594E-1, 9.4049576566756E-1, 9.4069428121746E-1, 9.4089245579626E-1, 9.4109028962515E-1, 9.4128778292583E-1, 9.4148493592049E-1, 9.4168174883187E-1, 9.4187822188320E-1, 9.4207435529825E-1, 9.4227014930126E-1, 9.4246560411701E-1, 9.4266071997078E-1, 9.4285549708832E-1, 9.4304993569593E-1, 9.4324403602037E-1, 9.4343779828892E-1, 9.4363122272932E-1, 9.4382430956985E-1, 9.4401705903923E-1, 9.4420947136670E-1, 9.4440154678197E-1, 9.4459328551524E-1, 9.4478468779717E-1, 9.4497575385894E-1, 9.4516648393216E-1, 9.4535687824893E-1, 9.4554693704184E-1, 9.4573666054392E-1, 9.4592604898869E-1, 9.4611510261011E-1, 9.4630382164263E-1, 9.4649220632114E-1, 9.4668025688100E-1, 9.4686797355801E-1, 9.4705535658844E-1, 9.4724240620902E-1, 9.4742912265689E-1, 9.4761550616968E-1, 9.4780155698544E-1, 9.4798727534267E-1, 9.4817266148032E-1, 9.4835771563776E-1, 9.4854243805480E-1, 9.4872682897170E-1, 9.4891088862914E-1, 9.4909461726822E-1, 9.4927801513050E-1, 9.4946108245793E-1, 9.4964381949290E-1, 9.4982622647821E-1, 9.5000830365711E-1, 9.5019005127323E-1, 9.5037146957063E-1, 9.5055255879378E-1, 9.5073331918757E-1, 9.5091375099730E-1, 9.5109385446865E-1, 9.5127362984773E-1, 9.5145307738105E-1, 9.5163219731551E-1, 9.5181098989841E-1, 9.5198945537745E-1, 9.5216759400072E-1, 9.5234540601671E-1, 9.5252289167429E-1, 9.5270005122271E-1, 9.5287688491164E-1, 9.5305339299108E-1, 9.5322957571146E-1, 9.5340543332356E-1, 9.5358096607856E-1, 9.5375617422798E-1, 9.5393105802375E-1, 9.5410561771816E-1, 9.5427985356384E-1, 9.5445376581384E-1, 9.5462735472152E-1, 9.5480062054064E-1, 9.5497356352531E-1, 9.5514618393000E-1, 9.5531848200952E-1, 9.5549045801906E-1, 9.5566211221415E-1, 9.5583344485066E-1, 9.5600445618483E-1, 9.5617514647324E-1, 9.5634551597280E-1, 9.5651556494077E-1, 9.5668529363476E-1, 9.5685470231271E-1, 9.5702379123289E-1, 9.5719256065392E-1, 9.5736101083475E-1, 9.5752914203463E-1, 9.5769695451319E-1, 9.5786444853034E-1, 9.5803162434635E-1, 9.5819848222178E-1, 9.5836502241753E-1, 9.5853124519481E-1, 9.5869715081516E-1, 9.5886273954043E-1, 9.5902801163276E-1, 9.5919296735464E-1, 9.5935760696882E-1, 9.5952193073841E-1, 9.5968593892678E-1, 9.5984963179763E-1, 9.6001300961496E-1, 9.6017607264304E-1, 9.6033882114647E-1, 9.6050125539013E-1, 9.6066337563921E-1, 9.6082518215915E-1, 9.6098667521573E-1, 9.6114785507499E-1, 9.6130872200324E-1, 9.6146927626712E-1, 9.6162951813351E-1, 9.6178944786958E-1, 9.6194906574279E-1, 9.6210837202086E-1, 9.6226736697180E-1, 9.6242605086389E-1, 9.6258442396566E-1, 9.6274248654592E-1, 9.6290023887377E-1, 9.6305768121854E-1, 9.6321481384983E-1, 9.6337163703752E-1, 9.6352815105173E-1, 9.6368435616285E-1, 9.6384025264152E-1, 9.6399584075862E-1, 9.6415112078531E-1, 9.6430609299297E-1, 9.6446075765325E-1, 9.6461511503804E-1, 9.6476916541947E-1, 9.6492290906992E-1, 9.6507634626199E-1, 9.6522947726855E-1, 9.6538230236270E-1, 9.6553482181774E-1, 9.6568703590725E-1, 9.6583894490502E-1, 9.6599054908507E-1, 9.6614184872164E-1, 9.6629284408922E-1, 9.6644353546251E-1, 9.6659392311643E-1, 9.6674400732612E-1, 9.6689378836694E-1, 9.6704326651448E-1, 9.6719244204454E-1, 9.6734131523312E-1, 9.6748988635644E-1, 9.6763815569094E-1, 9.6778612351326E-1, 9.6793379010024E-1, 9.6808115572895E-1, 9.6822822067662E-1, 9.6837498522073E-1, 9.6852144963893E-1, 9.6866761420906E-1, 9.6881347920920E-1, 9.6895904491758E-1, 9.6910431161264E-1, 9.6924927957301E-1, 9.6939394907751E-1, 9.6953832040515E-1, 9.6968239383512E-1, 9.6982616964681E-1, 9.6996964811976E-1, 9.7011282953374E-1, 9.7025571416864E-1, 9.7039830230458E-1, 9.7054059422183E-1, 9.7068259020084E-1, 9.7082429052223E-1, 9.7096569546679E-1, 9.7110680531549E-1, 9.7124762034944E-1, 9.7138814084996E-1, 9.7152836709849E-1, 9.7166829937667E-1, 9.7180793796627E-1, 9.7194728314924E-1, 9.7208633520767E-1, 9.7222509442383E-1, 9.7236356108013E-1, 9.7250173545912E-1, 9.7263961784352E-1, 9.7277720851621E-1, 9.7291450776019E-1, 9.7305151585861E-1, 9.7318823309479E-1, 9.7332465975217E-1, 9.7346079611434E-1, 9.7359664246503E-1, 9.7373219908810E-1, 9.7386746626756E-1, 9.7400244428755E-1, 9.7413713343234E-1, 9.7427153398633E-1, 9.7440564623406E-1, 9.7453947046020E-1, 9.7467300694953E-1, 9.7480625598697E-1, 9.7493921785757E-1, 9.7507189284648E-1, 9.7520428123900E-1, 9.7533638332052E-1, 9.7546819937658E-1, 9.7559972969281E-1, 9.7573097455496E-1, 9.7586193424890E-1, 9.7599260906062E-1, 9.7612299927620E-1, 9.7625310518185E-1, 9.7638292706386E-1, 9.7651246520866E-1, 9.7664171990275E-1, 9.7677069143277E-1, 9.7689938008543E-1, 9.7702778614755E-1, 9.7715590990605E-1, 9.7728375164795E-1, 9.7741131166036E-1, 9.7753859023048E-1, 9.7766558764563E-1, 9.7779230419317E-1, 9.7791874016061E-1, 9.7804489583549E-1, 9.7817077150548E-1, 9.7829636745832E-1, 9.7842168398182E-1, 9.7854672136390E-1, 9.7867147989253E-1, 9.7879595985580E-1, 9.7892016154183E-1, 9.7904408523885E-1, 9.7916773123515E-1, 9.7929109981911E-1, 9.7941419127917E-1, 9.7953700590383E-1, 9.7965954398169E-1, 9.7978180580138E-1, 9.7990379165163E-1, 9.8002550182122E-1, 9.8014693659899E-1, 9.8026809627385E-1, 9.8038898113478E-1, 9.8050959147080E-1, 9.8062992757099E-1, 9.8074998972451E-1, 9.8086977822056E-1, 9.8098929334838E-1, 9.8110853539728E-1, 9.8122750465663E-1, 9.8134620141583E-1, 9.8146462596435E-1, 9.8158277859168E-1, 9.8170065958737E-1, 9.8181826924103E-1, 9.8193560784230E-1, 9.8205267568085E-1, 9.8216947304640E-1, 9.8228600022873E-1, 9.8240225751763E-1, 9.8251824520293E-1, 9.8263396357451E-1, 9.8274941292228E-1, 9.8286459353618E-1, 9.8297950570617E-1, 9.8309414972226E-1, 9.8320852587448E-1, 9.8332263445289E-1, 9.8343647574757E-1, 9.8355005004864E-1, 9.8366335764622E-1, 9.8377639883047E-1, 9.8388917389158E-1, 9.8400168311973E-1, 9.8411392680515E-1, 9.8422590523807E-1, 9.8433761870874E-1, 9.8444906750743E-1, 9.8456025192441E-1, 9.8467117224998E-1, 9.8478182877444E-1, 9.8489222178810E-1, 9.8500235158129E-1, 9.8511221844434E-1, 9.8522182266758E-1, 9.8533116454136E-1, 9.8544024435601E-1, 9.8554906240189E-1, 9.8565761896935E-1, 9.8576591434874E-1, 9.8587394883040E-1, 9.8598172270469E-1, 9.8608923626194E-1, 9.8619648979250E-1, 9.8630348358671E-1, 9.8641021793488E-1, 9.8651669312734E-1, 9.8662290945440E-1, 9.8672886720635E-1, 9.8683456667349E-1, 9.8694000814608E-1, 9.8704519191440E-1, 9.8715011826869E-1, 9.8725478749918E-1, 9.8735919989607E-1, 9.8746335574958E-1, 9.8756725534986E-1, 9.8767089898708E-1, 9.8777428695137E-1, 9.8787741953284E-1, 9.8798029702157E-1, 9.8808291970762E-1, 9.8818528788103E-1, 9.8828740183181E-1, 9.8838926184992E-1, 9.8849086822533E-1, 9.8859222124794E-1, 9.8869332120765E-1, 9.8879416839430E-1, 9.8889476309772E-1, 9.8899510560769E-1, 9.8909519621394E-1, 9.8919503520621E-1, 9.8929462287415E-1, 9.8939395950739E-1, 9.8949304539554E-1, 9.8959188082813E-1, 9.8969046609468E-1, 9.8978880148465E-1, 9.8988688728745E-1, 9.8998472379247E-1, 9.9008231128901E-1, 9.9017965006638E-1, 9.9027674041378E-1, 9.9037358262041E-1, 9.9047017697538E-1, 9.9056652376778E-1, 9.9066262328662E-1, 9.9075847582088E-1, 9.9085408165946E-1, 9.9094944109123E-1, 9.9104455440498E-1, 9.9113942188946E-1, 9.9123404383335E-1, 9.9132842052526E-1, 9.9142255225377E-1, 9.9151643930737E-1, 9.9161008197449E-1, 9.9170348054350E-1, 9.9179663530272E-1, 9.9188954654038E-1, 9.9198221454465E-1, 9.9207463960364E-1, 9.9216682200539E-1, 9.9225876203786E-1, 9.9235045998894E-1, 9.9244191614646E-1, 9.9253313079816E-1, 9.9262410423172E-1, 9.9271483673475E-1, 9.9280532859477E-1, 9.9289558009922E-1, 9.9298559153548E-1, 9.9307536319083E-1, 9.9316489535250E-1, 9.9325418830761E-1, 9.9334324234321E-1, 9.9343205774628E-1, 9.9352063480369E-1, 9.9360897380225E-1, 9.9369707502868E-1, 9.9378493876959E-1, 9.9387256531155E-1, 9.9395995494099E-1, 9.9404710794430E-1, 9.9413402460774E-1, 9.9422070521750E-1, 9.9430715005968E-1, 9.9439335942027E-1, 9.9447933358520E-1, 9.9456507284028E-1, 9.9465057747122E-1, 9.9473584776365E-1, 9.9482088400311E-1, 9.9490568647501E-1, 9.9499025546470E-1, 9.9507459125741E-1, 9.9515869413828E-1, 9.9524256439233E-1, 9.9532620230449E-1, 9.9540960815960E-1, 9.9549278224238E-1, 9.9557572483745E-1, 9.9565843622932E-1, 9.9574091670241E-1, 9.9582316654102E-1, 9.9590518602935E-1, 9.9598697545147E-1, 9.9606853509138E-1, 9.9614986523293E-1, 9.9623096615989E-1, 9.9631183815590E-1, 9.9639248150449E-1, 9.9647289648908E-1, 9.9655308339298E-1, 9.9663304249938E-1, 9.9671277409135E-1, 9.9679227845185E-1, 9.9687155586373E-1, 9.9695060660971E-1, 9.9702943097238E-1, 9.9710802923425E-1, 9.9718640167766E-1, 9.9726454858487E-1, 9.9734247023800E-1, 9.9742016691905E-1, 9.9749763890989E-1, 9.9757488649227E-1, 9.9765190994782E-1, 9.9772870955805E-1, 9.9780528560433E-1, 9.9788163836790E-1, 9.9795776812988E-1, 9.9803367517128E-1, 9.9810935977294E-1, 9.9818482221560E-1, 9.9826006277986E-1, 9.9833508174619E-1, 9.9840987939494E-1, 9.9848445600629E-1, 9.9855881186033E-1, 9.9863294723699E-1, 9.9870686241607E-1, 9.9878055767724E-1, 9.9885403330002E-1, 9.9892728956381E-1, 9.9900032674786E-1, 9.9907314513128E-1, 9.9914574499306E-1, 9.9921812661203E-1, 9.9929029026688E-1, 9.9936223623617E-1, 9.9943396479830E-1, 9.9950547623156E-1, 9.9957677081406E-1, 9.9964784882378E-1, 9.9971871053857E-1, 9.9978935623612E-1, 9.9985978619396E-1, 9.9993000068950E-1, 1.0000000000000E+0};
@@ -67,6 +75,36 @@ constexpr std::array<float, lut_size> very_high_contrast{0.0000000000000E+0, 8.1
 
 
 
+/**************************************************************************************************
+ * Settings read from the parameter list once per frame.
+ * ************************************************************************************************/
+enum class FilmicInput {
+    none,
+    filmic_srgb,
+    filmic_log,
+    standard_srgb,
+    standard_linear,
+};
+
+struct FilmicSettings {
+    FilmicInput input{ FilmicInput::none };
+    const std::array<float, lut_size>* look{ nullptr };
+    const Lut1D* inverse_base{ nullptr };   //Filmic sRGB input only
+    float exposure{};
+    float mix{ 100.0f };
+    float gamma{ 1.0f };
+    bool auto_exposure{ false };        //Exposure is measured from the input. (exposure is added as compensation)
+    float auto_exposure_smoothing{};    //0..1
+};
+
+template <typename F> static FilmicSettings read_filmic_settings(const ParameterSnapshot<F>& params);
+static float measure_auto_exposure(const ImageStatistics& stats, const FilmicSettings& settings);
+static float smooth_auto_exposure(float target, const std::vector<float>& earlier_targets, float smoothing);
+static int auto_exposure_history(float smoothing) noexcept;
+template <SimdFloat S> static ColourRGBA<S> apply_filmic(ColourRGBA<S> c, const FilmicSettings& settings);
+
+
+
 /**************************************************************************************************
  * The renderer class.
  * Implements a host independent pixel renderer.
@@ -84,7 +122,12 @@ class Renderer{
         S::F aspect {};
         std::string seed_string{};
         uint32_t seed{};
-        ParameterList params{};
+        ParameterSnapshot<typename S::F> params{};  //Made from the parameter list once per frame
+        std::shared_ptr<const Lut3D> lut3d{};
+        std::string lut3d_error{};      //Why the 3D LUT file couldn't be loaded (the stage is skipped)
+        FilmicSettings settings{};
+        int input_bit_depth{ 32 };
+        Lut1D transfer{};   //The filmic chain (per channel), baked for the current parameters.
 
     public:
         //Constructor
@@ -109,7 +152,44 @@ class Renderer{
         
         //Parameters
         void set_parameters(ParameterList plist){
-            params = plist;
+            params = ParameterSnapshot<typename S::F>::make(plist);
+            lut3d = Lut3D::load_cube_file_cached(plist.get_string(ParameterID::lut3d_file), lut3d_error);
+            settings = read_filmic_settings(params);
+            if (!settings.auto_exposure) bake_transfer();   //Otherwise baked once the exposure is known
+        }
+
+        //A problem to show the user, found by set_parameters().  (Empty if none)  The render still goes ahead.
+        const std::string& error_message() const noexcept { return lut3d_error; }
+
+        //Bit depth of the input (8, 16 or 32).  Call before set_parameters().
+        //8 and 16-bit input use a table with an entry for every possible input value.  (Only After Effects calls
+        //this.  The OpenFX plug-in only accepts float clips, so it always uses the 32-bit table)
+        void set_input_bit_depth(int bits) noexcept {
+            input_bit_depth = bits;
+        }
+
+        //Input statistics.  If uses_input_statistics(), the host measures the input frame and calls
+        //set_input_statistics() after set_parameters() and before rendering.
+        //Auto exposure is smoothed over earlier frames.  The host measures earlier_input_frames() of them
+        //(nearest first, may be fewer at the start of a clip), so every frame renders the same in any order.
+        bool uses_input_statistics() const noexcept { return settings.auto_exposure; }
+        static int earlier_input_frames(const ParameterList& list) {
+            const auto s = read_filmic_settings(ParameterSnapshot<float>::make(list));
+            return (s.auto_exposure) ? auto_exposure_history(s.auto_exposure_smoothing) : 0;
+        }
+        void set_input_statistics(const ImageStatistics& stats, const std::vector<ImageStatistics>& earlier = {}) {
+#ifdef _DEBUG
+            check_statistics(stats);
+            for (const auto& e : earlier) check_statistics(e);
+#endif
+            std::vector<float> earlier_targets{};
+            for (const auto& e : earlier) {
+                if (e.count == 0) break;    //Frame not available.  (Older frames don't follow on from this one)
+                earlier_targets.push_back(measure_auto_exposure(e, settings));
+            }
+            const float target = measure_auto_exposure(stats, settings);
+            settings.exposure += smooth_auto_exposure(target, earlier_targets, settings.auto_exposure_smoothing);
+            bake_transfer();
         }
 
         //Render
@@ -117,6 +197,10 @@ class Renderer{
         ColourRGBA<S> render_pixel_with_input(S x, S y, const ColourRGBA<S>&) const;
 
     private:
+        void bake_transfer();
+        void check_transfer() const;    //Debug builds only
+        static void check_statistics(const ImageStatistics& stats);    //Debug builds only
+        ColourRGBA<S> apply_transfer(const ColourRGBA<S>& c) const;
 
 
 };
@@ -156,12 +240,13 @@ ColourRGBA<S> Renderer<S>::render_pixel(S x [[maybe_unused]], S y [[maybe_unused
  * ************************************************************************************************/
 template <SimdFloat S>
 static ColourRGBA<S> apply1DLut(const std::array<float,4096>& lut, ColourRGBA<S> c) {
+    constexpr int last = static_cast<int>(lut_size) - 2;   //Last index that has a next entry to interpolate to
     S idx_n = clamp(c.red) * lut_size;
     S idx_f = floor(idx_n);    
     for (int i = 0; i < idx_f.number_of_elements(); i++) {
         auto e = idx_f.element(i);
         auto idx = static_cast<int>(e);
-        idx = (idx < 0) ? 0 : ((idx > lut_size - 2) ? lut_size - 2 : idx);
+        idx = (idx < 0) ? 0 : ((idx > last) ? last : idx);
         auto v1 = lut[idx];
         auto v2 = lut[idx+1];
         auto v = std::lerp(v1,v2, idx_n.element(i) - static_cast<float>(idx));
@@ -173,7 +258,7 @@ static ColourRGBA<S> apply1DLut(const std::array<float,4096>& lut, ColourRGBA<S>
     for (int i = 0; i < idx_f.number_of_elements(); i++) {
         auto e = idx_f.element(i);
         auto idx = static_cast<int>(e);
-        idx = (idx < 0) ? 0 : ((lut_size - 2 > lut_size - 2) ? lut_size-2 : idx);
+        idx = (idx < 0) ? 0 : ((idx > last) ? last : idx);
         auto v1 = lut[idx];
         auto v2 = lut[idx + 1];
         auto v = std::lerp(v1, v2, idx_n.element(i) - static_cast<float>(idx));
@@ -185,7 +270,7 @@ static ColourRGBA<S> apply1DLut(const std::array<float,4096>& lut, ColourRGBA<S>
     for (int i = 0; i < idx_f.number_of_elements(); i++) {
         auto e = idx_f.element(i);
         auto idx = static_cast<int>(e);
-        idx = (idx < 0) ? 0 : ((idx > lut_size-2) ? lut_size - 2 : idx);
+        idx = (idx < 0) ? 0 : ((idx > last) ? last : idx);
         auto v1 = lut[idx];
         auto v2 = lut[idx + 1];
         auto v = std::lerp(v1, v2, idx_n.element(i) - static_cast<float>(idx));
@@ -197,51 +282,60 @@ static ColourRGBA<S> apply1DLut(const std::array<float,4096>& lut, ColourRGBA<S>
 
 
 /**************************************************************************************************
-
+ * Build the inverse of a look curve, sampled evenly over the curve's output (0..1).
+ * Each entry is found with a binary search of the curve.  The curves are strictly increasing.
+ * Within 0..1 the table is within 2e-6 of the search for "Medium Contrast" (used for Filmic sRGB).
+ * The steepest toes ("Very High Contrast") are within 5e-4 near zero.
  * ************************************************************************************************/
-template <SimdFloat S>
-static ColourRGBA<S> unapply1DLut(const std::array<float, 4096>& lut, ColourRGBA<S>c) {   
-  
-    for (int i = 0; i < c.red.number_of_elements(); i++) {
-        auto v = c.red.element(i);
+static Lut1D make_inverse_look(const std::array<float, lut_size>& lut) {
+    const auto search = [&lut](float v) {
         auto lower = std::lower_bound(lut.begin(), lut.end(), v);
         auto d = (lower != lut.end()) ? std::distance(lut.begin(), lower) : lut_size - 2;
         d = std::min(d, lut_size - 2);
-        
+
         auto v1 = lut[d];
         auto v2 = lut[d + 1];
         auto t = (v - v1) / (v2 - v1);
-        auto d_f = std::lerp(static_cast<float>(d), static_cast<float>(d + 1), t);
-
-        c.red.set_element(i, d_f / 4096.0f);
-
+        return std::lerp(static_cast<float>(d), static_cast<float>(d + 1), t) / 4096.0f;
+    };
+    Lut1D inverse = Lut1D::make_uniform(search, inverse_lut_size, 1.0f);
+
+#ifdef _DEBUG
+    //Check the table against the search, at and between its entries.  (Including 0 and 1)
+    for (int i = 0; i <= 4 * (inverse_lut_size - 1); i++) {
+        const float v = static_cast<float>(i) / static_cast<float>(4 * (inverse_lut_size - 1));
+        if (!(std::abs(inverse.lookup_linear_extended(FallbackFloat32(v)).v - search(v)) <= 5e-4f)) {
+            throw std::logic_error("Filmic: An inverse look table doesn't match the search of its curve.");
+        }
     }
-    for (int i = 0; i < c.green.number_of_elements(); i++) {
-        auto v = c.green.element(i);
-        auto lower = std::lower_bound(lut.begin(), lut.end(), v);
-        auto d = (lower != lut.end()) ? std::distance(lut.begin(), lower) : lut_size - 2;
-        d = std::min(d, lut_size - 2);
+#endif
+    return inverse;
+}
 
-        auto v1 = lut[d];
-        auto v2 = lut[d + 1];
-        auto t = (v - v1) / (v2 - v1);
-        auto d_f = std::lerp(static_cast<float>(d), static_cast<float>(d + 1), t);
 
-        c.green.set_element(i, d_f / 4096.0f);
-    }
-    for (int i = 0; i < c.blue.number_of_elements(); i++) {
-        auto v = c.blue.element(i);
-        auto lower = std::lower_bound(lut.begin(), lut.end(), v);
-        auto d = (lower != lut.end()) ? std::distance(lut.begin(), lower) : lut_size - 2;
-        d = std::min(d, lut_size - 2);
+/**************************************************************************************************
+ * The inverse table for one of the looks.  Each is built the first time it is needed.
+ * ************************************************************************************************/
+static const Lut1D& inverse_look(const std::array<float, lut_size>& lut) {
+    if (&lut == &very_low_contrast) { static const Lut1D inverse = make_inverse_look(lut); return inverse; }
+    if (&lut == &low_contrast) { static const Lut1D inverse = make_inverse_look(lut); return inverse; }
+    if (&lut == &medium_low_contrast) { static const Lut1D inverse = make_inverse_look(lut); return inverse; }
+    if (&lut == &medium_high_contrast) { static const Lut1D inverse = make_inverse_look(lut); return inverse; }
+    if (&lut == &high_contrast) { static const Lut1D inverse = make_inverse_look(lut); return inverse; }
+    if (&lut == &very_high_contrast) { static const Lut1D inverse = make_inverse_look(lut); return inverse; }
+    static const Lut1D inverse_base = make_inverse_look(base_contrast);
+    return inverse_base;
+}
 
-        auto v1 = lut[d];
-        auto v2 = lut[d + 1];
-        auto t = (v - v1) / (v2 - v1);
-        auto d_f = std::lerp(static_cast<float>(d), static_cast<float>(d + 1), t);
 
-        c.blue.set_element(i, d_f / 4096.0f);
-    }
+/**************************************************************************************************
+ * Undo a look using its inverse table (from inverse_look).
+ * ************************************************************************************************/
+template <SimdFloat S>
+static ColourRGBA<S> unapply1DLut(const Lut1D& inverse, ColourRGBA<S> c) {
+    c.red = inverse.lookup_linear_extended(c.red);
+    c.green = inverse.lookup_linear_extended(c.green);
+    c.blue = inverse.lookup_linear_extended(c.blue);
     return c;
 }
 
@@ -294,75 +388,273 @@ static ColourRGBA<S> apply_exposure(ColourRGBA<S> c, const float exposure) {
 
 
 /**************************************************************************************************
- * Render a pixel (or batch of pixels if using SIMD)
- * an input pixel is given
+ * Read the settings from the parameter snapshot.
+ * (Lists are looked up here once, rather than for every pixel)
  * ************************************************************************************************/
-template <SimdFloat S>
-ColourRGBA<S> Renderer<S>::render_pixel_with_input(S x [[maybe_unused]], S y [[maybe_unused]], const ColourRGBA<S>& in_colour) const {
-    if (width <= 0 || height <= 0) return ColourRGBA<S>{};
-         
-    ColourRGBA<S> c = in_colour;
-    const auto exposure = static_cast<typename S::F>(params.get_value(ParameterID::exposure));
+template <typename F>
+static FilmicSettings read_filmic_settings(const ParameterSnapshot<F>& params) {
+    FilmicSettings s{};
+
+    //In the order of the "Input Type" list
+    constexpr std::array<FilmicInput, 4> colourspaces{ FilmicInput::filmic_srgb, FilmicInput::filmic_log, FilmicInput::standard_srgb, FilmicInput::standard_linear };
+    const int colourspace = params.get_value_integer(ParameterID::colourspace_in);
+    if (colourspace >= 0 && colourspace < static_cast<int>(colourspaces.size())) s.input = colourspaces[colourspace];
+    if (s.input == FilmicInput::filmic_srgb) s.inverse_base = &inverse_look(base_contrast);
+
+    //In the order of the "Filmic Look" list.  (None is the same as medium)
+    const std::array<const std::array<float, lut_size>*, 8> looks{ &base_contrast, &very_low_contrast, &low_contrast, &medium_low_contrast, &base_contrast, &medium_high_contrast, &high_contrast, &very_high_contrast };
+    const int mode = params.get_value_integer(ParameterID::filmic_mode);
+    if (mode >= 0 && mode < static_cast<int>(looks.size())) s.look = looks[mode];
+
+    s.exposure = static_cast<float>(params.get_value(ParameterID::exposure));
+    s.auto_exposure = params.get_value_integer(ParameterID::exposure_mode) == 1;   //Manual, Auto
+    s.auto_exposure_smoothing = static_cast<float>(params.get_value(ParameterID::auto_exposure_smoothing)) * 0.01f;
+    s.mix = static_cast<float>(params.get_value(ParameterID::mix_amount));
+    s.gamma = static_cast<float>(params.get_value(ParameterID::gamma));
+    return s;
+}
 
 
+/**************************************************************************************************
+ * Auto exposure.  Returns the exposure (in stops) that brings the input's average to middle grey.
+ * The average is the geometric mean luminance, ignoring the darkest and brightest 5% of pixels.
+ * It is measured on the input values, then converted to scene linear through the input colour space.
+ * ************************************************************************************************/
+static float measure_auto_exposure(const ImageStatistics& stats, const FilmicSettings& settings) {
+    constexpr float middle_grey = 0.18f;
+    const float average = stats.log_average_luminance(0.05f, 0.95f);
+    if (average <= 0.0f) return 0.0f;
+
+    const FallbackFloat32 a{ average };
+    ColourRGBA<FallbackFloat32> c(a, a, a);
+    switch (settings.input) {
+    case FilmicInput::filmic_srgb:
+        c = to_standard(unapply1DLut(*settings.inverse_base, c));
+        break;
+    case FilmicInput::filmic_log:
+        c = to_standard(c);
+        break;
+    case FilmicInput::standard_srgb:
+        c.red = pow(c.red, 2.2);
+        break;
+    default:
+        break;
+    }
+    const float linear = c.red.v;
+    if (!(linear > 0.0f)) return 0.0f;
+    return std::clamp(std::log2(middle_grey / linear), -10.0f, 10.0f);
+}
+
+
+/**************************************************************************************************
+ * Smooth auto exposure over a sequence.
+ * The exposure is a weighted average of this frame's target and the targets of earlier frames,
+ * with frame k back weighted smoothing^k.  The history stops once the weight falls under 5%, or at 8 frames.
+ * ************************************************************************************************/
+static int auto_exposure_history(float smoothing) noexcept {
+    constexpr int max_history = 8;
+    if (!(smoothing > 0.0f)) return 0;
+    if (smoothing >= 1.0f) return max_history;
+    const int frames = static_cast<int>(std::ceil(std::log(0.05f) / std::log(smoothing)));
+    return std::clamp(frames, 1, max_history);
+}
+
+static float smooth_auto_exposure(float target, const std::vector<float>& earlier_targets, float smoothing) {
+    const size_t history = std::min(earlier_targets.size(), static_cast<size_t>(auto_exposure_history(smoothing)));
+    double sum = target;
+    double total = 1.0;
+    double weight = 1.0;
+    for (size_t k = 0; k < history; k++) {
+        weight *= smoothing;
+        sum += weight * earlier_targets[k];
+        total += weight;
+    }
+    return static_cast<float>(sum / total);
+}
+
+
+/**************************************************************************************************
+ * The filmic chain (up to the mix), evaluated directly.
+ * Used to bake the transfer table, and for pixels the table does not cover.
+ * ************************************************************************************************/
+template <SimdFloat S>
+static ColourRGBA<S> apply_filmic(ColourRGBA<S> c, const FilmicSettings& settings) {
+    const auto exposure = settings.exposure;
+
     //Convert to Filmic Log Space
-    if (params.get_string(ParameterID::colourspace_in) == "Filmic sRGB") {        
-        c = unapply1DLut(base_contrast,c);
+    switch (settings.input) {
+    case FilmicInput::filmic_srgb:
+        c = unapply1DLut(*settings.inverse_base, c);
         if (exposure != 0.0f) {
             c = to_standard(c);
             c = apply_exposure(c, exposure);
             c = to_filmic_log(c);
         }
-
-    }
-    else if (params.get_string(ParameterID::colourspace_in) == "Filmic Log") {
+        break;
+    case FilmicInput::filmic_log:
         if (exposure != 0.0f) {
             c = to_standard(c);
             c = apply_exposure(c, exposure);
             c = to_filmic_log(c);
         }
-    }
-    else if (params.get_string(ParameterID::colourspace_in) == "Standard (sRGB)") {
+        break;
+    case FilmicInput::standard_srgb:
         //To Standard (Linear)
         c.red = pow(c.red, 2.2);
         c.green = pow(c.green, 2.2);
         c.blue = pow(c.blue, 2.2);
-        
-        if (exposure != 0.0f) c = apply_exposure(c, exposure);        
+
+        if (exposure != 0.0f) c = apply_exposure(c, exposure);
         c = to_filmic_log(c);
-    }
-    else if (params.get_string(ParameterID::colourspace_in) == "Standard (Linear)") {
+        break;
+    case FilmicInput::standard_linear:
         if (exposure != 0.0f) c = apply_exposure(c, exposure);
         c = to_filmic_log(c);
+        break;
+    default:
+        break;
     }
     auto c_prelook = c;
     //We are now in filmic log colour space with exposure applied.
 
     //Blender's looks are applied in the filmic log colour space.  These looks convert directly to sRGB.
-    if (params.get_string(ParameterID::filmic_mode) == "Very Low Contrast") c = apply1DLut(very_low_contrast, c);
-    else if (params.get_string(ParameterID::filmic_mode) == "Low Contrast") c = apply1DLut(low_contrast, c);
-    else if (params.get_string(ParameterID::filmic_mode) == "Medium Low Contrast") c = apply1DLut(medium_low_contrast, c);
-    else if (params.get_string(ParameterID::filmic_mode) == "Medium Contrast") c = apply1DLut(base_contrast, c);
-    else if (params.get_string(ParameterID::filmic_mode) == "Medium High Contrast") c = apply1DLut(medium_high_contrast, c);
-    else if (params.get_string(ParameterID::filmic_mode) == "High Contrast") c = apply1DLut(high_contrast, c);
-    else if (params.get_string(ParameterID::filmic_mode) == "Very High Contrast") c = apply1DLut(very_high_contrast, c);
-    else if (params.get_string(ParameterID::filmic_mode) == "None") c = apply1DLut(base_contrast, c); //Same as medium
-
+    if (settings.look) c = apply1DLut(*settings.look, c);
 
     //Apply Mix
-    const auto mix = static_cast<typename S::F>(params.get_value(ParameterID::mix_amount));
-    if (mix != 100.0f) {
-        c = mix_colours(c_prelook, c, S(mix *0.01f));
+    if (settings.mix != 100.0f) {
+        c = mix_colours(c_prelook, c, S(settings.mix * 0.01f));
     }
+    return c;
+}
+
 
+/**************************************************************************************************
+ * Bake the filmic chain into a table.
+ * Every stage works on each channel separately with the same settings, so one curve covers r, g & b.
+ * 8 and 16-bit input get an entry for every possible input value (no interpolation).
+ * 32-bit input uses a logarithmic table (1024 entries per octave, 2^-16 .. 2^8, and zero).
+ * Gamma is not baked.  Its infinite slope at zero can't be interpolated accurately.
+ * ************************************************************************************************/
+template <SimdFloat S>
+void Renderer<S>::bake_transfer() {
+    const auto curve = [this](float v) {
+        const FallbackFloat32 f{ v };   //(A plain float would pick the 8-bit constructor)
+        return apply_filmic(ColourRGBA<FallbackFloat32>(f, f, f), settings).red.v;
+    };
+
+    if (input_bit_depth == 8) transfer = Lut1D::make_uniform(curve, 256, 1.0f);
+    else if (input_bit_depth == 16) transfer = Lut1D::make_uniform(curve, 32769, 1.0f);   //Adobe 16-bit (white is 0x8000)
+    else transfer = Lut1D::make_logarithmic(curve);
+#ifdef _DEBUG
+    check_transfer();
+#endif
+}
+
+
+/**************************************************************************************************
+ * Debug check of the baked table against apply_filmic(), over the whole input range.
+ * 8 and 16-bit check every input value.  32-bit checks zero, denormals, 128 steps per octave from
+ * 2^-24 to 2^9 (below, across and above the table), and values outside it (negative, NaN).
+ * ************************************************************************************************/
+template <SimdFloat S>
+void Renderer<S>::check_transfer() const {
+    const auto check = [this](float v) {
+        const S x{ v };
+        const float baked = apply_transfer(ColourRGBA<S>(x, x, x)).red.element(0);
+        const float direct = apply_filmic(ColourRGBA<S>(x, x, x), settings).red.element(0);
+        if (std::isnan(baked) && std::isnan(direct)) return;
+        if (!(std::abs(baked - direct) <= 1e-4f)) throw std::logic_error("Filmic: The baked transfer table doesn't match apply_filmic().");
+    };
+
+    if (input_bit_depth == 8 || input_bit_depth == 16) {
+        const int white = (input_bit_depth == 8) ? 255 : 32768;
+        for (int i = 0; i <= white; i++) check(static_cast<float>(i) / static_cast<float>(white));
+        return;
+    }
+    for (float v : { 0.0f, -0.0f, std::numeric_limits<float>::denorm_min(), std::numeric_limits<float>::min() * 0.5f, std::numeric_limits<float>::min(), -1.0f, std::numeric_limits<float>::quiet_NaN() }) check(v);
+    for (int i = -24 * 128; i <= 9 * 128; i++) check(std::exp2(static_cast<float>(i) / 128.0f));
+}
 
 
+/**************************************************************************************************
+ * Debug check of statistics from the host.  Each pixel counted must be in the histogram once, and
+ * the mean must be between the minimum and maximum.  (Unless there are no pixels, or some aren't finite)
+ * ************************************************************************************************/
+template <SimdFloat S>
+void Renderer<S>::check_statistics(const ImageStatistics& stats) {
+    uint64_t binned = 0;
+    for (const auto bin : stats.histogram) binned += bin;
+    if (binned != stats.count) throw std::logic_error("Filmic: The input statistics' histogram doesn't hold every pixel counted.");
+    if (stats.count == 0) return;
+    for (int i = 0; i < 3; i++) {
+        const float mean = stats.mean(i);
+        if (!std::isfinite(mean)) continue;     //NaN or infinite pixels
+        const float tolerance = 1e-5f * std::max(std::abs(stats.minimum[i]), std::abs(stats.maximum[i]));
+        if (mean < stats.minimum[i] - tolerance || mean > stats.maximum[i] + tolerance) throw std::logic_error("Filmic: The input statistics' mean isn't between the minimum and maximum.");
+    }
+}
+
+
+/**************************************************************************************************
+ * Apply the baked filmic chain.
+ *
+ * 32-bit input is within 1e-4 of apply_filmic() over the table's range.  (The largest errors are
+ * next to the corners in the look curves)  Zero is exact.
+ * If any lane is negative, NaN, between zero and 2^-16 or 2^8 and above, the whole vector is evaluated directly.
+ * (Below 2^-16 the curve is still steep after a large exposure, so it can't be clamped to the first entry)
+ * ************************************************************************************************/
+template <SimdFloat S>
+ColourRGBA<S> Renderer<S>::apply_transfer(const ColourRGBA<S>& in) const {
+    if (transfer.is_empty()) [[unlikely]] return apply_filmic(in, settings);   //Auto exposure without statistics
+
+    ColourRGBA<S> c = in;
+    if (input_bit_depth == 8 || input_bit_depth == 16) {
+        c.red = transfer.lookup_nearest(in.red);
+        c.green = transfer.lookup_nearest(in.green);
+        c.blue = transfer.lookup_nearest(in.blue);
+        return c;
+    }
+
+    if constexpr (SimdFloat32<S>) {
+        S out_red{}, out_green{}, out_blue{};
+        c.red = transfer.lookup_logarithmic(in.red, out_red);
+        c.green = transfer.lookup_logarithmic(in.green, out_green);
+        c.blue = transfer.lookup_logarithmic(in.blue, out_blue);
+
+        const S out_of_range = max(out_red, max(out_green, out_blue));
+        bool all_in_range = true;
+        for (int i = 0; i < S::number_of_elements(); i++) {
+            if (out_of_range.element(i) != 0.0f) all_in_range = false;
+        }
+        if (all_in_range) [[likely]] return c;
+    }
+    return apply_filmic(in, settings);
+}
+
+
+/**************************************************************************************************
+ * Render a pixel (or batch of pixels if using SIMD)
+ * an input pixel is given
+ * ************************************************************************************************/
+template <SimdFloat S>
+ColourRGBA<S> Renderer<S>::render_pixel_with_input(S x [[maybe_unused]], S y [[maybe_unused]], const ColourRGBA<S>& in_colour) const {
+    if (width <= 0 || height <= 0) return ColourRGBA<S>{};
+
+    //Input colour space, exposure, look & mix.
+    ColourRGBA<S> c = apply_transfer(in_colour);
+
+    //Apply the user's 3D LUT (optional)
+    if (lut3d) {
+        const auto lut3d_amount = params.get_value_f(ParameterID::lut3d_amount);
+        if (lut3d_amount >= 100.0f) c = lut3d->apply(c);
+        else if (lut3d_amount > 0.0f) c = mix_colours(c, lut3d->apply(c), S(lut3d_amount * 0.01f));
+    }
+
     //Apply Gamma
-    const auto gamma = static_cast<typename S::F>(params.get_value(ParameterID::gamma));
-    if (gamma != 1.0f) {
-        c.red = pow(c.red, 1.0f/gamma);
-        c.green = pow(c.green, 1.0f / gamma);
-        c.blue = pow(c.blue, 1.0f / gamma);
+    if (settings.gamma != 1.0f) {
+        c.red = pow(c.red, 1.0f / settings.gamma);
+        c.green = pow(c.green, 1.0f / settings.gamma);
+        c.blue = pow(c.blue, 1.0f / settings.gamma);
     }
 
     return c;
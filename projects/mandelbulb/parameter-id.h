@@ -55,12 +55,42 @@ enum class ParameterID {
 	input_transform_special3,
 	input_transform_special4,
 
-
-
-
-
-
-
+	//Fractal
+	power,
+	iterations,
+
+	//Camera
+	camera_distance,
+	camera_rotate_x,
+	camera_rotate_y,
+	field_of_view,
+
+	//Ray Marching
+	ray_steps,
+	surface_detail,
+
+	//Lighting & Colour
+	light_angle,
+	light_elevation,
+	colour_shift,
+	colour_frequency,
+
+	//Camera (continued)
+	zoom,
+
+	//Anti-aliasing
+	antialiasing,
+	antialias_threshold,
+	antialias_budget,
+
+	//Draft renders
+	draft_pattern,
+
+	//Quality tiers
+	quality,
+
+	//Lighting (continued)
+	surface_normals,
 
 	__last  //Must be last (used for array memory allocation)
 };
@@ -39,12 +39,52 @@ Description:
 #include "parameters.h"
 #include "parameter-id.h" 
 //#include "..\..\common\input-transforms.h"
+#include "..\..\common\antialiasing.h"
+#include "..\..\common\checkerboard.h"
+#include "..\..\common\quality-tier.h"
 
 ParameterList build_project_parameters() {
 	ParameterList params;
 	params.add_entry(ParameterEntry::make_seed(ParameterID::seed, "Random Seed"));
 
-
+	//Fractal
+	params.add_entry(ParameterEntry::make_number(ParameterID::power, "Power", 1.0, 32.0, 8.0, 2.0, 16.0, 2));
+	params.add_entry(ParameterEntry::make_number(ParameterID::iterations, "Iterations", 1.0, 100.0, 12.0, 1.0, 30.0, 0));
+
+	//Camera (orbits the origin)
+	params.add_entry(ParameterEntry::make_number(ParameterID::camera_distance, "Camera Distance", 0.1, 100.0, 2.6, 1.0, 10.0, 3));
+	params.add_entry(ParameterEntry::make_number(ParameterID::camera_rotate_x, "Camera Rotate X", -3600.0, 3600.0, 30.0, -180.0, 180.0, 2));
+	params.add_entry(ParameterEntry::make_number(ParameterID::camera_rotate_y, "Camera Rotate Y", -89.9, 89.9, 20.0, -89.9, 89.9, 2));
+	params.add_entry(ParameterEntry::make_number(ParameterID::field_of_view, "Field of View", 1.0, 150.0, 45.0, 10.0, 120.0, 1));
+	params.add_entry(ParameterEntry::make_number(ParameterID::zoom, "Zoom (Powers of 2)", 0.0, 100.0, 0.0, 0.0, 60.0, 2));
+
+	//Ray Marching
+	params.add_entry(ParameterEntry::make_number(ParameterID::ray_steps, "Max Ray Steps", 10.0, 2000.0, 200.0, 10.0, 1000.0, 0));
+	params.add_entry(ParameterEntry::make_number(ParameterID::surface_detail, "Surface Detail", 0.01, 100.0, 1.0, 0.1, 10.0, 2));
+
+	//Lighting & Colour
+	params.add_entry(ParameterEntry::make_number(ParameterID::light_angle, "Light Angle", -3600.0, 3600.0, 45.0, -180.0, 180.0, 2));
+	params.add_entry(ParameterEntry::make_number(ParameterID::light_elevation, "Light Elevation", -90.0, 90.0, 45.0, -90.0, 90.0, 2));
+	params.add_entry(ParameterEntry::make_number(ParameterID::colour_shift, "Colour Shift", -100.0, 100.0, 0.0, 0.0, 1.0, 3));
+	params.add_entry(ParameterEntry::make_number(ParameterID::colour_frequency, "Colour Frequency", 0.0, 100.0, 1.0, 0.0, 10.0, 3));
+
+	//Surface normals.  Finite differences over a pixel (smoother), or the exact gradient at the hit (sharper)
+	std::vector<std::string> normals_list{ "Finite Difference", "Exact" };
+	params.add_entry(ParameterEntry::make_list(ParameterID::surface_normals, "Surface Normals", std::move(normals_list)));
+
+	//Anti-aliasing.  Samples are only added along edges.  (See antialiasing.h)
+	std::vector<std::string> antialias_list{ antialias_mode_names.begin(), antialias_mode_names.end() };
+	params.add_entry(ParameterEntry::make_list(ParameterID::antialiasing, "Anti-aliasing", std::move(antialias_list)));
+	params.add_entry(ParameterEntry::make_number(ParameterID::antialias_threshold, "Anti-aliasing Threshold", 0.001, 1.0, 0.05, 0.01, 0.5, 3));
+	params.add_entry(ParameterEntry::make_number(ParameterID::antialias_budget, "Anti-aliasing Budget (Samples/Pixel)", 0.0, 15.0, 4.0, 0.0, 8.0, 2));
+
+	//Pixels rendered at draft quality (e.g. while a slider is dragged).  The rest are filled in.  (See checkerboard.h)
+	std::vector<std::string> draft_list{ draft_pattern_names.begin(), draft_pattern_names.end() };
+	params.add_entry(ParameterEntry::make_list(ParameterID::draft_pattern, "Draft Render", std::move(draft_list)));
+
+	//Work per pixel.  Automatic lowers it for reduced resolution & draft previews.  (See quality-tier.h)
+	std::vector<std::string> quality_list{ quality_tier_names.begin(), quality_tier_names.end() };
+	params.add_entry(ParameterEntry::make_list(ParameterID::quality, "Quality", std::move(quality_list)));
 
 	//Input Transforms (builds from common set used in multiple projects)
 	//build_input_transforms_parameter_list(params);
@@ -25,28 +25,116 @@ Description:
 
     The host independant renderer for the project.
 
+    Renders a Mandelbulb using distance estimated ray marching.
+    - Integer powers 2..9 use the "triplex" form of z^n, which is trig free (complex powers of the
+      unit vectors in the xy plane and the z/rho plane).  The power is a template parameter so each
+      power is unrolled into multiplies.  Other powers use the polar form (acos, atan2, pow, sin, cos).
+    - Each ray is first intersected with a bounding sphere, so marching starts at the fractal.
+    - Hosts that support it run a coarse depth pass first (begin_prepare()).  One cone per 8x8 tile
+      is marched until it touches the surface, stepping by the distance estimate less the cone's
+      radius, so every ray in the tile can safely start from that distance.
+    - Hosts that render frames in sequence can pass the previous frame's depth (set_previous_frame()).
+      Each surface point is moved into the new camera, and rays start a little before the nearest
+      point that lands around their pixel.  Pixels with a gap around them (newly visible) don't use
+      it, and rays that would start inside the set fall back to the coarse depth.
+    - Each SIMD lane is a separate ray.  Lanes that hit the surface or leave the bounding sphere stop
+      moving, and the vector stops as soon as all lanes are finished.  (The same for the escape-time
+      iterations inside the distance estimator)
+    - Hosts render a block at a time (render_block()).  Rays are started a vector at a time, and the
+      ones that reach the bounding sphere wait in a queue.  A lane whose ray has finished takes the
+      next waiting ray, so the vector isn't held up by its slowest ray.  Hits are packed together and
+      shaded in full vectors, and sky pixels just get the background.  Rays are started a quad (2D
+      packet) at a time, as neighbouring rays finish at about the same time.  (Double-double renders
+      a quad at a time)
+    - Surface normal from the distance estimator (tetrahedron of 4 samples).  Or, if "Surface Normals"
+      is exact, its gradient at the hit.  One pass of the estimator on dual numbers (simd-dual.h) gives
+      all 3 derivatives, for a little more than the cost of the 4 samples.  It shows detail smaller
+      than a pixel, which the samples smooth over.  (Double-double renders always use the samples, as
+      the gradient would be in the working precision)
+    - Colour from an orbit trap (closest approach of the orbit to the origin).
+    - Lit with diffuse, specular and ambient light.  Ambient occlusion compares the distance estimate at
+      points along the normal with their distance from the surface (spaced by the size of a pixel, so
+      it looks the same at any zoom).  It doesn't depend on how the ray got there.
+    - Each step down in quality tier (quality-tier.h) takes fewer march steps and stops further from
+      the surface.  The iterations are kept, as they change the shape (and the depth reused between
+      frames).
+
+    Precision is chosen each frame from the size of a pixel at the surface (found by marching the
+    centre ray once in double precision):
+    - native:        S itself (float for the hosts).  Good to a pixel size of about 1e-4.
+    - float64:       Lanes are converted to doubles of the same register width.  Good to about 1e-12.
+    - double_double: Ray positions are double-double, as are the first iterations of the distance
+                     estimator (until the orbits of neighbouring pixels are further apart than double
+                     precision can resolve).  The rest of the iterations are in double.
+                     Triplex powers only.  Fractional powers stop at float64.
+
 *******************************************************************************************************/
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <concepts>
 #include <string>
 #include <vector>
 #include <numbers>
+#include <stdexcept>
 #include <typeinfo>
+#include <type_traits>
+#include <limits>
+#include <cmath>
+#include <memory>
 
+#include "../../common/antialiasing.h"
+#include "../../common/checkerboard.h"
 #include "../../common/colour.h"
+#include "../../common/frame-history.h"
 #include "../../common/linear-algebra.h"
+#include "../../common/lut1d.h"
 #include "../../common/noise.h"
 #include "../../common/parameter-list.h"
+#include "../../common/quality-tier.h"
+#include "../../common/render-block.h"
 #include "..\..\common\input-transforms.h"
 
 #include "..\..\common\simd-cpuid.h"
 #include "..\..\common\simd-f32.h"
+#include "..\..\common\simd-f64.h"
+#include "..\..\common\simd-compaction.h"
+#include "..\..\common\simd-double-double.h"
+#include "..\..\common\simd-dual.h"
 #include "..\..\common\simd-uint32.h"
 #include "..\..\common\simd-concepts.h"
 
 
 
+/**************************************************************************************************
+ * Double precision SIMD type with the same register width as S.  (Used for deep zooms)
+ * ************************************************************************************************/
+template <SimdFloat S> struct SimdFloat64Of { typedef S type; };
+template <> struct SimdFloat64Of<FallbackFloat32> { typedef FallbackFloat64 type; };
+#if defined(_M_X64) || defined(__x86_64)
+template <> struct SimdFloat64Of<Simd128Float32> { typedef Simd128Float64 type; };
+template <> struct SimdFloat64Of<Simd256Float32> { typedef Simd256Float64 type; };
+template <> struct SimdFloat64Of<Simd512Float32> { typedef Simd512Float64 type; };
+#endif
+
+
+
+/**************************************************************************************************
+ * Where a vector of rays starts marching.  (See start_rays())
+ * ************************************************************************************************/
+template <SimdFloat W, typename P>
+struct RayStart {
+    vec3<P> direction{};
+    W t_far{};          //Where the ray leaves the bounding sphere
+    P start{};          //Start from the bounding sphere (and coarse depth)
+    P t{};              //Start, moved up to the previous frame's surface for seeded lanes
+    W seeded{};         //1.0 for lanes that start from the previous frame
+    W running{};        //1.0 for lanes that have something to march through
+};
+
+
 /**************************************************************************************************
  * The renderer class.
  * Implements a host independent pixel renderer.
@@ -54,7 +142,10 @@ Description:
  * ************************************************************************************************/
 template <SimdFloat S>
 class Renderer{
-    
+    typedef typename S::F F;
+    typedef typename SimdFloat64Of<S>::type D;
+
+    enum class MarchPrecision { native, float64, double_double };
 
     private:
         int width {};
@@ -64,7 +155,63 @@ class Renderer{
         S::F aspect {};
         std::string seed_string{};
         uint32_t seed{};
-        ParameterList params{};
+        ParameterSnapshot<typename S::F> params{};  //Made from the parameter list once per frame
+        AntialiasSettings antialias{};
+        DraftPattern draft{ DraftPattern::all };
+
+        //Quality tier (see quality-tier.h)
+        double preview_downsample{ 1.0 };
+        bool preview_draft{};
+        QualityTier quality{ QualityTier::full };
+
+        //Fractal
+        static constexpr double bailout = 2.0;
+        double power{ 8.0 };
+        int triplex_power{ 8 };         //2..9 if power is a whole number in that range (triplex form), otherwise 0 (polar form)
+        int iterations{ 12 };
+        double bounding_radius{ 1.35 }; //Sphere that contains the whole set
+        uint64_t scene_key{};           //Changes when the shape does.  (Depth is only reused between frames with the same key)
+
+        //Camera
+        vec3<double> camera_position{};
+        vec3<double> camera_forward{};
+        vec3<double> camera_right{};
+        vec3<double> camera_up{};
+        mat3<double> camera_basis{};    //Columns are right, up & forward.  (Camera space to world space)
+        double tan_half_fov{};
+        double pixel_angle{};           //Angle covered by one pixel.  Surface threshold grows with distance.
+
+        //Ray marching
+        int ray_steps{ 200 };
+        double detail{ 1.0 };
+
+        //Precision
+        MarchPrecision march_precision{ MarchPrecision::native };
+        double extended_dr_limit{};     //Double-double iterations stop once the derivative reaches this.
+
+        //Coarse depth (distance each tile's rays can start from).  Filled by the host, see begin_prepare().
+        static constexpr int tile_size = 8;
+        int tiles_x{};
+        int tiles_y{};
+        std::vector<float> tile_depth{};
+        bool depth_ready{};
+
+        //The previous frame's depth, moved into this frame's camera (infinity where nothing landed).  See set_previous_frame().
+        static constexpr double reprojection_back_off = 2.0;    //Rays start this many pixel widths nearer than the reprojected surface
+        std::shared_ptr<const FrameHistory> previous_frame{};
+        FrameHistory current_camera{};
+        std::vector<float> reprojected_depth{};
+        bool reprojected_ready{};
+
+        //This frame's depth, for the next frame.  (Each pixel is written by the thread that renders it)
+        bool record_depth{};
+        mutable std::vector<float> pixel_depth{};
+
+        //Lighting & colour
+        bool exact_normals{};           //Gradient of the distance estimator, rather than finite differences
+        vec3<double> light_direction{};
+        double colour_shift{};
+        double colour_frequency{ 1.0 };
 
     public:
         //Constructor
@@ -77,8 +224,8 @@ class Renderer{
 
         //Set the seed as a string (an integer seed will be calculated)
         void set_seed(const std::string & s){
-            this->seed=string_to_seed(s);             
-            this->seed_string = s; 
+            this->seed=string_to_seed(s);
+            this->seed_string = s;
         }
         //Set an integer seed. (string will be ignored)
         void set_seed_int(uint32_t s){
@@ -86,27 +233,162 @@ class Renderer{
         }
         std::string get_seed() const { return seed_string;}
         uint32_t get_seed_int() const { return seed;}
-        
+
         //Parameters
-        void set_parameters(ParameterList plist){
-            params = plist;
+        void set_parameters(ParameterList plist);
+
+        //Reduced resolution or draft previews.  (Call before set_parameters, see quality-tier.h)
+        void set_preview(double downsample, bool draft) noexcept {
+            preview_downsample = downsample;
+            preview_draft = draft;
         }
 
+        //Optional coarse depth pass before rendering.
+        //Call begin_prepare(), then prepare_line() for each line it returns (on any thread, in any order), then end_prepare().
+        int begin_prepare();
+        void prepare_line(int line) noexcept;
+        void end_prepare() noexcept;
+
+        //Optional reuse of the previous frame's depth (for hosts that render frames in sequence).
+        //Give the previous frame's history (or nullptr) before begin_prepare(), and take this frame's after rendering.
+        void set_previous_frame(std::shared_ptr<const FrameHistory> previous);
+        std::shared_ptr<const FrameHistory> take_frame_history();
+
         //Render
         ColourRGBA<S> render_pixel(S x, S y) const;
         ColourRGBA<S> render_pixel_with_input(S x, S y, ColourRGBA<S>) const;
 
+        //Render a block of pixels.  The same result as render_pixel() for each vector.
+        void render_block(int x, int y, int w, int h, BlockOutput<S>& out) const;
+
+        //Anti-aliasing for render_block() (see antialiasing.h)
+        const AntialiasSettings& antialias_settings() const noexcept { return antialias; }
+
+        //Pixels rendered at draft quality (see checkerboard.h)
+        DraftPattern draft_pattern() const noexcept { return draft; }
+
     private:
+        double centre_surface_distance() const;
 
+        template <int N> void prepare_tiles(int line) noexcept;
+        template <int N, SimdFloat W> S cone_march_lanes(S x, S y) const;
+        template <int N, SimdFloat W> W cone_march(W x, W y) const;
+        template <SimdFloat W> W reprojected_start(W x, W y) const;
+        template <SimdFloat W> W start_from_table(const std::vector<float>& table, int cell_size, int columns, int rows, W x, W y) const;
+        template <SimdFloat W> void store_depth(W x, W y, W t, W hit) const;
+        FrameHistory camera_history() const;
 
+        //N is the integer power (triplex form), or 0 for the polar form.
+        //W is the working type.  P is the type of positions (W, or DoubleDouble<W> for deep zooms).
+        template <int N> ColourRGBA<S> render_with_precision(S x, S y) const;
+        template <int N> void render_block_with_precision(BlockOutput<S>& out) const;
+        template <int N, SimdFloat W> void march_block(BlockOutput<S>& out) const;
+        template <typename P, SimdFloat W> vec3<P> ray_direction(W x, W y) const;
+        template <typename P, SimdFloat W> RayStart<W, P> start_rays(W x, W y) const;
+        template <SimdFloat W> W background(const vec3<W>& direction) const;
+        template <SimdFloat W> static void set_lanes(ColourRGBA<S>& result, int first, const ColourRGBA<W>& c);
+        template <int N, SimdFloat W, typename P> ColourRGBA<S> march_lanes(S x, S y) const;
+        template <int N, SimdFloat W, typename P> ColourRGBA<W> march(W x, W y) const;
+        template <int N, SimdFloat W, typename P> W distance_estimate(const vec3<P>& c, W& trap) const;
+        template <int N, SimdFloat W> vec3<W> distance_gradient(const vec3<W>& c) const;
+        template <int N> void check_distance_gradient() const;
+        template <int N, SimdFloat W, typename P> vec3<W> surface_normal(const vec3<P>& p, W h) const;
+        template <int N, SimdFloat W, typename P> ColourRGBA<W> shade(const vec3<W>& direction, const vec3<P>& p, W h, W trap, W hit) const;
 };
 
 
+/**************************************************************************************************
+ * Broadcast a double (or vector of doubles) to all lanes of T.  (A SIMD type or DoubleDouble)
+ * ************************************************************************************************/
+template <typename T>
+inline static T broadcast(double v) noexcept {
+    return T(static_cast<typename T::F>(v));
+}
+template <typename T>
+inline static vec3<T> broadcast(const vec3<double>& v) noexcept {
+    return vec3<T>(broadcast<T>(v.x), broadcast<T>(v.y), broadcast<T>(v.z));
+}
+
+
+/**************************************************************************************************
+ * Round a position to the working type.
+ * ************************************************************************************************/
+template <SimdFloat W> inline static W to_working(const W& a) noexcept { return a; }
+template <SimdFloat W> inline static W to_working(const DoubleDouble<W>& a) noexcept { return a.round(); }
+template <typename P> inline static auto to_working(const vec3<P>& a) noexcept {
+    return vec3<decltype(to_working(a.x))>(to_working(a.x), to_working(a.y), to_working(a.z));
+}
+
+
+/**************************************************************************************************
+ * x^N for a whole number N.  (Unrolled into multiplies at compile time)
+ * ************************************************************************************************/
+template <int N, typename T>
+inline static T integer_power(const T& x) noexcept {
+    static_assert(N >= 1);
+    if constexpr (N == 1) return x;
+    else if constexpr (N % 2 == 0) {
+        const T half = integer_power<N / 2>(x);
+        return half * half;
+    }
+    else return integer_power<N - 1>(x) * x;
+}
+
+
+/**************************************************************************************************
+ * (re + i*im)^N for a whole number N.  (Unrolled into multiplies at compile time)
+ * ************************************************************************************************/
+template <int N, typename T>
+inline static void complex_power(T& re, T& im) noexcept {
+    static_assert(N >= 1);
+    if constexpr (N == 1) return;
+    else if constexpr (N % 2 == 0) {
+        complex_power<N / 2>(re, im);
+        const T r = re * re - im * im;
+        im = (re + re) * im;
+        re = r;
+    }
+    else {
+        const T a = re;
+        const T b = im;
+        complex_power<N - 1>(re, im);
+        const T r = re * a - im * b;
+        im = fma(re, b, im * a);
+        re = r;
+    }
+}
+
+
+/**************************************************************************************************
+ * z^N + c in triplex form, where r = |z|.  Also returns r^(N-1) (for the derivative).
+ * (cos(n*phi), sin(n*phi)) = (x/rho + i*y/rho)^n and (cos(n*theta), sin(n*theta)) = (z/r + i*rho/r)^n
+ * ************************************************************************************************/
+template <int N, typename T>
+inline static vec3<T> triplex_step(const vec3<T>& z, const vec3<T>& c, const T& r, T& r_n_minus_1) noexcept {
+    typedef typename T::F TF;
+    const T rho = max(sqrt(fma(z.x, z.x, z.y * z.y)), T(static_cast<TF>(1e-20f)));
+    const T inverse_rho = T(static_cast<TF>(1.0f)) / rho;
+    const T inverse_r = T(static_cast<TF>(1.0f)) / r;
+    T cos_phi = z.x * inverse_rho;
+    T sin_phi = z.y * inverse_rho;
+    T cos_theta = z.z * inverse_r;
+    T sin_theta = rho * inverse_r;
+    complex_power<N>(cos_phi, sin_phi);
+    complex_power<N>(cos_theta, sin_theta);
+    r_n_minus_1 = integer_power<N - 1>(r);
+    const T zr = r_n_minus_1 * r;
+    const T zr_sin_theta = zr * sin_theta;
+    return vec3<T>(fma(zr_sin_theta, cos_phi, c.x), fma(zr_sin_theta, sin_phi, c.y), fma(zr, cos_theta, c.z));
+}
+
+
 /**************************************************************************************************
  * Set the size of the image to render in pixels.
  * ************************************************************************************************/
 template <SimdFloat S>
 void Renderer<S>::set_size(int w, int h) noexcept {
+    depth_ready = false;
+    reprojected_ready = false;
     this->width = w;
     this->height = h;
     this->width_f = static_cast<S::F>(w);
@@ -116,48 +398,1036 @@ void Renderer<S>::set_size(int w, int h) noexcept {
 }
 
 
+/**************************************************************************************************
+ * Set the parameters.
+ * Everything that is the same for each pixel (camera, light, precision) is calculated here.
+ * ************************************************************************************************/
+template <SimdFloat S>
+void Renderer<S>::set_parameters(ParameterList plist) {
+    params = ParameterSnapshot<typename S::F>::make(plist);
+    antialias = AntialiasSettings{ antialias_max_samples(params.get_value_integer(ParameterID::antialiasing)), static_cast<float>(params.get_value(ParameterID::antialias_threshold)), static_cast<float>(params.get_value(ParameterID::antialias_budget)) };
+    draft = params.template get_list<DraftPattern>(ParameterID::draft_pattern);
+    if (draft != DraftPattern::checkerboard && draft != DraftPattern::quarter) draft = DraftPattern::all;
+    quality = choose_quality_tier(params.get_value_integer(ParameterID::quality), automatic_quality_tier(preview_downsample, preview_draft && draft == DraftPattern::all));
+    antialias.max_samples = std::min(antialias.max_samples, quality_max_samples(quality));
+    depth_ready = false;
+    reprojected_ready = false;
+    constexpr double degrees = std::numbers::pi / 180.0;
+
+    //Fractal.  Low powers have a larger bulb.  (Points outside the bailout radius escape straight away, so it is always a bound)
+    power = std::max(1.0, params.get_value(ParameterID::power));
+    const double whole_power = std::round(params.get_value(ParameterID::power));
+    triplex_power = (whole_power >= 2.0 && whole_power <= 9.0 && std::abs(params.get_value(ParameterID::power) - whole_power) < 1e-6) ? static_cast<int>(whole_power) : 0;
+    iterations = std::max(1, static_cast<int>(params.get_value(ParameterID::iterations)));
+    if (power < 3.0) bounding_radius = bailout + 0.1;
+    else if (power < 4.0) bounding_radius = 1.45;
+    else bounding_radius = 1.35;
+    scene_key = std::bit_cast<uint64_t>(power) ^ (static_cast<uint64_t>(iterations) * 0x9E3779B97F4A7C15ull);
+
+    //Camera orbits the origin, looking at the origin.  (y is up)
+    const double distance = std::max(0.001, params.get_value(ParameterID::camera_distance));
+    const double yaw = params.get_value(ParameterID::camera_rotate_x) * degrees;
+    const double pitch = std::clamp(params.get_value(ParameterID::camera_rotate_y), -89.9, 89.9) * degrees;
+    camera_position = vec3<double>(distance * std::cos(pitch) * std::sin(yaw), distance * std::sin(pitch), distance * std::cos(pitch) * std::cos(yaw));
+    camera_forward = normalize(-camera_position);
+    camera_right = normalize(cross(camera_forward, vec3<double>(0.0, 1.0, 0.0)));
+    camera_up = cross(camera_right, camera_forward);
+    camera_basis = mat3<double>(camera_right, camera_up, camera_forward);
+
+    //Zoom narrows the field of view.  (Each step of 1 halves it)
+    const double fov = std::clamp(params.get_value(ParameterID::field_of_view), 1.0, 170.0) * degrees;
+    const double zoom = std::exp2(-std::clamp(params.get_value(ParameterID::zoom), 0.0, 100.0));
+    tan_half_fov = std::tan(fov * 0.5) * zoom;
+    pixel_angle = (height > 0) ? 2.0 * tan_half_fov / height : 0.001;
+
+    //Ray marching.  Lower quality tiers stop further from the surface, so need fewer steps.  (Rays that
+    //run out of steps miss, so the steps are cut by less)
+    constexpr std::array<double, 4> tier_steps{ 1.0, 0.75, 0.5, 0.35 };
+    constexpr std::array<double, 4> tier_detail{ 1.0, 0.6, 0.4, 0.25 };
+    ray_steps = std::max(1, static_cast<int>(params.get_value(ParameterID::ray_steps) * tier_steps[quality_steps(quality)]));
+    detail = std::max(0.0001, params.get_value(ParameterID::surface_detail)) * tier_detail[quality_steps(quality)];
+
+    //Precision.  From the size of a pixel where the centre ray meets the surface.
+    const double pixel_size = pixel_angle * centre_surface_distance() / detail;
+    const double native_limit = std::is_same_v<F, float> ? 1e-4 : 1e-12;
+    if (pixel_size >= native_limit) march_precision = MarchPrecision::native;
+    else if (pixel_size >= 1e-12 || triplex_power == 0) march_precision = MarchPrecision::float64;
+    else march_precision = MarchPrecision::double_double;
+    extended_dr_limit = 1e-10 / std::max(pixel_size, 1e-300);
+
+    //Light (relative to the camera, so the lit side faces the viewer as the camera moves)
+    const double light_yaw = params.get_value(ParameterID::light_angle) * degrees;
+    const double light_pitch = params.get_value(ParameterID::light_elevation) * degrees;
+    light_direction = camera_basis * vec3<double>(std::cos(light_pitch) * std::sin(light_yaw), std::sin(light_pitch), -std::cos(light_pitch) * std::cos(light_yaw));
+
+    exact_normals = params.get_value_integer(ParameterID::surface_normals) == 1;
+    colour_shift = params.get_value(ParameterID::colour_shift);
+    colour_frequency = params.get_value(ParameterID::colour_frequency);
+
+#ifdef _DEBUG
+    check_distance_gradient<0>();
+    check_distance_gradient<8>();
+#endif
+}
+
+
+/**************************************************************************************************
+ * Distance from the camera to the surface along the centre ray.  (Marched once, in double precision)
+ * If the ray misses, the distance to the origin.
+ * ************************************************************************************************/
+template <SimdFloat S>
+double Renderer<S>::centre_surface_distance() const {
+    typedef FallbackFloat64 W;
+    const double miss = std::sqrt(dot(camera_position, camera_position));
+    const double b = dot(camera_position, camera_forward);
+    const double discriminant = b * b - dot(camera_position, camera_position) + bounding_radius * bounding_radius;
+    if (discriminant < 0.0) return miss;
+    const double t_far = std::sqrt(discriminant) - b;
+    double t = std::max(-b - std::sqrt(discriminant), 0.0);
+    for (int i = 0; i < ray_steps; i++) {
+        W trap{};
+        const double distance = distance_estimate<0, W, W>(broadcast<W>(camera_position + camera_forward * t), trap).element(0);
+        if (distance < t * 1e-9) return t;
+        t += distance;
+        if (t > t_far) break;
+    }
+    return miss;
+}
+
+
+/**************************************************************************************************
+ * Allocate the coarse depth buffer.  Returns the number of lines of tiles to prepare.
+ * Not used for double-double zooms.  (The cone march is in double, which can't resolve the surface)
+ * ************************************************************************************************/
+template <SimdFloat S>
+int Renderer<S>::begin_prepare() {
+    depth_ready = false;
+    reprojected_ready = false;
+    tiles_x = 0;
+    tiles_y = 0;
+    reprojected_depth.clear();
+    if (width <= 0 || height <= 0 || march_precision == MarchPrecision::double_double) return 0;
+    tiles_x = (width + tile_size - 1) / tile_size;
+    tiles_y = (height + tile_size - 1) / tile_size;
+    tile_depth.assign(static_cast<size_t>(tiles_x) * tiles_y, 0.0f);
+
+    //The previous frame's surface is moved into this frame's camera by prepare_line().  (If it is the same shape)
+    if (previous_frame && previous_frame->scene == scene_key && !previous_frame->depth.empty()) {
+        current_camera = camera_history();
+        reprojected_depth.assign(static_cast<size_t>(width) * height, std::numeric_limits<float>::infinity());
+    }
+    return tiles_y;
+}
+
+
+template <SimdFloat S>
+void Renderer<S>::end_prepare() noexcept {
+    depth_ready = tiles_x > 0;
+    reprojected_ready = depth_ready && !reprojected_depth.empty();
+}
+
+
+/**************************************************************************************************
+ * Cone march one line of tiles, and reproject the same share of the previous frame's rows.
+ * Lines are independent, so they can be filled by different threads.
+ * ************************************************************************************************/
+template <SimdFloat S>
+void Renderer<S>::prepare_line(int line) noexcept {
+    if (line < 0 || line >= tiles_y) return;
+    if (!reprojected_depth.empty()) {
+        const int rows = previous_frame->height;
+        reproject_depth(*previous_frame, current_camera, line * rows / tiles_y, (line + 1) * rows / tiles_y, reprojected_depth);
+    }
+    switch (triplex_power) {
+    case 2: return prepare_tiles<2>(line);
+    case 3: return prepare_tiles<3>(line);
+    case 4: return prepare_tiles<4>(line);
+    case 5: return prepare_tiles<5>(line);
+    case 6: return prepare_tiles<6>(line);
+    case 7: return prepare_tiles<7>(line);
+    case 8: return prepare_tiles<8>(line);
+    case 9: return prepare_tiles<9>(line);
+    default: return prepare_tiles<0>(line);
+    }
+}
+
+
+template <SimdFloat S>
+template <int N>
+void Renderer<S>::prepare_tiles(int line) noexcept {
+    //Pixel coordinates of the centre of each tile.  (Rays add half a pixel)
+    constexpr F centre = static_cast<F>(tile_size / 2) - static_cast<F>(0.5f);
+    const S y = S(static_cast<F>(line * tile_size) + centre);
+    for (int i = 0; i < tiles_x; i += S::number_of_elements()) {
+        const S x = fma(S::make_sequential(static_cast<F>(i)), S(static_cast<F>(tile_size)), S(centre));
+        const S t = (march_precision == MarchPrecision::native) ? cone_march_lanes<N, S>(x, y) : cone_march_lanes<N, D>(x, y);
+        for (int e = 0; e < S::number_of_elements() && i + e < tiles_x; e++) {
+            //Round down, so the start is never past the distance found
+            const float depth = static_cast<float>(t.element(e));
+            tile_depth[static_cast<size_t>(line) * tiles_x + i + e] = (static_cast<double>(depth) > static_cast<double>(t.element(e))) ? std::nextafter(depth, 0.0f) : depth;
+        }
+    }
+}
+
+
+/**************************************************************************************************
+ * Cone march S's lanes using the working type W.  (See march_lanes())
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <int N, SimdFloat W>
+S Renderer<S>::cone_march_lanes(S x, S y) const {
+    if constexpr (std::is_same_v<W, S>) {
+        return cone_march<N, W>(x, y);
+    }
+    else {
+        typedef typename W::F WF;
+        constexpr int lanes = W::number_of_elements();
+
+        S result{};
+        for (int first = 0; first < S::number_of_elements(); first += lanes) {
+            W wx{};
+            W wy{};
+            for (int i = 0; i < lanes; i++) {
+                wx.set_element(i, static_cast<WF>(x.element(first + i)));
+                wy.set_element(i, static_cast<WF>(y.element(first + i)));
+            }
+            const W t = cone_march<N, W>(wx, wy);
+            for (int i = 0; i < lanes; i++) result.set_element(first + i, static_cast<F>(t.element(i)));
+        }
+        return result;
+    }
+}
+
+
+/**************************************************************************************************
+ * March a cone that contains every ray in a tile (x,y is the centre pixel).
+ * Every ray's point at distance t is within t * spread of the axis, so each step is the distance
+ * estimate at the axis less that radius.  Stops when the cone touches the surface, or the axis leaves
+ * the bounding sphere.  Returns a distance that every ray in the tile can start from.
+ * Far outside the bounding sphere the distance to the sphere is used, when it is the larger bound.
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <int N, SimdFloat W>
+W Renderer<S>::cone_march(W x, W y) const {
+    typedef typename W::F WF;
+    const W zero{ static_cast<WF>(0.0f) };
+    const W one{ static_cast<WF>(1.0f) };
+
+    const W u = fma((x + static_cast<WF>(0.5f)) / static_cast<WF>(width_f), W(static_cast<WF>(2.0f)), -one) * broadcast<W>(aspect * tan_half_fov);
+    const W v = fma((y + static_cast<WF>(0.5f)) / static_cast<WF>(height_f), W(static_cast<WF>(-2.0f)), one) * broadcast<W>(tan_half_fov);
+    const vec3<W> origin = broadcast<W>(camera_position);
+    const vec3<W> direction = normalize(camera_basis * vec3<W>(u, v, one));
+
+    //Radius of the cone per unit distance.  Half the tile's diagonal (with a margin).
+    const W spread = broadcast<W>(pixel_angle * tile_size * 0.5 * std::numbers::sqrt2 * 1.05);
+    const W threshold_scale = broadcast<W>(pixel_angle * 0.5 / detail);
+
+    //Nearest that any ray can reach the bounding sphere, and the furthest the axis is inside it.
+    const double camera_distance = std::sqrt(dot(camera_position, camera_position));
+    const W b = dot(origin, direction);
+    const W c = dot(origin, origin) - broadcast<W>(bounding_radius * bounding_radius);
+    const W discriminant = b * b - c;
+    const W t_far = blend(zero, sqrt(max(discriminant, zero)) - b, compare_greater_equal(discriminant, zero));
+    W t = broadcast<W>(std::max(camera_distance - bounding_radius, 0.0));
+
+    W running = blend(zero, one, compare_less(t, t_far));
+    for (int i = 0; i < ray_steps; i++) {
+        if (reduce_max(running) <= 0.0f) break;
+        const vec3<W> p = origin + direction * t;
+        const W radius = sqrt(dot(p, p));
+        W trap{};
+        const W estimate = max(distance_estimate<N, W, W>(p, trap), radius - broadcast<W>(bounding_radius));
+        const W step = estimate - t * spread;
+
+        //Stop when the cone touches the surface
+        running = blend(running, zero, compare_less(step, t * threshold_scale));
+        t = fma(step, running, t);
+        running = blend(running, zero, compare_greater(t, t_far));
+    }
+    return t;
+}
+
+
+/**************************************************************************************************
+ * Start distance for pixel x,y from a table with one entry per cell_size x cell_size pixels.
+ * (The coarse depth, or the reprojected depth)
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <SimdFloat W>
+W Renderer<S>::start_from_table(const std::vector<float>& table, int cell_size, int columns, int rows, W x, W y) const {
+    typedef typename W::F WF;
+    const W zero{ static_cast<WF>(0.0f) };
+    const WF inverse_cell = static_cast<WF>(1.0) / static_cast<WF>(cell_size);
+    const W column = clamp(floor(x * inverse_cell), zero, W(static_cast<WF>(columns - 1)));
+    const W row = clamp(floor(y * inverse_cell), zero, W(static_cast<WF>(rows - 1)));
+    return gather_from_table(table.data(), fma(row, W(static_cast<WF>(columns)), column));
+}
+
+
+/**************************************************************************************************
+ * Start distance for pixel x,y from the previous frame.  (0 if none)
+ * The nearest reprojected point in the 3x3 pixels around it, less the back off.  (Covers the change
+ * in depth between neighbouring rays, and points that landed a pixel away)
+ * A gap anywhere in the 3x3 means part of the surface there wasn't in the last frame, so no start.
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <SimdFloat W>
+W Renderer<S>::reprojected_start(W x, W y) const {
+    typedef typename W::F WF;
+    const W none{ std::numeric_limits<WF>::infinity() };
+    W nearest{ none };
+    W furthest{ static_cast<WF>(0.0f) };
+    for (int j = -1; j <= 1; j++) {
+        for (int i = -1; i <= 1; i++) {
+            const W d = start_from_table(reprojected_depth, 1, width, height, x + static_cast<WF>(i), y + static_cast<WF>(j));
+            nearest = min(nearest, d);
+            furthest = max(furthest, d);
+        }
+    }
+    return blend(nearest * broadcast<W>(1.0 - reprojection_back_off * pixel_angle), W(static_cast<WF>(0.0f)), compare_equal(furthest, none));
+}
+
+
+/**************************************************************************************************
+ * Keep the distance to the surface for each lane that hit it.  (Made slightly smaller than float rounding can add)
+ * Lanes outside the frame are skipped, as are samples between pixels.  (e.g. anti-aliasing.  Their pixel
+ * may belong to a block on another thread)
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <SimdFloat W>
+void Renderer<S>::store_depth(W x, W y, W t, W hit) const {
+    for (int i = 0; i < W::number_of_elements(); i++) {
+        if (!(hit.element(i) > 0)) continue;
+        const int px = static_cast<int>(x.element(i));
+        const int py = static_cast<int>(y.element(i));
+        if (px != x.element(i) || py != y.element(i)) continue;
+        if (px < 0 || py < 0 || px >= width || py >= height) continue;
+        pixel_depth[static_cast<size_t>(py) * width + px] = static_cast<float>(static_cast<double>(t.element(i)) * (1.0 - 1e-6));
+    }
+}
+
+
+/**************************************************************************************************
+ * Start keeping this frame's depth, and use the previous frame's (if it is the same shape).
+ * Call after set_size() and set_parameters().
+ * ************************************************************************************************/
+template <SimdFloat S>
+void Renderer<S>::set_previous_frame(std::shared_ptr<const FrameHistory> previous) {
+    previous_frame = std::move(previous);
+    record_depth = width > 0 && height > 0;
+    if (record_depth) pixel_depth.assign(static_cast<size_t>(width) * height, std::numeric_limits<float>::infinity());
+}
+
+
+/**************************************************************************************************
+ * This frame's camera and depth.  (Empty if set_previous_frame() wasn't called)
+ * ************************************************************************************************/
+template <SimdFloat S>
+std::shared_ptr<const FrameHistory> Renderer<S>::take_frame_history() {
+    auto history = std::make_shared<FrameHistory>(camera_history());
+    if (record_depth) history->depth = std::move(pixel_depth);
+    record_depth = false;
+    pixel_depth.clear();
+    return history;
+}
+
+
+template <SimdFloat S>
+FrameHistory Renderer<S>::camera_history() const {
+    FrameHistory history{};
+    history.width = width;
+    history.height = height;
+    history.camera_position = camera_position;
+    history.camera_forward = camera_forward;
+    history.camera_right = camera_right;
+    history.camera_up = camera_up;
+    history.tan_half_fov = tan_half_fov;
+    history.scene = scene_key;
+    return history;
+}
+
+
+/**************************************************************************************************
+ * Mandelbulb distance estimator (power N triplex form, or polar form when N is 0).
+ * Returns a lower bound on the distance from c to the set.  (Negative inside)
+ * trap is set to the closest approach of the orbit to the origin (squared).
+ * Lanes stop changing once they escape, and the loop ends when all lanes have escaped.
+ * If c is double-double, the first iterations are too.  They stop once the derivative is large
+ * enough that the difference between neighbouring pixels is well above double precision.
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <int N, SimdFloat W, typename P>
+W Renderer<S>::distance_estimate(const vec3<P>& c, W& trap) const {
+    typedef typename W::F WF;
+    const W bailout_squared = broadcast<W>(bailout * bailout);
+    const W n = broadcast<W>(power);
+    const W n_minus_1 = broadcast<W>(power - 1.0);
+    const W one{ static_cast<WF>(1.0f) };
+
+    vec3<W> z;
+    vec3<W> c_working;
+    W dr{ one };
+    W r2;
+    int i = 0;
+    if constexpr (N != 0 && std::is_same_v<P, DoubleDouble<W>>) {
+        vec3<P> z_extended = c;
+        P r2_extended = dot(z_extended, z_extended);
+        r2 = r2_extended.round();
+        trap = r2;
+        for (; i < iterations; i++) {
+            const auto running = compare_less_equal(r2, bailout_squared);
+            if (reduce_min(r2) > bailout * bailout) break;
+            if (reduce_min(blend(broadcast<W>(extended_dr_limit), dr, running)) >= extended_dr_limit) break;
+
+            const P r = max(sqrt(r2_extended), P(static_cast<WF>(1e-20f)));
+            P r_n_minus_1;
+            const vec3<P> next = triplex_step<N>(z_extended, c, r, r_n_minus_1);
+
+            dr = blend(dr, fma(r_n_minus_1.round() * n, dr, one), running);
+            z_extended.x = blend(z_extended.x, next.x, running);
+            z_extended.y = blend(z_extended.y, next.y, running);
+            z_extended.z = blend(z_extended.z, next.z, running);
+            r2_extended = blend(r2_extended, dot(next, next), running);
+            r2 = r2_extended.round();
+            trap = blend(trap, min(trap, r2), running);
+        }
+        z = to_working(z_extended);
+        c_working = to_working(c);
+    }
+    else {
+        z = to_working(c);
+        c_working = z;
+        r2 = dot(z, z);
+        trap = r2;
+    }
+
+    for (; i < iterations; i++) {
+        const auto running = compare_less_equal(r2, bailout_squared);
+        if (reduce_min(r2) > bailout * bailout) break;
+
+        //z = z^n + c   (in spherical coordinates: r^n, n*theta, n*phi)
+        const W r = max(sqrt(r2), W(static_cast<WF>(1e-20f)));
+        W r_n_minus_1;
+        vec3<W> next;
+        if constexpr (N == 0) {
+            const W theta = acos(clamp(z.z / r, W(static_cast<WF>(-1.0f)), one)) * n;
+            const W phi = atan2(z.y, z.x) * n;
+            r_n_minus_1 = pow(r, n_minus_1);
+            const W zr = r_n_minus_1 * r;
+            const W sin_theta = sin(theta);
+            next = vec3<W>(zr * sin_theta * cos(phi), zr * sin_theta * sin(phi), zr * cos(theta)) + c_working;
+        }
+        else {
+            next = triplex_step<N>(z, c_working, r, r_n_minus_1);
+        }
+
+        //Running derivative.  dr = n * r^(n-1) * dr + 1
+        dr = blend(dr, fma(r_n_minus_1 * n, dr, one), running);
+        z.x = blend(z.x, next.x, running);
+        z.y = blend(z.y, next.y, running);
+        z.z = blend(z.z, next.z, running);
+        r2 = blend(r2, dot(next, next), running);
+        trap = blend(trap, min(trap, r2), running);
+    }
+    const W r = sqrt(r2);
+    return static_cast<WF>(0.5f) * log(r) * r / dr;
+}
+
+
+/**************************************************************************************************
+ * Gradient of the distance estimator at c.
+ * The same iteration as distance_estimate, on dual numbers, so one pass gives all 3 derivatives.
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <int N, SimdFloat W>
+vec3<W> Renderer<S>::distance_gradient(const vec3<W>& c) const {
+    typedef typename W::F WF;
+    typedef Dual3<W> D;
+    const W bailout_squared = broadcast<W>(bailout * bailout);
+    const W n = broadcast<W>(power);
+    const W n_minus_1 = broadcast<W>(power - 1.0);
+    const D one{ static_cast<WF>(1.0f) };
+
+    const vec3<D> c_dual = variables(c);
+    vec3<D> z = c_dual;
+    D dr{ one };
+    D r2 = dot(z, z);
+    for (int i = 0; i < iterations; i++) {
+        const auto running = compare_less_equal(r2.v, bailout_squared);
+        if (reduce_min(r2.v) > bailout * bailout) break;
+
+        const D r = max(sqrt(r2), D(static_cast<WF>(1e-20f)));
+        D r_n_minus_1;
+        vec3<D> next;
+        if constexpr (N == 0) {
+            const D theta = acos(clamp(z.z / r, D(static_cast<WF>(-1.0f)), one)) * n;
+            const D phi = atan2(z.y, z.x) * n;
+            r_n_minus_1 = pow(r, n_minus_1);
+            const D zr = r_n_minus_1 * r;
+            const D sin_theta = sin(theta);
+            next = vec3<D>(zr * sin_theta * cos(phi) + c_dual.x, zr * sin_theta * sin(phi) + c_dual.y, zr * cos(theta) + c_dual.z);
+        }
+        else {
+            next = triplex_step<N>(z, c_dual, r, r_n_minus_1);
+        }
+
+        dr = blend(dr, fma(r_n_minus_1 * n, dr, one), running);
+        z.x = blend(z.x, next.x, running);
+        z.y = blend(z.y, next.y, running);
+        z.z = blend(z.z, next.z, running);
+        r2 = blend(r2, dot(next, next), running);
+    }
+    const D r = sqrt(r2);
+    return (log(r) * static_cast<WF>(0.5f) * r / dr).gradient();
+}
+
+
+/**************************************************************************************************
+ * Debug check of distance_gradient against central differences, at points around the set.
+ * (In double precision, for the polar form and a triplex power)
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <int N>
+void Renderer<S>::check_distance_gradient() const {
+    typedef FallbackFloat64 W;
+    constexpr double h = 1e-6;
+    const std::array<vec3<double>, 4> points{ vec3<double>(1.2, 0.3, -0.4), vec3<double>(-0.5, 1.1, 0.6), vec3<double>(0.2, -0.7, 1.3), vec3<double>(0.9, 0.9, 0.9) };
+    const auto estimate = [this](const vec3<double>& p) {
+        W trap{};
+        return distance_estimate<N, W, W>(broadcast<W>(p), trap).element(0);
+    };
+    for (const vec3<double>& p : points) {
+        const vec3<W> gradient = distance_gradient<N>(broadcast<W>(p));
+        const vec3<double> difference(
+            (estimate(vec3<double>(p.x + h, p.y, p.z)) - estimate(vec3<double>(p.x - h, p.y, p.z))) / (2.0 * h),
+            (estimate(vec3<double>(p.x, p.y + h, p.z)) - estimate(vec3<double>(p.x, p.y - h, p.z))) / (2.0 * h),
+            (estimate(vec3<double>(p.x, p.y, p.z + h)) - estimate(vec3<double>(p.x, p.y, p.z - h))) / (2.0 * h));
+        const vec3<double> error = vec3<double>(gradient.x.element(0), gradient.y.element(0), gradient.z.element(0)) - difference;
+        if (!(std::sqrt(dot(error, error)) <= 1e-5 * std::max(1.0, std::sqrt(dot(difference, difference))))) {
+            throw std::logic_error("Mandelbulb: The distance estimator's gradient doesn't match central differences.");
+        }
+    }
+}
 
 
+/**************************************************************************************************
+ * Surface normal.  Gradient of the distance estimator from a tetrahedron of 4 samples.
+ * (Or its exact gradient, if chosen.  Not for double-double positions)
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <int N, SimdFloat W, typename P>
+vec3<W> Renderer<S>::surface_normal(const vec3<P>& p, W h) const {
+    if constexpr (std::is_same_v<P, W>) {
+        if (exact_normals) {
+            const vec3<W> n = distance_gradient<N>(p);
+            const W length_squared = max(dot(n, n), W(std::numeric_limits<typename W::F>::min()));
+            return n / sqrt(length_squared);
+        }
+    }
+    W trap{};
+    const W d0 = distance_estimate<N>(vec3<P>(p.x + h, p.y - h, p.z - h), trap);
+    const W d1 = distance_estimate<N>(vec3<P>(p.x - h, p.y - h, p.z + h), trap);
+    const W d2 = distance_estimate<N>(vec3<P>(p.x - h, p.y + h, p.z - h), trap);
+    const W d3 = distance_estimate<N>(vec3<P>(p.x + h, p.y + h, p.z + h), trap);
+    const vec3<W> n(d0 - d1 - d2 + d3, -d0 - d1 + d2 + d3, -d0 + d1 - d2 + d3);
+    const W length_squared = max(dot(n, n), W(std::numeric_limits<typename W::F>::min()));
+    return n / sqrt(length_squared);
+}
+
+
+/**************************************************************************************************
+ * Colour a pixel.
+ * hit is 1.0 for lanes that hit the surface, otherwise 0.0 (background).
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <int N, SimdFloat W, typename P>
+ColourRGBA<W> Renderer<S>::shade(const vec3<W>& direction, const vec3<P>& p, W h, W trap, W hit) const {
+    typedef typename W::F WF;
+    const W zero{ static_cast<WF>(0.0f) };
+
+    const W sky = background(direction);
+    if (reduce_max(hit) <= 0.0f) return ColourRGBA<W>(sky, sky, sky);
+
+    //Base colour from the orbit trap (a cosine palette).
+    const W t = fma(sqrt(trap), broadcast<W>(colour_frequency), broadcast<W>(colour_shift)) * static_cast<WF>(2.0 * std::numbers::pi);
+    const W red = fma(cos(t), W(static_cast<WF>(0.45f)), W(static_cast<WF>(0.55f)));
+    const W green = fma(cos(t + static_cast<WF>(0.9f)), W(static_cast<WF>(0.45f)), W(static_cast<WF>(0.55f)));
+    const W blue = fma(cos(t + static_cast<WF>(1.8f)), W(static_cast<WF>(0.45f)), W(static_cast<WF>(0.55f)));
+
+    //Lighting
+    const vec3<W> normal = surface_normal<N>(p, h);
+    const vec3<W> light = broadcast<W>(light_direction);
+    const W diffuse = max(dot(normal, light), zero);
+    const vec3<W> half_vector = normalize(light - direction);
+    const W specular = pow(max(dot(normal, half_vector), zero), W(static_cast<WF>(32.0f))) * static_cast<WF>(0.3f);
+
+    //Ambient occlusion.  Samples 2 to 32 surface thresholds out along the normal.  (Nearer samples count more)
+    W occluded = zero;
+    W sample_distance = h * static_cast<WF>(2.0f);
+    W weight{ static_cast<WF>(0.5f) };
+    for (int i = 0; i < 5; i++) {
+        W sample_trap{};
+        const W d = distance_estimate<N>(vec3<P>(p.x + normal.x * sample_distance, p.y + normal.y * sample_distance, p.z + normal.z * sample_distance), sample_trap);
+        occluded = fma(weight, clamp((sample_distance - d) / sample_distance, zero, W(static_cast<WF>(1.0f))), occluded);
+        sample_distance *= static_cast<WF>(2.0f);
+        weight *= static_cast<WF>(0.5f);
+    }
+    const W occlusion = max(W(static_cast<WF>(1.0f)) - occluded, zero);
+    const W light_amount = fma(diffuse, W(static_cast<WF>(0.8f)), W(static_cast<WF>(0.25f)) * occlusion) * occlusion;
+
+    const auto is_hit = compare_greater(hit, zero);
+    return ColourRGBA<W>(
+        blend(sky, fma(red, light_amount, specular), is_hit),
+        blend(sky, fma(green, light_amount, specular), is_hit),
+        blend(sky, fma(blue, light_amount, specular), is_hit));
+}
+
+
+/**************************************************************************************************
+ * Background.  A vertical gradient.
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <SimdFloat W>
+W Renderer<S>::background(const vec3<W>& direction) const {
+    typedef typename W::F WF;
+    const W sky = clamp(fma(direction.y, W(static_cast<WF>(0.5f)), W(static_cast<WF>(0.5f))), W(static_cast<WF>(0.0f)), W(static_cast<WF>(1.0f)));
+    return fma(sky, W(static_cast<WF>(0.12f)), W(static_cast<WF>(0.02f)));
+}
+
 
 /**************************************************************************************************
  * Render a pixel (or batch of pixels if using SIMD)
- * 
+ * Dispatches to the distance estimator for the power.
  * ************************************************************************************************/
 template <SimdFloat S>
 ColourRGBA<S> Renderer<S>::render_pixel(S x, S y) const {
     if (width <=0 || height <=0) return ColourRGBA<S>{};
     next_random<typename S::F>(seed); //Reset random seed so it is the same for each pixel
-    
-   
-    
 
-    
-    return ColourRGBA{1.0f,0.0f,0.0f};  
+    switch (triplex_power) {
+    case 2: return render_with_precision<2>(x, y);
+    case 3: return render_with_precision<3>(x, y);
+    case 4: return render_with_precision<4>(x, y);
+    case 5: return render_with_precision<5>(x, y);
+    case 6: return render_with_precision<6>(x, y);
+    case 7: return render_with_precision<7>(x, y);
+    case 8: return render_with_precision<8>(x, y);
+    case 9: return render_with_precision<9>(x, y);
+    default: return render_with_precision<0>(x, y);
+    }
+}
 
-}    
 
 /**************************************************************************************************
- * Render a pixel (or batch of pixels if using SIMD)
- * an input pixel is given
+ * Dispatch to the precision chosen for this frame.
  * ************************************************************************************************/
 template <SimdFloat S>
-ColourRGBA<S> Renderer<S>::render_pixel_with_input(S x, S y, ColourRGBA<S>) const {
-    render_pixel(x, y);
+template <int N>
+ColourRGBA<S> Renderer<S>::render_with_precision(S x, S y) const {
+    if (march_precision == MarchPrecision::native) return march_lanes<N, S, S>(x, y);
+    if constexpr (N != 0) {
+        if (march_precision == MarchPrecision::double_double) return march_lanes<N, D, DoubleDouble<D>>(x, y);
+    }
+    return march_lanes<N, D, D>(x, y);
+}
+
+
+/**************************************************************************************************
+ * March S's lanes using the working type W.
+ * If W is a double type (with half as many lanes), lanes are converted and marched in two halves.
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <int N, SimdFloat W, typename P>
+ColourRGBA<S> Renderer<S>::march_lanes(S x, S y) const {
+    if constexpr (std::is_same_v<W, S>) {
+        return march<N, W, P>(x, y);
+    }
+    else {
+        typedef typename W::F WF;
+        constexpr int lanes = W::number_of_elements();
+        static_assert(S::number_of_elements() % lanes == 0);
+
+        ColourRGBA<S> result{};
+        for (int first = 0; first < S::number_of_elements(); first += lanes) {
+            W wx{};
+            W wy{};
+            for (int i = 0; i < lanes; i++) {
+                wx.set_element(i, static_cast<WF>(x.element(first + i)));
+                wy.set_element(i, static_cast<WF>(y.element(first + i)));
+            }
+            set_lanes(result, first, march<N, W, P>(wx, wy));
+        }
+        return result;
+    }
+}
+
+
+/**************************************************************************************************
+ * Copy the lanes of c to result, from lane first.
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <SimdFloat W>
+void Renderer<S>::set_lanes(ColourRGBA<S>& result, int first, const ColourRGBA<W>& c) {
+    for (int i = 0; i < W::number_of_elements(); i++) {
+        result.red.set_element(first + i, static_cast<F>(c.red.element(i)));
+        result.green.set_element(first + i, static_cast<F>(c.green.element(i)));
+        result.blue.set_element(first + i, static_cast<F>(c.blue.element(i)));
+        result.alpha.set_element(first + i, static_cast<F>(c.alpha.element(i)));
+    }
+}
+
+
+/**************************************************************************************************
+ * Ray march a pixel (or batch of pixels if using SIMD)
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <int N, SimdFloat W, typename P>
+ColourRGBA<W> Renderer<S>::march(W x, W y) const {
+    typedef typename W::F WF;
+    const W zero{ static_cast<WF>(0.0f) };
+
+    const vec3<P> origin = broadcast<P>(camera_position);
+    const RayStart<W, P> ray = start_rays<P>(x, y);
+    const vec3<P>& direction = ray.direction;
+    const vec3<W> direction_working = to_working(direction);
+    const W t_far = ray.t_far;
+    const P start = ray.start;
+    P t = ray.t;
+    const W seeded = ray.seeded;
+    bool check_seeded = reduce_max(seeded) > 0.0f;
+
+    //Ray march.  running is 1.0 for lanes still marching.
+    const W threshold_scale = broadcast<W>(pixel_angle * 0.5 / detail);
+    const W minimum_threshold{ std::numeric_limits<WF>::min() };
+    W running = ray.running;
+    W hit{ zero };
+    W trap{ zero };
+    W threshold{ zero };
+    for (int i = 0; i < ray_steps; i++) {
+        if (reduce_max(running) <= 0.0f) break;
+        W step_trap{};
+        const W distance = distance_estimate<N>(origin + direction * t, step_trap);
+        threshold = max(to_working(t) * threshold_scale, minimum_threshold);
+
+        //Seeded lanes that start inside the set have gone past the surface (something moved in front).
+        //They go back to the usual start, and don't step this time.
+        W stepping = running;
+        if (check_seeded) {
+            const W restart = blend(zero, seeded, compare_less(distance, zero));
+            t = blend(t, start, compare_greater(restart, zero));
+            stepping -= restart;
+            check_seeded = false;
+        }
+
+        //Lanes that reach the surface stop
+        const W now_hit = blend(zero, stepping, compare_less(distance, threshold));
+        trap = blend(trap, step_trap, compare_greater(now_hit, zero));
+        hit += now_hit;
+        running -= now_hit;
+        stepping -= now_hit;
+
+        //Lanes still running step forward, and stop if they leave the bounding sphere
+        t += distance * stepping;
+        running = blend(running, zero, compare_greater(to_working(t), t_far));
+    }
+
+    if (record_depth) store_depth(x, y, to_working(t), hit);
+    return shade<N>(direction_working, origin + direction * t, threshold, trap, hit);
+}
+
+/**************************************************************************************************
+ * Direction of the ray through the centre of pixel x,y.
+ * (Built in P, as u and v are tiny when zoomed in)
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <typename P, SimdFloat W>
+vec3<P> Renderer<S>::ray_direction(W x, W y) const {
+    typedef typename W::F WF;
+    const W one{ static_cast<WF>(1.0f) };
+    const W u = fma((x + static_cast<WF>(0.5f)) / static_cast<WF>(width_f), W(static_cast<WF>(2.0f)), -one) * broadcast<W>(aspect * tan_half_fov);
+    const W v = fma((y + static_cast<WF>(0.5f)) / static_cast<WF>(height_f), W(static_cast<WF>(-2.0f)), one) * broadcast<W>(tan_half_fov);
+    return normalize(camera_basis * vec3<P>(P(u), P(v), broadcast<P>(1.0)));
+}
+
+
+/**************************************************************************************************
+ * Start the rays for pixels x,y.
+ * Rays start where they enter the bounding sphere (or the coarse depth, if further), and seeded
+ * lanes start near the previous frame's surface.  Rays that miss the sphere aren't running.
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <typename P, SimdFloat W>
+RayStart<W, P> Renderer<S>::start_rays(W x, W y) const {
+    typedef typename W::F WF;
+    const W zero{ static_cast<WF>(0.0f) };
+    const W one{ static_cast<WF>(1.0f) };
+    RayStart<W, P> ray{};
+    ray.direction = ray_direction<P>(x, y);
+
+    //Bounding sphere
+    const vec3<W> origin_working = broadcast<W>(camera_position);
+    const vec3<W> direction_working = to_working(ray.direction);
+    const W b = dot(origin_working, direction_working);
+    const W c = dot(origin_working, origin_working) - broadcast<W>(bounding_radius * bounding_radius);
+    const W discriminant = b * b - c;
+    const W root = sqrt(max(discriminant, zero));
+    ray.t_far = root - b;
+    ray.start = P{ depth_ready ? max(-b - root, start_from_table(tile_depth, tile_size, tiles_x, tiles_y, x, y)) : max(-b - root, zero) };
+    ray.t = ray.start;
+
+    //Start near the previous frame's surface
+    if constexpr (std::is_same_v<P, W>) {
+        if (reprojected_ready) {
+            const W seed = reprojected_start(x, y);
+            ray.seeded = blend(zero, one, compare_greater(seed, ray.t));
+            ray.t = max(ray.t, seed);
+        }
+    }
+
+    ray.running = blend(zero, one, compare_greater_equal(discriminant, zero));
+    ray.running = blend(ray.running, zero, compare_greater(to_working(ray.t), ray.t_far));
+    ray.seeded *= ray.running;
+    return ray;
 }
 
 
+/**************************************************************************************************
+ * Render a block of pixels.
+ * Dispatches to the distance estimator for the power.
+ * ************************************************************************************************/
+template <SimdFloat S>
+void Renderer<S>::render_block(int x, int y, int w, int h, BlockOutput<S>& out) const {
+    out.resize(x, y, w, h);
+    if (out.width == 0 || out.height == 0) return;
+    if (width <= 0 || height <= 0) {
+        out.fill(ColourRGBA<S>{});
+        return;
+    }
+    next_random<typename S::F>(seed); //Reset random seed so it is the same for each pixel
 
+    switch (triplex_power) {
+    case 2: return render_block_with_precision<2>(out);
+    case 3: return render_block_with_precision<3>(out);
+    case 4: return render_block_with_precision<4>(out);
+    case 5: return render_block_with_precision<5>(out);
+    case 6: return render_block_with_precision<6>(out);
+    case 7: return render_block_with_precision<7>(out);
+    case 8: return render_block_with_precision<8>(out);
+    case 9: return render_block_with_precision<9>(out);
+    default: return render_block_with_precision<0>(out);
+    }
+}
 
 
+/**************************************************************************************************
+ * Dispatch a block to the precision chosen for this frame.
+ * Double-double positions are marched a quad at a time.  (The state is too big to keep per lane)
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <int N>
+void Renderer<S>::render_block_with_precision(BlockOutput<S>& out) const {
+    if (march_precision == MarchPrecision::native) return march_block<N, S>(out);
+    if constexpr (N != 0) {
+        if (march_precision == MarchPrecision::double_double) {
+            for (int j = 0; j < out.quad_rows(); j++) {
+                for (int i = 0; i < out.quads_per_row(); i++) {
+                    out.set_quad(i, j, march_lanes<N, D, DoubleDouble<D>>(make_quad_x<S>(static_cast<F>(out.x + i * QuadShape<S>::width)), make_quad_y<S>(static_cast<F>(out.y + j * QuadShape<S>::height))));
+                }
+            }
+            return;
+        }
+    }
+    march_block<N, D>(out);
+}
 
 
+/**************************************************************************************************
+ * Render a block of pixels with the lanes kept busy.  (W is the working type, and positions are W)
+ * Rays are started a whole vector at a time.  Those that reach the bounding sphere wait in a queue
+ * (see simd-compaction.h), and the rest are background.  Each lane marches one ray.  When a lane's
+ * ray finishes, its result is kept and it takes the next waiting ray.  The hits are then shaded in
+ * full vectors.
+ * Pixels are numbered a quad at a time (see simd-quad.h), so the lanes take neighbouring rays that
+ * tend to finish together.  Quads go along each row of quads, then down.
+ * ************************************************************************************************/
+template <SimdFloat S>
+template <int N, SimdFloat W>
+void Renderer<S>::march_block(BlockOutput<S>& out) const {
+    typedef typename W::F WF;
+    constexpr int lanes = W::number_of_elements();
+    constexpr int all_lanes = (1 << lanes) - 1;
+    constexpr int quad_width = QuadShape<S>::width;
+    constexpr int quad_height = QuadShape<S>::height;
+    constexpr int quad_lanes = QuadShape<S>::lanes;
+    const int count = out.quads_per_row() * out.quad_rows() * quad_lanes;
+    const int row_size = out.vectors_per_row * S::number_of_elements();     //Pixels per row of the output (whole vectors)
+    const W zero{ static_cast<WF>(0.0f) };
+    const W one{ static_cast<WF>(1.0f) };
+    const W none{ static_cast<WF>(-1.0f) };
+    const W first_x{ static_cast<WF>(out.x) };
+    const W first_y{ static_cast<WF>(out.y) };
+    const W block_width{ static_cast<WF>(out.width) };
+    const W block_height{ static_cast<WF>(out.height) };
+    const W inverse_quads_per_row{ static_cast<WF>(1.0 / out.quads_per_row()) };
+    const vec3<W> origin = broadcast<W>(camera_position);
+    const W threshold_scale = broadcast<W>(pixel_angle * 0.5 / detail);
+    const W minimum_threshold{ std::numeric_limits<WF>::min() };
+    const W step_limit{ static_cast<WF>(ray_steps) };
 
+    //Column and row of pixel numbers.  (The half keeps the division clear of rounding.  The quad sizes are powers of 2)
+    const auto pixel_of = [&](W item, W& column, W& row) {
+        const W quad = floor(item * static_cast<WF>(1.0 / quad_lanes));
+        const W lane = fms(quad, W(static_cast<WF>(-quad_lanes)), -item);
+        const W quad_row = floor((quad + static_cast<WF>(0.5f)) * inverse_quads_per_row);
+        const W quad_column = fms(quad_row, W(static_cast<WF>(-out.quads_per_row())), -quad);
+        const W lane_row = floor(lane * static_cast<WF>(1.0 / quad_width));
+        column = fma(quad_column, W(static_cast<WF>(quad_width)), fms(lane_row, W(static_cast<WF>(-quad_width)), -lane));
+        row = fma(quad_row, W(static_cast<WF>(quad_height)), lane_row);
+    };
 
+    //The rays that hit, packed together.  (Room for a whole vector past the end)
+    std::vector<WF> hit_item(count + lanes);
+    std::vector<WF> hit_t(count + lanes);
+    std::vector<WF> hit_trap(count + lanes);
+    std::vector<WF> hit_threshold(count + lanes);
+    int hits = 0;
 
+    //Rays started, waiting for a lane: pixel, direction, t_far, start, t and seeded.  (See RayStart)
+    LaneQueue<W, 8> waiting;
+    int next_pixel = 0;
 
+    //Lane state.  item is the pixel in the block each lane is marching. (-1 if idle)
+    W item{ none };
+    RayStart<W, W> ray{};
+    W steps{ zero };
+    W trap{ zero };
+    W threshold{ zero };
+    W hit{ zero };
+    while (true) {
+        //Finished lanes (hit, left the bounding sphere or out of steps) keep the hits
+        const W active = blend(one, zero, compare_less(item, zero));
+        const W finished = blend(active - ray.running, active, compare_greater_equal(steps, step_limit));
+        const auto finished_mask = compare_greater(finished, zero);
+        if (lane_bits(finished_mask) != 0) {
+            const auto hit_mask = compare_greater(hit * finished, zero);
+            if (lane_bits(hit_mask) != 0) {
+                compress_lanes(hit_item.data() + hits, hit_mask, item);
+                compress_lanes(hit_t.data() + hits, hit_mask, ray.t);
+                compress_lanes(hit_trap.data() + hits, hit_mask, trap);
+                hits += compress_lanes(hit_threshold.data() + hits, hit_mask, threshold);
+            }
+            item = blend(item, none, finished_mask);
+            ray.running = blend(ray.running, zero, finished_mask);
+        }
 
+        //Start the next vector of rays while fewer than a vector are waiting.  (Rays that miss the bounding sphere don't wait)
+        while (waiting.size() < lanes && next_pixel < count) {
+            const W pixel = W::make_sequential(static_cast<WF>(next_pixel));
+            next_pixel += lanes;
+            W column, row;
+            pixel_of(pixel, column, row);
+            RayStart<W, W> fresh = start_rays<W>(column + first_x, row + first_y);
+            fresh.running = blend(fresh.running, zero, compare_greater_equal(column, block_width));     //Past the edge of the block
+            fresh.running = blend(fresh.running, zero, compare_greater_equal(row, block_height));
+            waiting.push(compare_greater(fresh.running, zero), { pixel, fresh.direction.x, fresh.direction.y, fresh.direction.z, fresh.t_far, fresh.start, fresh.t, fresh.seeded });
+        }
+
+        //Idle lanes take waiting rays
+        const auto idle_mask = compare_less(item, zero);
+        const int idle = lane_bits(idle_mask);
+        if (idle == all_lanes && waiting.empty()) break;
+        if (idle != 0 && !waiting.empty()) {
+            std::array<W, 8> state{ item, ray.direction.x, ray.direction.y, ray.direction.z, ray.t_far, ray.start, ray.t, ray.seeded };
+            waiting.pop(idle, state);
+            const auto fresh = compare_greater(blend(zero, one, idle_mask) * blend(zero, one, compare_greater_equal(state[0], zero)), zero);
+            item = state[0];
+            ray.direction = vec3<W>(state[1], state[2], state[3]);
+            ray.t_far = state[4];
+            ray.start = state[5];
+            ray.t = state[6];
+            ray.seeded = state[7];
+            ray.running = blend(ray.running, one, fresh);
+            steps = blend(steps, zero, fresh);
+            hit = blend(hit, zero, fresh);
+        }
 
+        //Step every lane.  (Lanes not running don't move)
+        W step_trap{};
+        const W distance = distance_estimate<N>(origin + ray.direction * ray.t, step_trap);
+        threshold = max(ray.t * threshold_scale, minimum_threshold);
 
+        //Seeded lanes that start inside the set have gone past the surface (something moved in front).
+        //They go back to the usual start, and don't step this time.
+        const W restart = blend(zero, ray.seeded, compare_less(distance, zero));
+        ray.t = blend(ray.t, ray.start, compare_greater(restart, zero));
+        ray.seeded = zero;
+        W stepping = ray.running - restart;
 
+        //Lanes that reach the surface stop
+        const W now_hit = blend(zero, stepping, compare_less(distance, threshold));
+        trap = blend(trap, step_trap, compare_greater(now_hit, zero));
+        hit += now_hit;
+        ray.running -= now_hit;
+        stepping -= now_hit;
 
+        //Lanes still running step forward, and stop if they leave the bounding sphere
+        ray.t = fma(distance, stepping, ray.t);
+        ray.running = blend(ray.running, zero, compare_greater(ray.t, ray.t_far));
+        steps += one;
+    }
+
+    //Shade the hits, a full vector at a time.  (Colours go back to arrays in output order)
+    const size_t padded = static_cast<size_t>(row_size) * out.height;
+    std::vector<WF> red(padded);
+    std::vector<WF> green(padded);
+    std::vector<WF> blue(padded);
+    std::vector<WF> shaded(padded);
+    for (int i = 0; i < hits; i += lanes) {
+        const W valid = blend(zero, one, compare_less(W::make_sequential(static_cast<WF>(i)), W(static_cast<WF>(hits))));
+        const auto valid_mask = compare_greater(valid, zero);
+        const W pixel = load_lanes<W>(hit_item.data() + i);
+        const W t = load_lanes<W>(hit_t.data() + i);
+        W column, row;
+        pixel_of(pixel, column, row);
+        const W px = column + first_x;
+        const W py = row + first_y;
+        const vec3<W> direction = ray_direction<W>(px, py);
+        if (record_depth) store_depth(px, py, t, valid);
+        const ColourRGBA<W> c = shade<N>(direction, origin + direction * t, load_lanes<W>(hit_threshold.data() + i), load_lanes<W>(hit_trap.data() + i), valid);
+        const W index = fma(row, W(static_cast<WF>(row_size)), column);
+        scatter_lanes(red.data(), index, valid_mask, c.red);
+        scatter_lanes(green.data(), index, valid_mask, c.green);
+        scatter_lanes(blue.data(), index, valid_mask, c.blue);
+        scatter_lanes(shaded.data(), index, valid_mask, one);
+    }
+
+    //Output, with the background for the rest
+    for (int j = 0; j < out.height; j++) {
+        const W py{ static_cast<WF>(out.y + j) };
+        const size_t row_start = static_cast<size_t>(j) * row_size;
+        for (int i = 0; i < row_size; i += lanes) {
+            const W sky = background(ray_direction<W>(W::make_sequential(static_cast<WF>(out.x + i)), py));
+            const size_t index = row_start + i;
+            const auto is_hit = compare_greater(load_lanes<W>(shaded.data() + index), zero);
+            const ColourRGBA<W> c(blend(sky, load_lanes<W>(red.data() + index), is_hit), blend(sky, load_lanes<W>(green.data() + index), is_hit), blend(sky, load_lanes<W>(blue.data() + index), is_hit));
+            if constexpr (std::is_same_v<W, S>) {
+                out.set(i / lanes, j, c);
+            }
+            else {
+                ColourRGBA<S> result = out.get(i / S::number_of_elements(), j);
+                set_lanes(result, i % S::number_of_elements(), c);
+                out.set(i / S::number_of_elements(), j, result);
+            }
+        }
+    }
+}
 
+
+/**************************************************************************************************
+ * Render a pixel (or batch of pixels if using SIMD)
+ * an input pixel is given
+ * ************************************************************************************************/
+template <SimdFloat S>
+ColourRGBA<S> Renderer<S>::render_pixel_with_input(S x, S y, ColourRGBA<S>) const {
+    return render_pixel(x, y);
+}
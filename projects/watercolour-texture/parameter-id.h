@@ -56,6 +56,18 @@ enum class ParameterID {
 	input_transform_special2,
 	input_transform_special3,
 	input_transform_special4,
+	warp_mode,
+
+	//Anti-aliasing
+	antialiasing,
+	antialias_threshold,
+	antialias_budget,
+
+	//Draft renders
+	draft_pattern,
+
+	//Quality tiers
+	quality,
 
 	__last  //Must be last (used for array memory allocation)
 };
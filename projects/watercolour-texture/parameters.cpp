@@ -39,6 +39,9 @@ Description:
 #include "parameters.h"
 #include "parameter-id.h" 
 #include "..\..\common\input-transforms.h"
+#include "..\..\common\antialiasing.h"
+#include "..\..\common\checkerboard.h"
+#include "..\..\common\quality-tier.h"
 
 ParameterList build_project_parameters() {
 	ParameterList params;
@@ -49,6 +52,24 @@ ParameterList build_project_parameters() {
 	params.add_entry(ParameterEntry::make_number(ParameterID::evolve1, "Evolve (Linear/Speed)", -10000.0, 10000.0, 1.0, 0, 100.0, 2));
 	params.add_entry(ParameterEntry::make_number(ParameterID::evolve2, "Evolve (Loop)", -10000.0, 10000.0, 0.0, 0, 1, 4));
 
+	//Two-Level evaluates the warps at 1/4 resolution and interpolates them.  (Faster, small difference in fine detail)
+	std::vector<std::string> warp_mode_list{ "Full", "Two-Level (Fast)" };
+	params.add_entry(ParameterEntry::make_list(ParameterID::warp_mode, "Warp Evaluation", std::move(warp_mode_list)));
+
+	//Anti-aliasing.  Samples are only added along edges.  (See antialiasing.h)
+	std::vector<std::string> antialias_list{ antialias_mode_names.begin(), antialias_mode_names.end() };
+	params.add_entry(ParameterEntry::make_list(ParameterID::antialiasing, "Anti-aliasing", std::move(antialias_list)));
+	params.add_entry(ParameterEntry::make_number(ParameterID::antialias_threshold, "Anti-aliasing Threshold", 0.001, 1.0, 0.05, 0.01, 0.5, 3));
+	params.add_entry(ParameterEntry::make_number(ParameterID::antialias_budget, "Anti-aliasing Budget (Samples/Pixel)", 0.0, 15.0, 4.0, 0.0, 8.0, 2));
+
+	//Pixels rendered at draft quality (e.g. while a slider is dragged).  The rest are filled in.  (See checkerboard.h)
+	std::vector<std::string> draft_list{ draft_pattern_names.begin(), draft_pattern_names.end() };
+	params.add_entry(ParameterEntry::make_list(ParameterID::draft_pattern, "Draft Render", std::move(draft_list)));
+
+	//Work per pixel.  Automatic lowers it for reduced resolution & draft previews.  (See quality-tier.h)
+	std::vector<std::string> quality_list{ quality_tier_names.begin(), quality_tier_names.end() };
+	params.add_entry(ParameterEntry::make_list(ParameterID::quality, "Quality", std::move(quality_list)));
+
 	//Input Transforms (builds from common set used in multiple projects)
 	build_input_transforms_parameter_list(params);
 